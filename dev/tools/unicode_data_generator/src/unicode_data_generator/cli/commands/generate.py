@@ -25,6 +25,7 @@ def register_all_subparser(sub):
 
     add_unicode_version_argument(parser)
     add_precomputed_tuning_argument(parser)
+    add_tuning_argument(parser)
     add_no_cache_argument(parser)
 
 
@@ -42,6 +43,7 @@ def register_tables_subparser(sub):
 
     add_unicode_version_argument(parser)
     add_precomputed_tuning_argument(parser)
+    add_tuning_argument(parser)
     add_no_cache_argument(parser)
 
 
@@ -68,6 +70,13 @@ def add_precomputed_tuning_argument(parser):
         help='Use precomputed (hardcoded) optimal block sizes instead of running block-size fine-tuning',
     )
 
+def add_tuning_argument(parser):
+    parser.add_argument(
+        '--tuning',
+        choices=['size', 'speed'],
+        help='Tune the table layout for the smallest size or for the fastest lookup (default: chosen per dataset)',
+    )
+
 def add_no_cache_argument(parser):
     parser.add_argument(
         '--no-cache',
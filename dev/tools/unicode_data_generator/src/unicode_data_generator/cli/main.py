@@ -20,6 +20,7 @@ def main(argv=None):
                 target=args.target,
                 dataset=getattr(args, 'dataset', None),
                 use_precomputed_tuning=getattr(args, 'use_precomputed_tuning', None),
+                tuning=getattr(args, 'tuning', None),
             )
             dispatcher.generate(generate_context)
 
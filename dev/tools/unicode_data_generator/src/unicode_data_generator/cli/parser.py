@@ -1,4 +1,5 @@
 import argparse
+from pathlib import Path
 
 from ..core.paths import default_cache_dir, default_output_dir
 
@@ -19,12 +20,14 @@ def build_parser() -> argparse.ArgumentParser:
 
     output.add_argument(
         '--cache-dir',
+        type=Path,
         default=default_cache_dir(),
         help='Override cache directory',
     )
 
     output.add_argument(
         '--output-dir',
+        type=Path,
         default=default_output_dir(),
         help='Override output directory',
     )
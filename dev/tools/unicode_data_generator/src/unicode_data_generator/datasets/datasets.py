@@ -3,6 +3,10 @@ from .interface import Dataset, TestDataset
 
 from . import (
     case_mapping,
+    display_width,
+    general_properties,
+    grapheme_break,
+    normalization,
     utf_encoding,
 )
 
@@ -13,6 +17,10 @@ type TestDatasetId = str
 def available_datasets() -> dict[DatasetId, Type[Dataset]]:
     datasets: set[Type[Dataset]] = {
         case_mapping.CaseMappingDataset,
+        display_width.DisplayWidthDataset,
+        general_properties.GeneralPropertiesDataset,
+        grapheme_break.GraphemeBreakDataset,
+        normalization.NormalizationDataset,
     }
 
     return {dataset.identifier(): dataset for dataset in datasets}
@@ -21,6 +29,10 @@ def available_datasets() -> dict[DatasetId, Type[Dataset]]:
 def available_test_datasets() -> dict[TestDatasetId, Type[TestDataset]]:
     test_datasets: set[Type[TestDataset]] = {
         case_mapping.CaseMappingTestDataset,
+        display_width.DisplayWidthTestDataset,
+        general_properties.GeneralPropertiesTestDataset,
+        grapheme_break.GraphemeBreakTestDataset,
+        normalization.NormalizationTestDataset,
         utf_encoding.UtfEncodingTestDataset,
     }
 
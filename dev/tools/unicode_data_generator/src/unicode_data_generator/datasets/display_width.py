@@ -0,0 +1,210 @@
+from collections.abc import Iterator
+from typing import Literal, NoReturn
+
+from ..core.test_fail import test_fail
+from .interface import Dataset, PrimaryData, EncoderId
+from .interface import TestDataset, TestData
+from ..ucd.code_point_data import CodePoint, CodePointData
+from ..ucd.manager import FilePath, FileContents
+from ..core.ranges import code_point_range, usv_range
+
+
+# The display width of a code point, in terminal columns, follows the conventions of `wcwidth()`:
+#
+# - 0 for nonspacing and enclosing marks (`Mn`, `Me`), control characters (`Cc`), `Default_Ignorable_Code_Point`s
+#   and the Hangul Jamo vowels and trailing consonants (`Hangul_Syllable_Type` `V` and `T`),
+#   which are combined with the preceding character,
+# - 2 for wide and fullwidth characters (`East_Asian_Width` `W` and `F`),
+# - 1 for all other code points.
+
+zero_width_general_categories: set[str] = {'Mn', 'Me', 'Cc'}
+
+zero_width_hangul_syllable_types: set[str] = {'V', 'T'}
+
+wide_east_asian_widths: set[str] = {'W', 'F'}
+
+_necessary_ucd_files: set[str] = {
+    'ucd/extracted/DerivedGeneralCategory.txt',
+    'ucd/DerivedCoreProperties.txt',
+    'ucd/EastAsianWidth.txt',
+    'ucd/HangulSyllableType.txt',
+}
+
+
+def _display_width(data: CodePointData, code_point: CodePoint) -> int:
+    properties = data[code_point]
+
+    if (
+        properties.general_category in zero_width_general_categories
+        or 'Default_Ignorable_Code_Point' in properties.binary_properties
+        or properties.hangul_syllable_type in zero_width_hangul_syllable_types
+    ):
+        return 0
+
+    if properties.east_asian_width in wide_east_asian_widths:
+        return 2
+
+    return 1
+
+
+class DisplayWidthDataset(Dataset):
+    def __init__(self, data: CodePointData):
+        self.code_point_data = data
+
+        self._primary_data = PrimaryData([_display_width(data, code_point) for code_point in code_point_range()])
+
+
+    @classmethod
+    def identifier(cls) -> str:
+        return 'display_width'
+
+
+    @classmethod
+    def pretty_name(cls) -> str:
+        return 'display width'
+
+
+    @classmethod
+    def necessary_ucd_files(cls) -> set[str]:
+        return _necessary_ucd_files
+
+
+    @classmethod
+    def optimal_encoder(cls) -> EncoderId:
+        return 'multistage_lookup_tables'
+
+
+    @classmethod
+    def default_tuning(cls) -> Literal['size', 'speed']:
+        # Looked up for every non-ASCII code point when measuring or truncating text.
+        return 'speed'
+
+
+    def primary_data(self) -> PrimaryData:
+        return self._primary_data
+
+
+    def _analyze_impl(self) -> list[str]:
+        output: list[str] = []
+
+        for width in range(3):
+            count = sum(1 for value in self._primary_data.data if value == width)
+
+            output.append(f'width {width}: {count} code points')
+
+        return output
+
+
+    def _test_data_impl(self) -> None | NoReturn:
+        for code_point in code_point_range():
+            try:
+                expected = _display_width(self.code_point_data, code_point)
+                actual = self._primary_data.data[code_point]
+
+                if actual != expected:
+                    return test_fail(code_point, expected, actual)
+
+            except Exception:
+                test_fail(code_point, self.code_point_data[code_point], '<error>')
+
+
+def _ranges_and_values(contents: FileContents) -> Iterator[tuple[CodePoint, CodePoint, str]]:
+    # Yields the first and the last code point and the first property field of every data line of a UCD file.
+    # Like the parsers of the generator, the `@missing` lines in the comments are not applied.
+
+    for line in contents.splitlines():
+        line = line.partition('#')[0].strip()
+
+        if not line:
+            continue
+
+        fields = [field.strip() for field in line.split(';')]
+        first, _, last = fields[0].partition('..')
+
+        yield int(first, 16), int(last or first, 16), fields[1]
+
+
+def _display_widths_from_ucd_files(files: dict[FilePath, FileContents]) -> bytearray:
+    # The widths of all code points, read straight from the UCD files, without `CodePointData` and `_display_width`,
+    # so that the test data checks the tables instead of repeating how they were computed.
+
+    widths = bytearray([1]) * (0x10FFFF + 1)
+
+    def set_widths(filepath: FilePath, values: set[str], width: int):
+        for first, last, value in _ranges_and_values(files[filepath]):
+            if value in values:
+                widths[first:last + 1] = bytes([width]) * (last + 1 - first)
+
+    set_widths('ucd/EastAsianWidth.txt', {'W', 'F'}, 2)
+
+    set_widths('ucd/extracted/DerivedGeneralCategory.txt', {'Mn', 'Me', 'Cc'}, 0)
+    set_widths('ucd/DerivedCoreProperties.txt', {'Default_Ignorable_Code_Point'}, 0)
+    set_widths('ucd/HangulSyllableType.txt', {'V', 'T'}, 0)
+
+    return widths
+
+
+class DisplayWidthTestDataset(TestDataset):
+    def __init__(self, code_point_data: CodePointData):
+        self.code_point_data = code_point_data
+
+        self._data: list[TestData] = []
+
+
+    def load_raw_ucd_files(self, files: dict[FilePath, FileContents]):
+        widths = _display_widths_from_ucd_files(files)
+
+        test_data = TestData('display_width')
+
+        previous_code_point: CodePoint | None = None
+        previous_values: list[int] = []
+
+        for code_point in usv_range():
+            values = [widths[code_point]]
+
+            if self.should_code_point_be_tested(code_point) or values != previous_values:
+                # test for the first and the last code point of every run of equal widths
+
+                test_data[code_point] = values
+
+                if previous_code_point is not None:
+                    test_data[previous_code_point] = previous_values
+
+            previous_code_point = code_point
+            previous_values = values
+
+        self._data = [test_data]
+
+
+    def should_code_point_be_tested(self, code_point: CodePoint) -> bool:
+        return code_point < 0x100 # test every code point of the ASCII fast path and Latin-1
+
+
+    @classmethod
+    def identifier(cls) -> str:
+        return 'display_width'
+
+    @classmethod
+    def pretty_name(cls) -> str:
+        return 'display width'
+
+
+    @classmethod
+    def necessary_ucd_files(cls) -> set[str]:
+        return _necessary_ucd_files
+
+    @classmethod
+    def raw_ucd_files(cls) -> set[str]:
+        return _necessary_ucd_files
+
+    def data(self) -> list[TestData]:
+        return self._data
+
+    def _test_data_impl(self) -> None | NoReturn:
+        # Compares the independently computed test data with the widths that the tables are generated from.
+        for test_data in self.data():
+            for code_point, values in test_data.data.items():
+                expected = [_display_width(self.code_point_data, code_point)]
+
+                if values != expected:
+                    return test_fail(code_point, expected, values)
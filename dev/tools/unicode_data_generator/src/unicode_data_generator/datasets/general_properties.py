@@ -0,0 +1,196 @@
+from typing import Literal, NoReturn
+
+from ..core.test_fail import test_fail
+from .interface import Dataset, PrimaryData, EncoderId
+from .interface import TestDataset, TestData
+from ..ucd.code_point_data import CodePoint, CodePointData
+from ..core.ranges import code_point_range, usv_range
+
+
+# The order has to match `upp::general_category`.
+general_categories: list[str] = [
+    'Lu', 'Ll', 'Lt', 'Lm', 'Lo',
+    'Mn', 'Mc', 'Me',
+    'Nd', 'Nl', 'No',
+    'Pc', 'Pd', 'Ps', 'Pe', 'Pi', 'Pf', 'Po',
+    'Sm', 'Sc', 'Sk', 'So',
+    'Zs', 'Zl', 'Zp',
+    'Cc', 'Cf', 'Cs', 'Co', 'Cn',
+]
+
+# The bit of each property has to match `upp::binary_property`.
+binary_properties: list[str] = [
+    'White_Space',
+    'Alphabetic',
+    'XID_Start',
+    'XID_Continue',
+]
+
+# The general category is stored above the binary property bits.
+general_category_bit_offset: int = len(binary_properties)
+
+_necessary_ucd_files: set[str] = {
+    'ucd/extracted/DerivedGeneralCategory.txt',
+    'ucd/PropList.txt',
+    'ucd/DerivedCoreProperties.txt',
+}
+
+
+def _binary_property_bits(data: CodePointData, code_point: CodePoint) -> int:
+    bits: int = 0
+
+    for bit, property_name in enumerate(binary_properties):
+        if property_name in data[code_point].binary_properties:
+            bits |= 1 << bit
+
+    return bits
+
+
+def _general_category_index(data: CodePointData, code_point: CodePoint) -> int:
+    return general_categories.index(data[code_point].general_category)
+
+
+class GeneralPropertiesDataset(Dataset):
+    def __init__(self, data: CodePointData):
+        self.code_point_data = data
+
+        self._primary_data = self._generate_primary_data()
+
+
+    @classmethod
+    def identifier(cls) -> str:
+        return 'general_properties'
+
+
+    @classmethod
+    def pretty_name(cls) -> str:
+        return 'general properties'
+
+
+    @classmethod
+    def necessary_ucd_files(cls) -> set[str]:
+        return _necessary_ucd_files
+
+
+    @classmethod
+    def optimal_encoder(cls) -> EncoderId:
+        return 'multistage_lookup_tables'
+
+
+    @classmethod
+    def default_tuning(cls) -> Literal['size', 'speed']:
+        # Looked up for every code point by tokenizers and bulk classification.
+        return 'speed'
+
+
+    def primary_data(self) -> PrimaryData:
+        return self._primary_data
+
+
+    def _generate_primary_data(self) -> PrimaryData:
+        data: list[int] = []
+
+        for code_point in code_point_range():
+            general_category = _general_category_index(self.code_point_data, code_point)
+
+            data.append((general_category << general_category_bit_offset) | _binary_property_bits(self.code_point_data, code_point))
+
+        return PrimaryData(data)
+
+
+    def _analyze_impl(self) -> list[str]:
+        output: list[str] = []
+
+        for general_category in general_categories:
+            count = sum(1 for code_point in code_point_range() if self.code_point_data[code_point].general_category == general_category)
+
+            output.append(f'General_Category={general_category}: {count} code points')
+
+        output.append('')
+
+        for property_name in binary_properties:
+            count = sum(1 for code_point in code_point_range() if property_name in self.code_point_data[code_point].binary_properties)
+
+            output.append(f'{property_name}: {count} code points')
+
+        output.append('')
+        output.append(f'unique property values: {len(set(self._primary_data.data))}')
+
+        return output
+
+
+    def _test_data_impl(self) -> None | NoReturn:
+        for code_point in code_point_range():
+            try:
+                value = self._primary_data.data[code_point]
+
+                expected_general_category = self.code_point_data[code_point].general_category
+                actual_general_category = general_categories[value >> general_category_bit_offset]
+
+                if actual_general_category != expected_general_category:
+                    return test_fail(code_point, expected_general_category, actual_general_category)
+
+                for bit, property_name in enumerate(binary_properties):
+                    expected = property_name in self.code_point_data[code_point].binary_properties
+                    actual = (value >> bit) & 1 == 1
+
+                    if actual != expected:
+                        return test_fail(code_point, f'{property_name}={expected}', f'{property_name}={actual}')
+
+            except Exception:
+                test_fail(code_point, self.code_point_data[code_point], '<error>')
+
+
+class GeneralPropertiesTestDataset(TestDataset):
+    def __init__(self, code_point_data: CodePointData):
+        self.code_point_data = code_point_data
+
+        test_data = TestData('general_properties')
+
+        previous_code_point: CodePoint | None = None
+        previous_values: list[int] = []
+
+        for code_point in usv_range():
+            values = [_general_category_index(code_point_data, code_point), _binary_property_bits(code_point_data, code_point)]
+
+            if self.should_code_point_be_tested(code_point) or values != previous_values:
+                # test for the first and the last code point of every run of equal property values
+
+                test_data[code_point] = values
+
+                if previous_code_point is not None:
+                    test_data[previous_code_point] = previous_values
+
+            previous_code_point = code_point
+            previous_values = values
+
+        self._data = [test_data]
+
+
+    def should_code_point_be_tested(self, code_point: CodePoint) -> bool:
+        return code_point < 0x500 # test for a few first code points
+
+
+    @classmethod
+    def identifier(cls) -> str:
+        return 'general_properties'
+
+    @classmethod
+    def pretty_name(cls) -> str:
+        return 'general properties'
+
+
+    @classmethod
+    def necessary_ucd_files(cls) -> set[str]:
+        return _necessary_ucd_files
+    
+    def data(self) -> list[TestData]:
+        return self._data
+    
+    def _test_data_impl(self) -> None | NoReturn:
+        for test_data in self.data():
+            for code_point, values in test_data.data.items():
+                expected = [_general_category_index(self.code_point_data, code_point), _binary_property_bits(self.code_point_data, code_point)]
+
+                if values != expected:
+                    return test_fail(code_point, expected, values)
@@ -0,0 +1,236 @@
+from typing import Literal, NoReturn
+
+from ..core.test_fail import test_fail
+from .interface import Dataset, PrimaryData, EncoderId
+from .interface import TestDataset, TestData
+from ..ucd.code_point_data import CodePoint, CodePointData
+from ..ucd.manager import FilePath, FileContents
+from ..core.ranges import code_point_range, usv_range
+
+
+# The order has to match `upp::impl::unicode_data::grapheme_break::grapheme_cluster_break`.
+grapheme_cluster_break_values: list[str] = [
+    'Other',
+    'CR',
+    'LF',
+    'Control',
+    'Extend',
+    'ZWJ',
+    'Regional_Indicator',
+    'Prepend',
+    'SpacingMark',
+    'L',
+    'V',
+    'T',
+    'LV',
+    'LVT',
+]
+
+# The order has to match `upp::impl::unicode_data::grapheme_break::indic_conjunct_break`.
+indic_conjunct_break_values: list[str] = [
+    'None',
+    'Linker',
+    'Consonant',
+    'Extend',
+]
+
+# Layout of the primary data values (has to match `include/uni-cpp/impl/unicode_data/grapheme_break.hpp`):
+#
+# | bits  | field                                          |
+# |-------|------------------------------------------------|
+# | 0..3  | index of the Grapheme_Cluster_Break value      |
+# | 4     | set if the code point is Extended_Pictographic |
+# | 5..6  | index of the Indic_Conjunct_Break value        |
+
+extended_pictographic_bit: int = 4
+indic_conjunct_break_bit_offset: int = 5
+
+_necessary_ucd_files: set[str] = {
+    'ucd/auxiliary/GraphemeBreakProperty.txt',
+    'ucd/emoji/emoji-data.txt',
+    'ucd/DerivedCoreProperties.txt',
+}
+
+# The conformance test of UAX #29, copied into the test data for the tests of `views::graphemes` and `count_graphemes`.
+_conformance_test_file: str = 'ucd/auxiliary/GraphemeBreakTest.txt'
+
+
+def _grapheme_break_value(data: CodePointData, code_point: CodePoint) -> int:
+    properties = data[code_point]
+
+    value: int = grapheme_cluster_break_values.index(properties.grapheme_cluster_break)
+
+    if 'Extended_Pictographic' in properties.binary_properties:
+        value |= 1 << extended_pictographic_bit
+
+    value |= indic_conjunct_break_values.index(properties.indic_conjunct_break) << indic_conjunct_break_bit_offset
+
+    return value
+
+
+class GraphemeBreakDataset(Dataset):
+    def __init__(self, data: CodePointData):
+        self.code_point_data = data
+
+        self._primary_data = PrimaryData([_grapheme_break_value(data, code_point) for code_point in code_point_range()])
+
+
+    @classmethod
+    def identifier(cls) -> str:
+        return 'grapheme_break'
+
+
+    @classmethod
+    def pretty_name(cls) -> str:
+        return 'grapheme cluster break properties'
+
+
+    @classmethod
+    def necessary_ucd_files(cls) -> set[str]:
+        return _necessary_ucd_files
+
+
+    @classmethod
+    def optimal_encoder(cls) -> EncoderId:
+        return 'multistage_lookup_tables'
+
+
+    @classmethod
+    def default_tuning(cls) -> Literal['size', 'speed']:
+        # Looked up for every non-ASCII code point during grapheme cluster segmentation.
+        return 'speed'
+
+
+    def primary_data(self) -> PrimaryData:
+        return self._primary_data
+
+
+    def _analyze_impl(self) -> list[str]:
+        output: list[str] = []
+
+        for value in grapheme_cluster_break_values:
+            count = sum(1 for code_point in code_point_range() if self.code_point_data[code_point].grapheme_cluster_break == value)
+
+            output.append(f'Grapheme_Cluster_Break={value}: {count} code points')
+
+        output.append('')
+
+        for value in indic_conjunct_break_values:
+            count = sum(1 for code_point in code_point_range() if self.code_point_data[code_point].indic_conjunct_break == value)
+
+            output.append(f'Indic_Conjunct_Break={value}: {count} code points')
+
+        output.append('')
+
+        count = sum(1 for code_point in code_point_range() if 'Extended_Pictographic' in self.code_point_data[code_point].binary_properties)
+
+        output.append(f'Extended_Pictographic: {count} code points')
+        output.append('')
+        output.append(f'unique property values: {len(set(self._primary_data.data))}')
+
+        return output
+
+
+    def _test_data_impl(self) -> None | NoReturn:
+        for code_point in code_point_range():
+            try:
+                value = self._primary_data.data[code_point]
+                properties = self.code_point_data[code_point]
+
+                actual_grapheme_cluster_break = grapheme_cluster_break_values[value & ((1 << extended_pictographic_bit) - 1)]
+
+                if actual_grapheme_cluster_break != properties.grapheme_cluster_break:
+                    return test_fail(code_point, properties.grapheme_cluster_break, actual_grapheme_cluster_break)
+
+                expected_extended_pictographic = 'Extended_Pictographic' in properties.binary_properties
+                actual_extended_pictographic = (value >> extended_pictographic_bit) & 1 == 1
+
+                if actual_extended_pictographic != expected_extended_pictographic:
+                    return test_fail(code_point, f'Extended_Pictographic={expected_extended_pictographic}', f'Extended_Pictographic={actual_extended_pictographic}')
+
+                actual_indic_conjunct_break = indic_conjunct_break_values[value >> indic_conjunct_break_bit_offset]
+
+                if actual_indic_conjunct_break != properties.indic_conjunct_break:
+                    return test_fail(code_point, properties.indic_conjunct_break, actual_indic_conjunct_break)
+
+            except Exception:
+                test_fail(code_point, self.code_point_data[code_point], '<error>')
+
+
+class GraphemeBreakTestDataset(TestDataset):
+    def __init__(self, code_point_data: CodePointData):
+        self.code_point_data = code_point_data
+
+        test_data = TestData('grapheme_break_properties')
+
+        previous_code_point: CodePoint | None = None
+        previous_values: list[int] = []
+
+        for code_point in usv_range():
+            values = self._values(code_point)
+
+            if self.should_code_point_be_tested(code_point) or values != previous_values:
+                # test for the first and the last code point of every run of equal property values
+
+                test_data[code_point] = values
+
+                if previous_code_point is not None:
+                    test_data[previous_code_point] = previous_values
+
+            previous_code_point = code_point
+            previous_values = values
+
+        self._data = [test_data]
+        self._conformance_test: FileContents | None = None
+
+
+    def _values(self, code_point: CodePoint) -> list[int]:
+        properties = self.code_point_data[code_point]
+
+        return [
+            grapheme_cluster_break_values.index(properties.grapheme_cluster_break),
+            1 if 'Extended_Pictographic' in properties.binary_properties else 0,
+            indic_conjunct_break_values.index(properties.indic_conjunct_break),
+        ]
+
+
+    def should_code_point_be_tested(self, code_point: CodePoint) -> bool:
+        return code_point < 0x100 # test every code point of the ASCII fast path and Latin-1
+
+
+    @classmethod
+    def identifier(cls) -> str:
+        return 'grapheme_break'
+
+    @classmethod
+    def pretty_name(cls) -> str:
+        return 'grapheme cluster break properties'
+
+
+    @classmethod
+    def necessary_ucd_files(cls) -> set[str]:
+        return _necessary_ucd_files
+
+    @classmethod
+    def raw_ucd_files(cls) -> set[str]:
+        return {_conformance_test_file}
+
+    def load_raw_ucd_files(self, files: dict[FilePath, FileContents]):
+        self._conformance_test = files[_conformance_test_file]
+
+    def copied_ucd_files(self) -> dict[str, FileContents]:
+        if self._conformance_test is None:
+            return {}
+
+        return {'GraphemeBreakTest.txt': self._conformance_test}
+
+    def data(self) -> list[TestData]:
+        return self._data
+
+    def _test_data_impl(self) -> None | NoReturn:
+        for test_data in self.data():
+            for code_point, values in test_data.data.items():
+                expected = self._values(code_point)
+
+                if values != expected:
+                    return test_fail(code_point, expected, values)
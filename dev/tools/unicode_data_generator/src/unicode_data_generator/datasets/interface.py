@@ -5,6 +5,7 @@ from typing import NoReturn, Literal
 from pathlib import Path
 
 from ..ucd.code_point_data import CodePoint, CodePointData
+from ..ucd.manager import FilePath, FileContents
 from ..core.optimal_size import optimal_byte_size_for_value
 from ..core.tables import Table, Tables
 
@@ -79,6 +80,14 @@ class Dataset(ABC):
     def optimal_encoder(cls) -> EncoderId:
         pass
 
+    @classmethod
+    def default_tuning(cls) -> Literal['size', 'speed']:
+        """
+        The table layout tuning used when `generate` isn't given `--tuning`.
+        """
+
+        return 'size'
+
     @abstractmethod
     def primary_data(self) -> PrimaryData:
         pass
@@ -156,6 +165,21 @@ class TestDataset(ABC):
     def necessary_ucd_files(cls) -> set[str]:
         pass
 
+    @classmethod
+    def raw_ucd_files(cls) -> set[str]:
+        # UCD files that the test dataset reads itself instead of through the parsed `CodePointData`,
+        # so that the expected values don't go through the same parsers and functions as the tables they test.
+        # They're passed to `load_raw_ucd_files` before the test data is tested and emitted.
+        return set()
+
+    def load_raw_ucd_files(self, files: dict[FilePath, FileContents]):
+        pass
+
+    def copied_ucd_files(self) -> dict[str, FileContents]:
+        # Conformance test files of the UCD (e.g. `NormalizationTest.txt`) that are emitted into the test data as they are,
+        # by their file names. The tests run them against the library.
+        return {}
+
     @abstractmethod
     def data(self) -> Sequence[TestData]:
         pass
@@ -0,0 +1,430 @@
+import inspect
+from typing import Literal, NoReturn
+
+from ..core.internal_error import internal_error
+from ..core.test_fail import test_fail
+from .interface import Dataset, PrimaryData, ExtraTable, ExtraTables, ExtraValue, ExtraValues, EncoderId
+from .interface import TestDataset, TestData
+from ..ucd.code_point_data import CodePoint, CodePointData
+from ..ucd.manager import FilePath, FileContents
+from ..core.ranges import code_point_range, usv_range
+
+
+# Hangul syllables are decomposed and composed algorithmically (see Unicode Standard Chapter 3.12),
+# so they are not stored in the tables.
+hangul_syllable_first: CodePoint = 0xAC00
+hangul_syllable_last: CodePoint = 0xD7A3
+
+# Layout of the primary data values (has to match `include/uni-cpp/impl/unicode_data/normalization.hpp`):
+#
+# | bits    | field                                                                                   |
+# |---------|-----------------------------------------------------------------------------------------|
+# | 0..7    | Canonical_Combining_Class                                                               |
+# | 8..9    | NFC_QC (0 = Yes, 1 = Maybe, 2 = No)                                                     |
+# | 10..11  | NFKC_QC (0 = Yes, 1 = Maybe, 2 = No)                                                    |
+# | 12..14  | length of the full canonical decomposition (0 if there is none)                         |
+# | 15..19  | length of the full compatibility decomposition (0 if there is none)                     |
+# | 20      | set if the compatibility decomposition is the canonical one (and is stored only once)   |
+# | 21..    | offset of the decompositions in the `decompositions` table                              |
+#
+# The canonical decomposition is stored first, followed by the compatibility decomposition (unless bit 20 is set).
+# NFD_QC and NFKD_QC are `No` exactly when the canonical and the compatibility decomposition respectively is not empty.
+
+canonical_length_bit_offset: int = 12
+compatibility_length_bit_offset: int = 15
+shared_decomposition_bit: int = 20
+decomposition_offset_bit_offset: int = 21
+
+max_canonical_decomposition_length: int = (1 << (compatibility_length_bit_offset - canonical_length_bit_offset)) - 1
+max_compatibility_decomposition_length: int = (1 << (shared_decomposition_bit - compatibility_length_bit_offset)) - 1
+
+quick_check_values: dict[str, int] = {'Y': 0, 'M': 1, 'N': 2}
+
+_necessary_ucd_files: set[str] = {
+    'ucd/UnicodeData.txt',
+    'ucd/DerivedNormalizationProps.txt',
+}
+
+# The conformance test of UAX #15, copied into the test data for the tests of `normalize()` and `views::normalize`.
+_conformance_test_file: str = 'ucd/NormalizationTest.txt'
+
+
+def is_hangul_syllable(code_point: CodePoint) -> bool:
+    return hangul_syllable_first <= code_point <= hangul_syllable_last
+
+
+def _full_decomposition(data: CodePointData, code_point: CodePoint, compatibility: bool) -> list[CodePoint]:
+    properties = data[code_point]
+
+    if properties.decomposition_mapping is None or (properties.decomposition_type is not None and not compatibility):
+        return [code_point]
+
+    result: list[CodePoint] = []
+
+    for mapped_code_point in properties.decomposition_mapping:
+        result.extend(_full_decomposition(data, mapped_code_point, compatibility))
+
+    return result
+
+
+def full_canonical_decomposition(data: CodePointData, code_point: CodePoint) -> list[CodePoint]:
+    """
+    Returns an empty list if the code point has no canonical decomposition.
+    """
+
+    decomposition = _full_decomposition(data, code_point, compatibility=False)
+
+    return [] if decomposition == [code_point] else decomposition
+
+
+def full_compatibility_decomposition(data: CodePointData, code_point: CodePoint) -> list[CodePoint]:
+    """
+    Returns an empty list if the code point has no compatibility decomposition.
+    """
+
+    decomposition = _full_decomposition(data, code_point, compatibility=True)
+
+    return [] if decomposition == [code_point] else decomposition
+
+
+def quick_check(data: CodePointData, code_point: CodePoint, property_name: str) -> int:
+    return quick_check_values[data[code_point].normalization_quick_check.get(property_name, 'Y')]
+
+
+def primary_compositions(data: CodePointData) -> dict[tuple[CodePoint, CodePoint], CodePoint]:
+    """
+    Canonical compositions of pairs of code points, excluding Hangul syllables.
+    """
+
+    compositions: dict[tuple[CodePoint, CodePoint], CodePoint] = {}
+
+    for code_point in usv_range():
+        properties = data[code_point]
+
+        if properties.decomposition_mapping is None or properties.decomposition_type is not None:
+            continue
+
+        if 'Full_Composition_Exclusion' in properties.binary_properties:
+            continue
+
+        if len(properties.decomposition_mapping) != 2:
+            internal_error(f'Primary composite U+{code_point:04X} does not have a decomposition mapping of two code points!')
+
+        first, second = properties.decomposition_mapping
+
+        compositions[(first, second)] = code_point
+
+    return compositions
+
+
+class NormalizationDataset(Dataset):
+    def __init__(self, data: CodePointData):
+        self.code_point_data = data
+
+        self._init_data()
+
+        self._primary_data = self._generate_primary_data()
+        self._extra_tables = self._generate_extra_tables()
+        self._extra_values = self._generate_extra_values()
+
+
+    @classmethod
+    def identifier(cls) -> str:
+        return 'normalization'
+
+
+    @classmethod
+    def pretty_name(cls) -> str:
+        return 'normalization'
+
+
+    @classmethod
+    def necessary_ucd_files(cls) -> set[str]:
+        return _necessary_ucd_files
+
+
+    @classmethod
+    def optimal_encoder(cls) -> EncoderId:
+        return 'multistage_lookup_tables'
+
+
+    @classmethod
+    def default_tuning(cls) -> Literal['size', 'speed']:
+        # Looked up for every code point that fails the quick check when normalizing.
+        return 'speed'
+
+
+    def primary_data(self) -> PrimaryData:
+        return self._primary_data
+
+
+    def extra_tables(self) -> ExtraTables:
+        return self._extra_tables
+
+
+    def extra_values(self) -> ExtraValues:
+        return self._extra_values
+
+
+    def _has_data(self, code_point: CodePoint) -> bool:
+        return self._value_for_code_point(code_point, {}, []) != 0
+
+
+    def _init_data(self):
+        self.greatest_code_point_with_data = max(filter(self._has_data, code_point_range()))
+
+        self.compositions = primary_compositions(self.code_point_data)
+
+        self.composition_keys: list[int] = sorted(self._composition_key(first, second) for first, second in self.compositions.keys())
+
+
+    def _composition_key(self, first: CodePoint, second: CodePoint) -> int:
+        return (first << 21) | second
+
+
+    def _value_for_code_point(self, code_point: CodePoint, offsets: dict[tuple, int], decompositions: list[int]) -> int:
+        properties = self.code_point_data[code_point]
+
+        value: int = properties.canonical_combining_class
+        value |= quick_check(self.code_point_data, code_point, 'NFC_QC') << 8
+        value |= quick_check(self.code_point_data, code_point, 'NFKC_QC') << 10
+
+        if is_hangul_syllable(code_point):
+            return value
+
+        canonical = full_canonical_decomposition(self.code_point_data, code_point)
+        compatibility = full_compatibility_decomposition(self.code_point_data, code_point)
+
+        if len(canonical) == 0 and len(compatibility) == 0:
+            return value
+
+        self._assert_decomposition_fits(code_point, canonical, compatibility)
+
+        is_shared: bool = canonical == compatibility
+
+        stored: tuple[CodePoint, ...] = tuple(canonical) if is_shared else tuple(canonical + compatibility)
+
+        if stored not in offsets:
+            offsets[stored] = len(decompositions)
+            decompositions.extend(stored)
+
+        value |= len(canonical) << canonical_length_bit_offset
+        value |= len(compatibility) << compatibility_length_bit_offset
+        value |= int(is_shared) << shared_decomposition_bit
+        value |= offsets[stored] << decomposition_offset_bit_offset
+
+        return value
+
+
+    def _generate_primary_data(self) -> PrimaryData:
+        offsets: dict[tuple, int] = {}
+        self.decompositions: list[int] = []
+
+        data: list[int] = [
+            self._value_for_code_point(code_point, offsets, self.decompositions)
+            for code_point in range(0, self.greatest_code_point_with_data + 1)
+        ]
+
+        return PrimaryData(data)
+
+
+    def _generate_extra_tables(self) -> ExtraTables:
+        return ExtraTables({
+            'decompositions':    ExtraTable('decompositions', self.decompositions),
+            'composition_keys':  ExtraTable('composition_keys', self.composition_keys),
+            'composition_values': ExtraTable('composition_values', [
+                self.compositions[(key >> 21, key & 0x1FFFFF)] for key in self.composition_keys
+            ]),
+        })
+
+
+    def _generate_extra_values(self) -> ExtraValues:
+        return ExtraValues({
+            'greatest_code_point_with_normalization_data': ExtraValue(
+                name='greatest_code_point_with_normalization_data',
+                value=self.greatest_code_point_with_data
+            ),
+        })
+
+
+    def lookup(self, code_point: CodePoint) -> tuple[int, int, int, list[CodePoint], list[CodePoint]]:
+        """
+        Returns the CCC, NFC_QC, NFKC_QC, canonical and compatibility decomposition from the generated data.
+        """
+
+        if code_point > self.greatest_code_point_with_data:
+            return (0, 0, 0, [], [])
+
+        value = self._primary_data.data[code_point]
+
+        canonical_length = (value >> canonical_length_bit_offset) & max_canonical_decomposition_length
+        compatibility_length = (value >> compatibility_length_bit_offset) & max_compatibility_decomposition_length
+        is_shared = (value >> shared_decomposition_bit) & 1 == 1
+        offset = value >> decomposition_offset_bit_offset
+
+        compatibility_offset = offset if is_shared else offset + canonical_length
+
+        return (
+            value & 0xFF,
+            (value >> 8) & 0x3,
+            (value >> 10) & 0x3,
+            self.decompositions[offset:offset + canonical_length],
+            self.decompositions[compatibility_offset:compatibility_offset + compatibility_length],
+        )
+
+
+    def _analyze_impl(self) -> list[str]:
+        canonical_count = sum(1 for code_point in usv_range() if len(full_canonical_decomposition(self.code_point_data, code_point)) != 0)
+        compatibility_count = sum(1 for code_point in usv_range() if len(full_compatibility_decomposition(self.code_point_data, code_point)) != 0)
+
+        longest_canonical = max(len(full_canonical_decomposition(self.code_point_data, code_point)) for code_point in usv_range())
+        longest_compatibility = max(len(full_compatibility_decomposition(self.code_point_data, code_point)) for code_point in usv_range())
+
+        non_starters = sum(1 for code_point in usv_range() if self.code_point_data[code_point].canonical_combining_class != 0)
+
+        return [
+            f'code points with a canonical decomposition: {canonical_count} (longest: {longest_canonical})',
+            f'code points with a compatibility decomposition: {compatibility_count} (longest: {longest_compatibility})',
+            f'code points with a non-zero canonical combining class: {non_starters}',
+            f'primary compositions (excluding Hangul): {len(self.compositions)}',
+            '',
+            f'decompositions table length: {len(self.decompositions)}',
+            f'unique property values: {len(set(self._primary_data.data))}',
+            f'greatest code point with normalization data: U+{self.greatest_code_point_with_data:06X}',
+        ]
+
+
+    def _test_data_impl(self) -> None | NoReturn:
+        for code_point in code_point_range():
+            try:
+                expected = (
+                    self.code_point_data[code_point].canonical_combining_class,
+                    quick_check(self.code_point_data, code_point, 'NFC_QC'),
+                    quick_check(self.code_point_data, code_point, 'NFKC_QC'),
+                    [] if is_hangul_syllable(code_point) else full_canonical_decomposition(self.code_point_data, code_point),
+                    [] if is_hangul_syllable(code_point) else full_compatibility_decomposition(self.code_point_data, code_point),
+                )
+
+                actual = self.lookup(code_point)
+
+                if actual != expected:
+                    return test_fail(code_point, expected, actual)
+
+            except Exception:
+                test_fail(code_point, self.code_point_data[code_point], '<error>')
+
+        for (first, second), composite in self.compositions.items():
+            key = self._composition_key(first, second)
+
+            index = self.composition_keys.index(key)
+
+            if self._extra_tables['composition_values'].values[index] != composite:
+                return test_fail(composite, composite, self._extra_tables['composition_values'].values[index])
+
+
+    def _assert_decomposition_fits(self, code_point: CodePoint, canonical: list[CodePoint], compatibility: list[CodePoint]):
+        if len(canonical) > max_canonical_decomposition_length or len(compatibility) > max_compatibility_decomposition_length:
+            internal_error(f'The decomposition of U+{code_point:04X} is too long!\n'
+                           'The normalization data storage strategy has to be updated.\n'
+                           'This function will not work for new Unicode versions until it is updated.', frame = inspect.stack()[1])
+
+
+class NormalizationTestDataset(TestDataset):
+    def __init__(self, code_point_data: CodePointData):
+        self.code_point_data = code_point_data
+
+        properties = TestData('normalization_properties')
+        canonical_decompositions = TestData('canonical_decompositions')
+        compatibility_decompositions = TestData('compatibility_decompositions')
+        compositions = TestData('compositions')
+
+        previous_code_point: CodePoint | None = None
+        previous_values: list[int] = []
+
+        for code_point in usv_range():
+            values = self._properties(code_point)
+
+            if code_point < 0x500 or values != previous_values:
+                # test for the first and the last code point of every run of equal property values
+
+                properties[code_point] = values
+
+                if previous_code_point is not None:
+                    properties[previous_code_point] = previous_values
+
+            previous_code_point = code_point
+            previous_values = values
+
+            canonical = full_canonical_decomposition(code_point_data, code_point)
+            compatibility = full_compatibility_decomposition(code_point_data, code_point)
+
+            if len(canonical) != 0 and not is_hangul_syllable(code_point):
+                canonical_decompositions[code_point] = canonical
+
+            if len(compatibility) != 0 and not is_hangul_syllable(code_point):
+                compatibility_decompositions[code_point] = compatibility
+
+        for (first, second), composite in primary_compositions(code_point_data).items():
+            compositions[composite] = [first, second]
+
+        self._data = [properties, canonical_decompositions, compatibility_decompositions, compositions]
+        self._conformance_test: FileContents | None = None
+
+
+    def _properties(self, code_point: CodePoint) -> list[int]:
+        return [
+            self.code_point_data[code_point].canonical_combining_class,
+            quick_check(self.code_point_data, code_point, 'NFC_QC'),
+            quick_check(self.code_point_data, code_point, 'NFKC_QC'),
+        ]
+
+
+    @classmethod
+    def identifier(cls) -> str:
+        return 'normalization'
+
+    @classmethod
+    def pretty_name(cls) -> str:
+        return 'normalization'
+
+
+    @classmethod
+    def necessary_ucd_files(cls) -> set[str]:
+        return _necessary_ucd_files
+
+    @classmethod
+    def raw_ucd_files(cls) -> set[str]:
+        return {_conformance_test_file}
+
+    def load_raw_ucd_files(self, files: dict[FilePath, FileContents]):
+        self._conformance_test = files[_conformance_test_file]
+
+    def copied_ucd_files(self) -> dict[str, FileContents]:
+        if self._conformance_test is None:
+            return {}
+
+        return {'NormalizationTest.txt': self._conformance_test}
+
+    def data(self) -> list[TestData]:
+        return self._data
+
+    def _test_data_impl(self) -> None | NoReturn:
+        properties, canonical_decompositions, compatibility_decompositions, _ = self.data()
+
+        for code_point, values in properties.data.items():
+            expected = self._properties(code_point)
+
+            if values != expected:
+                return test_fail(code_point, expected, values)
+
+        for code_point, values in canonical_decompositions.data.items():
+            expected = full_canonical_decomposition(self.code_point_data, code_point)
+
+            if values != expected:
+                return test_fail(code_point, expected, values)
+
+        for code_point, values in compatibility_decompositions.data.items():
+            expected = full_compatibility_decomposition(self.code_point_data, code_point)
+
+            if values != expected:
+                return test_fail(code_point, expected, values)
\ No newline at end of file
@@ -13,6 +13,7 @@ class GenerateContext:
     target: Literal['all', 'tables', 'tests']
     dataset: str | None
     use_precomputed_tuning: bool | None
+    tuning: Literal['size', 'speed'] | None
 
 @dataclass
 class AnalyzeContext:
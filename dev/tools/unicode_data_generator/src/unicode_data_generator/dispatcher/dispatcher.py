@@ -1,6 +1,6 @@
 from . import context
 
-from ..ucd.manager import UCDManager
+from ..ucd.manager import UCDManager, FilePath, FileContents
 from ..ucd.parser import Parser
 from ..ucd.code_point_data import CodePointData
 from ..datasets.datasets import Dataset, TestDataset
@@ -53,7 +53,7 @@ class CommandDispatcher:
             d.test_data()
             
             encoder = available_encoders()[dataset.optimal_encoder()]
-            e = encoder(d, context.use_precomputed_tuning or False, context.unicode_version)
+            e = encoder(d, context.use_precomputed_tuning or False, context.unicode_version, context.tuning or dataset.default_tuning())
 
             e.test_data()
 
@@ -68,6 +68,9 @@ class CommandDispatcher:
 
             d = test_dataset(code_point_data)
 
+            if test_dataset.raw_ucd_files():
+                d.load_raw_ucd_files(self.get_raw_ucd_files(test_dataset.raw_ucd_files(), context.unicode_version))
+
             d.test_data()
 
             emitter = TestEmitter(self.global_context.output_dir, context.unicode_version)
@@ -108,6 +111,15 @@ class CommandDispatcher:
             return parser.parse_files(ucd_manager.get_loaded_files())
 
 
+    def get_raw_ucd_files(self, files: set[str], unicode_version: str) -> dict[FilePath, FileContents]:
+        ucd_manager = UCDManager(unicode_version, self.global_context.cache_dir)
+
+        for filepath in files:
+            ucd_manager.load_file(filepath)
+
+        return {filepath: ucd_manager.get_loaded_files()[filepath] for filepath in files}
+
+
     def clean(self, context: context.CleanContext):
         def delete_dir(name: str, path):
             print(f'[*] Removing the {name} directory: {path}')
@@ -218,8 +218,17 @@ class Emitter:
 
             self._write_line('// See `dev/docs/multistage-lookup-tables.md`.')
             self._write_line()
-            self._write_line(f'const std::uint32_t quot = code_point / {encoder.block_size};')
-            self._write_line(f'const std::uint32_t rem  = code_point % {encoder.block_size};')
+            block_size: int = encoder.block_size
+
+            if block_size & (block_size - 1) == 0:
+                # Power-of-two block sizes split the code point with a shift and a mask.
+
+                self._write_line(f'const std::uint32_t quot = code_point >> {block_size.bit_length() - 1}U;')
+                self._write_line(f'const std::uint32_t rem  = code_point & {format_int_as_hex_with_prefix(block_size - 1)}U;')
+
+            else:
+                self._write_line(f'const std::uint32_t quot = code_point / {block_size};')
+                self._write_line(f'const std::uint32_t rem  = code_point % {block_size};')
             self._write_line()
             
             if encoder.stage1_needs_extra_lookup:
@@ -2,6 +2,7 @@ from pathlib import Path
 
 from .integers import format_int_as_hex
 from ..datasets.interface import TestData, TestDataset
+from ..ucd.manager import FileContents
 
 class TestEmitter:
     def __init__(self, output_dir: Path, unicode_version: str):
@@ -16,6 +17,18 @@ class TestEmitter:
 
             self._emit_data_file(test_data, filepath)
 
+        for filename, contents in test_dataset.copied_ucd_files().items():
+            self._emit_copied_file(contents, self.output_dir / filename)
+
+
+    def _emit_copied_file(self, contents: FileContents, filepath: Path):
+        print(f'[*] Copying UCD test file: \'{filepath.name}\'')
+
+        filepath.parent.mkdir(parents=True, exist_ok=True)
+
+        with open(filepath, 'w', encoding='utf-8') as file:
+            file.write(contents)
+
 
     def _emit_data_file(self, data: TestData, filepath: Path):
         print(f'[*] Emitting test file: \'{filepath.name}\'')
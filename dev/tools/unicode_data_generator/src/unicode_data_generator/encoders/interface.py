@@ -1,5 +1,5 @@
 from abc import ABC, abstractmethod
-from typing import NoReturn
+from typing import NoReturn, Literal
 
 from ..datasets.interface import Dataset
 from ..core.tables import Table, Tables
@@ -8,12 +8,15 @@ from ..core.tables import Table, Tables
 EncodedTable = Table
 EncodedTables = Tables
 
+type Tuning = Literal['size', 'speed']
+
 
 class Encoder(ABC):
-    def __init__(self, dataset: Dataset, use_precomputed_tuning: bool, unicode_version: str):
+    def __init__(self, dataset: Dataset, use_precomputed_tuning: bool, unicode_version: str, tuning: Tuning = 'size'):
         self.dataset = dataset
         self.use_precomputed_tuning = use_precomputed_tuning
         self.unicode_version = unicode_version
+        self.tuning = tuning
 
         self.data = self.dataset.primary_data()
 
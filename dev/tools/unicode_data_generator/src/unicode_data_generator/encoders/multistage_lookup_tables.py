@@ -1,10 +1,10 @@
+from collections.abc import Sequence
 from typing import NoReturn
 
 from .interface import Encoder, EncodedTable, EncodedTables
 from ..datasets.datasets import DatasetId
 from ..core.test_fail import test_fail
 from ..core.progress_bar import ProgressBar
-from ..core.optimal_size import optimal_byte_size_for_value
 
 type UnicodeVersion = str
 type BlockSize = int
@@ -21,12 +21,17 @@ class MultistageLookupTables(Encoder):
     def _generate_encoded_tables(self, use_precomputed_tuning: bool) -> EncodedTables:
         block_size: BlockSize | None = None
 
-        if use_precomputed_tuning:
-            if self.unicode_version in precomputed_block_sizes().keys():
-                block_size = precomputed_block_sizes()[self.unicode_version][self.dataset.identifier()]
+        if self.tuning == 'speed':
+            # Only a handful of power-of-two block sizes are considered, so there is nothing worth precomputing.
+            print(f'[*] Tuning the block size of {self.dataset.pretty_name()} {self.pretty_name()} for lookup speed')
 
-            else:
-                print(f'[!] No precomputed block size found for Unicode version {self.unicode_version}')
+            block_size = self._fine_tune_power_of_two_block_size()
+
+        elif use_precomputed_tuning:
+            block_size = precomputed_block_sizes().get(self.unicode_version, {}).get(self.dataset.identifier())
+
+            if block_size is None:
+                print(f'[!] No precomputed block size found for {self.dataset.pretty_name()} in Unicode version {self.unicode_version}')
 
         if block_size is None:
             print(f'[*] Fine-tuning the block size of {self.dataset.pretty_name()} {self.pretty_name()}')
@@ -44,6 +49,28 @@ class MultistageLookupTables(Encoder):
 
         return tables
     
+    def _cost(self, tables: EncodedTables) -> int:
+        """
+        Cost of a table layout, in bytes.
+
+        Size tuning only counts the bytes of the tables. Speed tuning additionally charges every table
+        for the dependent load the lookup has to perform on it, so that an extra stage is only kept
+        when it saves more than `_speed_tuning_stage_cost` bytes.
+        """
+
+        if self.tuning == 'speed':
+            return tables.total_size() + _speed_tuning_stage_cost * len(tables.tables)
+        
+        return tables.total_size()
+
+    def _fine_tune_power_of_two_block_size(self) -> BlockSize:
+        block_sizes = [1 << shift for shift in range(4, 11)]
+
+        best_block_size = min(block_sizes, key=lambda block_size: self._cost(self._generate(block_size)))
+
+        print(f'[+] Fastest block size found: {best_block_size}')
+        return best_block_size
+
     def _fine_tune_block_size(self) -> BlockSize:
         step = 64
         greatest_block_size_initially_checked = 1024
@@ -87,6 +114,9 @@ class MultistageLookupTables(Encoder):
         current_block = []
         blocks = []
 
+        block_indexes: dict[tuple[int, ...], int] = {}
+        stage3_indexes: dict[int, int] = {}
+
         stage1_block_indexes: list[BlockSize] = []
 
         stage1 = EncodedTable('stage1', [])
@@ -94,68 +124,58 @@ class MultistageLookupTables(Encoder):
         stage3 = EncodedTable('stage3', [])
 
         for value in self.data.data:
-            stage3_index = _index_or_append(stage3.values, value)
+            stage3_index = _index_or_append(stage3.values, stage3_indexes, value)
 
             current_block.append(stage3_index)
 
             if len(current_block) == block_size:
-                block_index = _index_or_append(blocks, current_block)
+                block_index = _index_or_append(blocks, block_indexes, tuple(current_block))
 
                 stage1_block_indexes.append(block_index)
 
                 current_block = []
 
         if len(current_block) != 0:
-            blocks.append(current_block)
+            blocks.append(tuple(current_block))
             block_index = len(blocks) - 1
 
             stage1_block_indexes.append(block_index)
         
         # overlap the blocks as much as possible to compress the data
 
-        overlapped = _shortest_superarray(blocks)
+        overlapped, block_offsets = _shortest_superarray(blocks)
         stage2.values = overlapped
 
         for block_index in stage1_block_indexes:
-            stage1.values.append(_find_sublist(blocks[block_index], overlapped))
+            stage1.values.append(block_offsets[block_index])
+
+        if self.tuning == 'speed':
+            return self._choose_fastest_layout(stage1, stage2, stage3)
 
         tables = EncodedTables()
 
         # check for possible optimizations (see `format` above for the optimizations)
 
         if stage1.optimal_value_size() > 1:
-            unique_stage2_offsets = EncodedTable('stage2_offsets', sorted(set(stage1.values)))
-
-            stage1_current_size = stage1.total_size()
+            unique_stage2_offsets, new_stage1 = _extract_unique_stage2_offsets(stage1)
 
-            stage1_new_size = len(stage1.values) * optimal_byte_size_for_value(len(unique_stage2_offsets.values) - 1, is_signed=False)
-
-            stage2_offsets_size = unique_stage2_offsets.total_size()
-
-            saved_bytes = stage1_current_size - stage1_new_size - stage2_offsets_size
+            saved_bytes = stage1.total_size() - new_stage1.total_size() - unique_stage2_offsets.total_size()
 
             if saved_bytes > 0:
-                new_stage1 = EncodedTable('stage1', [])
-
-                for stage2_offset in stage1.values:
-                    new_stage1.values.append(unique_stage2_offsets.values.index(stage2_offset))
-
                 tables['stage1'] = new_stage1
                 tables['stage2_offsets'] = unique_stage2_offsets
 
             else:
                 tables['stage1'] = stage1
 
+        else:
+            tables['stage1'] = stage1
+
         if stage3.optimal_value_size() <= stage2.optimal_value_size():
             # If the property value type size is smaller or equal to the stage2 index type size,
             # then it's best to place the values inplace (in stage2).
 
-            new_stage2 = EncodedTable('stage2', [])
-
-            for stage3_index in stage2.values:
-                new_stage2.values.append(stage3.values[stage3_index])
-
-            tables['stage2'] = new_stage2
+            tables['stage2'] = _store_stage3_values_inplace(stage2, stage3)
 
         else:
             tables['stage2'] = stage2
@@ -163,6 +183,33 @@ class MultistageLookupTables(Encoder):
 
         return tables
 
+    def _choose_fastest_layout(self, stage1: EncodedTable, stage2: EncodedTable, stage3: EncodedTable) -> EncodedTables:
+        """
+        Picks the layout with the lowest `_cost` out of every combination of the optional
+        `stage2_offsets` and `stage3` tables.
+        """
+
+        stage1_variants = [{'stage1': stage1}]
+
+        if stage1.optimal_value_size() > 1:
+            unique_stage2_offsets, new_stage1 = _extract_unique_stage2_offsets(stage1)
+
+            stage1_variants.append({'stage1': new_stage1, 'stage2_offsets': unique_stage2_offsets})
+
+        stage2_variants = [
+            {'stage2': _store_stage3_values_inplace(stage2, stage3)},
+            {'stage2': stage2, 'stage3': stage3},
+        ]
+
+        layouts = [
+            EncodedTables({**stage1_variant, **stage2_variant})
+            for stage1_variant in stage1_variants
+            for stage2_variant in stage2_variants
+        ]
+
+        # `min` returns the first of equally expensive layouts, so fewer stages win ties.
+        return min(layouts, key=self._cost)
+
 
     def _test_data_impl(self) -> None | NoReturn:
         for code_point, property in enumerate(self.data.data):
@@ -195,6 +242,11 @@ class MultistageLookupTables(Encoder):
                 test_fail(code_point, property, '<error>')
 
 
+# Every table of the layout costs the lookup one dependent load. In speed tuning, a table
+# has to save at least this many bytes to be worth that load.
+_speed_tuning_stage_cost = 4096
+
+
 def precomputed_block_sizes() -> dict[UnicodeVersion, dict[DatasetId, BlockSize]]:
     return {
         '15.0.0': {
@@ -205,6 +257,10 @@ def precomputed_block_sizes() -> dict[UnicodeVersion, dict[DatasetId, BlockSize]
         },
         '16.0.0': {
             'case_mapping': 64,
+            'display_width': 128,
+            'general_properties': 164,
+            'grapheme_break': 136,
+            'normalization': 75,
         },
         '17.0.0': {
             'case_mapping': 40,
@@ -218,59 +274,135 @@ def precomputed_block_sizes() -> dict[UnicodeVersion, dict[DatasetId, BlockSize]
     }
 
 
-def _index_or_append(l: list, value) -> int:
-    try:
-        return l.index(value)
-    
-    except ValueError:
+def _extract_unique_stage2_offsets(stage1: EncodedTable) -> tuple[EncodedTable, EncodedTable]:
+    unique_stage2_offsets = EncodedTable('stage2_offsets', sorted(set(stage1.values)))
+
+    index_of_offset = {offset: index for index, offset in enumerate(unique_stage2_offsets.values)}
+
+    new_stage1 = EncodedTable('stage1', [index_of_offset[stage2_offset] for stage2_offset in stage1.values])
+
+    return unique_stage2_offsets, new_stage1
+
+
+def _store_stage3_values_inplace(stage2: EncodedTable, stage3: EncodedTable) -> EncodedTable:
+    new_stage2 = EncodedTable('stage2', [])
+
+    for stage3_index in stage2.values:
+        new_stage2.values.append(stage3.values[stage3_index])
+
+    return new_stage2
+
+
+def _index_or_append(l: list, indexes: dict, value) -> int:
+    index = indexes.get(value)
+
+    if index is None:
         l.append(value)
-        return len(l) - 1
+
+        index = len(l) - 1
+        indexes[value] = index
+
+    return index
     
 
 # from: https://stackoverflow.com/a/17870684
-def _find_sublist(sublist: list, list: list) -> int:
+def _find_sublist(sublist: Sequence, list: Sequence) -> int | None:
     sublist_length = len(sublist)
 
     for ind in (i for i,e in enumerate(list) if e==sublist[0]):
         if list[ind:ind + sublist_length]==sublist:
             return ind
     
-    raise AssertionError()
-
-
-def _overlap(a: list, b: list) -> int:
-    max_overlap = 0
-    for i in range(1, min(len(a), len(b)) + 1):
-        if a[-i:] == b[:i]:
-            max_overlap = i
-    return max_overlap
-
-
-def _merge_arrays(arr1: list, arr2: list) -> list:
-    overlap_ab = _overlap(arr1, arr2)
-    overlap_ba = _overlap(arr2, arr1)
-    if overlap_ab >= overlap_ba:
-        return arr1 + arr2[overlap_ab:]
-    else:
-        return arr2 + arr1[overlap_ba:]
-
-
-def _shortest_superarray(arrays: list[list]) -> list:
-    while len(arrays) > 1:
-        max_olap = -1
-        best_pair = (0, 1)
-        merged = []
-        for i in range(len(arrays)):
-            for j in range(len(arrays)):
-                if i != j:
-                    merged_candidate = _merge_arrays(arrays[i], arrays[j])
-                    olap = len(arrays[i]) + len(arrays[j]) - len(merged_candidate)
-                    if olap > max_olap:
-                        max_olap = olap
-                        best_pair = (i, j)
-                        merged = merged_candidate
-        i, j = best_pair
-        new_arrays = [arrays[k] for k in range(len(arrays)) if k != i and k != j]
-        new_arrays.append(merged)
-        arrays = new_arrays
-    return arrays[0]
\ No newline at end of file
+    return None
+
+
+def _shortest_superarray(arrays: list[tuple[int, ...]]) -> tuple[list[int], list[int]]:
+    """
+    Greedy approximation of the shortest common superarray of distinct `arrays`.
+
+    Repeatedly joins the two arrays with the greatest suffix-prefix overlap, like the classic
+    greedy shortest common superstring algorithm. The overlaps are found level by level
+    (from the longest to the shortest) with a hash map of prefixes, so the arrays are never compared pairwise.
+
+    Returns the superarray and the offset of each of the `arrays` in it.
+    """
+
+    # Arrays contained in a longer array don't need to be placed on their own.
+    contained_in: dict[int, tuple[int, int]] = {}
+    max_length = max(len(array) for array in arrays)
+
+    for i in sorted(range(len(arrays)), key=lambda i: len(arrays[i]), reverse=True):
+        if len(arrays[i]) == max_length:
+            continue
+
+        for j, container in enumerate(arrays):
+            if j != i and j not in contained_in and len(container) > len(arrays[i]):
+                position = _find_sublist(arrays[i], container)
+
+                if position is not None:
+                    contained_in[i] = (j, position)
+                    break
+
+    remaining = [i for i in range(len(arrays)) if i not in contained_in]
+
+    next_of: dict[int, int] = {}
+    overlap_with_next: dict[int, int] = {}
+    has_previous: set[int] = set()
+
+    chain_of: dict[int, int] = {i: i for i in remaining}
+
+    def find_chain(i: int) -> int:
+        while chain_of[i] != i:
+            chain_of[i] = chain_of[chain_of[i]]
+            i = chain_of[i]
+        return i
+
+    for overlap in range(max_length - 1, 0, -1):
+        arrays_by_prefix: dict[tuple[int, ...], list[int]] = {}
+
+        for b in remaining:
+            if b not in has_previous and len(arrays[b]) > overlap:
+                arrays_by_prefix.setdefault(arrays[b][:overlap], []).append(b)
+
+        for a in remaining:
+            if a in next_of or len(arrays[a]) <= overlap:
+                continue
+
+            candidates = arrays_by_prefix.get(arrays[a][-overlap:])
+
+            if candidates is None:
+                continue
+
+            for candidate_index, b in enumerate(candidates):
+                # joining `a` with the beginning of its own chain would create a cycle
+                if find_chain(a) != find_chain(b):
+                    next_of[a] = b
+                    overlap_with_next[a] = overlap
+                    has_previous.add(b)
+
+                    chain_of[find_chain(b)] = find_chain(a)
+
+                    del candidates[candidate_index]
+                    break
+
+    superarray: list[int] = []
+    offsets: list[int] = [0] * len(arrays)
+
+    for start in remaining:
+        if start in has_previous:
+            continue
+
+        current: int | None = start
+        skip: int = 0
+
+        while current is not None:
+            offsets[current] = len(superarray) - skip
+            superarray.extend(arrays[current][skip:])
+
+            skip = overlap_with_next.get(current, 0)
+            current = next_of.get(current)
+
+    for i, (container, position) in contained_in.items():
+        offsets[i] = offsets[container] + position
+
+    return superarray, offsets
\ No newline at end of file
@@ -1,4 +1,4 @@
-from dataclasses import dataclass
+from dataclasses import dataclass, field
 
 type CodePoint = int
 
@@ -18,6 +18,29 @@ class CodePointProperties:
 
     general_category: str
 
+    binary_properties: set[str] = field(default_factory=set)
+
+    canonical_combining_class: int = 0
+
+    # Decomposition_Mapping from `UnicodeData.txt` (a single level of the decomposition, not the full decomposition).
+    # The type is `None` for canonical mappings and the tag without angle brackets (e.g. 'compat') otherwise.
+    decomposition_mapping: list[CodePoint] | None = None
+    decomposition_type: str | None = None
+
+    # Values other than 'Y' of the NFD_QC, NFC_QC, NFKD_QC and NFKC_QC properties, keyed by the property name.
+    normalization_quick_check: dict[str, str] = field(default_factory=dict)
+
+    grapheme_cluster_break: str = 'Other'
+
+    # Indic_Conjunct_Break from `DerivedCoreProperties.txt` ('Consonant', 'Extend', 'Linker' or 'None').
+    indic_conjunct_break: str = 'None'
+
+    # East_Asian_Width from `EastAsianWidth.txt` ('A', 'F', 'H', 'N', 'Na' or 'W').
+    east_asian_width: str = 'N'
+
+    # Hangul_Syllable_Type from `HangulSyllableType.txt` ('L', 'V', 'T', 'LV', 'LVT' or 'NA').
+    hangul_syllable_type: str = 'NA'
+
     @classmethod
     def default_properties_for_code_point(cls, code_point: CodePoint):
         return cls(
@@ -10,6 +10,12 @@ from .parsers import (
     unicode_data,
     special_casing,
     case_folding,
+    general_category,
+    property_list,
+    derived_normalization_props,
+    grapheme_break_property,
+    east_asian_width,
+    hangul_syllable_type,
 )
 
 class Parser:
@@ -44,6 +50,14 @@ class Parser:
             'ucd/UnicodeData.txt',
             'ucd/SpecialCasing.txt',
             'ucd/CaseFolding.txt',
+            'ucd/extracted/DerivedGeneralCategory.txt',
+            'ucd/PropList.txt',
+            'ucd/DerivedCoreProperties.txt',
+            'ucd/DerivedNormalizationProps.txt',
+            'ucd/auxiliary/GraphemeBreakProperty.txt',
+            'ucd/emoji/emoji-data.txt',
+            'ucd/EastAsianWidth.txt',
+            'ucd/HangulSyllableType.txt',
         ]
 
         order = {k: i for i, k in enumerate(priority)}
@@ -66,6 +80,24 @@ class Parser:
             case 'ucd/CaseFolding.txt':
                 case_folding.CaseFoldingParser(contents).update_code_point_data(code_point_data)
 
+            case 'ucd/extracted/DerivedGeneralCategory.txt':
+                general_category.DerivedGeneralCategoryParser(contents).update_code_point_data(code_point_data)
+
+            case 'ucd/PropList.txt' | 'ucd/DerivedCoreProperties.txt' | 'ucd/emoji/emoji-data.txt':
+                property_list.PropertyListParser(contents).update_code_point_data(code_point_data)
+
+            case 'ucd/DerivedNormalizationProps.txt':
+                derived_normalization_props.DerivedNormalizationPropsParser(contents).update_code_point_data(code_point_data)
+
+            case 'ucd/auxiliary/GraphemeBreakProperty.txt':
+                grapheme_break_property.GraphemeBreakPropertyParser(contents).update_code_point_data(code_point_data)
+
+            case 'ucd/EastAsianWidth.txt':
+                east_asian_width.EastAsianWidthParser(contents).update_code_point_data(code_point_data)
+
+            case 'ucd/HangulSyllableType.txt':
+                hangul_syllable_type.HangulSyllableTypeParser(contents).update_code_point_data(code_point_data)
+
             case _:
                 internal_error('Failed to parse an unknown UCD file!')
 
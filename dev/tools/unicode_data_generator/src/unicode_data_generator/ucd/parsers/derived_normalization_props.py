@@ -0,0 +1,32 @@
+from ..manager import FileContents
+from ..code_point_data import CodePoint, CodePointData
+
+from .simple import SimpleUCDFileParser
+
+_quick_check_properties: set[str] = {'NFD_QC', 'NFC_QC', 'NFKD_QC', 'NFKC_QC'}
+
+class DerivedNormalizationPropsParser:
+    """
+    Parses `Full_Composition_Exclusion` and the quick check properties from `DerivedNormalizationProps.txt`.
+    """
+
+    def __init__(self, contents: FileContents):
+        self.contents = contents
+
+    def update_code_point_data(self, data: CodePointData):
+        parser = SimpleUCDFileParser(self.contents)
+
+        for code_point_fields in parser.parse():
+            if code_point_fields.is_from_at_missing_line:
+                continue
+
+            code_point: CodePoint = code_point_fields.code_point
+            property_name: str = code_point_fields.fields[0]
+
+            if len(code_point_fields.fields) == 1:
+                data[code_point].binary_properties.add(property_name)
+
+            elif property_name in _quick_check_properties:
+                data[code_point].normalization_quick_check[property_name] = code_point_fields.fields[1]
+
+            # other properties (e.g. `NFKC_CF`) are not used
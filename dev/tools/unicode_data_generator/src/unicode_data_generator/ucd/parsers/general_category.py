@@ -0,0 +1,20 @@
+from ..manager import FileContents
+from ..code_point_data import CodePoint, CodePointData
+
+from .simple import SimpleUCDFileParser
+
+class DerivedGeneralCategoryParser:
+    def __init__(self, contents: FileContents):
+        self.contents = contents
+
+    def update_code_point_data(self, data: CodePointData):
+        parser = SimpleUCDFileParser(self.contents)
+
+        for code_point_fields in parser.parse():
+            code_point: CodePoint = code_point_fields.code_point
+            general_category: str = code_point_fields.fields[0]
+
+            if general_category == 'Cn': # unassigned is the default value, don't create entries for it
+                continue
+
+            data[code_point].general_category = general_category
@@ -0,0 +1,31 @@
+from ..manager import FileContents
+from ..code_point_data import CodePoint, CodePointData
+
+from .simple import SimpleUCDFileParser
+
+class PropertyListParser:
+    """
+    Parses binary properties from UCD files in the `PropList.txt` format
+    (e.g. `PropList.txt`, `DerivedCoreProperties.txt` and `emoji-data.txt`).
+
+    The only enumerated property in these files, `InCB` from `DerivedCoreProperties.txt`, is parsed as well.
+    """
+
+    def __init__(self, contents: FileContents):
+        self.contents = contents
+
+    def update_code_point_data(self, data: CodePointData):
+        parser = SimpleUCDFileParser(self.contents)
+
+        for code_point_fields in parser.parse():
+            if code_point_fields.is_from_at_missing_line:
+                continue
+
+            code_point: CodePoint = code_point_fields.code_point
+            property_name: str = code_point_fields.fields[0]
+
+            if len(code_point_fields.fields) == 1:
+                data[code_point].binary_properties.add(property_name)
+
+            elif property_name == 'InCB':
+                data[code_point].indic_conjunct_break = code_point_fields.fields[1]
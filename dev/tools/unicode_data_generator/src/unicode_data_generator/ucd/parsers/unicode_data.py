@@ -29,6 +29,8 @@ class UnicodeDataParser:
 
                 if len(data_fields[2]) != 0:
                     data[code_point].general_category = data_fields[2]
+
+                self._update_normalization_data(data, code_point, data_fields)
                 
 
     def _update_case_mapping_data(self, data: CodePointData, code_point: CodePoint, data_fields: list[str]):
@@ -55,4 +57,24 @@ class UnicodeDataParser:
             ) # type: ignore
 
             data[code_point].simple_titlecase_mapping = simple_titlecase_mapping
-            data[code_point].titlecase_mapping = [simple_titlecase_mapping]
\ No newline at end of file
+            data[code_point].titlecase_mapping = [simple_titlecase_mapping]
+
+
+    def _update_normalization_data(self, data: CodePointData, code_point: CodePoint, data_fields: list[str]):
+
+        if len(data_fields[3]) != 0:
+            data[code_point].canonical_combining_class = int(data_fields[3])
+
+        decomposition_field: str = data_fields[5].strip()
+
+        if len(decomposition_field) != 0:
+            decomposition_type: str | None = None
+
+            if decomposition_field.startswith('<'): # compatibility mapping, e.g. `<compat> 0020 0308`
+                index = decomposition_field.index('>')
+
+                decomposition_type = decomposition_field[1:index]
+                decomposition_field = decomposition_field[index + 1:]
+
+            data[code_point].decomposition_type = decomposition_type
+            data[code_point].decomposition_mapping = [parse_hex(value) for value in decomposition_field.split()]
\ No newline at end of file
@@ -18,5 +18,18 @@ namespace upp
 #include "encoding.hpp"
 #include "ranges.hpp"
 #include "string.hpp"
+#include "properties.hpp"
+#include "normalization.hpp"
+#include "display_width.hpp"
+#include "compact_string.hpp"
+#include "offset_index.hpp"
+#include "line_index.hpp"
+#include "rope.hpp"
+#include "shared_string.hpp"
+#include "string_builder.hpp"
+#include "intern_pool.hpp"
+#include "compare.hpp"
+#include "hash.hpp"
+#include "format.hpp"
 
 #endif // UNI_CPP_ALL_HPP
\ No newline at end of file
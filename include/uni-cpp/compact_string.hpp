@@ -0,0 +1,650 @@
+#ifndef UNI_CPP_COMPACT_STRING_HPP
+#define UNI_CPP_COMPACT_STRING_HPP
+
+/// @file
+///
+/// @brief Provides `compact_ustring`, a string type with constant time access to code points by their index.
+///
+
+#include "uchar.hpp"
+#include "encoding.hpp"
+#include "string.hpp"
+#include "impl/swar.hpp"
+#include "impl/decode_valid.hpp"
+#include "impl/encode_valid.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <compare>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <expected>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace upp
+{
+    namespace impl::compact_string
+    {
+        /// @brief The number of code points and the largest code point of a valid code unit sequence, collected one code unit at a time.
+        ///
+        template<encoding Encoding>
+        struct code_unit_summary
+        {
+            std::size_t   code_point_count = 0;
+            std::uint32_t max_code_unit    = 0; // excluding UTF-16 surrogates
+            bool          supplementary    = false;
+
+            constexpr void add(const std::uint32_t code_unit) noexcept
+            {
+                if constexpr (Encoding == encoding::utf8)
+                {
+                    if ((code_unit & 0xC0U) != 0x80U)
+                        ++code_point_count;
+
+                    max_code_unit = std::max(max_code_unit, code_unit);
+                }
+                else if constexpr (Encoding == encoding::utf16)
+                {
+                    // A surrogate pair is counted at its high surrogate.
+                    if ((code_unit & 0xFC00U) == 0xDC00U)
+                        return;
+
+                    ++code_point_count;
+
+                    if ((code_unit & 0xFC00U) == 0xD800U)
+                        supplementary = true;
+                    else
+                        max_code_unit = std::max(max_code_unit, code_unit);
+                }
+                else
+                {
+                    ++code_point_count;
+
+                    max_code_unit = std::max(max_code_unit, code_unit);
+                }
+            }
+
+            /// @brief Returns the number of bytes needed to store every code point of the sequence: 1, 2 or 4.
+            ///
+            [[nodiscard]] constexpr std::size_t width() const noexcept
+            {
+                if constexpr (Encoding == encoding::utf8)
+                {
+                    // Leading bytes from 0xC4 encode code points above U+00FF, and leading bytes from 0xF0 encode code points above U+FFFF.
+                    // Continuation bytes are all below 0xC0.
+                    if (max_code_unit >= 0xF0U)
+                        return 4;
+
+                    return max_code_unit >= 0xC4U ? 2uz : 1uz;
+                }
+                else
+                {
+                    if (supplementary || max_code_unit > 0xFFFFU)
+                        return 4;
+
+                    return max_code_unit > 0xFFU ? 2uz : 1uz;
+                }
+            }
+        };
+
+        /// @brief Summarizes the valid code unit sequence `[data, data + size)`. ASCII is skipped a word at a time in UTF-8.
+        ///
+        template<encoding Encoding, typename T>
+        [[nodiscard]] constexpr code_unit_summary<Encoding> summarize(const T* data, const std::size_t size) noexcept
+        {
+            code_unit_summary<Encoding> summary;
+
+            std::size_t index = 0;
+
+            if constexpr (Encoding == encoding::utf8)
+            {
+                for (; index + swar::word_size <= size; index += swar::word_size)
+                {
+                    const swar::word_type word = swar::load_word(data + index);
+
+                    if (swar::is_ascii_word(word))
+                    {
+                        summary.code_point_count += swar::word_size;
+                        continue;
+                    }
+
+                    for (std::size_t i = 0; i < swar::word_size; ++i)
+                        summary.add(static_cast<std::uint32_t>((word >> (8U * i)) & 0xFFU));
+                }
+            }
+
+            for (; index < size; ++index)
+                summary.add(static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<T>>(data[index])));
+
+            return summary;
+        }
+
+        /// @brief Decodes the valid code unit sequence `[data, data + size)` into `out`, which has room for every code point.
+        ///
+        template<encoding Encoding, typename T, typename U>
+        constexpr void decode_into(const T* data, const std::size_t size, U* out) noexcept
+        {
+            std::size_t index = 0;
+
+            while (index < size)
+            {
+                if constexpr (Encoding == encoding::utf8)
+                {
+                    if (index + swar::word_size <= size)
+                    {
+                        const swar::word_type word = swar::load_word(data + index);
+
+                        if (swar::is_ascii_word(word))
+                        {
+                            for (std::size_t i = 0; i < swar::word_size; ++i)
+                                *out++ = static_cast<U>((word >> (8U * i)) & 0xFFU);
+
+                            index += swar::word_size;
+                            continue;
+                        }
+                    }
+                }
+
+                const auto [code_point, length] = decode_valid_code_point<Encoding>(data + index);
+
+                *out++ = static_cast<U>(code_point);
+                index += length;
+            }
+        }
+
+        /// @brief Returns the number of `Encoding` code units that encode `code_points`.
+        ///
+        template<encoding Encoding, typename U>
+        [[nodiscard]] constexpr std::size_t encoded_size(const std::span<const U> code_points) noexcept
+        {
+            std::size_t size  = code_points.size();
+            std::size_t index = 0;
+
+            if constexpr (Encoding == encoding::utf8 && sizeof(U) == 1)
+            {
+                // Code points from U+0080 to U+00FF take two bytes, which is one extra byte for every byte with the most significant bit set.
+                for (; index + swar::word_size <= code_points.size(); index += swar::word_size)
+                    size += static_cast<std::size_t>(std::popcount(swar::load_word(code_points.data() + index) & swar::high_bits));
+            }
+
+            for (; index < code_points.size(); ++index)
+            {
+                const auto code_point = static_cast<std::uint32_t>(code_points[index]);
+
+                if constexpr (Encoding == encoding::utf8)
+                    size += (code_point >= 0x80U) + (code_point >= 0x800U) + (code_point >= 0x10000U);
+                else if constexpr (Encoding == encoding::utf16)
+                    size += (code_point >= 0x10000U);
+            }
+
+            return size;
+        }
+
+        /// @brief Encodes `code_points` into `out`, which has room for their `encoded_size<Encoding>` code units.
+        ///
+        /// Code points that are encoded as a single code unit are copied in bulk: every code point into UTF-32,
+        /// 1 and 2 byte storage into UTF-16, and runs of ASCII (found a word at a time) of 1 byte storage into UTF-8.
+        ///
+        template<encoding Encoding, typename U, typename T>
+        constexpr void encode_code_points(const std::span<const U> code_points, T* out) noexcept
+        {
+            const auto to_code_unit = [](const U code_point) static { return static_cast<T>(code_point); };
+
+            if constexpr (Encoding == encoding::utf32 || (Encoding == encoding::utf16 && sizeof(U) <= 2))
+            {
+                std::ranges::transform(code_points, out, to_code_unit);
+            }
+            else if constexpr (Encoding == encoding::utf8 && sizeof(U) == 1)
+            {
+                for (std::size_t index = 0; index < code_points.size();)
+                {
+                    const std::size_t ascii_length = swar::ascii_prefix_length(code_points.data() + index, code_points.size() - index);
+
+                    out = std::ranges::transform(code_points.subspan(index, ascii_length), out, to_code_unit).out;
+
+                    index += ascii_length;
+
+                    if (index < code_points.size())
+                        out += encode_valid_code_point<Encoding>(static_cast<std::uint32_t>(code_points[index++]), out);
+                }
+            }
+            else
+            {
+                for (const U code_point : code_points)
+                    out += encode_valid_code_point<Encoding>(static_cast<std::uint32_t>(code_point), out);
+            }
+        }
+
+        /// @brief Constructs a string from a container of valid `Encoding` code units, without copying them.
+        ///
+        template<encoding Encoding, typename Container>
+        [[nodiscard]] constexpr basic_ustring<Encoding, Container> adopt(Container&& container)
+        {
+            if constexpr (Encoding == encoding::utf8)
+                return basic_ustring<Encoding, Container>::from_utf8_unchecked(std::move(container));
+            else if constexpr (Encoding == encoding::utf16)
+                return basic_ustring<Encoding, Container>::from_utf16_unchecked(std::move(container));
+            else
+                return basic_ustring<Encoding, Container>::from_utf32_unchecked(std::move(container));
+        }
+    } // namespace impl::compact_string
+
+    /// @brief An immutable Unicode string that stores every code point in 1, 2 or 4 bytes, for constant time access by code point index.
+    ///
+    /// The width is the smallest one that fits the largest code point of the string, like in CPython's string objects (PEP 393):
+    /// - 1 byte if every code point is at most U+00FF (ASCII and Latin-1 text),
+    /// - 2 bytes if every code point is at most U+FFFF (text without supplementary code points),
+    /// - 4 bytes otherwise.
+    ///
+    /// Use it for APIs that index text by code points, like Python string offsets. Indexing a UTF-8 string by code points
+    /// needs a scan from the beginning, while `compact_ustring` indexes its code points directly. Latin text takes about as much memory as in UTF-8.
+    ///
+    /// The width is chosen when the string is created, from what validating (or scanning) the input finds,
+    /// so creating a `compact_ustring` takes two passes over the input. Converting it back to a `basic_ustring` allocates the exact size up front.
+    ///
+    /// `compact_ustring` is a random access range of `uchar`.
+    ///
+    /// @par Example
+    ///
+    /// @code{.cpp}
+    ///
+    /// using namespace upp::string_literals;
+    ///
+    /// const upp::compact_ustring string{u8"na\u00EFve caf\u00E9"_us};
+    ///
+    /// const upp::uchar ch = string[2];  // U+00EF, found without decoding the first two characters
+    /// const auto width    = string.width(); // 1 byte per code point
+    ///
+    /// const upp::ustring utf8 = string.substr(6).to_ustring(); // "caf\u00E9"
+    ///
+    /// @endcode
+    ///
+    /// @headerfile "" <uni-cpp/compact_string.hpp>
+    ///
+    class compact_ustring
+    {
+    public:
+        using value_type      = uchar;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        /// @brief Random access iterator over the code points of a `compact_ustring`.
+        ///
+        class iterator
+        {
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using value_type       = uchar;
+            using difference_type  = std::ptrdiff_t;
+
+            constexpr iterator() noexcept = default;
+
+            [[nodiscard]] constexpr uchar operator*() const noexcept { return (*m_string)[static_cast<size_type>(m_index)]; }
+
+            [[nodiscard]] constexpr uchar operator[](const difference_type offset) const noexcept
+            {
+                return (*m_string)[static_cast<size_type>(m_index + offset)];
+            }
+
+            constexpr iterator& operator++() noexcept
+            {
+                ++m_index;
+                return *this;
+            }
+
+            constexpr iterator operator++(int) noexcept
+            {
+                iterator copy = *this;
+                ++m_index;
+                return copy;
+            }
+
+            constexpr iterator& operator--() noexcept
+            {
+                --m_index;
+                return *this;
+            }
+
+            constexpr iterator operator--(int) noexcept
+            {
+                iterator copy = *this;
+                --m_index;
+                return copy;
+            }
+
+            constexpr iterator& operator+=(const difference_type offset) noexcept
+            {
+                m_index += offset;
+                return *this;
+            }
+
+            constexpr iterator& operator-=(const difference_type offset) noexcept
+            {
+                m_index -= offset;
+                return *this;
+            }
+
+            [[nodiscard]] friend constexpr iterator operator+(iterator it, const difference_type offset) noexcept { return it += offset; }
+            [[nodiscard]] friend constexpr iterator operator+(const difference_type offset, iterator it) noexcept { return it += offset; }
+            [[nodiscard]] friend constexpr iterator operator-(iterator it, const difference_type offset) noexcept { return it -= offset; }
+
+            [[nodiscard]] friend constexpr difference_type operator-(const iterator& x, const iterator& y) noexcept { return x.m_index - y.m_index; }
+
+            [[nodiscard]] friend constexpr bool operator==(const iterator& x, const iterator& y) noexcept { return x.m_index == y.m_index; }
+
+            [[nodiscard]] friend constexpr std::strong_ordering operator<=>(const iterator& x, const iterator& y) noexcept
+            {
+                return x.m_index <=> y.m_index;
+            }
+
+        private:
+            friend compact_ustring;
+
+            constexpr iterator(const compact_ustring* string, const difference_type index) noexcept
+                : m_string(string), m_index(index)
+            {
+            }
+
+        private:
+            const compact_ustring* m_string = nullptr;
+            difference_type        m_index  = 0;
+        };
+
+        using const_iterator = iterator;
+
+        /// @brief Special value. The exact meaning depends on the context.
+        ///
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+    public:
+        /// @brief Constructs an empty string.
+        ///
+        constexpr compact_ustring() noexcept = default;
+
+        /// @brief Constructs the string with the code points of `string`.
+        ///
+        /// The string is scanned once to find the width, skipping ASCII a word at a time in UTF-8,
+        /// and then decoded directly into the storage. If the underlying container caches metadata about the text
+        /// (like `with_text_metadata`), ASCII strings are not scanned.
+        ///
+        template<encoding Encoding, string_compatible_container<Encoding> Container>
+            requires unicode_encoding<Encoding>
+        explicit constexpr compact_ustring(const basic_ustring<Encoding, Container>& string)
+        {
+            const auto code_units = string.code_units();
+
+            impl::compact_string::code_unit_summary<Encoding> summary;
+
+            if constexpr (impl::text_metadata_container<Container>)
+            {
+                if (string.is_ascii())
+                    summary.code_point_count = code_units.size();
+                else
+                    summary = impl::compact_string::summarize<Encoding>(code_units.data(), code_units.size());
+            }
+            else
+            {
+                summary = impl::compact_string::summarize<Encoding>(code_units.data(), code_units.size());
+            }
+
+            assign_valid<Encoding>(code_units.data(), code_units.size(), summary);
+        }
+
+        /// @brief Constructs a `compact_ustring` from UTF-8 encoded data with error checking.
+        ///
+        /// The width is determined while validating, from the largest leading byte, so the input is read twice in total.
+        ///
+        /// @return `std::expected` containing the string on success, or a `from_utf8_error` on failure.
+        ///
+        template<std::ranges::contiguous_range Range>
+            requires std::ranges::sized_range<Range> && ranges::code_unit_range_for<Range, encoding::utf8>
+        [[nodiscard]] static constexpr std::expected<compact_ustring, from_utf8_error> from_utf8(Range&& range)
+        {
+            return from_utf<encoding::utf8, from_utf8_error>(range);
+        }
+
+        /// @brief Constructs a `compact_ustring` from UTF-16 encoded data with error checking.
+        ///
+        /// @return `std::expected` containing the string on success, or a `from_utf16_error` on failure.
+        ///
+        template<std::ranges::contiguous_range Range>
+            requires std::ranges::sized_range<Range> && ranges::code_unit_range_for<Range, encoding::utf16>
+        [[nodiscard]] static constexpr std::expected<compact_ustring, from_utf16_error> from_utf16(Range&& range)
+        {
+            return from_utf<encoding::utf16, from_utf16_error>(range);
+        }
+
+        /// @brief Constructs a `compact_ustring` from UTF-32 encoded data with error checking.
+        ///
+        /// @return `std::expected` containing the string on success, or a `from_utf32_error` on failure.
+        ///
+        template<std::ranges::contiguous_range Range>
+            requires std::ranges::sized_range<Range> && ranges::code_unit_range_for<Range, encoding::utf32>
+        [[nodiscard]] static constexpr std::expected<compact_ustring, from_utf32_error> from_utf32(Range&& range)
+        {
+            return from_utf<encoding::utf32, from_utf32_error>(range);
+        }
+
+        /// @brief Returns the number of code points in the string.
+        ///
+        [[nodiscard]] constexpr size_type size() const noexcept
+        {
+            return std::visit([](const auto& code_points) static { return code_points.size(); }, m_code_points);
+        }
+
+        /// @brief Checks whether the string is empty.
+        ///
+        [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+        /// @brief Returns the number of bytes used to store every code point: 1, 2 or 4.
+        ///
+        [[nodiscard]] constexpr size_type width() const noexcept
+        {
+            return std::visit([](const auto& code_points) static { return sizeof(code_points[0]); }, m_code_points);
+        }
+
+        /// @brief Returns the code point at `index`. O(1).
+        ///
+        /// @pre `index < size()`
+        ///
+        [[nodiscard]] constexpr uchar operator[](const size_type index) const noexcept
+        {
+            return uchar::from_unchecked(
+                std::visit([index](const auto& code_points) { return static_cast<std::uint32_t>(code_points[index]); }, m_code_points));
+        }
+
+        /// @brief Returns the code point at `index`. O(1).
+        ///
+        /// @throws std::out_of_range if `index >= size()`.
+        ///
+        [[nodiscard]] constexpr uchar at(const size_type index) const
+        {
+            if (index >= size())
+                throw std::out_of_range("upp::compact_ustring::at: index out of range");
+
+            return (*this)[index];
+        }
+
+        /// @brief Returns the first code point.
+        ///
+        /// @pre `!empty()`
+        ///
+        [[nodiscard]] constexpr uchar front() const noexcept { return (*this)[0]; }
+
+        /// @brief Returns the last code point.
+        ///
+        /// @pre `!empty()`
+        ///
+        [[nodiscard]] constexpr uchar back() const noexcept { return (*this)[size() - 1]; }
+
+        [[nodiscard]] constexpr iterator begin() const noexcept { return iterator{this, 0}; }
+
+        [[nodiscard]] constexpr iterator end() const noexcept { return iterator{this, static_cast<difference_type>(size())}; }
+
+        /// @brief Returns a random access view of the code points of the string.
+        ///
+        [[nodiscard]] constexpr std::ranges::subrange<iterator> chars() const noexcept { return {begin(), end()}; }
+
+        /// @brief Returns the code points `[pos, pos + count)`, or `[pos, size())` if the string is shorter.
+        ///
+        /// The result is stored with the same width as this string.
+        ///
+        /// @throws std::out_of_range if `pos > size()`.
+        ///
+        [[nodiscard]] constexpr compact_ustring substr(const size_type pos, const size_type count = npos) const
+        {
+            const size_type string_size = size();
+
+            if (pos > string_size)
+                throw std::out_of_range("upp::compact_ustring::substr: pos out of range");
+
+            const size_type length = std::min(count, string_size - pos);
+
+            compact_ustring result;
+
+            std::visit(
+                [&](const auto& code_points) {
+                    using storage_type = std::remove_cvref_t<decltype(code_points)>;
+
+                    const auto first = code_points.begin() + static_cast<difference_type>(pos);
+
+                    result.m_code_points.emplace<storage_type>(first, first + static_cast<difference_type>(length));
+                },
+                m_code_points);
+
+            return result;
+        }
+
+        /// @brief Returns the string encoded in `Encoding`, stored in a `Container`.
+        ///
+        /// The encoded size is computed first (a word at a time for text stored with 1 byte per code point),
+        /// then the container is resized once and the code units are written into it directly.
+        /// Code points that take a single code unit are copied in bulk, including runs of ASCII into UTF-8.
+        /// Containers that cache metadata about their text (like `with_text_metadata`) are appended to instead, to keep the metadata.
+        ///
+        /// @tparam Encoding The encoding of the result. Default value is `encoding::utf8`.
+        /// @tparam Container The underlying container of the result.
+        ///         Default value is `std::basic_string<typename encoding_traits<Encoding>::default_code_unit_type>`.
+        ///
+        template<encoding Encoding = encoding::utf8,
+                 string_compatible_container<Encoding> Container = std::basic_string<typename encoding_traits<Encoding>::default_code_unit_type>>
+            requires unicode_encoding<Encoding>
+        [[nodiscard]] constexpr basic_ustring<Encoding, Container> to_ustring() const
+        {
+            return std::visit(
+                [](const auto& code_points) {
+                    using code_unit_type = Container::value_type;
+                    using size_type      = Container::size_type;
+
+                    const std::span code_points_span{code_points};
+
+                    const std::size_t size = impl::compact_string::encoded_size<Encoding>(code_points_span);
+
+                    Container container;
+
+                    if constexpr (impl::text_metadata_container<Container>)
+                    {
+                        if constexpr (impl::reserves_for_size_hint<Container>)
+                            container.reserve(static_cast<size_type>(size));
+
+                        for (const auto code_point : code_points_span)
+                        {
+                            std::array<code_unit_type, 4> code_units{};
+
+                            const std::size_t length = impl::encode_valid_code_point<Encoding>(static_cast<std::uint32_t>(code_point), code_units.data());
+
+                            container.insert(std::as_const(container).end(), code_units.data(), code_units.data() + length);
+                        }
+                    }
+                    else if constexpr (requires { container.resize_and_overwrite(size_type{}, [](code_unit_type*, size_type n) { return n; }); })
+                    {
+                        container.resize_and_overwrite(static_cast<size_type>(size), [&](code_unit_type* const out, const size_type n) {
+                            impl::compact_string::encode_code_points<Encoding>(code_points_span, out);
+                            return n;
+                        });
+                    }
+                    else
+                    {
+                        container.insert(std::as_const(container).end(), static_cast<size_type>(size), code_unit_type{});
+
+                        impl::compact_string::encode_code_points<Encoding>(code_points_span, container.data());
+                    }
+
+                    return impl::compact_string::adopt<Encoding>(std::move(container));
+                },
+                m_code_points);
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const compact_ustring& x, const compact_ustring& y) noexcept
+        {
+            return std::visit(
+                [](const auto& x_code_points, const auto& y_code_points) static { return std::ranges::equal(x_code_points, y_code_points); },
+                x.m_code_points, y.m_code_points);
+        }
+
+        /// @brief Compares the strings lexicographically by their code points.
+        ///
+        [[nodiscard]] friend constexpr std::strong_ordering operator<=>(const compact_ustring& x, const compact_ustring& y) noexcept
+        {
+            return std::visit(
+                [](const auto& x_code_points, const auto& y_code_points) static {
+                    return std::lexicographical_compare_three_way(x_code_points.begin(), x_code_points.end(), y_code_points.begin(),
+                                                                  y_code_points.end());
+                },
+                x.m_code_points, y.m_code_points);
+        }
+
+    private:
+        template<encoding Encoding, typename T>
+        constexpr void assign_valid(const T* data, const std::size_t size, const impl::compact_string::code_unit_summary<Encoding>& summary)
+        {
+            const auto decode = [&](auto& code_points) { impl::compact_string::decode_into<Encoding>(data, size, code_points.data()); };
+
+            switch (summary.width())
+            {
+            case 1:
+                decode(m_code_points.emplace<0>(summary.code_point_count));
+                break;
+            case 2:
+                decode(m_code_points.emplace<1>(summary.code_point_count));
+                break;
+            default:
+                decode(m_code_points.emplace<2>(summary.code_point_count));
+                break;
+            }
+        }
+
+        template<encoding Encoding, typename ErrorType, typename Range>
+        [[nodiscard]] static constexpr std::expected<compact_ustring, ErrorType> from_utf(Range& range)
+        {
+            using default_code_unit_type = encoding_traits<Encoding>::default_code_unit_type;
+
+            impl::compact_string::code_unit_summary<Encoding> summary;
+
+            auto expected = encoding_traits<Encoding>::validate_range(
+                range, [&](const default_code_unit_type code_unit) { summary.add(static_cast<std::uint32_t>(code_unit)); });
+
+            if (!expected.has_value())
+                return std::expected<compact_ustring, ErrorType>{std::unexpect, std::move(expected).error()};
+
+            compact_ustring result;
+
+            result.assign_valid<Encoding>(std::ranges::data(range), static_cast<std::size_t>(std::ranges::size(range)), summary);
+
+            return result;
+        }
+
+    private:
+        std::variant<std::vector<std::uint8_t>, std::vector<char16_t>, std::vector<char32_t>> m_code_points;
+    };
+} // namespace upp
+
+#endif // UNI_CPP_COMPACT_STRING_HPP
\ No newline at end of file
@@ -0,0 +1,348 @@
+#ifndef UNI_CPP_COMPARE_HPP
+#define UNI_CPP_COMPARE_HPP
+
+/// @file
+///
+/// @brief Equality and code point order comparison of text in any pair of encodings, without transcoding.
+///
+
+#include "encoding.hpp"
+#include "ranges.hpp"
+#include "string.hpp"
+#include "impl/swar.hpp"
+#include "impl/search.hpp"
+#include "impl/decode_valid.hpp"
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <bit>
+
+namespace upp
+{
+    namespace impl::compare
+    {
+        /// ASCII is decoded as UTF-8, which it's a subset of.
+        template<encoding Encoding>
+        inline constexpr encoding decoded_as = Encoding == encoding::ascii ? encoding::utf8 : Encoding;
+
+        /// @brief Packs the low bytes of the four 16 bit lanes of `word` into the low 32 bits.
+        ///
+        [[nodiscard]] constexpr swar::word_type pack_16_bit_lanes(const swar::word_type word) noexcept
+        {
+            const swar::word_type pairs = (word | (word >> 8U)) & 0x0000'FFFF'0000'FFFFULL;
+
+            return (pairs | (pairs >> 16U)) & 0xFFFF'FFFFULL;
+        }
+
+        /// @brief Packs the low bytes of the two 32 bit lanes of `word` into the low 16 bits.
+        ///
+        [[nodiscard]] constexpr swar::word_type pack_32_bit_lanes(const swar::word_type word) noexcept
+        {
+            return (word | (word >> 24U)) & 0xFFFFULL;
+        }
+
+        /// @brief Loads `swar::word_size` code units starting at `ptr` as one byte each, if all of them are ASCII.
+        ///
+        /// @return `false` if any of the code units is not ASCII, in which case `bytes` is unspecified.
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr bool load_ascii_block(const T* ptr, swar::word_type& bytes) noexcept
+        {
+            if constexpr (sizeof(T) == 1)
+            {
+                bytes = swar::load_word(ptr);
+
+                return swar::is_ascii_word(bytes);
+            }
+            else if constexpr (sizeof(T) == 2)
+            {
+                constexpr swar::word_type non_ascii = 0xFF80'FF80'FF80'FF80ULL;
+
+                const swar::word_type low  = search::load_lanes(ptr);
+                const swar::word_type high = search::load_lanes(ptr + 4);
+
+                if (((low | high) & non_ascii) != 0)
+                    return false;
+
+                bytes = pack_16_bit_lanes(low) | (pack_16_bit_lanes(high) << 32U);
+
+                return true;
+            }
+            else
+            {
+                constexpr swar::word_type non_ascii = 0xFFFF'FF80'FFFF'FF80ULL;
+
+                bytes = 0;
+
+                for (std::size_t i = 0; i < 4; ++i)
+                {
+                    const swar::word_type word = search::load_lanes(ptr + 2 * i);
+
+                    if ((word & non_ascii) != 0)
+                        return false;
+
+                    bytes |= pack_32_bit_lanes(word) << (16U * i);
+                }
+
+                return true;
+            }
+        }
+
+        /// @brief Compares two contiguous sequences in the same encoding by their code units.
+        ///
+        /// Code unit order is code point order in UTF-8 and UTF-32. In UTF-16 it differs only for a mismatch between a surrogate
+        /// and a code unit in `[0xE000, 0xFFFF]`; moving the latter below the surrogates fixes the order without decoding anything.
+        ///
+        template<encoding Encoding, typename T, typename U>
+        [[nodiscard]] constexpr std::strong_ordering compare_code_units(const T* x, const std::size_t x_size, const U* y,
+                                                                        const std::size_t y_size) noexcept
+        {
+            using lane = search::lanes<sizeof(T)>;
+
+            const std::size_t size = std::min(x_size, y_size);
+
+            std::size_t index = 0;
+
+            for (; index + lane::count <= size; index += lane::count)
+            {
+                const swar::word_type difference = search::load_lanes(x + index) ^ search::load_lanes(y + index);
+
+                if (difference != 0)
+                {
+                    index += static_cast<std::size_t>(std::countr_zero(difference)) / lane::bits;
+                    break;
+                }
+            }
+
+            for (; index < size; ++index)
+            {
+                if (search::code_unit_value(x[index]) != search::code_unit_value(y[index]))
+                    break;
+            }
+
+            if (index == size)
+                return x_size <=> y_size;
+
+            auto x_code_unit = search::code_unit_value(x[index]);
+            auto y_code_unit = search::code_unit_value(y[index]);
+
+            if constexpr (Encoding == encoding::utf16)
+            {
+                if (x_code_unit >= 0xD800U && y_code_unit >= 0xD800U)
+                {
+                    // Valid UTF-16 has no unpaired surrogates, so every code unit in `[0xD800, 0xDFFF]` belongs to a supplementary code point.
+                    x_code_unit -= x_code_unit >= 0xE000U ? 0x2800U : 0U;
+                    y_code_unit -= y_code_unit >= 0xE000U ? 0x2800U : 0U;
+                }
+            }
+
+            return x_code_unit <=> y_code_unit;
+        }
+
+        /// @brief Compares two contiguous sequences in different encodings by their code points.
+        ///
+        /// While both sides are ASCII, a word of code units of each side is compared at once.
+        ///
+        template<encoding XEncoding, encoding YEncoding, typename T, typename U>
+        [[nodiscard]] constexpr std::strong_ordering compare_code_points(const T* x, const std::size_t x_size, const U* y,
+                                                                         const std::size_t y_size) noexcept
+        {
+            std::size_t x_index = 0;
+            std::size_t y_index = 0;
+
+            while (true)
+            {
+                while (x_index + swar::word_size <= x_size && y_index + swar::word_size <= y_size)
+                {
+                    swar::word_type x_bytes = 0;
+                    swar::word_type y_bytes = 0;
+
+                    if (!load_ascii_block(x + x_index, x_bytes) || !load_ascii_block(y + y_index, y_bytes))
+                        break;
+
+                    if (x_bytes != y_bytes)
+                    {
+                        const auto shift = static_cast<unsigned>(std::countr_zero(x_bytes ^ y_bytes)) & ~7U;
+
+                        return ((x_bytes >> shift) & 0xFFU) <=> ((y_bytes >> shift) & 0xFFU);
+                    }
+
+                    x_index += swar::word_size;
+                    y_index += swar::word_size;
+                }
+
+                if (x_index == x_size || y_index == y_size)
+                    return (x_index == x_size ? 0 : 1) <=> (y_index == y_size ? 0 : 1);
+
+                const auto [x_code_point, x_length] = decode_valid_code_point<decoded_as<XEncoding>>(x + x_index);
+                const auto [y_code_point, y_length] = decode_valid_code_point<decoded_as<YEncoding>>(y + y_index);
+
+                if (x_code_point != y_code_point)
+                    return x_code_point <=> y_code_point;
+
+                x_index += x_length;
+                y_index += y_length;
+            }
+        }
+
+        template<encoding XEncoding, encoding YEncoding, std::input_iterator XIt, std::sentinel_for<XIt> XSentinel, std::input_iterator YIt,
+                 std::sentinel_for<YIt> YSentinel>
+        [[nodiscard]] constexpr std::strong_ordering compare_code_points(XIt x, const XSentinel x_end, YIt y, const YSentinel y_end)
+        {
+            for (; x != x_end && y != y_end;)
+            {
+                const std::uint32_t x_code_point = decode_valid_code_point_and_advance<decoded_as<XEncoding>>(x);
+                const std::uint32_t y_code_point = decode_valid_code_point_and_advance<decoded_as<YEncoding>>(y);
+
+                if (x_code_point != y_code_point)
+                    return x_code_point <=> y_code_point;
+            }
+
+            return (x == x_end ? 0 : 1) <=> (y == y_end ? 0 : 1);
+        }
+
+        template<typename Range>
+        inline constexpr bool is_contiguous_sized = std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range>;
+
+        template<encoding XEncoding, encoding YEncoding, typename XRange, typename YRange>
+        [[nodiscard]] constexpr std::strong_ordering compare(XRange&& x, YRange&& y)
+        {
+            if constexpr (is_contiguous_sized<XRange> && is_contiguous_sized<YRange>)
+            {
+                const auto* const x_data = std::ranges::data(x);
+                const auto* const y_data = std::ranges::data(y);
+                const auto        x_size = static_cast<std::size_t>(std::ranges::size(x));
+                const auto        y_size = static_cast<std::size_t>(std::ranges::size(y));
+
+                if constexpr (decoded_as<XEncoding> == decoded_as<YEncoding>)
+                    return compare_code_units<decoded_as<XEncoding>>(x_data, x_size, y_data, y_size);
+                else
+                    return compare_code_points<XEncoding, YEncoding>(x_data, x_size, y_data, y_size);
+            }
+            else
+            {
+                return compare_code_points<XEncoding, YEncoding>(std::ranges::begin(x), std::ranges::end(x), std::ranges::begin(y),
+                                                                 std::ranges::end(y));
+            }
+        }
+
+        template<encoding XEncoding, encoding YEncoding, typename XRange, typename YRange>
+        [[nodiscard]] constexpr bool equal(XRange&& x, YRange&& y)
+        {
+            if constexpr (decoded_as<XEncoding> == decoded_as<YEncoding> && std::ranges::sized_range<XRange> && std::ranges::sized_range<YRange>)
+            {
+                // The same code points are encoded with the same code units.
+                if (static_cast<std::size_t>(std::ranges::size(x)) != static_cast<std::size_t>(std::ranges::size(y)))
+                    return false;
+            }
+
+            return compare<XEncoding, YEncoding>(x, y) == 0;
+        }
+    } // namespace impl::compare
+
+    /// @brief Checks whether two valid code unit sequences, in any two encodings, consist of the same code points.
+    ///
+    /// Neither side is transcoded. Sequences in the same encoding are compared a word of code units at a time.
+    /// Contiguous sequences in different encodings are compared a word of code units at a time while both are ASCII,
+    /// and are decoded one code point at a time otherwise.
+    ///
+    /// The code points are compared as they are; canonically equivalent sequences in different normalization forms are
+    /// not equal. Normalize both sides first (see `basic_ustring::normalize`) to compare them for canonical equivalence.
+    ///
+    /// @tparam XEncoding The encoding of `x`.
+    /// @tparam YEncoding The encoding of `y`.
+    ///
+    /// @par Example
+    ///
+    /// @code{.cpp}
+    ///
+    /// using namespace std::string_view_literals;
+    ///
+    /// const bool same = upp::equal<upp::encoding::utf8, upp::encoding::utf16>(u8"Gr\u00FC\u00DFe"sv | upp::views::mark_as_valid_utf8,
+    ///                                                                         u"Gr\u00FC\u00DFe"sv | upp::views::mark_as_valid_utf16); // true
+    ///
+    /// @endcode
+    ///
+    /// @see compare
+    ///
+    /// @headerfile "" <uni-cpp/compare.hpp>
+    ///
+    template<encoding XEncoding, encoding YEncoding, std::ranges::input_range XRange, std::ranges::input_range YRange>
+        requires ranges::valid_code_unit_range<XRange, XEncoding> && ranges::valid_code_unit_range<YRange, YEncoding>
+    [[nodiscard]] constexpr bool equal(XRange&& x, YRange&& y)
+    {
+        return impl::compare::equal<XEncoding, YEncoding>(x, y);
+    }
+
+    /// @brief Checks whether two strings, in any two encodings, consist of the same code points.
+    ///
+    /// @copydetails equal(XRange&&, YRange&&)
+    ///
+    /// @headerfile "" <uni-cpp/compare.hpp>
+    ///
+    template<encoding XEncoding, string_compatible_container<XEncoding> XContainer, encoding YEncoding,
+             string_compatible_container<YEncoding> YContainer>
+    [[nodiscard]] constexpr bool equal(const basic_ustring<XEncoding, XContainer>& x, const basic_ustring<YEncoding, YContainer>& y) noexcept
+    {
+        return impl::compare::equal<XEncoding, YEncoding>(x.code_units(), y.code_units());
+    }
+
+    /// @brief Compares two valid code unit sequences, in any two encodings, lexicographically by their code points.
+    ///
+    /// Unlike comparing UTF-16 code units (e.g. `std::u16string`'s `operator<=>`), the result is the same in every encoding:
+    /// supplementary code points sort after all code points of the Basic Multilingual Plane. Two UTF-16 sequences are compared
+    /// by their code units, with a fix-up of the first mismatching pair that avoids decoding anything.
+    ///
+    /// Neither side is transcoded. See `equal` for how the sequences are scanned.
+    ///
+    /// @tparam XEncoding The encoding of `x`.
+    /// @tparam YEncoding The encoding of `y`.
+    ///
+    /// @return `std::strong_ordering::less` if `x` is ordered before `y`, `std::strong_ordering::greater` if it's ordered after it,
+    ///         `std::strong_ordering::equal` otherwise.
+    ///
+    /// @par Example
+    ///
+    /// @code{.cpp}
+    ///
+    /// using namespace std::string_view_literals;
+    ///
+    /// // U+FF61 HALFWIDTH IDEOGRAPHIC FULL STOP vs. U+1F600 GRINNING FACE
+    /// const auto x = u"\uFF61"sv | upp::views::mark_as_valid_utf16;
+    /// const auto y = u"\U0001F600"sv | upp::views::mark_as_valid_utf16;
+    ///
+    /// upp::compare<upp::encoding::utf16, upp::encoding::utf16>(x, y); // std::strong_ordering::less, although 0xFF61 > 0xD83D
+    ///
+    /// @endcode
+    ///
+    /// @see equal
+    ///
+    /// @headerfile "" <uni-cpp/compare.hpp>
+    ///
+    template<encoding XEncoding, encoding YEncoding, std::ranges::input_range XRange, std::ranges::input_range YRange>
+        requires ranges::valid_code_unit_range<XRange, XEncoding> && ranges::valid_code_unit_range<YRange, YEncoding>
+    [[nodiscard]] constexpr std::strong_ordering compare(XRange&& x, YRange&& y)
+    {
+        return impl::compare::compare<XEncoding, YEncoding>(x, y);
+    }
+
+    /// @brief Compares two strings, in any two encodings, lexicographically by their code points.
+    ///
+    /// @copydetails compare(XRange&&, YRange&&)
+    ///
+    /// @headerfile "" <uni-cpp/compare.hpp>
+    ///
+    template<encoding XEncoding, string_compatible_container<XEncoding> XContainer, encoding YEncoding,
+             string_compatible_container<YEncoding> YContainer>
+    [[nodiscard]] constexpr std::strong_ordering compare(const basic_ustring<XEncoding, XContainer>& x,
+                                                         const basic_ustring<YEncoding, YContainer>& y) noexcept
+    {
+        return impl::compare::compare<XEncoding, YEncoding>(x.code_units(), y.code_units());
+    }
+} // namespace upp
+
+#endif // UNI_CPP_COMPARE_HPP
\ No newline at end of file
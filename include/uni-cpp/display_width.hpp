@@ -0,0 +1,273 @@
+#ifndef UNI_CPP_DISPLAY_WIDTH_HPP
+#define UNI_CPP_DISPLAY_WIDTH_HPP
+
+/// @file
+///
+/// @brief Measuring and truncating text by the number of terminal columns it occupies.
+///
+/// The width of every code point is `uchar::display_width()`, which follows the conventions of POSIX `wcwidth()`
+/// for the supported Unicode version: combining marks and other zero width characters take no columns,
+/// wide and fullwidth East Asian characters and emoji take two columns, and all other characters take one column.
+///
+
+#include "uchar.hpp"
+#include "encoding.hpp"
+#include "ranges.hpp"
+#include "string.hpp"
+#include "impl/swar.hpp"
+#include "impl/decode_valid.hpp"
+#include "impl/unicode_data/display_width.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <bit>
+
+namespace upp
+{
+    namespace impl::display_width
+    {
+        namespace data = unicode_data::display_width;
+
+        /// @brief Returns the width of an ASCII code point: 0 for control characters, 1 for everything else.
+        ///
+        [[nodiscard]] constexpr std::size_t ascii_width(const std::uint32_t code_point) noexcept
+        {
+            return code_point >= 0x20U && code_point != 0x7FU ? 1uz : 0uz;
+        }
+
+        [[nodiscard]] constexpr std::size_t code_point_width(const std::uint32_t code_point) noexcept
+        {
+            if (code_point < 0x80U)
+                return ascii_width(code_point);
+
+            return data::lookup_display_width(code_point);
+        }
+
+        /// @brief Returns the total width of a word of ASCII bytes.
+        ///
+        /// Adding `0x60` to a byte sets its most significant bit if the byte is at least `0x20` (not a C0 control character),
+        /// and adding `0x01` sets it only for `0x7F` (DELETE). Neither addition can carry into the next byte of an ASCII word.
+        ///
+        [[nodiscard]] constexpr std::size_t ascii_word_width(const swar::word_type word) noexcept
+        {
+            constexpr swar::word_type ones = 0x0101'0101'0101'0101ULL;
+
+            const swar::word_type not_c0_control = (word + 0x60U * ones) & swar::high_bits;
+            const swar::word_type is_delete      = (word + ones) & swar::high_bits;
+
+            return static_cast<std::size_t>(std::popcount(not_c0_control & ~is_delete));
+        }
+
+        template<typename T>
+            requires(sizeof(T) == 1)
+        [[nodiscard]] constexpr std::size_t utf8_display_width(const T* code_units, const std::size_t size) noexcept
+        {
+            std::size_t width = 0;
+            std::size_t index = 0;
+
+            while (index < size)
+            {
+                if (index + swar::word_size <= size)
+                {
+                    const swar::word_type word = swar::load_word(code_units + index);
+
+                    if (swar::is_ascii_word(word))
+                    {
+                        width += ascii_word_width(word);
+                        index += swar::word_size;
+                        continue;
+                    }
+                }
+
+                const auto [code_point, length] = decode_valid_code_point<encoding::utf8>(code_units + index);
+
+                width += code_point_width(code_point);
+                index += length;
+            }
+
+            return width;
+        }
+
+        template<typename T>
+            requires(sizeof(T) == 1)
+        [[nodiscard]] constexpr std::size_t utf8_truncate_to_width(const T* code_units, const std::size_t size, const std::size_t max_width) noexcept
+        {
+            std::size_t width = 0;
+            std::size_t index = 0;
+
+            while (index < size)
+            {
+                // Every ASCII character is at most one column wide, so a whole word of ASCII fits if there are enough columns left.
+                if (index + swar::word_size <= size && max_width - width >= swar::word_size)
+                {
+                    const swar::word_type word = swar::load_word(code_units + index);
+
+                    if (swar::is_ascii_word(word))
+                    {
+                        width += ascii_word_width(word);
+                        index += swar::word_size;
+                        continue;
+                    }
+                }
+
+                const auto [code_point, length] = decode_valid_code_point<encoding::utf8>(code_units + index);
+
+                const std::size_t columns = code_point_width(code_point);
+
+                if (max_width - width < columns)
+                    return index;
+
+                width += columns;
+                index += length;
+            }
+
+            return size;
+        }
+
+        template<encoding Encoding, std::input_iterator It, std::sentinel_for<It> Sentinel>
+        [[nodiscard]] constexpr std::size_t display_width(It it, const Sentinel end)
+        {
+            std::size_t width = 0;
+
+            while (it != end)
+                width += code_point_width(decode_valid_code_point_and_advance<Encoding>(it));
+
+            return width;
+        }
+
+        template<encoding Encoding, std::forward_iterator It, std::sentinel_for<It> Sentinel>
+        [[nodiscard]] constexpr std::size_t truncate_to_width(It it, const Sentinel end, const std::size_t max_width)
+        {
+            std::size_t width  = 0;
+            std::size_t offset = 0;
+
+            while (it != end)
+            {
+                It next = it;
+
+                const std::size_t columns = code_point_width(decode_valid_code_point_and_advance<Encoding>(next));
+
+                if (max_width - width < columns)
+                    break;
+
+                width += columns;
+                offset += static_cast<std::size_t>(std::ranges::distance(it, next));
+                it = next;
+            }
+
+            return offset;
+        }
+
+        template<encoding Encoding, typename Range>
+        inline constexpr bool has_utf8_fast_path = (Encoding == encoding::ascii || Encoding == encoding::utf8) &&
+                                                   std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range>;
+    } // namespace impl::display_width
+
+    /// @brief Returns the number of terminal columns that a valid `Encoding` code unit sequence occupies.
+    ///
+    /// The result is the sum of `uchar::display_width()` of every code point, which is what terminals
+    /// and `wcswidth()` compute. Use it to align columns of text that mixes ASCII, CJK characters and emoji.
+    ///
+    /// Contiguous ASCII and UTF-8 ranges are measured a word at a time while the text is ASCII.
+    ///
+    /// @tparam Encoding The encoding of the code units.
+    ///
+    /// @par Example
+    ///
+    /// @code{.cpp}
+    ///
+    /// using namespace std::string_view_literals;
+    ///
+    /// // "ab", two CJK ideographs and "e" followed by U+0301 COMBINING ACUTE ACCENT
+    /// const auto width = upp::display_width<upp::encoding::utf8>(u8"ab\u4E16\u754Ce\u0301"sv | upp::views::mark_as_valid_utf8); // 7
+    ///
+    /// @endcode
+    ///
+    /// @see truncate_to_width, uchar::display_width
+    ///
+    /// @headerfile "" <uni-cpp/display_width.hpp>
+    ///
+    template<encoding Encoding, std::ranges::input_range Range>
+        requires ranges::valid_code_unit_range<Range, Encoding>
+    [[nodiscard]] constexpr std::size_t display_width(Range&& range)
+    {
+        if constexpr (impl::display_width::has_utf8_fast_path<Encoding, Range>)
+            return impl::display_width::utf8_display_width(std::ranges::data(range), static_cast<std::size_t>(std::ranges::size(range)));
+        else
+            return impl::display_width::display_width<Encoding>(std::ranges::begin(range), std::ranges::end(range));
+    }
+
+    /// @brief Returns the number of terminal columns that a string occupies.
+    ///
+    /// @copydetails display_width(Range&&)
+    ///
+    /// @headerfile "" <uni-cpp/display_width.hpp>
+    ///
+    template<encoding Encoding, string_compatible_container<Encoding> Container>
+    [[nodiscard]] constexpr std::size_t display_width(const basic_ustring<Encoding, Container>& string) noexcept
+    {
+        const auto code_units = string.code_units();
+
+        if constexpr (Encoding == encoding::ascii || Encoding == encoding::utf8)
+            return impl::display_width::utf8_display_width(code_units.data(), code_units.size());
+        else
+            return impl::display_width::display_width<Encoding>(code_units.begin(), code_units.end());
+    }
+
+    /// @brief Returns the length (in code units) of the longest prefix of a valid `Encoding` code unit sequence that fits into `max_width` columns.
+    ///
+    /// Code points are never split. Zero width code points that follow the last code point that fits (like combining marks)
+    /// are a part of the prefix, because they don't need any more columns.
+    ///
+    /// The scan stops at the first code point that doesn't fit, so the rest of the sequence is never decoded.
+    /// Contiguous ASCII and UTF-8 ranges are scanned a word at a time while the text is ASCII.
+    ///
+    /// @tparam Encoding The encoding of the code units.
+    ///
+    /// @param range Range of valid `Encoding` code units.
+    /// @param max_width The number of available columns.
+    ///
+    /// @return The number of code units of the prefix, or the size of `range` if the whole sequence fits.
+    ///
+    /// @note Truncating the text this way can separate a base character from a following spacing mark or
+    ///       split an emoji sequence. Use @ref upp::views::graphemes "views::graphemes" to truncate at grapheme cluster boundaries.
+    ///
+    /// @see display_width, uchar::display_width
+    ///
+    /// @headerfile "" <uni-cpp/display_width.hpp>
+    ///
+    template<encoding Encoding, std::ranges::forward_range Range>
+        requires ranges::valid_code_unit_range<Range, Encoding>
+    [[nodiscard]] constexpr std::size_t truncate_to_width(Range&& range, const std::size_t max_width)
+    {
+        if constexpr (impl::display_width::has_utf8_fast_path<Encoding, Range>)
+        {
+            const auto size = static_cast<std::size_t>(std::ranges::size(range));
+
+            return impl::display_width::utf8_truncate_to_width(std::ranges::data(range), size, max_width);
+        }
+        else
+            return impl::display_width::truncate_to_width<Encoding>(std::ranges::begin(range), std::ranges::end(range), max_width);
+    }
+
+    /// @brief Returns the length (in code units) of the longest prefix of a string that fits into `max_width` columns.
+    ///
+    /// @copydetails truncate_to_width(Range&&, std::size_t)
+    ///
+    /// @headerfile "" <uni-cpp/display_width.hpp>
+    ///
+    template<encoding Encoding, string_compatible_container<Encoding> Container>
+    [[nodiscard]] constexpr std::size_t truncate_to_width(const basic_ustring<Encoding, Container>& string, const std::size_t max_width) noexcept
+    {
+        const auto code_units = string.code_units();
+
+        if constexpr (Encoding == encoding::ascii || Encoding == encoding::utf8)
+            return impl::display_width::utf8_truncate_to_width(code_units.data(), code_units.size(), max_width);
+        else
+            return impl::display_width::truncate_to_width<Encoding>(code_units.begin(), code_units.end(), max_width);
+    }
+} // namespace upp
+
+#endif // UNI_CPP_DISPLAY_WIDTH_HPP
\ No newline at end of file
@@ -0,0 +1,413 @@
+#ifndef UNI_CPP_FORMAT_HPP
+#define UNI_CPP_FORMAT_HPP
+
+/// @file
+///
+/// @brief Provides `std::formatter` specializations for the uni-cpp string and character types.
+///
+/// All of them format into `char` output as UTF-8. The format specification is `[[fill]align][width][.precision][s]`
+/// (`[c]` instead of `[s]` for characters, which take no precision), where width and precision are counted in code points.
+/// Width and precision can also be passed as arguments (`{:{}}`, `{:.{2}}`). Text is left-aligned by default.
+///
+/// @par Example
+///
+/// @code{.cpp}
+///
+/// using namespace std::string_view_literals;
+///
+/// const auto name = upp::utf16_string::from_utf16_unchecked(u"Zo\u00EB"sv);
+///
+/// std::format("[{:*^7}]", name); // "[**Zo\u00EB**]"
+/// std::format("[{:.2}]", name);  // "[Zo]"
+///
+/// @endcode
+///
+
+#include "uchar.hpp"
+#include "encoding.hpp"
+#include "string.hpp"
+#include "impl/decode_valid.hpp"
+#include "impl/encode_valid.hpp"
+#include "impl/text_metadata.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+namespace upp::impl::format
+{
+    enum class alignment : std::uint8_t
+    {
+        left,
+        center,
+        right,
+    };
+
+    /// @brief The parsed format specification that the uni-cpp formatters share.
+    ///
+    class text_formatter
+    {
+    public:
+        template<typename ParseContext>
+        constexpr ParseContext::iterator parse(ParseContext& ctx, const bool allow_precision, const char type)
+        {
+            auto       it  = ctx.begin();
+            const auto end = ctx.end();
+
+            if (it == end || *it == '}')
+                return it;
+
+            // The fill character can be any code point, so it takes up to 4 code units of the UTF-8 format string.
+            const auto fill_size = static_cast<std::ptrdiff_t>(fill_length(*it));
+
+            if (fill_size < end - it && to_alignment(it[fill_size]))
+            {
+                std::copy(it, it + fill_size, m_fill.begin());
+
+                m_fill_size = static_cast<std::uint8_t>(fill_size);
+                m_align     = *to_alignment(it[fill_size]);
+                it += fill_size + 1;
+            }
+            else if (to_alignment(*it))
+            {
+                m_align = *to_alignment(*it);
+                ++it;
+            }
+
+            it = parse_count(ctx, it, m_width, m_width_arg_id, '1');
+
+            if (it != end && *it == '.')
+            {
+                if (!allow_precision)
+                    throw std::format_error("precision is not allowed for characters");
+
+                const auto precision_begin = ++it;
+
+                it = parse_count(ctx, it, m_precision, m_precision_arg_id, '0');
+
+                if (it == precision_begin)
+                    throw std::format_error("missing precision");
+            }
+
+            if (it != end && *it == type)
+                ++it;
+
+            if (it != end && *it != '}')
+                throw std::format_error("invalid format specification for a uni-cpp string or character");
+
+            return it;
+        }
+
+    protected:
+        /// @brief Writes the valid `Encoding` code units `[data, data + size)` to the output of `ctx` as UTF-8, padded and truncated.
+        ///
+        template<encoding Encoding, typename T, typename FormatContext>
+        FormatContext::iterator write(const T* const data, std::size_t size, FormatContext& ctx) const
+        {
+            const std::size_t precision = resolve(m_precision, m_precision_arg_id, ctx);
+            const std::size_t width     = resolve(m_width, m_width_arg_id, ctx);
+
+            if (precision != no_count)
+                size = prefix_size(data, size, precision);
+
+            // The code points only need to be counted for padding, a word at a time in UTF-8.
+            const std::size_t code_point_count = width != no_count ? text_metadata::count_code_points(data, size) : 0;
+
+            const std::size_t padding = width != no_count && width > code_point_count ? width - code_point_count : 0;
+
+            std::size_t left_padding = 0;
+
+            if (m_align == alignment::center)
+                left_padding = padding / 2;
+            else if (m_align == alignment::right)
+                left_padding = padding;
+
+            auto out = write_fill(ctx.out(), left_padding);
+
+            out = write_utf8<Encoding>(data, size, out);
+
+            return write_fill(out, padding - left_padding);
+        }
+
+    private:
+        static constexpr std::size_t no_count = std::numeric_limits<std::size_t>::max();
+
+        [[nodiscard]] static constexpr std::size_t fill_length(const char first) noexcept
+        {
+            const auto value = static_cast<std::uint8_t>(first);
+
+            if (value >= 0xF0U)
+                return 4;
+            if (value >= 0xE0U)
+                return 3;
+            if (value >= 0xC0U)
+                return 2;
+
+            return 1;
+        }
+
+        [[nodiscard]] static constexpr std::optional<alignment> to_alignment(const char ch) noexcept
+        {
+            switch (ch)
+            {
+            case '<':
+                return alignment::left;
+            case '^':
+                return alignment::center;
+            case '>':
+                return alignment::right;
+            default:
+                return std::nullopt;
+            }
+        }
+
+        /// @brief Parses a width or precision: a number, `{}` or `{arg-id}`.
+        ///
+        /// A width can't start with `0`, which is a flag for numbers, so `min_digit` is `'1'` for widths and `'0'` for precisions.
+        ///
+        template<typename ParseContext>
+        static constexpr ParseContext::iterator parse_count(ParseContext& ctx, ParseContext::iterator it, std::size_t& count, std::size_t& arg_id,
+                                                            const char min_digit)
+        {
+            const auto end = ctx.end();
+
+            const auto parse_number = [&it, end] {
+                std::size_t number = 0;
+
+                for (; it != end && *it >= '0' && *it <= '9'; ++it)
+                {
+                    if (number > (no_count - 1) / 10)
+                        throw std::format_error("width or precision is too large");
+
+                    number = number * 10 + static_cast<std::size_t>(*it - '0');
+                }
+
+                return number;
+            };
+
+            if (it == end)
+                return it;
+
+            if (*it == '{')
+            {
+                ++it;
+
+                if (it != end && *it == '}')
+                {
+                    arg_id = ctx.next_arg_id();
+                }
+                else
+                {
+                    arg_id = parse_number();
+                    ctx.check_arg_id(arg_id);
+                }
+
+                if (it == end || *it != '}')
+                    throw std::format_error("invalid width or precision argument");
+
+                return ++it;
+            }
+
+            if (*it >= min_digit && *it <= '9')
+                count = parse_number();
+
+            return it;
+        }
+
+        template<typename FormatContext>
+        [[nodiscard]] static std::size_t resolve(const std::size_t count, const std::size_t arg_id, FormatContext& ctx)
+        {
+            if (arg_id == no_count)
+                return count;
+
+            return std::visit_format_arg(
+                [](const auto value) -> std::size_t {
+                    using value_type = std::remove_cvref_t<decltype(value)>;
+
+                    if constexpr (std::integral<value_type> && !std::same_as<value_type, bool> && !std::same_as<value_type, char>)
+                    {
+                        if constexpr (std::signed_integral<value_type>)
+                        {
+                            if (value < 0)
+                                throw std::format_error("negative width or precision");
+                        }
+
+                        return static_cast<std::size_t>(value);
+                    }
+                    else
+                    {
+                        throw std::format_error("width or precision argument is not an integer");
+                    }
+                },
+                ctx.arg(arg_id));
+        }
+
+        /// @brief Returns the number of code units of the first `count` code points of `[data, data + size)`.
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr std::size_t prefix_size(const T* const data, const std::size_t size, std::size_t count) noexcept
+        {
+            for (std::size_t index = 0; index < size; ++index)
+            {
+                if (text_metadata::is_leading_code_unit(data[index]) && count-- == 0)
+                    return index;
+            }
+
+            return size;
+        }
+
+        template<typename OutputIt>
+        OutputIt write_fill(OutputIt out, std::size_t count) const
+        {
+            for (; count > 0; --count)
+                out = std::ranges::copy(m_fill.data(), m_fill.data() + m_fill_size, out).out;
+
+            return out;
+        }
+
+        /// @brief Writes valid `Encoding` code units as UTF-8.
+        ///
+        /// UTF-8 and ASCII are copied as they are. Other encodings are transcoded into a stack buffer, which is copied to the
+        /// output whenever it fills up, so that the output receives large chunks instead of single characters.
+        ///
+        template<encoding Encoding, typename T, typename OutputIt>
+        static OutputIt write_utf8(const T* const data, const std::size_t size, OutputIt out)
+        {
+            if constexpr (sizeof(T) == 1)
+            {
+                const auto* const bytes = reinterpret_cast<const char*>(data);
+
+                return std::ranges::copy(bytes, bytes + size, out).out;
+            }
+            else
+            {
+                std::array<char, 256> buffer;
+                std::size_t           buffer_size = 0;
+
+                for (std::size_t index = 0; index < size;)
+                {
+                    if (buffer.size() - buffer_size < 4)
+                    {
+                        out         = std::ranges::copy(buffer.data(), buffer.data() + buffer_size, out).out;
+                        buffer_size = 0;
+                    }
+
+                    const std::uint32_t value = text_metadata::code_unit_value(data[index]);
+
+                    if (value < 0x80U)
+                    {
+                        buffer[buffer_size++] = static_cast<char>(value);
+                        ++index;
+                        continue;
+                    }
+
+                    const auto [code_point, length] = decode_valid_code_point<Encoding>(data + index);
+
+                    buffer_size += encode_valid_code_point<encoding::utf8>(code_point, buffer.data() + buffer_size);
+                    index += length;
+                }
+
+                return std::ranges::copy(buffer.data(), buffer.data() + buffer_size, out).out;
+            }
+        }
+
+    private:
+        std::array<char, 4> m_fill{' '};
+        std::uint8_t        m_fill_size = 1;
+        alignment           m_align     = alignment::left;
+
+        std::size_t m_width            = no_count;
+        std::size_t m_width_arg_id     = no_count;
+        std::size_t m_precision        = no_count;
+        std::size_t m_precision_arg_id = no_count;
+    };
+} // namespace upp::impl::format
+
+/// @brief Formats a `basic_ustring` as UTF-8, transcoding it straight into the output.
+///
+template<upp::encoding Encoding, typename Container>
+struct std::formatter<upp::basic_ustring<Encoding, Container>, char> : upp::impl::format::text_formatter
+{
+    template<typename ParseContext>
+    constexpr ParseContext::iterator parse(ParseContext& ctx)
+    {
+        return text_formatter::parse(ctx, true, 's');
+    }
+
+    template<typename FormatContext>
+    FormatContext::iterator format(const upp::basic_ustring<Encoding, Container>& string, FormatContext& ctx) const
+    {
+        const auto code_units = string.code_units();
+
+        return write<Encoding>(code_units.data(), code_units.size(), ctx);
+    }
+};
+
+/// @brief Formats a `basic_ascii_string`.
+///
+template<typename Container>
+struct std::formatter<upp::basic_ascii_string<Container>, char> : upp::impl::format::text_formatter
+{
+    template<typename ParseContext>
+    constexpr ParseContext::iterator parse(ParseContext& ctx)
+    {
+        return text_formatter::parse(ctx, true, 's');
+    }
+
+    template<typename FormatContext>
+    FormatContext::iterator format(const upp::basic_ascii_string<Container>& string, FormatContext& ctx) const
+    {
+        const auto code_units = string.code_units();
+
+        return write<upp::encoding::utf8>(code_units.data(), code_units.size(), ctx);
+    }
+};
+
+/// @brief Formats a `uchar` as its UTF-8 encoding.
+///
+template<>
+struct std::formatter<upp::uchar, char> : upp::impl::format::text_formatter
+{
+    template<typename ParseContext>
+    constexpr ParseContext::iterator parse(ParseContext& ctx)
+    {
+        return text_formatter::parse(ctx, false, 'c');
+    }
+
+    template<typename FormatContext>
+    FormatContext::iterator format(const upp::uchar ch, FormatContext& ctx) const
+    {
+        const auto encoded = ch.encode_utf8();
+
+        return write<upp::encoding::utf8>(encoded.data(), encoded.size(), ctx);
+    }
+};
+
+/// @brief Formats an `ascii_char`.
+///
+template<>
+struct std::formatter<upp::ascii_char, char> : upp::impl::format::text_formatter
+{
+    template<typename ParseContext>
+    constexpr ParseContext::iterator parse(ParseContext& ctx)
+    {
+        return text_formatter::parse(ctx, false, 'c');
+    }
+
+    template<typename FormatContext>
+    FormatContext::iterator format(const upp::ascii_char ch, FormatContext& ctx) const
+    {
+        const auto code_unit = static_cast<char>(ch.value());
+
+        return write<upp::encoding::utf8>(&code_unit, 1, ctx);
+    }
+};
+
+#endif // UNI_CPP_FORMAT_HPP
\ No newline at end of file
@@ -0,0 +1,400 @@
+#ifndef UNI_CPP_HASH_HPP
+#define UNI_CPP_HASH_HPP
+
+/// @file
+///
+/// @brief Hashing and comparing text so that the same code points hash and compare equal in every encoding.
+///
+
+#include "uchar.hpp"
+#include "encoding.hpp"
+#include "ranges.hpp"
+#include "string.hpp"
+#include "compare.hpp"
+#include "impl/swar.hpp"
+#include "impl/search.hpp"
+#include "impl/decode_valid.hpp"
+#include "impl/utility.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <concepts>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <bit>
+
+namespace upp
+{
+    namespace impl::hash
+    {
+        /// @brief Hashes a stream of bytes 8 bytes at a time.
+        ///
+        /// The result depends only on the bytes, not on how they are split between the calls to `update`.
+        ///
+        class byte_stream_hasher
+        {
+        public:
+            template<typename T>
+                requires(sizeof(T) == 1)
+            constexpr void update(const T* const data, const std::size_t size) noexcept
+            {
+                std::size_t index = 0;
+
+                m_size += size;
+
+                if (m_pending_size != 0)
+                {
+                    while (m_pending_size < swar::word_size && index < size)
+                        append_pending(data[index++]);
+
+                    if (m_pending_size < swar::word_size)
+                        return;
+
+                    mix(m_pending);
+                    m_pending      = 0;
+                    m_pending_size = 0;
+                }
+
+                for (; index + swar::word_size <= size; index += swar::word_size)
+                    mix(swar::load_word(data + index));
+
+                while (index < size)
+                    append_pending(data[index++]);
+            }
+
+            [[nodiscard]] constexpr std::uint64_t finish() const noexcept
+            {
+                std::uint64_t state = m_state ^ scramble(m_pending) ^ m_size;
+
+                // The finalizer of MurmurHash3, so that every bit of the state affects every bit of the result.
+                state ^= state >> 33U;
+                state *= 0xFF51'AFD7'ED55'8CCDULL;
+                state ^= state >> 33U;
+                state *= 0xC4CE'B9FE'1A85'EC53ULL;
+                state ^= state >> 33U;
+
+                return state;
+            }
+
+        private:
+            [[nodiscard]] static constexpr std::uint64_t scramble(std::uint64_t word) noexcept
+            {
+                word *= 0x87C3'7B91'1142'53D5ULL;
+                word = std::rotl(word, 31);
+                word *= 0x4CF5'AD43'2745'937FULL;
+
+                return word;
+            }
+
+            constexpr void mix(const std::uint64_t word) noexcept
+            {
+                m_state ^= scramble(word);
+                m_state = std::rotl(m_state, 27) * 5U + 0x52DC'E729U;
+            }
+
+            template<typename T>
+            constexpr void append_pending(const T byte) noexcept
+            {
+                m_pending |= static_cast<std::uint64_t>(std::bit_cast<std::uint8_t>(byte)) << (8U * m_pending_size);
+                ++m_pending_size;
+            }
+
+        private:
+            std::uint64_t m_state        = 0x9E37'79B9'7F4A'7C15ULL;
+            std::uint64_t m_pending      = 0;
+            std::size_t   m_pending_size = 0;
+            std::uint64_t m_size         = 0;
+        };
+
+        /// @brief Transcodes code points to UTF-8 into a stack buffer and hashes the buffer whenever it fills up.
+        ///
+        class utf8_buffer
+        {
+        public:
+            /// @brief Appends ASCII code units, which are the same in UTF-8.
+            ///
+            template<typename T>
+            constexpr void append_ascii(const T* const data, const std::size_t size) noexcept
+            {
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    if (m_size == m_buffer.size())
+                        flush();
+
+                    m_buffer[m_size++] = static_cast<char8_t>(data[i]);
+                }
+            }
+
+            constexpr void append(const std::uint32_t code_point) noexcept
+            {
+                if (m_size + 4 > m_buffer.size())
+                    flush();
+
+                for (const char8_t code_unit : uchar::from_unchecked(code_point).encode_utf8())
+                    m_buffer[m_size++] = code_unit;
+            }
+
+            [[nodiscard]] constexpr std::uint64_t finish() noexcept
+            {
+                flush();
+
+                return m_hasher.finish();
+            }
+
+        private:
+            constexpr void flush() noexcept
+            {
+                m_hasher.update(m_buffer.data(), m_size);
+                m_size = 0;
+            }
+
+        private:
+            byte_stream_hasher       m_hasher;
+            std::array<char8_t, 256> m_buffer{};
+            std::size_t              m_size = 0;
+        };
+
+        /// @brief Returns the hash of the UTF-8 form of a contiguous valid `Encoding` code unit sequence.
+        ///
+        template<encoding Encoding, typename T>
+        [[nodiscard]] constexpr std::uint64_t hash_code_units(const T* const data, const std::size_t size) noexcept
+        {
+            if constexpr (Encoding == encoding::ascii || Encoding == encoding::utf8)
+            {
+                byte_stream_hasher hasher;
+
+                hasher.update(data, size);
+
+                return hasher.finish();
+            }
+            else
+            {
+                using lane = search::lanes<sizeof(T)>;
+
+                // Every lane whose code unit is not ASCII.
+                constexpr swar::word_type non_ascii = lane::ones * ((swar::word_type{1} << lane::bits) - 0x80U);
+
+                utf8_buffer buffer;
+
+                for (std::size_t index = 0; index < size;)
+                {
+                    if (index + lane::count <= size && (search::load_lanes(data + index) & non_ascii) == 0)
+                    {
+                        buffer.append_ascii(data + index, lane::count);
+                        index += lane::count;
+                        continue;
+                    }
+
+                    const auto [code_point, length] = decode_valid_code_point<Encoding>(data + index);
+
+                    buffer.append(code_point);
+                    index += length;
+                }
+
+                return buffer.finish();
+            }
+        }
+
+        template<encoding Encoding, std::input_iterator It, std::sentinel_for<It> Sentinel>
+        [[nodiscard]] constexpr std::uint64_t hash_code_units(It it, const Sentinel end)
+        {
+            utf8_buffer buffer;
+
+            while (it != end)
+                buffer.append(decode_valid_code_point_and_advance<Encoding == encoding::ascii ? encoding::utf8 : Encoding>(it));
+
+            return buffer.finish();
+        }
+
+        template<encoding Encoding, typename Range>
+        [[nodiscard]] constexpr std::uint64_t hash_range(Range&& range)
+        {
+            if constexpr (compare::is_contiguous_sized<Range>)
+                return hash_code_units<Encoding>(std::ranges::data(range), static_cast<std::size_t>(std::ranges::size(range)));
+            else
+                return hash_code_units<Encoding>(std::ranges::begin(range), std::ranges::end(range));
+        }
+
+        template<typename T>
+        struct text_operand_traits
+        {
+        };
+
+        template<typename Container>
+        struct text_operand_traits<basic_ascii_string<Container>>
+        {
+            static constexpr encoding encoding_value   = encoding::ascii;
+            static constexpr bool     needs_validation = false;
+
+            [[nodiscard]] static constexpr std::optional<std::span<const typename Container::value_type>>
+                valid_code_units(const basic_ascii_string<Container>& string) noexcept
+            {
+                return string.code_units();
+            }
+        };
+
+        template<encoding Encoding, typename Container>
+        struct text_operand_traits<basic_ustring<Encoding, Container>>
+        {
+            static constexpr encoding encoding_value   = Encoding;
+            static constexpr bool     needs_validation = false;
+
+            [[nodiscard]] static constexpr std::optional<std::span<const typename Container::value_type>>
+                valid_code_units(const basic_ustring<Encoding, Container>& string) noexcept
+            {
+                return string.code_units();
+            }
+        };
+
+        template<typename View, encoding Encoding>
+        struct text_operand_traits<ranges::valid_code_unit_view<View, Encoding>>
+        {
+            static constexpr encoding encoding_value   = Encoding;
+            static constexpr bool     needs_validation = false;
+
+            [[nodiscard]] static constexpr std::optional<std::ranges::ref_view<const ranges::valid_code_unit_view<View, Encoding>>>
+                valid_code_units(const ranges::valid_code_unit_view<View, Encoding>& view) noexcept
+            {
+                return std::ranges::ref_view{view};
+            }
+        };
+
+        /// String views are not known to be valid, so they are validated. Invalid ones are compared and hashed by their code units.
+        template<typename CharT>
+            requires any_of<CharT, char8_t, char16_t, char32_t>
+        struct text_operand_traits<std::basic_string_view<CharT>>
+        {
+            static constexpr encoding encoding_value = sizeof(CharT) == 1   ? encoding::utf8
+                                                       : sizeof(CharT) == 2 ? encoding::utf16
+                                                                            : encoding::utf32;
+            static constexpr bool     needs_validation = true;
+
+            [[nodiscard]] static constexpr std::optional<std::span<const CharT>> valid_code_units(const std::basic_string_view<CharT> view) noexcept
+            {
+                if (!encoding_traits<encoding_value>::validate_range(view))
+                    return std::nullopt;
+
+                return std::span<const CharT>{view};
+            }
+        };
+
+        /// @brief Hashes the code units of an invalid string view as they are.
+        ///
+        template<typename CharT>
+        [[nodiscard]] constexpr std::uint64_t hash_invalid_code_units(const std::basic_string_view<CharT> view) noexcept
+        {
+            byte_stream_hasher hasher;
+
+            for (const CharT code_unit : view)
+            {
+                const auto bytes = std::bit_cast<std::array<std::uint8_t, sizeof(CharT)>>(code_unit);
+
+                hasher.update(bytes.data(), bytes.size());
+            }
+
+            return hasher.finish();
+        }
+
+        template<typename T>
+        concept text_operand = requires { text_operand_traits<std::remove_cvref_t<T>>::encoding_value; };
+    } // namespace impl::hash
+
+    /// @brief A hash function object for text, which gives the same hash to the same code points in every encoding.
+    ///
+    /// Hashes strings (`basic_ustring` and `basic_ascii_string`), views marked as valid (`ranges::valid_code_unit_view`,
+    /// e.g. the result of `views::mark_as_valid_utf16`) and `std::u8string_view`, `std::u16string_view` and `std::u32string_view`.
+    /// It's transparent, so together with `upp::equal_to` it enables heterogeneous lookup in unordered containers:
+    /// a map keyed by `ustring` can be searched with a `utf16_string` or a `std::u8string_view` without converting them.
+    ///
+    /// The hash is computed from the UTF-8 form of the text. UTF-8 text is hashed directly, 8 bytes at a time.
+    /// Text in other encodings is transcoded to UTF-8 into a small stack buffer while it's hashed, with runs of ASCII
+    /// code units copied without decoding them.
+    ///
+    /// Invalid UTF-16 and UTF-32 string views are hashed by their code units, which is also how `upp::equal_to` compares them.
+    ///
+    /// @par Example
+    ///
+    /// @code{.cpp}
+    ///
+    /// using namespace std::string_view_literals;
+    /// using namespace upp::string_literals;
+    ///
+    /// std::unordered_map<upp::ustring, int, upp::hash, upp::equal_to> ports{{u8"http"_us, 80}};
+    ///
+    /// ports.find(u8"http"sv);                                               // found
+    /// ports.find(upp::utf16_string::from_utf16_unchecked(u"http"sv));      // found
+    ///
+    /// @endcode
+    ///
+    /// @headerfile "" <uni-cpp/hash.hpp>
+    ///
+    struct hash
+    {
+        using is_transparent = void;
+
+        template<impl::hash::text_operand T>
+        [[nodiscard]] constexpr std::size_t operator()(const T& text) const noexcept
+        {
+            using traits = impl::hash::text_operand_traits<T>;
+
+            constexpr encoding text_encoding = traits::encoding_value;
+
+            if constexpr (!traits::needs_validation)
+            {
+                return static_cast<std::size_t>(impl::hash::hash_range<text_encoding>(*traits::valid_code_units(text)));
+            }
+            else if constexpr (text_encoding == encoding::utf8)
+            {
+                // UTF-8 is hashed by its code units anyway, so validating it first wouldn't change the result.
+                return static_cast<std::size_t>(impl::hash::hash_range<text_encoding>(text));
+            }
+            else
+            {
+                if (const auto code_units = traits::valid_code_units(text))
+                    return static_cast<std::size_t>(impl::hash::hash_range<text_encoding>(*code_units));
+
+                return static_cast<std::size_t>(impl::hash::hash_invalid_code_units(text));
+            }
+        }
+    };
+
+    /// @brief A transparent equality function object for text, which compares the code points of its operands in any encodings.
+    ///
+    /// Accepts the same operands as `upp::hash` and compares them with `upp::equal`, without transcoding them.
+    /// String views are validated first. An invalid string view is only equal to a string view with the same code units,
+    /// consistently with how `upp::hash` hashes it, so every operand is equal to itself.
+    ///
+    /// @headerfile "" <uni-cpp/hash.hpp>
+    ///
+    struct equal_to
+    {
+        using is_transparent = void;
+
+        template<impl::hash::text_operand T, impl::hash::text_operand U>
+        [[nodiscard]] constexpr bool operator()(const T& x, const U& y) const noexcept
+        {
+            using x_traits = impl::hash::text_operand_traits<T>;
+            using y_traits = impl::hash::text_operand_traits<U>;
+
+            const auto x_code_units = x_traits::valid_code_units(x);
+            const auto y_code_units = y_traits::valid_code_units(y);
+
+            if (!x_code_units || !y_code_units)
+            {
+                if constexpr (std::same_as<T, U> && x_traits::needs_validation)
+                    return !x_code_units && !y_code_units && x == y;
+                else
+                    return false;
+            }
+
+            return impl::compare::equal<x_traits::encoding_value, y_traits::encoding_value>(*x_code_units, *y_code_units);
+        }
+    };
+} // namespace upp
+
+#endif // UNI_CPP_HASH_HPP
\ No newline at end of file
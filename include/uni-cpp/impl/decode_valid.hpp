@@ -0,0 +1,134 @@
+#ifndef UNI_CPP_IMPL_DECODE_VALID_HPP
+#define UNI_CPP_IMPL_DECODE_VALID_HPP
+
+/// @file
+///
+/// @brief Decoding of single code points from sequences of valid code units.
+///
+/// Algorithms that scan whole strings (property lookup, normalization, segmentation) work on the raw code units
+/// instead of going through a decoding view, so that they can copy unchanged parts verbatim or refer to them.
+///
+
+#include "../encoding.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <bit>
+
+namespace upp::impl
+{
+    struct decoded_code_point
+    {
+        std::uint32_t value;
+        std::uint8_t  length;
+    };
+
+    template<typename T>
+        requires(sizeof(T) == 1)
+    [[nodiscard]] constexpr std::uint32_t decode_valid_utf8_code_point(const T* code_units, std::uint8_t width) noexcept
+    {
+        const auto byte = [code_units](std::size_t index) { return static_cast<std::uint32_t>(std::bit_cast<std::uint8_t>(code_units[index])); };
+
+        switch (width)
+        {
+        case 1:
+            return byte(0);
+        case 2:
+            return ((byte(0) & 0x1FU) << 6U) | (byte(1) & 0x3FU);
+        case 3:
+            return ((byte(0) & 0x0FU) << 12U) | ((byte(1) & 0x3FU) << 6U) | (byte(2) & 0x3FU);
+        default:
+            return ((byte(0) & 0x07U) << 18U) | ((byte(1) & 0x3FU) << 12U) | ((byte(2) & 0x3FU) << 6U) | (byte(3) & 0x3FU);
+        }
+    }
+
+    /// @brief Decodes the code point starting at `code_units`.
+    ///
+    /// @pre `code_units` points to the beginning of a complete, valid `Encoding` sequence.
+    ///
+    template<encoding Encoding, typename T>
+        requires unicode_encoding<Encoding>
+    [[nodiscard]] constexpr decoded_code_point decode_valid_code_point(const T* code_units) noexcept
+    {
+        if constexpr (Encoding == encoding::utf8)
+        {
+            const std::uint8_t width = utf8::char_width_from_leading_byte(std::bit_cast<char8_t>(code_units[0]));
+
+            return {decode_valid_utf8_code_point(code_units, width), width};
+        }
+        else if constexpr (Encoding == encoding::utf16)
+        {
+            const auto first = std::bit_cast<char16_t>(code_units[0]);
+
+            if (!utf16::is_high_surrogate(first))
+                return {static_cast<std::uint32_t>(first), 1};
+
+            return {utf16::decode_valid_surrogate_pair(first, std::bit_cast<char16_t>(code_units[1])), 2};
+        }
+        else
+        {
+            return {static_cast<std::uint32_t>(std::bit_cast<char32_t>(code_units[0])), 1};
+        }
+    }
+
+    template<std::input_iterator It>
+    [[nodiscard]] constexpr std::uint32_t read_code_unit(It& it)
+    {
+        using code_unit_type = std::remove_cvref_t<std::iter_reference_t<It>>;
+
+        const auto code_unit = static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<code_unit_type>>(*it));
+        ++it;
+
+        return code_unit;
+    }
+
+    /// @brief Decodes the code point starting at `it` and advances `it` past it.
+    ///
+    /// Works with any iterator over code units, for ranges that are not contiguous.
+    ///
+    /// @pre `it` points to the beginning of a complete, valid `Encoding` sequence.
+    ///
+    template<encoding Encoding, std::input_iterator It>
+    [[nodiscard]] constexpr std::uint32_t decode_valid_code_point_and_advance(It& it)
+    {
+        const std::uint32_t first = read_code_unit(it);
+
+        if constexpr (Encoding == encoding::utf8)
+        {
+            const std::uint8_t width = utf8::char_width_from_leading_byte(static_cast<char8_t>(first));
+
+            switch (width)
+            {
+            case 1:
+                return first;
+            case 2:
+                return ((first & 0x1FU) << 6U) | (read_code_unit(it) & 0x3FU);
+            case 3: {
+                const std::uint32_t second = read_code_unit(it);
+                return ((first & 0x0FU) << 12U) | ((second & 0x3FU) << 6U) | (read_code_unit(it) & 0x3FU);
+            }
+            default: {
+                const std::uint32_t second = read_code_unit(it);
+                const std::uint32_t third  = read_code_unit(it);
+                return ((first & 0x07U) << 18U) | ((second & 0x3FU) << 12U) | ((third & 0x3FU) << 6U) | (read_code_unit(it) & 0x3FU);
+            }
+            }
+        }
+        else if constexpr (Encoding == encoding::utf16)
+        {
+            if (!utf16::is_high_surrogate(static_cast<char16_t>(first)))
+                return first;
+
+            return utf16::decode_valid_surrogate_pair(static_cast<char16_t>(first), static_cast<char16_t>(read_code_unit(it)));
+        }
+        else
+        {
+            // ASCII and UTF-32 code units are code points.
+            return first;
+        }
+    }
+} // namespace upp::impl
+
+#endif // UNI_CPP_IMPL_DECODE_VALID_HPP
\ No newline at end of file
@@ -0,0 +1,76 @@
+#ifndef UNI_CPP_IMPL_ENCODE_VALID_HPP
+#define UNI_CPP_IMPL_ENCODE_VALID_HPP
+
+/// @file
+///
+/// @brief Encoding of single code points into raw code unit buffers.
+///
+/// Used where code points are written through a pointer into a buffer that is known to have room for them,
+/// instead of appending the ranges returned by `uchar::encode_utf8` and `uchar::encode_utf16` one by one.
+///
+
+#include "../encoding.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace upp::impl
+{
+    /// @brief Encodes the valid code point `code_point` into `out`, which has room for it, and returns the number of code units written.
+    ///
+    template<encoding Encoding, typename T>
+        requires unicode_encoding<Encoding>
+    constexpr std::size_t encode_valid_code_point(const std::uint32_t code_point, T* const out) noexcept
+    {
+        const auto unit = [](const std::uint32_t value) static { return static_cast<T>(value); };
+
+        if constexpr (Encoding == encoding::utf8)
+        {
+            if (code_point < 0x80U)
+            {
+                out[0] = unit(code_point);
+                return 1;
+            }
+
+            if (code_point < 0x800U)
+            {
+                out[0] = unit(0xC0U | (code_point >> 6U));
+                out[1] = unit(0x80U | (code_point & 0x3FU));
+                return 2;
+            }
+
+            if (code_point < 0x10000U)
+            {
+                out[0] = unit(0xE0U | (code_point >> 12U));
+                out[1] = unit(0x80U | ((code_point >> 6U) & 0x3FU));
+                out[2] = unit(0x80U | (code_point & 0x3FU));
+                return 3;
+            }
+
+            out[0] = unit(0xF0U | (code_point >> 18U));
+            out[1] = unit(0x80U | ((code_point >> 12U) & 0x3FU));
+            out[2] = unit(0x80U | ((code_point >> 6U) & 0x3FU));
+            out[3] = unit(0x80U | (code_point & 0x3FU));
+            return 4;
+        }
+        else if constexpr (Encoding == encoding::utf16)
+        {
+            if (code_point < 0x10000U)
+            {
+                out[0] = unit(code_point);
+                return 1;
+            }
+
+            out[0] = unit(0xD800U + ((code_point - 0x10000U) >> 10U));
+            out[1] = unit(0xDC00U + ((code_point - 0x10000U) & 0x3FFU));
+            return 2;
+        }
+        else
+        {
+            out[0] = unit(code_point);
+            return 1;
+        }
+    }
+} // namespace upp::impl
+
+#endif // UNI_CPP_IMPL_ENCODE_VALID_HPP
\ No newline at end of file
@@ -11,8 +11,17 @@
 
 namespace upp
 {
+    enum class ascii_error_code : std::uint8_t
+    {
+        invalid_code_unit,
+        /// Never produced by decoding. Reported by the string factories when the input doesn't fit into a fixed-capacity container.
+        capacity_exceeded,
+    };
+
     struct ascii_error
     {
+        ascii_error_code code = ascii_error_code::invalid_code_unit;
+
         [[nodiscard]] constexpr bool operator==(const ascii_error&) const noexcept = default;
     };
 
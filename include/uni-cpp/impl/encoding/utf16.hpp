@@ -16,6 +16,8 @@ namespace upp
     {
         unpaired_high_surrogate,
         unpaired_low_surrogate,
+        /// Never produced by decoding. Reported by the string factories when the input doesn't fit into a fixed-capacity container.
+        capacity_exceeded,
     };
 
     struct utf16_error
@@ -22,6 +22,8 @@ namespace upp
         encoded_surrogate,
         out_of_range,
         invalid_leading_byte,
+        /// Never produced by decoding. Reported by the string factories when the input doesn't fit into a fixed-capacity container.
+        capacity_exceeded,
     };
 
     struct utf8_error
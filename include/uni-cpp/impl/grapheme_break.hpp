@@ -0,0 +1,194 @@
+#ifndef UNI_CPP_IMPL_GRAPHEME_BREAK_HPP
+#define UNI_CPP_IMPL_GRAPHEME_BREAK_HPP
+
+/// @file
+///
+/// @brief Extended grapheme cluster boundaries (UAX #29, section 3.1.1).
+///
+/// @see https://www.unicode.org/reports/tr29/
+///
+
+#include "../encoding.hpp"
+#include "decode_valid.hpp"
+#include "unicode_data/grapheme_break.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace upp::impl::grapheme_break
+{
+    namespace data = unicode_data::grapheme_break;
+
+    using data::grapheme_cluster_break;
+    using data::indic_conjunct_break;
+
+    /// @brief The part of a grapheme cluster that the break rules look back at.
+    ///
+    /// Clusters are always scanned from a boundary, and every sequence that a rule looks behind at (GB9c, GB11, GB12 and GB13)
+    /// lies within a single cluster. The state therefore only has to remember what was seen since the start of the cluster.
+    ///
+    class cluster_state
+    {
+    public:
+        constexpr explicit cluster_state(const data::code_point_properties first) noexcept
+            : m_previous(first.cluster_break())
+        {
+            update(first);
+        }
+
+        /// @brief Checks whether there is a boundary between the previous code point and `next`.
+        /// If there is none, `next` becomes a part of the cluster.
+        ///
+        [[nodiscard]] constexpr bool is_boundary_before(const data::code_point_properties next) noexcept
+        {
+            if (breaks_before(next))
+                return true;
+
+            m_previous = next.cluster_break();
+            update(next);
+
+            return false;
+        }
+
+    private:
+        using gcb = grapheme_cluster_break;
+
+        [[nodiscard]] constexpr bool breaks_before(const data::code_point_properties next_properties) const noexcept
+        {
+            const gcb previous = m_previous;
+            const gcb next     = next_properties.cluster_break();
+
+            // GB3, GB4, GB5
+            if (previous == gcb::cr)
+                return next != gcb::lf;
+
+            if (previous == gcb::lf || previous == gcb::control || next == gcb::cr || next == gcb::lf || next == gcb::control)
+                return true;
+
+            // GB6, GB7, GB8
+            if (previous == gcb::l && (next == gcb::l || next == gcb::v || next == gcb::lv || next == gcb::lvt))
+                return false;
+
+            if ((previous == gcb::lv || previous == gcb::v) && (next == gcb::v || next == gcb::t))
+                return false;
+
+            if ((previous == gcb::lvt || previous == gcb::t) && next == gcb::t)
+                return false;
+
+            // GB9, GB9a, GB9b
+            if (next == gcb::extend || next == gcb::zwj || next == gcb::spacing_mark || previous == gcb::prepend)
+                return false;
+
+            // GB9c
+            if (m_conjunct == conjunct_state::linked && next_properties.conjunct_break() == indic_conjunct_break::consonant)
+                return false;
+
+            // GB11
+            if (m_pictographic == pictographic_state::zwj && next_properties.is_extended_pictographic())
+                return false;
+
+            // GB12, GB13
+            if (previous == gcb::regional_indicator && next == gcb::regional_indicator)
+                return !m_odd_regional_indicators;
+
+            // GB999
+            return true;
+        }
+
+        constexpr void update(const data::code_point_properties properties) noexcept
+        {
+            const gcb value = properties.cluster_break();
+
+            // GB11: \p{ExtPict} Extend* ZWJ
+            if (properties.is_extended_pictographic())
+                m_pictographic = pictographic_state::pictographic;
+            else if (value == gcb::zwj && m_pictographic == pictographic_state::pictographic)
+                m_pictographic = pictographic_state::zwj;
+            else if (value != gcb::extend || m_pictographic != pictographic_state::pictographic)
+                m_pictographic = pictographic_state::none;
+
+            // GB9c: \p{InCB=Consonant} [\p{InCB=Extend}\p{InCB=Linker}]* \p{InCB=Linker} [\p{InCB=Extend}\p{InCB=Linker}]*
+            switch (properties.conjunct_break())
+            {
+            case indic_conjunct_break::consonant:
+                m_conjunct = conjunct_state::consonant;
+                break;
+            case indic_conjunct_break::linker:
+                if (m_conjunct != conjunct_state::none)
+                    m_conjunct = conjunct_state::linked;
+                break;
+            case indic_conjunct_break::extend:
+                break;
+            default:
+                m_conjunct = conjunct_state::none;
+                break;
+            }
+
+            // GB12, GB13: count the regional indicators of the current run
+            m_odd_regional_indicators = value == gcb::regional_indicator && !m_odd_regional_indicators;
+        }
+
+    private:
+        enum class pictographic_state : std::uint8_t
+        {
+            none,
+            pictographic, ///< After \p{ExtPict} Extend*
+            zwj,          ///< After \p{ExtPict} Extend* ZWJ
+        };
+
+        enum class conjunct_state : std::uint8_t
+        {
+            none,
+            consonant, ///< After a consonant and extenders, without a linker.
+            linked,    ///< After a consonant, extenders and at least one linker.
+        };
+
+        gcb                m_previous;
+        pictographic_state m_pictographic            = pictographic_state::none;
+        conjunct_state     m_conjunct                = conjunct_state::none;
+        bool               m_odd_regional_indicators = false;
+    };
+
+    template<std::input_iterator It>
+    [[nodiscard]] constexpr bool is_ascii_code_unit(const It& it)
+    {
+        using code_unit_type = std::remove_cvref_t<std::iter_reference_t<It>>;
+
+        return static_cast<std::make_unsigned_t<code_unit_type>>(*it) < 0x80U;
+    }
+
+    /// @brief Finds the end of the grapheme cluster that starts at `it`.
+    ///
+    /// @pre `it != end` and `it` is at a grapheme cluster boundary of a valid `Encoding` sequence.
+    ///
+    template<encoding Encoding, std::forward_iterator It, std::sentinel_for<It> Sentinel>
+    [[nodiscard]] constexpr It find_cluster_end(It it, const Sentinel end)
+    {
+        const std::uint32_t first = decode_valid_code_point_and_advance<Encoding>(it);
+
+        // An ASCII code point other than CR followed by another ASCII code point is a whole cluster:
+        // no rule keeps ASCII characters together except CR LF (GB3), and the next code point is not
+        // an extender that would join the cluster. Most text goes through here, without any table lookup.
+        if (first < 0x80U && first != '\r' && (it == end || is_ascii_code_unit(it)))
+            return it;
+
+        cluster_state state{data::lookup_properties(first)};
+
+        while (it != end)
+        {
+            It next = it;
+
+            const std::uint32_t code_point = decode_valid_code_point_and_advance<Encoding>(next);
+
+            if (state.is_boundary_before(data::lookup_properties(code_point)))
+                break;
+
+            it = next;
+        }
+
+        return it;
+    }
+} // namespace upp::impl::grapheme_break
+
+#endif // UNI_CPP_IMPL_GRAPHEME_BREAK_HPP
\ No newline at end of file
@@ -3,6 +3,7 @@
 // Changes made by uni-cpp:
 // - change the main namespace to upp::impl
 // - change macro prefix to UNI_CPP_IMPL_
+// - make operator== constexpr
 
 #ifndef UNI_CPP_IMPL_INPLACE_VECTOR_HPP
 #define UNI_CPP_IMPL_INPLACE_VECTOR_HPP
@@ -934,7 +935,7 @@ namespace upp::impl
         friend bool operator>=(const inplace_vector& lhs, const inplace_vector& rhs) { return rhs <= lhs; }
         friend bool operator!=(const inplace_vector& lhs, const inplace_vector& rhs) { return !(lhs == rhs); }
 #endif
-        friend bool operator==(const inplace_vector& lhs, const inplace_vector& rhs)
+        constexpr friend bool operator==(const inplace_vector& lhs, const inplace_vector& rhs)
         {
             if (lhs.size() != rhs.size())
                 return false;
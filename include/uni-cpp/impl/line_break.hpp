@@ -0,0 +1,210 @@
+#ifndef UNI_CPP_IMPL_LINE_BREAK_HPP
+#define UNI_CPP_IMPL_LINE_BREAK_HPP
+
+/// @file
+///
+/// @brief Finding line breaks (LF, CR LF, CR, NEL, LS and PS) in valid code unit sequences.
+///
+/// Contiguous sequences are scanned a word at a time for the code units that can start a line break, and only those
+/// candidates are looked at in full. In UTF-8, NEL (U+0085) starts with `0xC2` and LS (U+2028) and PS (U+2029) start with `0xE2`.
+/// Only the code units of the line breaks themselves are ever compared, nothing is decoded.
+///
+
+#include "../encoding.hpp"
+#include "swar.hpp"
+#include "search.hpp"
+#include "text_metadata.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace upp
+{
+    /// @brief Selects which sequences end a line.
+    ///
+    /// @see views::lines, ranges::count_lines
+    ///
+    /// @headerfile "" <uni-cpp/ranges.hpp>
+    ///
+    enum class line_break_policy : std::uint8_t
+    {
+        lf,      ///< Only LF (U+000A) ends a line.
+        ascii,   ///< LF, CR LF and a lone CR (U+000D) end a line.
+        unicode, ///< LF, CR LF, CR, NEL (U+0085), LS (U+2028) and PS (U+2029) end a line.
+    };
+
+    namespace impl::line_break
+    {
+        /// @brief The position of a line break within a code unit sequence: `index` is where it starts, `length` is its
+        ///        number of code units. `length` is zero if there is no line break.
+        ///
+        struct break_position
+        {
+            std::size_t index;
+            std::size_t length;
+        };
+
+        /// @brief Returns an iterator past the line break that starts at `it`, or `it` if no line break starts there.
+        ///
+        /// @pre `it != end`
+        ///
+        template<encoding Encoding, line_break_policy Policy, std::forward_iterator It, std::sentinel_for<It> Sentinel>
+        [[nodiscard]] constexpr It skip_line_break(const It it, const Sentinel end)
+        {
+            const std::uint32_t first = text_metadata::code_unit_value(*it);
+
+            It next = std::ranges::next(it);
+
+            if (first == 0x0AU)
+                return next;
+
+            if constexpr (Policy != line_break_policy::lf)
+            {
+                if (first == 0x0DU)
+                {
+                    if (next != end && text_metadata::code_unit_value(*next) == 0x0AU)
+                        ++next;
+
+                    return next;
+                }
+            }
+
+            if constexpr (Policy == line_break_policy::unicode && Encoding == encoding::utf8)
+            {
+                if (first == 0xC2U && next != end && text_metadata::code_unit_value(*next) == 0x85U)
+                    return ++next;
+
+                if (first == 0xE2U && next != end && text_metadata::code_unit_value(*next) == 0x80U)
+                {
+                    // 0xA8 and 0xA9 are the last code units of LS and PS.
+                    if (++next != end && (text_metadata::code_unit_value(*next) | 1U) == 0xA9U)
+                        return ++next;
+                }
+            }
+            else if constexpr (Policy == line_break_policy::unicode && Encoding != encoding::ascii)
+            {
+                if (first == 0x85U || (first | 1U) == 0x2029U)
+                    return next;
+            }
+
+            return it;
+        }
+
+        /// @brief Returns a word with the most significant bit set in the lanes of `word` that can start a line break.
+        ///
+        template<encoding Encoding, line_break_policy Policy, typename T>
+        [[nodiscard]] constexpr swar::word_type candidate_lanes(const swar::word_type word) noexcept
+        {
+            using lane = search::lanes<sizeof(T)>;
+
+            const auto matches = [word](const std::uint32_t code_unit) {
+                return search::zero_lanes<sizeof(T)>(word ^ (lane::ones * code_unit));
+            };
+
+            swar::word_type candidates = matches(0x0AU);
+
+            if constexpr (Policy != line_break_policy::lf)
+                candidates |= matches(0x0DU);
+
+            if constexpr (Policy == line_break_policy::unicode && Encoding == encoding::utf8)
+            {
+                candidates |= matches(0xC2U) | matches(0xE2U);
+            }
+            else if constexpr (Policy == line_break_policy::unicode && Encoding != encoding::ascii)
+            {
+                // Setting the lowest bit of every lane turns LS into PS, so one comparison finds both.
+                candidates |= matches(0x85U) | search::zero_lanes<sizeof(T)>((word | lane::ones) ^ (lane::ones * 0x2029U));
+            }
+
+            return candidates;
+        }
+
+        /// @brief Returns the position of the first line break in the valid `Encoding` code unit sequence `[data, data + size)`,
+        ///        or `{size, 0}` if there is none.
+        ///
+        template<encoding Encoding, line_break_policy Policy, typename T>
+        [[nodiscard]] constexpr break_position find_line_break(const T* const data, const std::size_t size) noexcept
+        {
+            using lane = search::lanes<sizeof(T)>;
+
+            const T* const end = data + size;
+
+            std::size_t index = 0;
+
+            for (; index + lane::count <= size; index += lane::count)
+            {
+                swar::word_type candidates = candidate_lanes<Encoding, Policy, T>(search::load_lanes(data + index));
+
+                while (candidates != 0)
+                {
+                    const std::size_t candidate = index + static_cast<std::size_t>(std::countr_zero(candidates)) / lane::bits;
+                    const T* const    next      = skip_line_break<Encoding, Policy>(data + candidate, end);
+
+                    if (next != data + candidate)
+                        return break_position{candidate, static_cast<std::size_t>(next - (data + candidate))};
+
+                    candidates &= candidates - 1U;
+                }
+            }
+
+            for (; index < size; ++index)
+            {
+                const T* const next = skip_line_break<Encoding, Policy>(data + index, end);
+
+                if (next != data + index)
+                    return break_position{index, static_cast<std::size_t>(next - (data + index))};
+            }
+
+            return break_position{size, 0};
+        }
+
+        template<std::forward_iterator It>
+        struct line_bounds
+        {
+            /// Past the last code unit of the line, where its line break starts.
+            It line_end;
+
+            /// Past the line break, where the next line starts.
+            It next_line;
+        };
+
+        /// @brief Finds the end of the line that starts at `it` in a valid `Encoding` code unit sequence.
+        ///
+        /// If the line isn't terminated by a line break, both iterators of the result are at `end`.
+        ///
+        template<encoding Encoding, line_break_policy Policy, std::forward_iterator It, std::sentinel_for<It> Sentinel>
+        [[nodiscard]] constexpr line_bounds<It> find_line_end(It it, const Sentinel end)
+        {
+            if constexpr (std::contiguous_iterator<It> && std::sized_sentinel_for<Sentinel, It>)
+            {
+                const auto size = static_cast<std::size_t>(end - it);
+
+                const auto [index, length] = find_line_break<Encoding, Policy>(std::to_address(it), size);
+
+                const It line_end = it + static_cast<std::iter_difference_t<It>>(index);
+
+                return line_bounds<It>{line_end, line_end + static_cast<std::iter_difference_t<It>>(length)};
+            }
+            else
+            {
+                // Every line break starts with a code unit that only ever starts a code point,
+                // so the sequence can be scanned one code unit at a time.
+                for (; it != end; ++it)
+                {
+                    It next = skip_line_break<Encoding, Policy>(it, end);
+
+                    if (next != it)
+                        return line_bounds<It>{std::move(it), std::move(next)};
+                }
+
+                return line_bounds<It>{it, it};
+            }
+        }
+    } // namespace impl::line_break
+} // namespace upp
+
+#endif // UNI_CPP_IMPL_LINE_BREAK_HPP
\ No newline at end of file
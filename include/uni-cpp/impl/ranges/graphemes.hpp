@@ -0,0 +1,279 @@
+#ifndef UNI_CPP_IMPL_RANGES_GRAPHEMES_HPP
+#define UNI_CPP_IMPL_RANGES_GRAPHEMES_HPP
+
+/// @file
+///
+/// @brief Defines a view that splits a valid code unit sequence into extended grapheme clusters.
+///
+
+#include "base.hpp"
+#include "view_interface.hpp"
+#include "valid_code_unit_range.hpp"
+
+#include "../../encoding.hpp"
+#include "../grapheme_break.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <concepts>
+#include <ranges>
+#include <utility>
+
+namespace upp::ranges
+{
+    /// @brief A view that splits a valid `Encoding` code unit sequence into extended grapheme clusters, as defined by
+    /// [UAX #29](https://www.unicode.org/reports/tr29/).
+    ///
+    /// Each element is a `std::ranges::subrange` of the underlying code units that form one grapheme cluster
+    /// (a user-perceived character), so clusters can be measured, copied or used to truncate text without splitting them.
+    ///
+    /// An ASCII character other than CR that is followed by another ASCII character is a cluster on its own,
+    /// so runs of ASCII text are split without looking up any character properties.
+    ///
+    /// @tparam View Underlying view type. Must be a forward range that models `valid_code_unit_range<View, Encoding>`.
+    ///
+    /// @tparam Encoding The encoding of the underlying code units.
+    ///
+    /// @note Users should use the @ref upp::views::graphemes "views::graphemes" range adaptors instead of using this type directly.
+    ///
+    /// @headerfile "" <uni-cpp/ranges.hpp>
+    ///
+    template<std::ranges::view View, encoding Encoding>
+        requires std::ranges::forward_range<View> && valid_code_unit_range<View, Encoding>
+    class graphemes_view : public UNI_CPP_IMPL_VIEW_INTERFACE(graphemes_view<View, Encoding>)
+    {
+    private:
+        template<bool>
+        class iterator;
+
+    public:
+        /// @brief Default constructor.
+        ///
+        graphemes_view()
+            requires std::default_initializable<View>
+        = default;
+
+        /// @brief Constructs the `graphemes_view` from the underlying view.
+        ///
+        constexpr explicit graphemes_view(View base)
+            : m_base(std::move(base))
+        {
+        }
+
+        /// @brief Constructs the `graphemes_view` from the underlying view.
+        ///
+        /// Tagged constructor for CTAD.
+        ///
+        constexpr graphemes_view(View base, encoding_tag_t<Encoding>)
+            : m_base(std::move(base))
+        {
+        }
+
+        /// @brief Returns a copy of the underlying view.
+        ///
+        constexpr View base() const&
+            requires std::copy_constructible<View>
+        {
+            return m_base;
+        }
+
+        /// @brief Returns the underlying view by moving it.
+        ///
+        constexpr View base() && { return std::move(m_base); }
+
+        /// @brief Returns an iterator to the first grapheme cluster.
+        ///
+        constexpr iterator<false> begin() { return iterator<false>(std::ranges::begin(m_base), std::ranges::end(m_base)); }
+
+        /// @brief Returns an iterator to the first grapheme cluster.
+        ///
+        constexpr iterator<true> begin() const
+            requires std::ranges::forward_range<const View> && valid_code_unit_range<const View, Encoding>
+        {
+            return iterator<true>(std::ranges::begin(m_base), std::ranges::end(m_base));
+        }
+
+        /// @brief Returns a sentinel marking the end of the range.
+        ///
+        constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+    private:
+        template<bool Const>
+        class iterator
+        {
+        private:
+            using base_t = impl::maybe_const<Const, View>;
+
+        public:
+            using iterator_concept  = std::forward_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+            using value_type        = std::ranges::subrange<std::ranges::iterator_t<base_t>>;
+            using difference_type   = std::ptrdiff_t;
+
+        public:
+            /// @brief Default constructor.
+            ///
+            iterator()
+                requires std::default_initializable<std::ranges::iterator_t<base_t>>
+            = default;
+
+            /// @brief Constructs a `const` iterator from a non-`const` iterator.
+            ///
+            constexpr explicit iterator(iterator<!Const> i)
+                requires Const && std::convertible_to<std::ranges::iterator_t<View>, std::ranges::iterator_t<base_t>> &&
+                             std::convertible_to<std::ranges::sentinel_t<View>, std::ranges::sentinel_t<base_t>>
+                : m_current{std::move(i.m_current)}, m_next{std::move(i.m_next)}, m_end{std::move(i.m_end)}
+            {
+            }
+
+            /// @brief Returns the code units of the current grapheme cluster.
+            ///
+            [[nodiscard]] constexpr value_type operator*() const { return value_type(m_current, m_next); }
+
+            /// @brief Advances the iterator to the next grapheme cluster.
+            ///
+            constexpr iterator& operator++()
+            {
+                m_current = m_next;
+                find_next_boundary();
+
+                return *this;
+            }
+
+            /// @brief Advances the iterator to the next grapheme cluster.
+            ///
+            constexpr iterator operator++(int)
+            {
+                iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            /// @brief Compares two iterators.
+            ///
+            friend constexpr bool operator==(const iterator& x, const iterator& y)
+                requires std::equality_comparable<std::ranges::iterator_t<base_t>>
+            {
+                return x.m_current == y.m_current;
+            }
+
+            /// @brief Compares an iterator with the end of the range.
+            ///
+            friend constexpr bool operator==(const iterator& x, std::default_sentinel_t) { return x.m_current == x.m_end; }
+
+        private:
+            constexpr iterator(std::ranges::iterator_t<base_t> current, std::ranges::sentinel_t<base_t> end)
+                : m_current{current}, m_next{std::move(current)}, m_end{std::move(end)}
+            {
+                find_next_boundary();
+            }
+
+            /// @brief Moves `m_next` to the end of the grapheme cluster that starts at `m_current`.
+            ///
+            constexpr void find_next_boundary()
+            {
+                if (m_current != m_end)
+                    m_next = upp::impl::grapheme_break::find_cluster_end<Encoding>(m_current, m_end);
+            }
+
+        private:
+            std::ranges::iterator_t<base_t> m_current = std::ranges::iterator_t<base_t>();
+            std::ranges::iterator_t<base_t> m_next    = std::ranges::iterator_t<base_t>();
+            std::ranges::sentinel_t<base_t> m_end     = std::ranges::sentinel_t<base_t>();
+
+            friend class graphemes_view;
+        };
+
+    private:
+        View m_base = View();
+    };
+
+    /// @cond
+
+    template<typename Range, encoding Encoding>
+    graphemes_view(Range&&, encoding_tag_t<Encoding>) -> graphemes_view<std::views::all_t<Range>, Encoding>;
+
+    /// @endcond
+
+    /// @brief Returns the number of extended grapheme clusters in a valid `Encoding` code unit sequence.
+    ///
+    /// Equivalent to `std::ranges::distance(range | views::graphemes<Encoding>)`, without constructing the view.
+    ///
+    /// @headerfile "" <uni-cpp/ranges.hpp>
+    ///
+    template<encoding Encoding, std::ranges::forward_range Range>
+        requires valid_code_unit_range<Range, Encoding>
+    [[nodiscard]] constexpr std::size_t count_graphemes(Range&& range)
+    {
+        auto       it  = std::ranges::begin(range);
+        const auto end = std::ranges::end(range);
+
+        std::size_t count = 0;
+
+        for (; it != end; ++count)
+            it = upp::impl::grapheme_break::find_cluster_end<Encoding>(std::move(it), end);
+
+        return count;
+    }
+
+    namespace impl
+    {
+        template<encoding Encoding>
+        struct graphemes_fn : public std::ranges::range_adaptor_closure<graphemes_fn<Encoding>>
+        {
+        public:
+            template<std::ranges::viewable_range Range>
+                requires std::ranges::forward_range<Range> && valid_code_unit_range<Range, Encoding>
+            [[nodiscard]] constexpr auto operator()(Range&& range) const
+            {
+                return graphemes_view(std::forward<Range>(range), encoding_tag<Encoding>);
+            }
+        };
+    } // namespace impl
+
+    namespace views
+    {
+        /// @brief Range adaptor that splits a valid `Encoding` code unit sequence into extended grapheme clusters.
+        ///
+        /// @tparam Encoding The encoding of the code units.
+        ///
+        /// @par Example
+        ///
+        /// @code{.cpp}
+        ///
+        /// using namespace std::string_view_literals;
+        ///
+        /// // "e" followed by U+0301 COMBINING ACUTE ACCENT, and the flag of Japan (two regional indicators)
+        /// auto utf8_sequence = u8"e\u0301\U0001F1EF\U0001F1F5!"sv | upp::views::mark_as_valid_utf8;
+        ///
+        /// // Yields the code units of "e\u0301", "\U0001F1EF\U0001F1F5" and "!"
+        /// auto clusters = utf8_sequence | upp::views::graphemes<upp::encoding::utf8>;
+        ///
+        /// @endcode
+        ///
+        /// @see count_graphemes
+        ///
+        template<encoding Encoding>
+        inline constexpr impl::graphemes_fn<Encoding> graphemes{};
+
+        /// @brief Range adaptor that splits a valid UTF-8 code unit sequence into extended grapheme clusters.
+        ///
+        /// @see @ref upp::ranges::views::graphemes "views::graphemes"
+        ///
+        inline constexpr impl::graphemes_fn<encoding::utf8> graphemes_utf8{};
+
+        /// @brief Range adaptor that splits a valid UTF-16 code unit sequence into extended grapheme clusters.
+        ///
+        /// @see @ref upp::ranges::views::graphemes "views::graphemes"
+        ///
+        inline constexpr impl::graphemes_fn<encoding::utf16> graphemes_utf16{};
+
+        /// @brief Range adaptor that splits a valid UTF-32 code unit sequence into extended grapheme clusters.
+        ///
+        /// @see @ref upp::ranges::views::graphemes "views::graphemes"
+        ///
+        inline constexpr impl::graphemes_fn<encoding::utf32> graphemes_utf32{};
+    } // namespace views
+} // namespace upp::ranges
+
+#endif // UNI_CPP_IMPL_RANGES_GRAPHEMES_HPP
\ No newline at end of file
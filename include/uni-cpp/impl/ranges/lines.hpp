@@ -0,0 +1,295 @@
+#ifndef UNI_CPP_IMPL_RANGES_LINES_HPP
+#define UNI_CPP_IMPL_RANGES_LINES_HPP
+
+/// @file
+///
+/// @brief Defines a view that splits a valid code unit sequence into lines.
+///
+
+#include "base.hpp"
+#include "view_interface.hpp"
+#include "valid_code_unit_range.hpp"
+
+#include "../../encoding.hpp"
+#include "../line_break.hpp"
+#include "../text_metadata.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <concepts>
+#include <ranges>
+#include <utility>
+
+namespace upp::ranges
+{
+    /// @brief A view that splits a valid `Encoding` code unit sequence into lines.
+    ///
+    /// Each element is a `std::ranges::subrange` of the underlying code units of one line, without its line break.
+    /// Which sequences end a line is selected by `Policy`. A line break at the very end of the sequence doesn't start another line,
+    /// so `"a\nb\n"` and `"a\nb"` both have the lines `"a"` and `"b"`, and an empty sequence has no lines at all.
+    ///
+    /// Contiguous sequences are scanned a word at a time for the code units that can start a line break,
+    /// so long lines are skipped over without looking at every code unit on its own.
+    ///
+    /// @tparam View Underlying view type. Must be a forward range that models `valid_code_unit_range<View, Encoding>`.
+    ///
+    /// @tparam Encoding The encoding of the underlying code units.
+    ///
+    /// @tparam Policy Which sequences end a line.
+    ///
+    /// @note Users should use the @ref upp::views::lines "views::lines" range adaptors instead of using this type directly.
+    ///
+    /// @headerfile "" <uni-cpp/ranges.hpp>
+    ///
+    template<std::ranges::view View, encoding Encoding, line_break_policy Policy>
+        requires std::ranges::forward_range<View> && valid_code_unit_range<View, Encoding>
+    class lines_view : public UNI_CPP_IMPL_VIEW_INTERFACE(lines_view<View, Encoding, Policy>)
+    {
+    private:
+        template<bool>
+        class iterator;
+
+    public:
+        /// @brief Default constructor.
+        ///
+        lines_view()
+            requires std::default_initializable<View>
+        = default;
+
+        /// @brief Constructs the `lines_view` from the underlying view.
+        ///
+        constexpr explicit lines_view(View base)
+            : m_base(std::move(base))
+        {
+        }
+
+        /// @brief Returns a copy of the underlying view.
+        ///
+        constexpr View base() const&
+            requires std::copy_constructible<View>
+        {
+            return m_base;
+        }
+
+        /// @brief Returns the underlying view by moving it.
+        ///
+        constexpr View base() && { return std::move(m_base); }
+
+        /// @brief Returns an iterator to the first line.
+        ///
+        constexpr iterator<false> begin() { return iterator<false>(std::ranges::begin(m_base), std::ranges::end(m_base)); }
+
+        /// @brief Returns an iterator to the first line.
+        ///
+        constexpr iterator<true> begin() const
+            requires std::ranges::forward_range<const View> && valid_code_unit_range<const View, Encoding>
+        {
+            return iterator<true>(std::ranges::begin(m_base), std::ranges::end(m_base));
+        }
+
+        /// @brief Returns a sentinel marking the end of the range.
+        ///
+        constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+    private:
+        template<bool Const>
+        class iterator
+        {
+        private:
+            using base_t = impl::maybe_const<Const, View>;
+
+        public:
+            using iterator_concept  = std::forward_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+            using value_type        = std::ranges::subrange<std::ranges::iterator_t<base_t>>;
+            using difference_type   = std::ptrdiff_t;
+
+        public:
+            /// @brief Default constructor.
+            ///
+            iterator()
+                requires std::default_initializable<std::ranges::iterator_t<base_t>>
+            = default;
+
+            /// @brief Constructs a `const` iterator from a non-`const` iterator.
+            ///
+            constexpr explicit iterator(iterator<!Const> i)
+                requires Const && std::convertible_to<std::ranges::iterator_t<View>, std::ranges::iterator_t<base_t>> &&
+                             std::convertible_to<std::ranges::sentinel_t<View>, std::ranges::sentinel_t<base_t>>
+                : m_current{std::move(i.m_current)}, m_line_end{std::move(i.m_line_end)}, m_next{std::move(i.m_next)}, m_end{std::move(i.m_end)}
+            {
+            }
+
+            /// @brief Returns the code units of the current line, without its line break.
+            ///
+            [[nodiscard]] constexpr value_type operator*() const { return value_type(m_current, m_line_end); }
+
+            /// @brief Advances the iterator to the next line.
+            ///
+            constexpr iterator& operator++()
+            {
+                m_current = m_next;
+                find_line_end();
+
+                return *this;
+            }
+
+            /// @brief Advances the iterator to the next line.
+            ///
+            constexpr iterator operator++(int)
+            {
+                iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            /// @brief Compares two iterators.
+            ///
+            friend constexpr bool operator==(const iterator& x, const iterator& y)
+                requires std::equality_comparable<std::ranges::iterator_t<base_t>>
+            {
+                return x.m_current == y.m_current;
+            }
+
+            /// @brief Compares an iterator with the end of the range.
+            ///
+            friend constexpr bool operator==(const iterator& x, std::default_sentinel_t) { return x.m_current == x.m_end; }
+
+        private:
+            constexpr iterator(std::ranges::iterator_t<base_t> current, std::ranges::sentinel_t<base_t> end)
+                : m_current{std::move(current)}, m_end{std::move(end)}
+            {
+                find_line_end();
+            }
+
+            /// @brief Moves `m_line_end` and `m_next` to the end of the line that starts at `m_current`.
+            ///
+            constexpr void find_line_end()
+            {
+                if (m_current == m_end)
+                    return;
+
+                auto [line_end, next_line] = upp::impl::line_break::find_line_end<Encoding, Policy>(m_current, m_end);
+
+                m_line_end = std::move(line_end);
+                m_next     = std::move(next_line);
+            }
+
+        private:
+            std::ranges::iterator_t<base_t> m_current  = std::ranges::iterator_t<base_t>();
+            std::ranges::iterator_t<base_t> m_line_end = std::ranges::iterator_t<base_t>();
+            std::ranges::iterator_t<base_t> m_next     = std::ranges::iterator_t<base_t>();
+            std::ranges::sentinel_t<base_t> m_end      = std::ranges::sentinel_t<base_t>();
+
+            friend class lines_view;
+        };
+
+    private:
+        View m_base = View();
+    };
+
+    /// @brief Returns the number of lines in a valid `Encoding` code unit sequence.
+    ///
+    /// Equivalent to `std::ranges::distance(range | views::lines<Encoding, Policy>)`, without constructing the view.
+    /// With `line_break_policy::lf`, the line feeds of a contiguous UTF-8 sequence are counted a word at a time
+    /// instead of finding the end of every line.
+    ///
+    /// @headerfile "" <uni-cpp/ranges.hpp>
+    ///
+    template<encoding Encoding, line_break_policy Policy = line_break_policy::unicode, std::ranges::forward_range Range>
+        requires valid_code_unit_range<Range, Encoding>
+    [[nodiscard]] constexpr std::size_t count_lines(Range&& range)
+    {
+        if constexpr (Policy == line_break_policy::lf && std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range>)
+        {
+            const auto* const data = std::ranges::data(range);
+            const std::size_t size = std::ranges::size(range);
+
+            if (size == 0)
+                return 0;
+
+            // The last line only ends with a line feed if it isn't the end of the sequence.
+            const bool unterminated = upp::impl::text_metadata::code_unit_value(data[size - 1]) != 0x0AU;
+
+            return upp::impl::text_metadata::count_line_feeds(data, size) + (unterminated ? 1 : 0);
+        }
+        else
+        {
+            auto       it  = std::ranges::begin(range);
+            const auto end = std::ranges::end(range);
+
+            std::size_t count = 0;
+
+            for (; it != end; ++count)
+                it = upp::impl::line_break::find_line_end<Encoding, Policy>(std::move(it), end).next_line;
+
+            return count;
+        }
+    }
+
+    namespace impl
+    {
+        template<encoding Encoding, line_break_policy Policy>
+        struct lines_fn : public std::ranges::range_adaptor_closure<lines_fn<Encoding, Policy>>
+        {
+        public:
+            template<std::ranges::viewable_range Range>
+                requires std::ranges::forward_range<Range> && valid_code_unit_range<Range, Encoding>
+            [[nodiscard]] constexpr auto operator()(Range&& range) const
+            {
+                return lines_view<std::views::all_t<Range>, Encoding, Policy>(std::views::all(std::forward<Range>(range)));
+            }
+        };
+    } // namespace impl
+
+    namespace views
+    {
+        /// @brief Range adaptor that splits a valid `Encoding` code unit sequence into lines.
+        ///
+        /// @tparam Encoding The encoding of the code units.
+        ///
+        /// @tparam Policy Which sequences end a line. By default, every Unicode line break ends a line:
+        ///         LF, CR LF, CR, NEL (U+0085), LS (U+2028) and PS (U+2029).
+        ///
+        /// @par Example
+        ///
+        /// @code{.cpp}
+        ///
+        /// using namespace std::string_view_literals;
+        ///
+        /// auto utf8_sequence = u8"GET / HTTP/1.1\r\nHost: example.com\r\n\r\n"sv | upp::views::mark_as_valid_utf8;
+        ///
+        /// // Yields the code units of "GET / HTTP/1.1", "Host: example.com" and ""
+        /// auto lines = utf8_sequence | upp::views::lines<upp::encoding::utf8>;
+        ///
+        /// // Yields the code units of "a\rb" and "c"
+        /// auto lf_lines = u8"a\rb\nc"sv | upp::views::mark_as_valid_utf8 | upp::views::lines<upp::encoding::utf8, upp::line_break_policy::lf>;
+        ///
+        /// @endcode
+        ///
+        /// @see count_lines
+        ///
+        template<encoding Encoding, line_break_policy Policy = line_break_policy::unicode>
+        inline constexpr impl::lines_fn<Encoding, Policy> lines{};
+
+        /// @brief Range adaptor that splits a valid UTF-8 code unit sequence into lines at every Unicode line break.
+        ///
+        /// @see @ref upp::ranges::views::lines "views::lines"
+        ///
+        inline constexpr impl::lines_fn<encoding::utf8, line_break_policy::unicode> lines_utf8{};
+
+        /// @brief Range adaptor that splits a valid UTF-16 code unit sequence into lines at every Unicode line break.
+        ///
+        /// @see @ref upp::ranges::views::lines "views::lines"
+        ///
+        inline constexpr impl::lines_fn<encoding::utf16, line_break_policy::unicode> lines_utf16{};
+
+        /// @brief Range adaptor that splits a valid UTF-32 code unit sequence into lines at every Unicode line break.
+        ///
+        /// @see @ref upp::ranges::views::lines "views::lines"
+        ///
+        inline constexpr impl::lines_fn<encoding::utf32, line_break_policy::unicode> lines_utf32{};
+    } // namespace views
+} // namespace upp::ranges
+
+#endif // UNI_CPP_IMPL_RANGES_LINES_HPP
\ No newline at end of file
@@ -0,0 +1,310 @@
+#ifndef UNI_CPP_IMPL_RANGES_NORMALIZE_HPP
+#define UNI_CPP_IMPL_RANGES_NORMALIZE_HPP
+
+/// @file
+///
+/// @brief Defines a view that lazily normalizes a range of code points.
+///
+
+#include "base.hpp"
+#include "approximately_sized_range.hpp"
+#include "view_interface.hpp"
+
+#include "../../uchar.hpp"
+#include "../../encoding.hpp"
+#include "../../normalization.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <concepts>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace upp::ranges
+{
+    /// @brief A view that lazily converts a range of `uchar`s to the normalization form `Form`.
+    ///
+    /// The underlying range is processed one normalization segment at a time. A segment is a starter that is unchanged
+    /// by `Form` together with all the following code points that may interact with it. Segments that consist
+    /// of such a starter alone (most of the text) are passed through without being decomposed.
+    ///
+    /// @tparam View Underlying view type. Must be a forward range of `uchar`s.
+    ///
+    /// @tparam Form The normalization form.
+    ///
+    /// @note Users should use the @ref upp::views::normalize "views::normalize" range adaptors instead of using this type directly.
+    ///
+    /// @headerfile "" <uni-cpp/ranges.hpp>
+    ///
+    template<std::ranges::view View, normalization_form Form>
+        requires std::ranges::forward_range<View> && std::same_as<std::ranges::range_value_t<View>, uchar>
+    class normalize_view : public UNI_CPP_IMPL_VIEW_INTERFACE(normalize_view<View, Form>)
+    {
+    private:
+        template<bool>
+        class iterator;
+
+    public:
+        /// @brief Default constructor.
+        ///
+        normalize_view()
+            requires std::default_initializable<View>
+        = default;
+
+        /// @brief Constructs the `normalize_view` from the underlying view.
+        ///
+        constexpr explicit normalize_view(View base)
+            : m_base(std::move(base))
+        {
+        }
+
+        /// @brief Constructs the `normalize_view` from the underlying view.
+        ///
+        /// Tagged constructor for CTAD.
+        ///
+        constexpr normalize_view(View base, nontype_t<Form>)
+            : m_base(std::move(base))
+        {
+        }
+
+        /// @brief Returns a copy of the underlying view.
+        ///
+        constexpr View base() const&
+            requires std::copy_constructible<View>
+        {
+            return m_base;
+        }
+
+        /// @brief Returns the underlying view by moving it.
+        ///
+        constexpr View base() && { return std::move(m_base); }
+
+        /// @brief Returns an iterator to the beginning of the range.
+        ///
+        constexpr iterator<false> begin() { return iterator<false>(std::ranges::begin(m_base), std::ranges::end(m_base)); }
+
+        /// @brief Returns an iterator to the beginning of the range.
+        ///
+        constexpr iterator<true> begin() const
+            requires std::ranges::forward_range<const View> && std::same_as<std::ranges::range_value_t<const View>, uchar>
+        {
+            return iterator<true>(std::ranges::begin(m_base), std::ranges::end(m_base));
+        }
+
+        /// @brief Returns a sentinel marking the end of the range.
+        ///
+        constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+        /// @brief Returns an approximate size of the range.
+        ///
+        /// Normalization rarely changes the number of code points much, so this is the size of the underlying view.
+        ///
+        constexpr auto reserve_hint()
+            requires approximately_sized_range<View>
+        {
+            return ranges::reserve_hint(m_base);
+        }
+
+        /// @brief Returns an approximate size of the range.
+        ///
+        constexpr auto reserve_hint() const
+            requires approximately_sized_range<const View>
+        {
+            return ranges::reserve_hint(m_base);
+        }
+
+    private:
+        template<bool Const>
+        class iterator
+        {
+        private:
+            using base_t = impl::maybe_const<Const, View>;
+
+        public:
+            using iterator_concept  = std::forward_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+            using value_type        = uchar;
+            using difference_type   = std::ptrdiff_t;
+
+        public:
+            /// @brief Default constructor.
+            ///
+            iterator()
+                requires std::default_initializable<std::ranges::iterator_t<base_t>>
+            = default;
+
+            /// @brief Constructs a `const` iterator from a non-`const` iterator.
+            ///
+            constexpr explicit iterator(iterator<!Const> i)
+                requires Const && std::convertible_to<std::ranges::iterator_t<View>, std::ranges::iterator_t<base_t>> &&
+                             std::convertible_to<std::ranges::sentinel_t<View>, std::ranges::sentinel_t<base_t>>
+                : m_next{std::move(i.m_next)}, m_end{std::move(i.m_end)}, m_buffer{std::move(i.m_buffer)}, m_position{i.m_position}
+            {
+            }
+
+            /// @brief Returns the current code point.
+            ///
+            [[nodiscard]] constexpr uchar operator*() const
+            {
+                return uchar::from_unchecked(upp::impl::normalization::code_point_of(m_buffer[m_position]));
+            }
+
+            /// @brief Advances the iterator to the next code point.
+            ///
+            constexpr iterator& operator++()
+            {
+                if (++m_position == m_buffer.size())
+                    read_next_segment();
+
+                return *this;
+            }
+
+            /// @brief Advances the iterator to the next code point.
+            ///
+            constexpr iterator operator++(int)
+            {
+                iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            /// @brief Compares two iterators.
+            ///
+            friend constexpr bool operator==(const iterator& x, const iterator& y)
+                requires std::equality_comparable<std::ranges::iterator_t<base_t>>
+            {
+                // `m_next` points past the current segment, so it identifies the segment.
+                return x.m_next == y.m_next && x.m_position == y.m_position;
+            }
+
+            /// @brief Compares an iterator with the end of the range.
+            ///
+            friend constexpr bool operator==(const iterator& x, std::default_sentinel_t) noexcept { return x.m_buffer.empty(); }
+
+        private:
+            constexpr iterator(std::ranges::iterator_t<base_t> current, std::ranges::sentinel_t<base_t> end)
+                : m_next{std::move(current)}, m_end{std::move(end)}
+            {
+                read_next_segment();
+            }
+
+            /// @brief Reads and normalizes the segment starting at `m_next`. Leaves the buffer empty at the end of the underlying range.
+            ///
+            constexpr void read_next_segment()
+            {
+                namespace normalization = upp::impl::normalization;
+
+                m_buffer.clear();
+                m_position = 0;
+
+                if (m_next == m_end)
+                    return;
+
+                const std::uint32_t first = (*m_next).value();
+                ++m_next;
+
+                if (normalization::is_segment_start<Form>(first) && (m_next == m_end || normalization::is_segment_start<Form>((*m_next).value())))
+                {
+                    // A lone starter that is unchanged by `Form` is already normalized.
+                    m_buffer.push_back(first);
+                    return;
+                }
+
+                normalization::decompose<Form>(first, m_buffer);
+
+                for (; m_next != m_end && !normalization::is_segment_start<Form>((*m_next).value()); ++m_next)
+                    normalization::decompose<Form>((*m_next).value(), m_buffer);
+
+                normalization::normalize_decomposed<Form>(m_buffer);
+            }
+
+        private:
+            std::ranges::iterator_t<base_t> m_next = std::ranges::iterator_t<base_t>();
+            std::ranges::sentinel_t<base_t> m_end  = std::ranges::sentinel_t<base_t>();
+
+            std::vector<std::uint32_t> m_buffer;
+            std::size_t                m_position = 0;
+
+            friend class normalize_view;
+        };
+
+    private:
+        View m_base = View();
+    };
+
+    /// @cond
+
+    template<typename Range, normalization_form Form>
+    normalize_view(Range&&, nontype_t<Form>) -> normalize_view<std::views::all_t<Range>, Form>;
+
+    /// @endcond
+
+    namespace impl
+    {
+        template<normalization_form Form>
+        struct normalize_fn : public std::ranges::range_adaptor_closure<normalize_fn<Form>>
+        {
+        public:
+            template<std::ranges::viewable_range Range>
+                requires std::ranges::forward_range<Range> && std::same_as<std::ranges::range_value_t<Range>, uchar>
+            [[nodiscard]] constexpr auto operator()(Range&& range) const
+            {
+                return normalize_view(std::forward<Range>(range), nontype<Form>);
+            }
+        };
+    } // namespace impl
+
+    namespace views
+    {
+        /// @brief Range adaptor that lazily converts a range of `uchar`s to the normalization form `Form`.
+        ///
+        /// @tparam Form The normalization form.
+        ///
+        /// @par Example
+        ///
+        /// @code{.cpp}
+        ///
+        /// using namespace std::string_view_literals;
+        ///
+        /// // "A" followed by U+030A COMBINING RING ABOVE
+        /// auto utf8_sequence = u8"A\u030A"sv | upp::views::mark_as_valid_utf8;
+        ///
+        /// // Yields U+00C5 (LATIN CAPITAL LETTER A WITH RING ABOVE)
+        /// auto nfc = utf8_sequence | upp::views::decode_valid_utf8 | upp::views::normalize<upp::normalization_form::nfc>;
+        ///
+        /// @endcode
+        ///
+        /// @see basic_ustring::normalize
+        ///
+        template<normalization_form Form>
+        inline constexpr impl::normalize_fn<Form> normalize{};
+
+        /// @brief Range adaptor that lazily converts a range of `uchar`s to NFC.
+        ///
+        /// @see @ref upp::ranges::views::normalize "views::normalize"
+        ///
+        inline constexpr impl::normalize_fn<normalization_form::nfc> normalize_nfc{};
+
+        /// @brief Range adaptor that lazily converts a range of `uchar`s to NFD.
+        ///
+        /// @see @ref upp::ranges::views::normalize "views::normalize"
+        ///
+        inline constexpr impl::normalize_fn<normalization_form::nfd> normalize_nfd{};
+
+        /// @brief Range adaptor that lazily converts a range of `uchar`s to NFKC.
+        ///
+        /// @see @ref upp::ranges::views::normalize "views::normalize"
+        ///
+        inline constexpr impl::normalize_fn<normalization_form::nfkc> normalize_nfkc{};
+
+        /// @brief Range adaptor that lazily converts a range of `uchar`s to NFKD.
+        ///
+        /// @see @ref upp::ranges::views::normalize "views::normalize"
+        ///
+        inline constexpr impl::normalize_fn<normalization_form::nfkd> normalize_nfkd{};
+    } // namespace views
+} // namespace upp::ranges
+
+#endif // UNI_CPP_IMPL_RANGES_NORMALIZE_HPP
\ No newline at end of file
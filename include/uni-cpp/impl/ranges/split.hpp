@@ -0,0 +1,421 @@
+#ifndef UNI_CPP_IMPL_RANGES_SPLIT_HPP
+#define UNI_CPP_IMPL_RANGES_SPLIT_HPP
+
+/// @file
+///
+/// @brief Defines a view that splits a valid code unit sequence at code point delimiters or at whitespace.
+///
+
+#include "base.hpp"
+#include "view_interface.hpp"
+#include "valid_code_unit_range.hpp"
+
+#include "../../uchar.hpp"
+#include "../../encoding.hpp"
+#include "../split.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <concepts>
+#include <initializer_list>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+namespace upp::ranges
+{
+    /// @brief A view that splits a valid `Encoding` code unit sequence at the delimiters that `Delimiter` finds.
+    ///
+    /// Each element is a `std::ranges::subrange` of the underlying code units between two delimiters.
+    /// A code point delimiter (@ref upp::views::split_on "views::split_on", @ref upp::views::split_on_any "views::split_on_any")
+    /// splits like `std::views::split`: adjacent delimiters and delimiters at either end produce empty elements,
+    /// and an empty sequence has no elements. A run of whitespace (@ref upp::views::split_whitespace "views::split_whitespace")
+    /// is a single delimiter, and whitespace at either end is skipped, so there are no empty elements.
+    ///
+    /// Contiguous sequences are scanned a word at a time for the code units that can start a delimiter,
+    /// so the code points between delimiters are not decoded.
+    ///
+    /// @tparam View Underlying view type. Must be a forward range that models `valid_code_unit_range<View, Encoding>`.
+    ///
+    /// @tparam Encoding The encoding of the underlying code units.
+    ///
+    /// @tparam Delimiter The implementation of the delimiter search.
+    ///
+    /// @note Users should use the @ref upp::views::split_on "views::split_on", @ref upp::views::split_on_any "views::split_on_any"
+    ///       and @ref upp::views::split_whitespace "views::split_whitespace" range adaptors instead of using this type directly.
+    ///
+    /// @headerfile "" <uni-cpp/ranges.hpp>
+    ///
+    template<std::ranges::view View, encoding Encoding, typename Delimiter>
+        requires std::ranges::forward_range<View> && valid_code_unit_range<View, Encoding>
+    class split_view : public UNI_CPP_IMPL_VIEW_INTERFACE(split_view<View, Encoding, Delimiter>)
+    {
+    private:
+        template<bool>
+        class iterator;
+
+    public:
+        /// @brief Constructs the `split_view` from the underlying view and the delimiter.
+        ///
+        constexpr split_view(View base, Delimiter delimiter)
+            : m_base(std::move(base)), m_delimiter(std::move(delimiter))
+        {
+        }
+
+        /// @brief Returns a copy of the underlying view.
+        ///
+        constexpr View base() const&
+            requires std::copy_constructible<View>
+        {
+            return m_base;
+        }
+
+        /// @brief Returns the underlying view by moving it.
+        ///
+        constexpr View base() && { return std::move(m_base); }
+
+        /// @brief Returns an iterator to the first element.
+        ///
+        constexpr iterator<false> begin() { return iterator<false>(m_delimiter, std::ranges::begin(m_base), std::ranges::end(m_base)); }
+
+        /// @brief Returns an iterator to the first element.
+        ///
+        constexpr iterator<true> begin() const
+            requires std::ranges::forward_range<const View> && valid_code_unit_range<const View, Encoding>
+        {
+            return iterator<true>(m_delimiter, std::ranges::begin(m_base), std::ranges::end(m_base));
+        }
+
+        /// @brief Returns a sentinel marking the end of the range.
+        ///
+        constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+    private:
+        template<bool Const>
+        class iterator
+        {
+        private:
+            using base_t = impl::maybe_const<Const, View>;
+
+        public:
+            using iterator_concept  = std::forward_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+            using value_type        = std::ranges::subrange<std::ranges::iterator_t<base_t>>;
+            using difference_type   = std::ptrdiff_t;
+
+        public:
+            /// @brief Default constructor.
+            ///
+            iterator()
+                requires std::default_initializable<std::ranges::iterator_t<base_t>>
+            = default;
+
+            /// @brief Constructs a `const` iterator from a non-`const` iterator.
+            ///
+            constexpr explicit iterator(iterator<!Const> i)
+                requires Const && std::convertible_to<std::ranges::iterator_t<View>, std::ranges::iterator_t<base_t>> &&
+                             std::convertible_to<std::ranges::sentinel_t<View>, std::ranges::sentinel_t<base_t>>
+                : m_delimiter{i.m_delimiter}, m_current{std::move(i.m_current)}, m_delimiter_begin{std::move(i.m_delimiter_begin)},
+                  m_delimiter_end{std::move(i.m_delimiter_end)}, m_end{std::move(i.m_end)}, m_trailing_empty{i.m_trailing_empty}
+            {
+            }
+
+            /// @brief Returns the code units of the current element.
+            ///
+            [[nodiscard]] constexpr value_type operator*() const { return value_type(m_current, m_delimiter_begin); }
+
+            /// @brief Advances the iterator to the next element.
+            ///
+            constexpr iterator& operator++()
+            {
+                // The current element reaches the end of the sequence.
+                if (m_delimiter_begin == m_end)
+                {
+                    m_current        = m_delimiter_begin;
+                    m_trailing_empty = false;
+
+                    return *this;
+                }
+
+                m_current = m_delimiter_end;
+
+                // A delimiter at the end of the sequence is followed by an empty element, unless whitespace at the end is skipped.
+                if (m_current == m_end)
+                {
+                    m_delimiter_begin = m_current;
+                    m_trailing_empty  = !Delimiter::collapses_runs;
+                }
+                else
+                {
+                    find_delimiter();
+                }
+
+                return *this;
+            }
+
+            /// @brief Advances the iterator to the next element.
+            ///
+            constexpr iterator operator++(int)
+            {
+                iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            /// @brief Compares two iterators.
+            ///
+            friend constexpr bool operator==(const iterator& x, const iterator& y)
+                requires std::equality_comparable<std::ranges::iterator_t<base_t>>
+            {
+                return x.m_current == y.m_current && x.m_trailing_empty == y.m_trailing_empty;
+            }
+
+            /// @brief Compares an iterator with the end of the range.
+            ///
+            friend constexpr bool operator==(const iterator& x, std::default_sentinel_t)
+            {
+                return x.m_current == x.m_end && !x.m_trailing_empty;
+            }
+
+        private:
+            constexpr iterator(const Delimiter& delimiter, std::ranges::iterator_t<base_t> current, std::ranges::sentinel_t<base_t> end)
+                : m_delimiter{std::addressof(delimiter)}, m_current{std::move(current)}, m_end{std::move(end)}
+            {
+                if constexpr (Delimiter::collapses_runs)
+                    m_current = delimiter.skip(std::move(m_current), m_end);
+
+                find_delimiter();
+            }
+
+            /// @brief Moves `m_delimiter_begin` and `m_delimiter_end` to the first delimiter at or after `m_current`.
+            ///
+            constexpr void find_delimiter()
+            {
+                auto [delimiter_begin, delimiter_end] = upp::impl::split::find(*m_delimiter, m_current, m_end);
+
+                m_delimiter_begin = std::move(delimiter_begin);
+                m_delimiter_end   = std::move(delimiter_end);
+            }
+
+        private:
+            const Delimiter*                m_delimiter       = nullptr;
+            std::ranges::iterator_t<base_t> m_current         = std::ranges::iterator_t<base_t>();
+            std::ranges::iterator_t<base_t> m_delimiter_begin = std::ranges::iterator_t<base_t>();
+            std::ranges::iterator_t<base_t> m_delimiter_end   = std::ranges::iterator_t<base_t>();
+            std::ranges::sentinel_t<base_t> m_end             = std::ranges::sentinel_t<base_t>();
+            bool                            m_trailing_empty  = false;
+
+            friend class split_view;
+        };
+
+    private:
+        View      m_base;
+        Delimiter m_delimiter;
+    };
+
+    namespace impl
+    {
+        template<encoding Encoding, typename Delimiter>
+        class split_closure : public std::ranges::range_adaptor_closure<split_closure<Encoding, Delimiter>>
+        {
+        public:
+            constexpr explicit split_closure(Delimiter delimiter)
+                : m_delimiter(std::move(delimiter))
+            {
+            }
+
+            template<std::ranges::viewable_range Range>
+                requires std::ranges::forward_range<Range> && valid_code_unit_range<Range, Encoding>
+            [[nodiscard]] constexpr auto operator()(Range&& range) const
+            {
+                return split_view<std::views::all_t<Range>, Encoding, Delimiter>(std::views::all(std::forward<Range>(range)), m_delimiter);
+            }
+
+        private:
+            Delimiter m_delimiter;
+        };
+
+        template<encoding Encoding>
+        struct split_on_fn
+        {
+        public:
+            template<std::ranges::viewable_range Range>
+                requires std::ranges::forward_range<Range> && valid_code_unit_range<Range, Encoding>
+            [[nodiscard]] constexpr auto operator()(Range&& range, const uchar delimiter) const
+            {
+                return (*this)(delimiter)(std::forward<Range>(range));
+            }
+
+            [[nodiscard]] constexpr auto operator()(const uchar delimiter) const
+            {
+                using delimiter_type = upp::impl::split::code_point_delimiter<Encoding>;
+
+                return split_closure<Encoding, delimiter_type>(delimiter_type(delimiter));
+            }
+        };
+
+        template<encoding Encoding>
+        struct split_on_any_fn
+        {
+        public:
+            template<std::ranges::viewable_range Range>
+                requires std::ranges::forward_range<Range> && valid_code_unit_range<Range, Encoding>
+            [[nodiscard]] constexpr auto operator()(Range&& range, const std::initializer_list<uchar> delimiters) const
+            {
+                return (*this)(delimiters)(std::forward<Range>(range));
+            }
+
+            [[nodiscard]] constexpr auto operator()(const std::initializer_list<uchar> delimiters) const
+            {
+                using delimiter_type = upp::impl::split::code_point_set_delimiter<Encoding>;
+
+                return split_closure<Encoding, delimiter_type>(delimiter_type(delimiters));
+            }
+        };
+    } // namespace impl
+
+    namespace views
+    {
+        /// @brief Range adaptor that splits a valid `Encoding` code unit sequence at every occurrence of a code point.
+        ///
+        /// The delimiter is encoded once and searched for like a substring, a word at a time for contiguous sequences.
+        ///
+        /// @tparam Encoding The encoding of the code units.
+        ///
+        /// @par Example
+        ///
+        /// @code{.cpp}
+        ///
+        /// using namespace std::string_view_literals;
+        /// using namespace upp::char_literals;
+        ///
+        /// auto utf8_sequence = u8"a\u3001b\u3001\u3001c"sv | upp::views::mark_as_valid_utf8;
+        ///
+        /// // Yields the code units of "a", "b", "" and "c"
+        /// auto fields = utf8_sequence | upp::views::split_on<upp::encoding::utf8>(U'\u3001'_uc);
+        ///
+        /// @endcode
+        ///
+        /// @see split_on_any, split_whitespace
+        ///
+        template<encoding Encoding>
+        inline constexpr impl::split_on_fn<Encoding> split_on{};
+
+        /// @brief Range adaptor that splits a valid UTF-8 code unit sequence at every occurrence of a code point.
+        ///
+        /// @see @ref upp::ranges::views::split_on "views::split_on"
+        ///
+        inline constexpr impl::split_on_fn<encoding::utf8> split_on_utf8{};
+
+        /// @brief Range adaptor that splits a valid UTF-16 code unit sequence at every occurrence of a code point.
+        ///
+        /// @see @ref upp::ranges::views::split_on "views::split_on"
+        ///
+        inline constexpr impl::split_on_fn<encoding::utf16> split_on_utf16{};
+
+        /// @brief Range adaptor that splits a valid UTF-32 code unit sequence at every occurrence of a code point.
+        ///
+        /// @see @ref upp::ranges::views::split_on "views::split_on"
+        ///
+        inline constexpr impl::split_on_fn<encoding::utf32> split_on_utf32{};
+
+        /// @brief Range adaptor that splits a valid `Encoding` code unit sequence at every occurrence of any of up to 16 code points.
+        ///
+        /// Contiguous sequences are scanned a word at a time for the first code units of the delimiters,
+        /// and only the code points that start with one of them are decoded.
+        ///
+        /// @tparam Encoding The encoding of the code units.
+        ///
+        /// @throws std::bad_alloc if more than 16 delimiters are given.
+        ///
+        /// @par Example
+        ///
+        /// @code{.cpp}
+        ///
+        /// using namespace std::string_view_literals;
+        /// using namespace upp::char_literals;
+        ///
+        /// auto utf8_sequence = u8"a,b\u00A6c"sv | upp::views::mark_as_valid_utf8;
+        ///
+        /// // Yields the code units of "a", "b" and "c"
+        /// auto fields = utf8_sequence | upp::views::split_on_any<upp::encoding::utf8>({U','_uc, U'\u00A6'_uc});
+        ///
+        /// @endcode
+        ///
+        /// @see split_on, split_whitespace
+        ///
+        template<encoding Encoding>
+        inline constexpr impl::split_on_any_fn<Encoding> split_on_any{};
+
+        /// @brief Range adaptor that splits a valid UTF-8 code unit sequence at every occurrence of any of up to 16 code points.
+        ///
+        /// @see @ref upp::ranges::views::split_on_any "views::split_on_any"
+        ///
+        inline constexpr impl::split_on_any_fn<encoding::utf8> split_on_any_utf8{};
+
+        /// @brief Range adaptor that splits a valid UTF-16 code unit sequence at every occurrence of any of up to 16 code points.
+        ///
+        /// @see @ref upp::ranges::views::split_on_any "views::split_on_any"
+        ///
+        inline constexpr impl::split_on_any_fn<encoding::utf16> split_on_any_utf16{};
+
+        /// @brief Range adaptor that splits a valid UTF-32 code unit sequence at every occurrence of any of up to 16 code points.
+        ///
+        /// @see @ref upp::ranges::views::split_on_any "views::split_on_any"
+        ///
+        inline constexpr impl::split_on_any_fn<encoding::utf32> split_on_any_utf32{};
+
+        /// @brief Range adaptor that splits a valid `Encoding` code unit sequence into the words between runs of whitespace
+        ///        (code points with the `White_Space` property).
+        ///
+        /// Whitespace at the beginning and the end is skipped, so none of the words are empty.
+        ///
+        /// @tparam Encoding The encoding of the code units.
+        ///
+        /// @par Example
+        ///
+        /// @code{.cpp}
+        ///
+        /// using namespace std::string_view_literals;
+        ///
+        /// auto utf8_sequence = u8"  one\u3000two \t three\n"sv | upp::views::mark_as_valid_utf8;
+        ///
+        /// // Yields the code units of "one", "two" and "three"
+        /// auto words = utf8_sequence | upp::views::split_whitespace<upp::encoding::utf8>;
+        ///
+        /// @endcode
+        ///
+        /// @see split_on, split_on_any
+        ///
+        template<encoding Encoding>
+        inline constexpr impl::split_closure<Encoding, upp::impl::split::whitespace_delimiter<Encoding>> split_whitespace{
+            upp::impl::split::whitespace_delimiter<Encoding>{}
+        };
+
+        /// @brief Range adaptor that splits a valid UTF-8 code unit sequence into the words between runs of whitespace.
+        ///
+        /// @see @ref upp::ranges::views::split_whitespace "views::split_whitespace"
+        ///
+        inline constexpr impl::split_closure<encoding::utf8, upp::impl::split::whitespace_delimiter<encoding::utf8>> split_whitespace_utf8{
+            upp::impl::split::whitespace_delimiter<encoding::utf8>{}
+        };
+
+        /// @brief Range adaptor that splits a valid UTF-16 code unit sequence into the words between runs of whitespace.
+        ///
+        /// @see @ref upp::ranges::views::split_whitespace "views::split_whitespace"
+        ///
+        inline constexpr impl::split_closure<encoding::utf16, upp::impl::split::whitespace_delimiter<encoding::utf16>> split_whitespace_utf16{
+            upp::impl::split::whitespace_delimiter<encoding::utf16>{}
+        };
+
+        /// @brief Range adaptor that splits a valid UTF-32 code unit sequence into the words between runs of whitespace.
+        ///
+        /// @see @ref upp::ranges::views::split_whitespace "views::split_whitespace"
+        ///
+        inline constexpr impl::split_closure<encoding::utf32, upp::impl::split::whitespace_delimiter<encoding::utf32>> split_whitespace_utf32{
+            upp::impl::split::whitespace_delimiter<encoding::utf32>{}
+        };
+    } // namespace views
+} // namespace upp::ranges
+
+#endif // UNI_CPP_IMPL_RANGES_SPLIT_HPP
\ No newline at end of file
@@ -0,0 +1,209 @@
+#ifndef UNI_CPP_IMPL_RANGES_TRIM_HPP
+#define UNI_CPP_IMPL_RANGES_TRIM_HPP
+
+/// @file
+///
+/// @brief Defines range adaptors that strip White_Space from either end of a valid code unit sequence.
+///
+
+#include "base.hpp"
+#include "valid_code_unit_range.hpp"
+
+#include "../../encoding.hpp"
+#include "../decode_valid.hpp"
+#include "../split.hpp"
+#include "../text_metadata.hpp"
+
+#include <iterator>
+#include <concepts>
+#include <ranges>
+#include <utility>
+
+namespace upp::ranges
+{
+    namespace impl
+    {
+        /// @brief Returns an iterator to the first code point of `[it, end)` that isn't White_Space.
+        ///
+        template<encoding Encoding, std::forward_iterator It, std::sentinel_for<It> Sentinel>
+        [[nodiscard]] constexpr It trim_start_position(It it, const Sentinel end)
+        {
+            return upp::impl::split::whitespace_delimiter<Encoding>{}.skip(std::move(it), end);
+        }
+
+        /// @brief Returns an iterator past the last code point of `[begin, end)` that isn't White_Space.
+        ///
+        template<encoding Encoding, std::forward_iterator It, std::sentinel_for<It> Sentinel>
+        [[nodiscard]] constexpr It trim_end_position(It begin, const Sentinel end)
+        {
+            using whitespace = upp::impl::split::whitespace_delimiter<Encoding>;
+
+            if constexpr (std::bidirectional_iterator<It>)
+            {
+                // Steps back a code point at a time, so only the trailing whitespace and the code point in front of it are decoded.
+                It it = std::ranges::next(begin, end);
+
+                while (it != begin)
+                {
+                    It previous = it;
+
+                    do
+                    {
+                        --previous;
+                    } while (!upp::impl::text_metadata::is_leading_code_unit(*previous));
+
+                    It next = previous;
+
+                    if (!whitespace::is_whitespace(upp::impl::decode_valid_code_point_and_advance<Encoding>(next)))
+                        break;
+
+                    it = std::move(previous);
+                }
+
+                return it;
+            }
+            else
+            {
+                It trimmed_end = begin;
+
+                for (It it = std::move(begin); it != end;)
+                {
+                    if (!whitespace::is_whitespace(upp::impl::decode_valid_code_point_and_advance<Encoding>(it)))
+                        trimmed_end = it;
+                }
+
+                return trimmed_end;
+            }
+        }
+
+        template<encoding Encoding, bool TrimStart, bool TrimEnd>
+        struct trim_fn : public std::ranges::range_adaptor_closure<trim_fn<Encoding, TrimStart, TrimEnd>>
+        {
+        public:
+            template<std::ranges::viewable_range Range>
+                requires std::ranges::forward_range<Range> && std::ranges::borrowed_range<Range> && valid_code_unit_range<Range, Encoding>
+            [[nodiscard]] constexpr auto operator()(Range&& range) const
+            {
+                auto       first = std::ranges::begin(range);
+                const auto last  = std::ranges::end(range);
+
+                if constexpr (TrimStart)
+                    first = trim_start_position<Encoding>(std::move(first), last);
+
+                if constexpr (TrimEnd)
+                {
+                    using subrange_type = std::ranges::subrange<std::ranges::iterator_t<Range>>;
+
+                    auto trimmed_last = trim_end_position<Encoding>(first, last);
+
+                    return valid_code_unit_view<subrange_type, Encoding>(subrange_type(std::move(first), std::move(trimmed_last)));
+                }
+                else
+                {
+                    using subrange_type = std::ranges::subrange<std::ranges::iterator_t<Range>, std::ranges::sentinel_t<Range>>;
+
+                    return valid_code_unit_view<subrange_type, Encoding>(subrange_type(std::move(first), last));
+                }
+            }
+        };
+    } // namespace impl
+
+    namespace views
+    {
+        /// @brief Range adaptor that strips the White_Space code points from both ends of a valid `Encoding` code unit sequence.
+        ///
+        /// Nothing is copied: the result is a `valid_code_unit_view` of a `std::ranges::subrange` of the underlying code units,
+        /// so the range has to be a `std::ranges::borrowed_range`. Leading whitespace is skipped front to back, and trailing
+        /// whitespace back to front if the iterators are bidirectional, so only the stripped code points are decoded.
+        ///
+        /// @tparam Encoding The encoding of the code units.
+        ///
+        /// @par Example
+        ///
+        /// @code{.cpp}
+        ///
+        /// using namespace std::string_view_literals;
+        ///
+        /// auto utf8_sequence = u8"\u3000 name\t\n"sv | upp::views::mark_as_valid_utf8;
+        ///
+        /// // The code units of "name"
+        /// auto trimmed = utf8_sequence | upp::views::trim<upp::encoding::utf8>;
+        ///
+        /// @endcode
+        ///
+        /// @see trim_start, trim_end
+        ///
+        template<encoding Encoding>
+        inline constexpr impl::trim_fn<Encoding, true, true> trim{};
+
+        /// @brief Range adaptor that strips the White_Space code points from both ends of a valid UTF-8 code unit sequence.
+        ///
+        /// @see @ref upp::ranges::views::trim "views::trim"
+        ///
+        inline constexpr impl::trim_fn<encoding::utf8, true, true> trim_utf8{};
+
+        /// @brief Range adaptor that strips the White_Space code points from both ends of a valid UTF-16 code unit sequence.
+        ///
+        /// @see @ref upp::ranges::views::trim "views::trim"
+        ///
+        inline constexpr impl::trim_fn<encoding::utf16, true, true> trim_utf16{};
+
+        /// @brief Range adaptor that strips the White_Space code points from both ends of a valid UTF-32 code unit sequence.
+        ///
+        /// @see @ref upp::ranges::views::trim "views::trim"
+        ///
+        inline constexpr impl::trim_fn<encoding::utf32, true, true> trim_utf32{};
+
+        /// @brief Range adaptor that strips the White_Space code points from the beginning of a valid `Encoding` code unit sequence.
+        ///
+        /// @see @ref upp::ranges::views::trim "views::trim"
+        ///
+        template<encoding Encoding>
+        inline constexpr impl::trim_fn<Encoding, true, false> trim_start{};
+
+        /// @brief Range adaptor that strips the White_Space code points from the beginning of a valid UTF-8 code unit sequence.
+        ///
+        /// @see @ref upp::ranges::views::trim_start "views::trim_start"
+        ///
+        inline constexpr impl::trim_fn<encoding::utf8, true, false> trim_start_utf8{};
+
+        /// @brief Range adaptor that strips the White_Space code points from the beginning of a valid UTF-16 code unit sequence.
+        ///
+        /// @see @ref upp::ranges::views::trim_start "views::trim_start"
+        ///
+        inline constexpr impl::trim_fn<encoding::utf16, true, false> trim_start_utf16{};
+
+        /// @brief Range adaptor that strips the White_Space code points from the beginning of a valid UTF-32 code unit sequence.
+        ///
+        /// @see @ref upp::ranges::views::trim_start "views::trim_start"
+        ///
+        inline constexpr impl::trim_fn<encoding::utf32, true, false> trim_start_utf32{};
+
+        /// @brief Range adaptor that strips the White_Space code points from the end of a valid `Encoding` code unit sequence.
+        ///
+        /// @see @ref upp::ranges::views::trim "views::trim"
+        ///
+        template<encoding Encoding>
+        inline constexpr impl::trim_fn<Encoding, false, true> trim_end{};
+
+        /// @brief Range adaptor that strips the White_Space code points from the end of a valid UTF-8 code unit sequence.
+        ///
+        /// @see @ref upp::ranges::views::trim_end "views::trim_end"
+        ///
+        inline constexpr impl::trim_fn<encoding::utf8, false, true> trim_end_utf8{};
+
+        /// @brief Range adaptor that strips the White_Space code points from the end of a valid UTF-16 code unit sequence.
+        ///
+        /// @see @ref upp::ranges::views::trim_end "views::trim_end"
+        ///
+        inline constexpr impl::trim_fn<encoding::utf16, false, true> trim_end_utf16{};
+
+        /// @brief Range adaptor that strips the White_Space code points from the end of a valid UTF-32 code unit sequence.
+        ///
+        /// @see @ref upp::ranges::views::trim_end "views::trim_end"
+        ///
+        inline constexpr impl::trim_fn<encoding::utf32, false, true> trim_end_utf32{};
+    } // namespace views
+} // namespace upp::ranges
+
+#endif // UNI_CPP_IMPL_RANGES_TRIM_HPP
\ No newline at end of file
@@ -0,0 +1,216 @@
+#ifndef UNI_CPP_IMPL_SEARCH_HPP
+#define UNI_CPP_IMPL_SEARCH_HPP
+
+/// @file
+///
+/// @brief Searching for code unit sequences, a word of code units at a time.
+///
+/// Candidate positions are found by comparing whole words of the haystack against the first and the last code unit
+/// of the needle, and only the candidates are compared in full. A word holds 8, 4 or 2 code units, depending on their size.
+///
+/// The functions only compare code units. For valid haystacks and needles in UTF-8 or UTF-16, every match starts and ends
+/// on a code point boundary, because no complete code unit sequence occurs in the middle of another one.
+///
+
+#include "swar.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <bit>
+
+namespace upp::impl::search
+{
+    /// Returned when there is no match.
+    inline constexpr std::size_t not_found = static_cast<std::size_t>(-1);
+
+    template<typename T>
+    [[nodiscard]] constexpr swar::word_type code_unit_value(const T code_unit) noexcept
+    {
+        return static_cast<swar::word_type>(static_cast<std::make_unsigned_t<T>>(code_unit));
+    }
+
+    /// Every code unit sized lane of a word is one code unit.
+    template<std::size_t CodeUnitSize>
+    struct lanes
+    {
+        static constexpr std::size_t count = swar::word_size / CodeUnitSize;
+        static constexpr std::size_t bits  = 8uz * CodeUnitSize;
+
+        /// The least significant bit of every lane.
+        static constexpr swar::word_type ones = ~swar::word_type{0} / ((swar::word_type{1} << bits) - 1U);
+
+        /// Every bit except for the most significant one of every lane.
+        static constexpr swar::word_type low_bits = ones * ((swar::word_type{1} << (bits - 1U)) - 1U);
+
+        /// The most significant bit of every lane.
+        static constexpr swar::word_type high_bits = ones << (bits - 1U);
+    };
+
+    /// @brief Loads `lanes<sizeof(T)>::count` code units starting at `ptr`, with the first one in the least significant lane.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr swar::word_type load_lanes(const T* ptr) noexcept
+    {
+        if constexpr (sizeof(T) == 1)
+        {
+            return swar::load_word(ptr);
+        }
+        else
+        {
+            swar::word_type word = 0;
+
+            for (std::size_t i = 0; i < lanes<sizeof(T)>::count; ++i)
+                word |= code_unit_value(ptr[i]) << (lanes<sizeof(T)>::bits * i);
+
+            return word;
+        }
+    }
+
+    /// @brief Returns a word with `code_unit` in every lane.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr swar::word_type broadcast(const T code_unit) noexcept
+    {
+        return lanes<sizeof(T)>::ones * code_unit_value(code_unit);
+    }
+
+    /// @brief Returns a word with the most significant bit set in exactly the lanes of `word` that are zero.
+    ///
+    template<std::size_t CodeUnitSize>
+    [[nodiscard]] constexpr swar::word_type zero_lanes(const swar::word_type word) noexcept
+    {
+        using lane = lanes<CodeUnitSize>;
+
+        // Adding `low_bits` to the low bits of a lane never carries into the next lane, so unlike `(word - ones) & ~word`
+        // this has no false positives above a zero lane.
+        return ~(((word & lane::low_bits) + lane::low_bits) | word | lane::low_bits);
+    }
+
+    template<typename T, typename U>
+    [[nodiscard]] constexpr bool equal_code_units(const T* x, const U* y, const std::size_t size) noexcept
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (code_unit_value(x[i]) != code_unit_value(y[i]))
+                return false;
+        }
+
+        return true;
+    }
+
+    /// @brief Returns the index of the first occurrence of `needle` in `[haystack, haystack + size)` at or after `from`, or `not_found`.
+    ///
+    template<typename T, typename U>
+        requires(sizeof(T) == sizeof(U))
+    [[nodiscard]] constexpr std::size_t find(const T* haystack, const std::size_t size, const U* needle, const std::size_t needle_size,
+                                             const std::size_t from) noexcept
+    {
+        using lane = lanes<sizeof(T)>;
+
+        if (needle_size > size || from > size - needle_size)
+            return not_found;
+
+        if (needle_size == 0)
+            return from;
+
+        const swar::word_type first = broadcast(needle[0]);
+        const swar::word_type last  = broadcast(needle[needle_size - 1]);
+
+        // Both the first and the last code unit of the needle have to match, which rejects most candidates at once.
+        std::size_t index = from;
+
+        for (; index + needle_size - 1 + lane::count <= size; index += lane::count)
+        {
+            swar::word_type candidates = zero_lanes<sizeof(T)>(load_lanes(haystack + index) ^ first) &
+                                         zero_lanes<sizeof(T)>(load_lanes(haystack + index + needle_size - 1) ^ last);
+
+            while (candidates != 0)
+            {
+                const std::size_t offset = static_cast<std::size_t>(std::countr_zero(candidates)) / lane::bits;
+
+                if (needle_size <= 2 || equal_code_units(haystack + index + offset + 1, needle + 1, needle_size - 2))
+                    return index + offset;
+
+                candidates &= candidates - 1U;
+            }
+        }
+
+        for (; index + needle_size <= size; ++index)
+        {
+            if (equal_code_units(haystack + index, needle, needle_size))
+                return index;
+        }
+
+        return not_found;
+    }
+
+    /// @brief Returns the index of the last occurrence of `needle` in `[haystack, haystack + size)` that starts at or before `from`,
+    ///        or `not_found`.
+    ///
+    template<typename T, typename U>
+        requires(sizeof(T) == sizeof(U))
+    [[nodiscard]] constexpr std::size_t rfind(const T* haystack, const std::size_t size, const U* needle, const std::size_t needle_size,
+                                              const std::size_t from) noexcept
+    {
+        using lane = lanes<sizeof(T)>;
+
+        if (needle_size > size)
+            return not_found;
+
+        // The candidates are `[0, end)`.
+        std::size_t end = (from < size - needle_size ? from : size - needle_size) + 1;
+
+        if (needle_size == 0)
+            return end - 1;
+
+        const swar::word_type first = broadcast(needle[0]);
+        const swar::word_type last  = broadcast(needle[needle_size - 1]);
+
+        for (; end >= lane::count; end -= lane::count)
+        {
+            const std::size_t index = end - lane::count;
+
+            swar::word_type candidates = zero_lanes<sizeof(T)>(load_lanes(haystack + index) ^ first) &
+                                         zero_lanes<sizeof(T)>(load_lanes(haystack + index + needle_size - 1) ^ last);
+
+            while (candidates != 0)
+            {
+                const auto        bit    = static_cast<unsigned>(std::bit_width(candidates) - 1);
+                const std::size_t offset = bit / lane::bits;
+
+                if (needle_size <= 2 || equal_code_units(haystack + index + offset + 1, needle + 1, needle_size - 2))
+                    return index + offset;
+
+                candidates ^= swar::word_type{1} << bit;
+            }
+        }
+
+        while (end-- > 0)
+        {
+            if (equal_code_units(haystack + end, needle, needle_size))
+                return end;
+        }
+
+        return not_found;
+    }
+
+    /// @brief Returns the number of non-overlapping occurrences of the non-empty `needle` in `[haystack, haystack + size)`.
+    ///
+    template<typename T, typename U>
+        requires(sizeof(T) == sizeof(U))
+    [[nodiscard]] constexpr std::size_t count(const T* haystack, const std::size_t size, const U* needle, const std::size_t needle_size) noexcept
+    {
+        std::size_t result = 0;
+
+        for (std::size_t index = find(haystack, size, needle, needle_size, 0); index != not_found;
+             index             = find(haystack, size, needle, needle_size, index + needle_size))
+        {
+            ++result;
+        }
+
+        return result;
+    }
+} // namespace upp::impl::search
+
+#endif // UNI_CPP_IMPL_SEARCH_HPP
\ No newline at end of file
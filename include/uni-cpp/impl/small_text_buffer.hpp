@@ -0,0 +1,783 @@
+#ifndef UNI_CPP_IMPL_SMALL_TEXT_BUFFER_HPP
+#define UNI_CPP_IMPL_SMALL_TEXT_BUFFER_HPP
+
+/// @file
+///
+/// @brief Defines `small_text_buffer`, a small-string-optimized code unit container that caches metadata about the text.
+///
+
+#include "../encoding.hpp"
+#include "text_metadata.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <compare>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+
+namespace upp
+{
+    /// @brief Contiguous code unit container with a 31 byte inline buffer in a 32 byte object, that caches metadata about the text.
+    ///
+    /// Up to `inline_capacity` code units (31 UTF-8, 15 UTF-16 or 7 UTF-32 code units) are stored inside the object itself.
+    /// Longer sequences are stored in a heap allocation, which grows geometrically.
+    ///
+    /// The header byte, which also stores the inline size, caches whether all code units are ASCII,
+    /// and heap-allocated buffers cache the number of code points in the spare bytes of the header.
+    /// Both are kept up to date by the member functions that insert and erase code units, so `is_ascii()` is O(1),
+    /// and so is `code_point_count()` for ASCII text and for heap-allocated buffers.
+    /// `basic_ustring` uses the cached metadata when the container provides it.
+    ///
+    /// Code units of 1 byte are counted as UTF-8, code units of 2 bytes as UTF-16 and code units of 4 bytes as UTF-32.
+    /// The code point count is only meaningful if the buffer holds a valid code unit sequence.
+    ///
+    /// The non-`const` overloads of the element access functions (`begin()`, `data()`, `operator[]` etc.) give write access
+    /// to the code units, so they discard the cached metadata. After that, `is_ascii()` and `code_point_count()` scan
+    /// the code units until the buffer is cleared or reassigned. `basic_ustring` only ever reads the container through
+    /// `const` references, so the metadata of its container always stays cached.
+    ///
+    /// During constant evaluation the code units are always stored in a heap allocation.
+    ///
+    /// Satisfies the `string_compatible_container` and `reservable_container` concepts.
+    ///
+    /// @tparam T The code unit type.
+    ///
+    /// @see small_ustring, small_utf16_string
+    ///
+    /// @headerfile "" <uni-cpp/string.hpp>
+    ///
+    template<code_unit_type T>
+    class small_text_buffer
+    {
+    public:
+        using value_type             = T;
+        using size_type              = std::size_t;
+        using difference_type        = std::ptrdiff_t;
+        using reference              = T&;
+        using const_reference        = const T&;
+        using pointer                = T*;
+        using const_pointer          = const T*;
+        using iterator               = T*;
+        using const_iterator         = const T*;
+        using reverse_iterator       = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        /// @brief The number of code units that are stored without a heap allocation.
+        ///
+        static constexpr size_type inline_capacity = (32uz - 1uz) / sizeof(T);
+
+    public:
+        /// @brief Constructs an empty buffer.
+        ///
+        constexpr small_text_buffer() noexcept { reset(); }
+
+        /// @brief Constructs a buffer with `count` copies of `value`.
+        ///
+        constexpr small_text_buffer(const size_type count, const T& value)
+            : small_text_buffer()
+        {
+            insert(cend(), count, value);
+        }
+
+        /// @brief Constructs a buffer with the contents of the range `[first, last)`.
+        ///
+        template<std::input_iterator It, std::sentinel_for<It> Sentinel>
+        constexpr small_text_buffer(It first, Sentinel last)
+            : small_text_buffer()
+        {
+            append_range(std::ranges::subrange(std::move(first), std::move(last)));
+        }
+
+        /// @brief Constructs a buffer with the contents of the initializer list `init`.
+        ///
+        constexpr small_text_buffer(const std::initializer_list<T> init)
+            : small_text_buffer()
+        {
+            append_range(init);
+        }
+
+        /// @brief Copy constructor. Copies the cached metadata too.
+        ///
+        constexpr small_text_buffer(const small_text_buffer& other)
+            : small_text_buffer()
+        {
+            copy_from(other);
+        }
+
+        /// @brief Move constructor. Leaves `other` empty.
+        ///
+        constexpr small_text_buffer(small_text_buffer&& other) noexcept
+            : m_rep{other.m_rep}
+        {
+            other.reset();
+        }
+
+        /// @brief Copy assignment operator. Copies the cached metadata too.
+        ///
+        constexpr small_text_buffer& operator=(const small_text_buffer& other)
+        {
+            if (this != &other)
+            {
+                set_size(0);
+                copy_from(other);
+            }
+
+            return *this;
+        }
+
+        /// @brief Move assignment operator. Leaves `other` empty.
+        ///
+        constexpr small_text_buffer& operator=(small_text_buffer&& other) noexcept
+        {
+            if (this != &other)
+            {
+                deallocate_heap();
+
+                m_rep = other.m_rep;
+                other.reset();
+            }
+
+            return *this;
+        }
+
+        /// @brief Replaces the contents with the initializer list `init`.
+        ///
+        constexpr small_text_buffer& operator=(const std::initializer_list<T> init)
+        {
+            assign(init);
+            return *this;
+        }
+
+        /// @brief Destructor.
+        ///
+        constexpr ~small_text_buffer() { deallocate_heap(); }
+
+        /// @brief Replaces the contents with `count` copies of `value`.
+        ///
+        constexpr void assign(const size_type count, const T& value)
+        {
+            const T copy = value;
+
+            clear();
+            insert(cend(), count, copy);
+        }
+
+        /// @brief Replaces the contents with the contents of the range `[first, last)`.
+        ///
+        /// @pre `first` and `last` are not iterators into `*this`.
+        ///
+        template<std::input_iterator It, std::sentinel_for<It> Sentinel>
+        constexpr void assign(It first, Sentinel last)
+        {
+            clear();
+            append_range(std::ranges::subrange(std::move(first), std::move(last)));
+        }
+
+        /// @brief Replaces the contents with the initializer list `init`.
+        ///
+        constexpr void assign(const std::initializer_list<T> init)
+        {
+            clear();
+            append_range(init);
+        }
+
+        /// @name Element access
+        ///
+        /// The non-`const` overloads discard the cached metadata.
+        ///
+        /// @{
+
+        [[nodiscard]] constexpr reference at(const size_type index)
+        {
+            if (index >= size())
+                throw std::out_of_range("upp::small_text_buffer::at");
+
+            return data()[index];
+        }
+
+        [[nodiscard]] constexpr const_reference at(const size_type index) const
+        {
+            if (index >= size())
+                throw std::out_of_range("upp::small_text_buffer::at");
+
+            return data()[index];
+        }
+
+        [[nodiscard]] constexpr reference       operator[](const size_type index) noexcept { return data()[index]; }
+        [[nodiscard]] constexpr const_reference operator[](const size_type index) const noexcept { return data()[index]; }
+
+        [[nodiscard]] constexpr reference       front() noexcept { return data()[0]; }
+        [[nodiscard]] constexpr const_reference front() const noexcept { return data()[0]; }
+
+        [[nodiscard]] constexpr reference       back() noexcept { return data()[size() - 1]; }
+        [[nodiscard]] constexpr const_reference back() const noexcept { return data()[size() - 1]; }
+
+        [[nodiscard]] constexpr T* data() noexcept
+        {
+            discard_metadata();
+            return storage();
+        }
+
+        [[nodiscard]] constexpr const T* data() const noexcept { return storage(); }
+
+        /// @}
+
+        /// @name Iterators
+        ///
+        /// The non-`const` overloads discard the cached metadata.
+        ///
+        /// @{
+
+        [[nodiscard]] constexpr iterator       begin() noexcept { return data(); }
+        [[nodiscard]] constexpr const_iterator begin() const noexcept { return data(); }
+        [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return data(); }
+
+        [[nodiscard]] constexpr iterator       end() noexcept { return data() + size(); }
+        [[nodiscard]] constexpr const_iterator end() const noexcept { return data() + size(); }
+        [[nodiscard]] constexpr const_iterator cend() const noexcept { return data() + size(); }
+
+        [[nodiscard]] constexpr reverse_iterator       rbegin() noexcept { return reverse_iterator(end()); }
+        [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+
+        [[nodiscard]] constexpr reverse_iterator       rend() noexcept { return reverse_iterator(begin()); }
+        [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+        [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+        /// @}
+
+        /// @name Capacity
+        ///
+        /// @{
+
+        [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+        [[nodiscard]] constexpr size_type size() const noexcept
+        {
+            if (is_heap())
+                return m_rep.heap.size;
+
+            return m_rep.local.tag & inline_size_mask;
+        }
+
+        [[nodiscard]] constexpr size_type max_size() const noexcept
+        {
+            return static_cast<size_type>(std::numeric_limits<difference_type>::max()) / sizeof(T);
+        }
+
+        [[nodiscard]] constexpr size_type capacity() const noexcept { return is_heap() ? m_rep.heap.capacity : inline_capacity; }
+
+        /// @brief Makes `capacity()` at least `new_capacity`.
+        ///
+        constexpr void reserve(const size_type new_capacity)
+        {
+            if (new_capacity <= capacity())
+                return;
+
+            if (new_capacity > max_size())
+                throw std::length_error("upp::small_text_buffer::reserve");
+
+            relocate(new_capacity, size(), 0);
+        }
+
+        /// @brief Reduces the capacity to `size()`, or moves the code units back into the inline buffer if they fit.
+        ///
+        constexpr void shrink_to_fit()
+        {
+            if (is_heap() && size() < capacity())
+                relocate(size(), size(), 0);
+        }
+
+        /// @}
+
+        /// @name Cached metadata
+        ///
+        /// @{
+
+        /// @brief Checks whether all code units are ASCII. O(1) unless the metadata was discarded.
+        ///
+        [[nodiscard]] constexpr bool is_ascii() const noexcept
+        {
+            const unsigned char tag = this->tag();
+
+            if ((tag & metadata_flag) != 0)
+                return (tag & ascii_flag) != 0;
+
+            return impl::text_metadata::is_ascii(storage(), size());
+        }
+
+        /// @brief Returns the number of code points. O(1) for ASCII text and heap-allocated buffers, unless the metadata was discarded.
+        ///
+        /// Inline buffers with non-ASCII text count the code points of their at most 31 bytes, a word at a time in UTF-8.
+        ///
+        [[nodiscard]] constexpr size_type code_point_count() const noexcept
+        {
+            const std::uint32_t count = known_code_point_count();
+
+            if (count != uncached_count)
+                return count;
+
+            return impl::text_metadata::count_code_points(storage(), size());
+        }
+
+        /// @}
+
+        /// @name Modifiers
+        ///
+        /// @{
+
+        /// @brief Removes all code units. The capacity is unchanged.
+        ///
+        constexpr void clear() noexcept
+        {
+            set_size(0);
+            set_metadata(metadata_flag | ascii_flag, 0);
+        }
+
+        constexpr iterator insert(const const_iterator pos, const T& value) { return insert(pos, 1, value); }
+
+        constexpr iterator insert(const const_iterator pos, const size_type count, const T& value)
+        {
+            const T copy = value;
+
+            T* const gap = make_gap(index_of(pos), count);
+
+            std::fill_n(gap, count, copy);
+            note_inserted(gap, count);
+
+            return gap;
+        }
+
+        /// @pre `first` and `last` are not iterators into `*this`.
+        ///
+        template<std::input_iterator It, std::sentinel_for<It> Sentinel>
+        constexpr iterator insert(const const_iterator pos, It first, Sentinel last)
+        {
+            return insert_range(pos, std::ranges::subrange(std::move(first), std::move(last)));
+        }
+
+        constexpr iterator insert(const const_iterator pos, const std::initializer_list<T> init) { return insert_range(pos, init); }
+
+        /// @pre `range` is not a view into `*this`.
+        ///
+        template<std::ranges::input_range Range>
+        constexpr iterator insert_range(const const_iterator pos, Range&& range)
+        {
+            const size_type index = index_of(pos);
+
+            if constexpr (std::ranges::forward_range<Range> || std::ranges::sized_range<Range>)
+            {
+                const auto count = static_cast<size_type>(std::ranges::distance(range));
+
+                T* const gap = make_gap(index, count);
+
+                std::ranges::copy(range, gap);
+                note_inserted(gap, count);
+
+                return gap;
+            }
+            else
+            {
+                // The length of the range isn't known in advance, so collect the code units first.
+                small_text_buffer code_units;
+
+                code_units.append_range(std::forward<Range>(range));
+
+                return insert_range(pos, std::as_const(code_units));
+            }
+        }
+
+        /// @pre `range` is not a view into `*this`.
+        ///
+        template<std::ranges::input_range Range>
+        constexpr void append_range(Range&& range)
+        {
+            if constexpr (std::ranges::forward_range<Range> || std::ranges::sized_range<Range>)
+            {
+                insert_range(cend(), std::forward<Range>(range));
+            }
+            else
+            {
+                for (auto&& code_unit : range)
+                    push_back(static_cast<T>(code_unit));
+            }
+        }
+
+        constexpr void push_back(const T& value)
+        {
+            const T         copy = value;
+            const size_type size = this->size();
+
+            T* slot;
+
+            if (size < capacity())
+            {
+                slot = storage() + size;
+                set_size(size + 1);
+            }
+            else
+            {
+                slot = make_gap(size, 1);
+            }
+
+            *slot = copy;
+            note_inserted(slot, 1);
+        }
+
+        constexpr void pop_back() { erase(cend() - 1); }
+
+        constexpr iterator erase(const const_iterator pos) { return erase(pos, pos + 1); }
+
+        constexpr iterator erase(const const_iterator first, const const_iterator last)
+        {
+            const size_type index = index_of(first);
+            const size_type count = static_cast<size_type>(last - first);
+            const size_type size  = this->size();
+
+            T* const code_units = storage();
+
+            note_erasing(code_units + index, count);
+
+            std::copy(code_units + index + count, code_units + size, code_units + index);
+            set_size(size - count);
+
+            note_erased();
+
+            return storage() + index;
+        }
+
+        constexpr void resize(const size_type count) { resize(count, T()); }
+
+        constexpr void resize(const size_type count, const T& value)
+        {
+            const size_type size = this->size();
+
+            if (count < size)
+                erase(cbegin() + count, cend());
+            else
+                insert(cend(), count - size, value);
+        }
+
+        constexpr void swap(small_text_buffer& other) noexcept { std::swap(m_rep, other.m_rep); }
+
+        friend constexpr void swap(small_text_buffer& x, small_text_buffer& y) noexcept { x.swap(y); }
+
+        /// @}
+
+        [[nodiscard]] friend constexpr bool operator==(const small_text_buffer& x, const small_text_buffer& y) noexcept
+        {
+            return std::equal(x.begin(), x.end(), y.begin(), y.end());
+        }
+
+        [[nodiscard]] friend constexpr auto operator<=>(const small_text_buffer& x, const small_text_buffer& y) noexcept
+        {
+            return std::lexicographical_compare_three_way(x.begin(), x.end(), y.begin(), y.end());
+        }
+
+    private:
+        // The first byte of both representations is the tag. In the inline representation it also stores the size.
+        static constexpr unsigned char heap_flag        = 0x80U;
+        static constexpr unsigned char metadata_flag    = 0x40U; // The ASCII flag and the code point count are up to date.
+        static constexpr unsigned char ascii_flag       = 0x20U;
+        static constexpr unsigned char metadata_mask    = metadata_flag | ascii_flag;
+        static constexpr unsigned char inline_size_mask = 0x1FU;
+
+        // Stored as the code point count of heap-allocated buffers if it's unknown or doesn't fit.
+        static constexpr std::uint32_t uncached_count = std::numeric_limits<std::uint32_t>::max();
+
+        struct inline_representation
+        {
+            unsigned char tag;
+            T             code_units[inline_capacity];
+        };
+
+        struct heap_representation
+        {
+            unsigned char tag;
+            std::uint32_t code_point_count;
+            T*            data;
+            size_type     size;
+            size_type     capacity;
+        };
+
+        union representation
+        {
+            inline_representation local;
+            heap_representation   heap;
+        };
+
+        static_assert(inline_capacity <= inline_size_mask);
+
+        // The representation is the only data member, so this is the size of the buffer. The class itself is incomplete here.
+        static_assert(sizeof(void*) != 8 || sizeof(representation) == 32, "small_text_buffer is 32 bytes on 64-bit targets");
+
+        [[nodiscard]] static constexpr std::uint32_t to_cached_count(const size_type count) noexcept
+        {
+            return count < uncached_count ? static_cast<std::uint32_t>(count) : uncached_count;
+        }
+
+        [[nodiscard]] static constexpr T* allocate(const size_type count)
+        {
+            if (count == 0)
+                return nullptr;
+
+            T* const data = std::allocator<T>().allocate(count);
+
+            if consteval
+            {
+                // Objects have to be alive before they can be assigned to during constant evaluation.
+                for (size_type i = 0; i < count; ++i)
+                    std::construct_at(data + i);
+            }
+
+            return data;
+        }
+
+        /// @brief Empties the buffer without freeing any heap allocation.
+        ///
+        constexpr void reset() noexcept
+        {
+            if consteval
+            {
+                m_rep.heap = heap_representation{.tag = heap_flag | metadata_mask, .code_point_count = 0, .data = nullptr, .size = 0, .capacity = 0};
+            }
+            else
+            {
+                m_rep.local = inline_representation{.tag = metadata_mask, .code_units = {}};
+            }
+        }
+
+        constexpr void deallocate_heap() noexcept
+        {
+            if (is_heap() && m_rep.heap.data != nullptr)
+                std::allocator<T>().deallocate(m_rep.heap.data, m_rep.heap.capacity);
+        }
+
+        [[nodiscard]] constexpr bool is_heap() const noexcept
+        {
+            if consteval
+            {
+                // The inline representation is never used during constant evaluation.
+                return true;
+            }
+            else
+            {
+                // Reading the tag through either member is fine, it's a part of their common initial sequence.
+                return (m_rep.local.tag & heap_flag) != 0;
+            }
+        }
+
+        [[nodiscard]] constexpr unsigned char tag() const noexcept { return is_heap() ? m_rep.heap.tag : m_rep.local.tag; }
+
+        [[nodiscard]] constexpr T* storage() noexcept { return is_heap() ? m_rep.heap.data : m_rep.local.code_units; }
+
+        [[nodiscard]] constexpr const T* storage() const noexcept { return is_heap() ? m_rep.heap.data : m_rep.local.code_units; }
+
+        [[nodiscard]] constexpr size_type index_of(const const_iterator pos) const noexcept { return static_cast<size_type>(pos - storage()); }
+
+        constexpr void set_size(const size_type size) noexcept
+        {
+            if (is_heap())
+                m_rep.heap.size = size;
+            else
+                m_rep.local.tag = static_cast<unsigned char>((m_rep.local.tag & ~inline_size_mask) | size);
+        }
+
+        /// @brief Returns the code point count if the metadata is up to date, or `uncached_count` if it isn't.
+        ///
+        /// Inline buffers don't store the count of non-ASCII text, so it's counted here.
+        ///
+        [[nodiscard]] constexpr std::uint32_t known_code_point_count() const noexcept
+        {
+            const unsigned char tag = this->tag();
+
+            if ((tag & metadata_flag) == 0)
+                return uncached_count;
+
+            if ((tag & ascii_flag) != 0)
+                return to_cached_count(size());
+
+            if (is_heap())
+                return m_rep.heap.code_point_count;
+
+            return to_cached_count(impl::text_metadata::count_code_points(storage(), size()));
+        }
+
+        constexpr void set_metadata(const unsigned char flags, const std::uint32_t code_point_count) noexcept
+        {
+            if (is_heap())
+            {
+                m_rep.heap.tag              = static_cast<unsigned char>((m_rep.heap.tag & ~metadata_mask) | flags);
+                m_rep.heap.code_point_count = code_point_count;
+            }
+            else
+            {
+                m_rep.local.tag = static_cast<unsigned char>((m_rep.local.tag & ~metadata_mask) | flags);
+            }
+        }
+
+        constexpr void discard_metadata() noexcept { set_metadata(0, uncached_count); }
+
+        /// @brief Updates the metadata after `count` code units were inserted at `first`.
+        ///
+        constexpr void note_inserted(const T* const first, const size_type count) noexcept
+        {
+            const unsigned char tag = this->tag();
+
+            if ((tag & metadata_flag) == 0)
+                return;
+
+            const bool inserted_ascii = impl::text_metadata::is_ascii(first, count);
+            const auto flags          = static_cast<unsigned char>(inserted_ascii ? (tag & metadata_mask) : metadata_flag);
+
+            if (!is_heap())
+            {
+                set_metadata(flags, uncached_count);
+                return;
+            }
+
+            std::uint32_t code_point_count = m_rep.heap.code_point_count;
+
+            if (code_point_count != uncached_count)
+            {
+                const size_type inserted = inserted_ascii ? count : impl::text_metadata::count_code_points(first, count);
+
+                code_point_count = to_cached_count(code_point_count + inserted);
+            }
+
+            set_metadata(flags, code_point_count);
+        }
+
+        /// @brief Updates the code point count before `count` code units at `first` are erased.
+        ///
+        constexpr void note_erasing(const T* const first, const size_type count) noexcept
+        {
+            if ((tag() & metadata_flag) == 0 || !is_heap() || m_rep.heap.code_point_count == uncached_count)
+                return;
+
+            m_rep.heap.code_point_count -= static_cast<std::uint32_t>(impl::text_metadata::count_code_points(first, count));
+        }
+
+        /// @brief Updates the ASCII flag after code units were erased, because the erased code units might have been the only non-ASCII ones.
+        ///
+        constexpr void note_erased() noexcept
+        {
+            const unsigned char tag = this->tag();
+
+            if ((tag & metadata_mask) == metadata_flag && impl::text_metadata::is_ascii(storage(), size()))
+                set_metadata(metadata_mask, to_cached_count(size()));
+        }
+
+        /// @brief Copies the code units and the metadata of `other` into this empty buffer.
+        ///
+        constexpr void copy_from(const small_text_buffer& other)
+        {
+            const size_type size = other.size();
+
+            reserve(size);
+
+            std::copy_n(other.storage(), size, storage());
+            set_size(size);
+            set_metadata(other.tag() & metadata_mask, other.known_code_point_count());
+        }
+
+        [[nodiscard]] constexpr size_type grown_capacity(const size_type required_capacity) const
+        {
+            const size_type max_size = this->max_size();
+
+            if (required_capacity > max_size)
+                throw std::length_error("upp::small_text_buffer");
+
+            const size_type capacity = this->capacity();
+
+            if (capacity > max_size / 2)
+                return max_size;
+
+            return std::max(required_capacity, 2 * capacity);
+        }
+
+        /// @brief Makes room for `count` code units at `index` and returns a pointer to them.
+        ///
+        /// The metadata is not updated, call `note_inserted` after writing the code units.
+        ///
+        [[nodiscard]] constexpr T* make_gap(const size_type index, const size_type count)
+        {
+            const size_type size = this->size();
+
+            if (count > max_size() - size)
+                throw std::length_error("upp::small_text_buffer");
+
+            if (size + count > capacity())
+            {
+                relocate(grown_capacity(size + count), index, count);
+            }
+            else
+            {
+                T* const code_units = storage();
+
+                std::copy_backward(code_units + index, code_units + size, code_units + size + count);
+                set_size(size + count);
+            }
+
+            return storage() + index;
+        }
+
+        /// @brief Moves the code units into new storage for `new_capacity` code units, leaving a gap of `gap_size` code units at `index`.
+        ///
+        /// The inline buffer is used if `new_capacity` allows it, so this also moves heap-allocated code units back into the object.
+        ///
+        constexpr void relocate(const size_type new_capacity, const size_type index, const size_type gap_size)
+        {
+            const size_type     size             = this->size();
+            const unsigned char flags            = tag() & metadata_mask;
+            const std::uint32_t code_point_count = known_code_point_count();
+
+            T* const        old_code_units = storage();
+            const bool      was_heap       = is_heap();
+            const size_type old_capacity   = capacity();
+
+            const auto move_code_units = [&](T* const new_code_units) {
+                std::copy_n(old_code_units, index, new_code_units);
+                std::copy_n(old_code_units + index, size - index, new_code_units + index + gap_size);
+
+                if (was_heap && old_code_units != nullptr)
+                    std::allocator<T>().deallocate(old_code_units, old_capacity);
+            };
+
+            if !consteval
+            {
+                if (new_capacity <= inline_capacity)
+                {
+                    // Only heap-allocated code units can end up here, so the inline buffer doesn't overlap them.
+                    inline_representation local{.tag = static_cast<unsigned char>(flags | (size + gap_size)), .code_units = {}};
+
+                    move_code_units(local.code_units);
+
+                    m_rep.local = local;
+                    return;
+                }
+            }
+
+            T* const new_code_units = allocate(new_capacity);
+
+            move_code_units(new_code_units);
+
+            m_rep.heap = heap_representation{.tag              = static_cast<unsigned char>(heap_flag | flags),
+                                             .code_point_count = code_point_count,
+                                             .data             = new_code_units,
+                                             .size             = size + gap_size,
+                                             .capacity         = new_capacity};
+        }
+
+    private:
+        representation m_rep;
+    };
+} // namespace upp
+
+#endif // UNI_CPP_IMPL_SMALL_TEXT_BUFFER_HPP
\ No newline at end of file
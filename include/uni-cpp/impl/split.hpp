@@ -0,0 +1,388 @@
+#ifndef UNI_CPP_IMPL_SPLIT_HPP
+#define UNI_CPP_IMPL_SPLIT_HPP
+
+/// @file
+///
+/// @brief Finding delimiters (a code point, any of a set of code points, or runs of whitespace) in valid code unit sequences.
+///
+/// Contiguous sequences are scanned a word at a time for the code units that can start a delimiter: the encoded delimiter
+/// is searched for like a substring, and for sets of code points only the candidates whose first code unit starts one of them
+/// are decoded. Other sequences are compared or decoded one code point at a time.
+///
+
+#include "../uchar.hpp"
+#include "../encoding.hpp"
+#include "swar.hpp"
+#include "search.hpp"
+#include "text_metadata.hpp"
+#include "decode_valid.hpp"
+#include "encode_valid.hpp"
+#include "inplace_vector.hpp"
+#include "unicode_data/general_properties.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace upp::impl::split
+{
+    /// @brief The position of a delimiter within a code unit sequence. `length` is zero if there is no delimiter.
+    ///
+    struct match
+    {
+        std::size_t index;
+        std::size_t length;
+    };
+
+    template<std::forward_iterator It>
+    struct match_bounds
+    {
+        It begin;
+        It end;
+    };
+
+    /// ASCII sequences are scanned as UTF-8. Non-ASCII delimiters never match them.
+    template<encoding Encoding>
+    inline constexpr encoding scan_encoding = Encoding == encoding::ascii ? encoding::utf8 : Encoding;
+
+    template<encoding Encoding>
+    using code_unit_t = encoding_traits<scan_encoding<Encoding>>::default_code_unit_type;
+
+    /// @brief Returns a word with the most significant bit set in the lanes of `word` that are equal to `value`.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr swar::word_type equal_lanes(const swar::word_type word, const std::uint32_t value) noexcept
+    {
+        return search::zero_lanes<sizeof(T)>(word ^ (search::lanes<sizeof(T)>::ones * value));
+    }
+
+    /// @brief Finds the first delimiter in the valid code unit sequence `[it, end)`.
+    ///
+    /// If there is no delimiter, both iterators of the result are at `end`.
+    ///
+    template<typename Delimiter, std::forward_iterator It, std::sentinel_for<It> Sentinel>
+    [[nodiscard]] constexpr match_bounds<It> find(const Delimiter& delimiter, It it, const Sentinel end)
+    {
+        if constexpr (std::contiguous_iterator<It> && std::sized_sentinel_for<Sentinel, It>)
+        {
+            const auto [index, length] = delimiter.find_contiguous(std::to_address(it), static_cast<std::size_t>(end - it));
+
+            const It delimiter_begin = it + static_cast<std::iter_difference_t<It>>(index);
+
+            return match_bounds<It>{delimiter_begin, delimiter_begin + static_cast<std::iter_difference_t<It>>(length)};
+        }
+        else
+        {
+            return delimiter.find_generic(std::move(it), end);
+        }
+    }
+
+    /// @brief A single code point, searched for in its encoded form.
+    ///
+    template<encoding Encoding>
+    class code_point_delimiter
+    {
+    public:
+        static constexpr bool collapses_runs = false;
+
+    public:
+        constexpr explicit code_point_delimiter(const uchar delimiter) noexcept
+            : m_size(static_cast<std::uint8_t>(encode_valid_code_point<scan_encoding<Encoding>>(delimiter.value(), m_code_units.data())))
+        {
+        }
+
+        template<typename T>
+        [[nodiscard]] constexpr match find_contiguous(const T* const data, const std::size_t size) const noexcept
+        {
+            // A complete code unit sequence never occurs in the middle of another one, so every match is the delimiter.
+            const std::size_t index = search::find(data, size, m_code_units.data(), m_size, 0);
+
+            return index == search::not_found ? match{size, 0} : match{index, m_size};
+        }
+
+        template<std::forward_iterator It, std::sentinel_for<It> Sentinel>
+        [[nodiscard]] constexpr match_bounds<It> find_generic(It it, const Sentinel end) const
+        {
+            for (; it != end; ++it)
+            {
+                It          next  = it;
+                std::size_t count = 0;
+
+                while (count < m_size && next != end && text_metadata::code_unit_value(*next) == text_metadata::code_unit_value(m_code_units[count]))
+                {
+                    ++count;
+                    ++next;
+                }
+
+                if (count == m_size)
+                    return match_bounds<It>{std::move(it), std::move(next)};
+            }
+
+            return match_bounds<It>{it, it};
+        }
+
+    private:
+        std::array<code_unit_t<Encoding>, 4> m_code_units{};
+        std::uint8_t                         m_size;
+    };
+
+    /// @brief Any code point of a small set.
+    ///
+    /// The first code units of the encoded code points are the candidates that a contiguous sequence is scanned for.
+    ///
+    template<encoding Encoding>
+    class code_point_set_delimiter
+    {
+    public:
+        static constexpr bool collapses_runs = false;
+
+        /// The maximum number of code points in the set.
+        static constexpr std::size_t max_size = 16;
+
+    public:
+        /// @brief Constructs the set of `delimiters`.
+        ///
+        /// @throws std::bad_alloc if there are more than `max_size` delimiters.
+        ///
+        constexpr explicit code_point_set_delimiter(const std::initializer_list<uchar> delimiters)
+        {
+            for (const uchar delimiter : delimiters)
+            {
+                std::array<code_unit_t<Encoding>, 4> code_units{};
+
+                encode_valid_code_point<scan_encoding<Encoding>>(delimiter.value(), code_units.data());
+
+                const std::uint32_t first = text_metadata::code_unit_value(code_units[0]);
+
+                m_code_points.push_back(delimiter.value());
+
+                if (std::ranges::find(m_first_code_units, first) == m_first_code_units.end())
+                    m_first_code_units.push_back(first);
+            }
+        }
+
+        template<typename T>
+        [[nodiscard]] constexpr match find_contiguous(const T* const data, const std::size_t size) const noexcept
+        {
+            using lane = search::lanes<sizeof(T)>;
+
+            std::size_t index = 0;
+
+            for (; index + lane::count <= size; index += lane::count)
+            {
+                const swar::word_type word = search::load_lanes(data + index);
+
+                swar::word_type candidates = 0;
+
+                for (const std::uint32_t first : m_first_code_units)
+                    candidates |= equal_lanes<T>(word, first);
+
+                while (candidates != 0)
+                {
+                    const std::size_t candidate = index + static_cast<std::size_t>(std::countr_zero(candidates)) / lane::bits;
+
+                    if (const std::size_t length = match_at(data + candidate); length != 0)
+                        return match{candidate, length};
+
+                    candidates &= candidates - 1U;
+                }
+            }
+
+            for (; index < size; ++index)
+            {
+                if (std::ranges::find(m_first_code_units, text_metadata::code_unit_value(data[index])) == m_first_code_units.end())
+                    continue;
+
+                if (const std::size_t length = match_at(data + index); length != 0)
+                    return match{index, length};
+            }
+
+            return match{size, 0};
+        }
+
+        template<std::forward_iterator It, std::sentinel_for<It> Sentinel>
+        [[nodiscard]] constexpr match_bounds<It> find_generic(It it, const Sentinel end) const
+        {
+            while (it != end)
+            {
+                It next = it;
+
+                if (contains(decode_valid_code_point_and_advance<Encoding>(next)))
+                    return match_bounds<It>{std::move(it), std::move(next)};
+
+                it = std::move(next);
+            }
+
+            return match_bounds<It>{it, it};
+        }
+
+    private:
+        [[nodiscard]] constexpr bool contains(const std::uint32_t code_point) const noexcept
+        {
+            return std::ranges::find(m_code_points, code_point) != m_code_points.end();
+        }
+
+        /// @brief Returns the length of the delimiter that starts at `code_units`, or zero.
+        ///
+        /// @pre `code_units` points to the first code unit of a delimiter, so it's the beginning of a code point.
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr std::size_t match_at(const T* const code_units) const noexcept
+        {
+            const auto [code_point, length] = decode_valid_code_point<scan_encoding<Encoding>>(code_units);
+
+            return contains(code_point) ? length : 0;
+        }
+
+    private:
+        inplace_vector<std::uint32_t, max_size> m_code_points;
+        inplace_vector<std::uint32_t, max_size> m_first_code_units;
+    };
+
+    /// @brief A run of code points with the `White_Space` property.
+    ///
+    template<encoding Encoding>
+    class whitespace_delimiter
+    {
+    public:
+        static constexpr bool collapses_runs = true;
+
+    public:
+        template<typename T>
+        [[nodiscard]] constexpr match find_contiguous(const T* const data, const std::size_t size) const noexcept
+        {
+            using lane = search::lanes<sizeof(T)>;
+
+            std::size_t index = 0;
+
+            for (; index + lane::count <= size; index += lane::count)
+            {
+                swar::word_type candidates = candidate_lanes<T>(search::load_lanes(data + index));
+
+                while (candidates != 0)
+                {
+                    const std::size_t candidate = index + static_cast<std::size_t>(std::countr_zero(candidates)) / lane::bits;
+
+                    if (is_whitespace_at(data + candidate))
+                        return match{candidate, skip_contiguous(data + candidate, size - candidate)};
+
+                    candidates &= candidates - 1U;
+                }
+            }
+
+            for (; index < size; ++index)
+            {
+                if (text_metadata::is_leading_code_unit(data[index]) && is_whitespace_at(data + index))
+                    return match{index, skip_contiguous(data + index, size - index)};
+            }
+
+            return match{size, 0};
+        }
+
+        template<std::forward_iterator It, std::sentinel_for<It> Sentinel>
+        [[nodiscard]] constexpr match_bounds<It> find_generic(It it, const Sentinel end) const
+        {
+            while (it != end)
+            {
+                It next = it;
+
+                if (is_whitespace(decode_valid_code_point_and_advance<Encoding>(next)))
+                    return match_bounds<It>{it, skip(std::move(next), end)};
+
+                it = std::move(next);
+            }
+
+            return match_bounds<It>{it, it};
+        }
+
+        /// @brief Returns an iterator past the whitespace at the beginning of `[it, end)`.
+        ///
+        template<std::forward_iterator It, std::sentinel_for<It> Sentinel>
+        [[nodiscard]] constexpr It skip(It it, const Sentinel end) const
+        {
+            while (it != end)
+            {
+                It next = it;
+
+                if (!is_whitespace(decode_valid_code_point_and_advance<Encoding>(next)))
+                    break;
+
+                it = std::move(next);
+            }
+
+            return it;
+        }
+
+        [[nodiscard]] static constexpr bool is_whitespace(const std::uint32_t code_point) noexcept
+        {
+            namespace data = unicode_data::general_properties;
+
+            return (data::lookup_binary_properties(code_point) & data::white_space_bit) != 0;
+        }
+
+    private:
+        /// @brief Returns a word with the most significant bit set in the lanes of `word` that can start a whitespace code point.
+        ///
+        /// Those are U+0009..U+000D and U+0020, and the first code units of U+0085, U+00A0, U+1680, U+2000..U+200A, U+2028, U+2029,
+        /// U+202F, U+205F and U+3000.
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr swar::word_type candidate_lanes(const swar::word_type word) noexcept
+        {
+            using lane = search::lanes<sizeof(T)>;
+
+            swar::word_type candidates = equal_lanes<T>(word, 0x20U);
+
+            for (std::uint32_t control = 0x09U; control <= 0x0DU; ++control)
+                candidates |= equal_lanes<T>(word, control);
+
+            if constexpr (sizeof(T) == 1)
+            {
+                candidates |= equal_lanes<T>(word, 0xC2U) | equal_lanes<T>(word, 0xE1U) | equal_lanes<T>(word, 0xE2U) | equal_lanes<T>(word, 0xE3U);
+            }
+            else
+            {
+                // U+2000..U+203F are a single candidate, which also covers the separators and U+202F.
+                candidates |= equal_lanes<T>(word, 0x85U) | equal_lanes<T>(word, 0xA0U) | equal_lanes<T>(word, 0x1680U) |
+                              equal_lanes<T>(word, 0x205FU) | equal_lanes<T>(word, 0x3000U) |
+                              equal_lanes<T>(word & ~(lane::ones * 0x3FU), 0x2000U);
+            }
+
+            return candidates;
+        }
+
+        template<typename T>
+        [[nodiscard]] static constexpr bool is_whitespace_at(const T* const code_units) noexcept
+        {
+            return is_whitespace(decode_valid_code_point<scan_encoding<Encoding>>(code_units).value);
+        }
+
+        /// @brief Returns the length of the run of whitespace at the beginning of `[data, data + size)`.
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr std::size_t skip_contiguous(const T* const data, const std::size_t size) noexcept
+        {
+            std::size_t index = 0;
+
+            while (index < size)
+            {
+                const auto [code_point, length] = decode_valid_code_point<scan_encoding<Encoding>>(data + index);
+
+                if (!is_whitespace(code_point))
+                    break;
+
+                index += length;
+            }
+
+            return index;
+        }
+    };
+} // namespace upp::impl::split
+
+#endif // UNI_CPP_IMPL_SPLIT_HPP
\ No newline at end of file
@@ -7,7 +7,10 @@
 ///
 
 #include "../../encoding.hpp"
+#include "../inplace_vector.hpp"
+#include "../small_text_buffer.hpp"
 
+#include <cstddef>
 #include <string>
 #include <concepts>
 #include <ranges>
@@ -152,6 +155,71 @@ namespace upp
     /// @brief Default Unicode string type. Uses the UTF-8 encoding.
     ///
     using ustring = basic_ustring<encoding::utf8, std::u8string>;
+
+    /// @brief UTF-8 string type that stores up to 31 code units inline and caches whether it's ASCII and its code point count.
+    ///
+    /// Uses `small_text_buffer` as the underlying container.
+    ///
+    /// @headerfile "" <uni-cpp/string.hpp>
+    ///
+    using small_utf8_string = basic_utf8_string<small_text_buffer<char8_t>>;
+
+    /// @brief UTF-16 string type that stores up to 15 code units inline and caches whether it's ASCII and its code point count.
+    ///
+    /// Uses `small_text_buffer` as the underlying container.
+    ///
+    /// @headerfile "" <uni-cpp/string.hpp>
+    ///
+    using small_utf16_string = basic_utf16_string<small_text_buffer<char16_t>>;
+
+    /// @brief Default Unicode string type that stores short strings inline. Uses the UTF-8 encoding.
+    ///
+    /// @headerfile "" <uni-cpp/string.hpp>
+    ///
+    using small_ustring = small_utf8_string;
+
+    /// @brief ASCII string type with a fixed capacity of `N` characters, stored inline without any heap allocation.
+    ///
+    /// `from_ascii` reports input that doesn't fit as an error instead of throwing.
+    ///
+    /// @headerfile "" <uni-cpp/string.hpp>
+    ///
+    template<std::size_t N>
+    using inplace_ascii_string = basic_ascii_string<impl::inplace_vector<char, N>>;
+
+    /// @brief Unicode string type with a fixed capacity of `N` code units, stored inline without any heap allocation.
+    ///
+    /// Meant for short strings like tags, keys or tokens. The checked factories (`from_utf8`, `from_utf16` and `from_utf32`)
+    /// report input that doesn't fit as a `capacity_exceeded` error instead of throwing, and never split a code point.
+    /// The other factories throw `std::bad_alloc` if the input doesn't fit.
+    ///
+    /// @tparam Encoding Used for encoding the Unicode code points.
+    /// @tparam N The maximum number of code units.
+    ///
+    /// @headerfile "" <uni-cpp/string.hpp>
+    ///
+    template<encoding Encoding, std::size_t N>
+    using basic_inplace_ustring = basic_ustring<Encoding, impl::inplace_vector<typename encoding_traits<Encoding>::default_code_unit_type, N>>;
+
+    /// @brief UTF-8 string type with a fixed capacity of `N` code units.
+    ///
+    template<std::size_t N>
+    using inplace_utf8_string = basic_inplace_ustring<encoding::utf8, N>;
+
+    /// @brief UTF-16 string type with a fixed capacity of `N` code units.
+    ///
+    template<std::size_t N>
+    using inplace_utf16_string = basic_inplace_ustring<encoding::utf16, N>;
+
+    /// @brief UTF-32 string type with a fixed capacity of `N` code units.
+    ///
+    template<std::size_t N>
+    using inplace_utf32_string = basic_inplace_ustring<encoding::utf32, N>;
+
+    /// @brief Default Unicode string type with a fixed capacity of `N` code units. Uses the UTF-8 encoding.
+    ///
+    template<std::size_t N>
+    using inplace_ustring = basic_inplace_ustring<encoding::utf8, N>;
 } // namespace upp
 
 #endif // UNI_CPP_IMPL_STRING_FWD_HPP
\ No newline at end of file
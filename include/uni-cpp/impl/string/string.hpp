@@ -8,12 +8,16 @@
 
 #include "../../uchar.hpp"
 #include "../../encoding.hpp"
+#include "../../normalization.hpp"
 
 #include "../ranges/base.hpp"
 #include "../ranges/approximately_sized_range.hpp"
+#include "../ranges/valid_code_unit_range.hpp"
+#include "../text_metadata.hpp"
 
 #include "fwd.hpp"
 #include "string_literal.hpp"
+#include "with_text_metadata.hpp"
 
 #include <type_traits>
 #include <memory>
@@ -44,6 +48,61 @@ namespace upp
         { cc.max_size() } -> std::same_as<decltype(n)>;
     };
 
+    /// @brief Concept for identifying containers with a fixed capacity that store their elements inline, like `inplace_vector`.
+    ///
+    /// The string factories never reserve storage up front in such containers, and the checked factories (`from_utf8` etc.)
+    /// report input that doesn't fit as a `capacity_exceeded` error instead of throwing.
+    ///
+    /// @headerfile "" <uni-cpp/string.hpp>
+    ///
+    template<typename C>
+    concept fixed_capacity_container = container<C> && requires(C& c, const typename C::value_type& v) {
+        { c.try_push_back(v) } -> std::same_as<typename C::value_type*>;
+        { C::capacity() } -> std::same_as<typename C::size_type>;
+    };
+
+    /// @brief Concept for identifying containers that can take over the storage of a `From` container, whose elements have a different type.
+    ///
+    /// `C::adopt_storage(std::move(from), n)` must return a `C` that owns the allocation of `from` and holds the `n` elements whose
+    /// object representations were written to the beginning of `from.data()`. Containers that keep their elements in a byte buffer
+    /// (e.g. a `std::vector<std::byte>`) can implement it without allocating.
+    ///
+    /// `basic_ustring::transcode() &&` uses it to transcode a string inside its own storage.
+    ///
+    /// @headerfile "" <uni-cpp/string.hpp>
+    ///
+    template<typename C, typename From>
+    concept storage_adopting_container = container<C> && container<From> && requires(From&& from, typename C::size_type n) {
+        { C::adopt_storage(std::move(from), n) } -> std::same_as<C>;
+    };
+
+    namespace impl
+    {
+        /// Containers in which the factories reserve the (estimated) final size up front.
+        /// Reserving more than the capacity of a fixed-capacity container throws, so they are excluded.
+        template<typename C>
+        concept reserves_for_size_hint = reservable_container<C> && !fixed_capacity_container<C>;
+
+        /// Containers that cache whether all of their code units are ASCII and how many code points they hold, like `small_text_buffer`.
+        template<typename C>
+        concept text_metadata_container = container<C> && requires(const C& cc) {
+            { cc.is_ascii() } -> std::same_as<bool>;
+            { cc.code_point_count() } -> std::same_as<typename C::size_type>;
+        };
+
+        /// Containers that also cache whether any of their code points is supplementary (above U+FFFF), like `with_text_metadata`.
+        template<typename C>
+        concept supplementary_metadata_container = text_metadata_container<C> && requires(const C& cc) {
+            { cc.has_supplementary_code_points() } -> std::same_as<bool>;
+        };
+
+        /// Containers that can be constructed from their underlying container together with the counts of its code units,
+        /// like `with_text_metadata`. The validating factories collect the counts while they validate.
+        template<typename C>
+        concept counted_metadata_container = text_metadata_container<C> && requires { typename C::container_type; } &&
+                                             std::constructible_from<C, typename C::container_type, const text_metadata::counts&>;
+    } // namespace impl
+
     template<string_compatible_container<encoding::ascii> Container>
     class basic_ascii_string
     {
@@ -148,6 +207,9 @@ namespace upp
         ///
         /// @return `std::expected` containing the string on success, or an `from_ascii_error` on failure.
         ///
+        /// If `Container` is a `fixed_capacity_container` (e.g. for `inplace_ascii_string`) and the string doesn't fit into it,
+        /// the error code is `ascii_error_code::capacity_exceeded`, and `valid_up_to` is the capacity.
+        ///
         /// If you are absolutely certain that `range` is valid ASCII, you can use `from_ascii_unchecked` instead.
         ///
         /// @see from_ascii_lossy, from_ascii_unchecked
@@ -159,6 +221,18 @@ namespace upp
             requires ranges::code_unit_range_for<Range, encoding::ascii>
         [[nodiscard]] static constexpr std::expected<basic_ascii_string, from_ascii_error> from_ascii(Range&& range);
 
+        /// @brief Same as `from_ascii(range)`, but the underlying container is constructed with the allocator `alloc`.
+        ///
+        /// All memory of the result is allocated with `alloc`, so with e.g. a `std::pmr::polymorphic_allocator`
+        /// the string can be constructed in a per-request arena.
+        ///
+        /// @note This function participates in overload resolution only if the underlying container type
+        /// is allocator-aware and `std::uses_allocator_v<container_type, Allocator>` is `true`.
+        ///
+        template<std::ranges::input_range Range, typename Allocator>
+            requires ranges::code_unit_range_for<Range, encoding::ascii> && std::uses_allocator_v<Container, Allocator>
+        [[nodiscard]] static constexpr std::expected<basic_ascii_string, from_ascii_error> from_ascii(Range&& range, const Allocator& alloc);
+
         /// @brief Constructs a `basic_ascii_string` from ASCII encoded data, replacing decoding errors with `ascii_char::substitute_character()`s.
         ///
         /// @see from_ascii, from_ascii_unchecked
@@ -170,6 +244,18 @@ namespace upp
             requires ranges::code_unit_range_for<Range, encoding::ascii>
         [[nodiscard]] static constexpr basic_ascii_string from_ascii_lossy(Range&& range);
 
+        /// @brief Same as `from_ascii_lossy(range)`, but the underlying container is constructed with the allocator `alloc`.
+        ///
+        /// All memory of the result is allocated with `alloc`, so with e.g. a `std::pmr::polymorphic_allocator`
+        /// the string can be constructed in a per-request arena.
+        ///
+        /// @note This function participates in overload resolution only if the underlying container type
+        /// is allocator-aware and `std::uses_allocator_v<container_type, Allocator>` is `true`.
+        ///
+        template<std::ranges::input_range Range, typename Allocator>
+            requires ranges::code_unit_range_for<Range, encoding::ascii> && std::uses_allocator_v<Container, Allocator>
+        [[nodiscard]] static constexpr basic_ascii_string from_ascii_lossy(Range&& range, const Allocator& alloc);
+
         /// @brief Constructs a `basic_ascii_string` from ASCII encoded data without error checking.
         ///
         /// @pre `range` MUST be valid ASCII.
@@ -186,6 +272,18 @@ namespace upp
             requires ranges::code_unit_range_for<Range, encoding::ascii>
         [[nodiscard]] static constexpr basic_ascii_string from_ascii_unchecked(Range&& range);
 
+        /// @brief Same as `from_ascii_unchecked(range)`, but the underlying container is constructed with the allocator `alloc`.
+        ///
+        /// All memory of the result is allocated with `alloc`, so with e.g. a `std::pmr::polymorphic_allocator`
+        /// the string can be constructed in a per-request arena.
+        ///
+        /// @note This function participates in overload resolution only if the underlying container type
+        /// is allocator-aware and `std::uses_allocator_v<container_type, Allocator>` is `true`.
+        ///
+        template<std::ranges::input_range Range, typename Allocator>
+            requires ranges::code_unit_range_for<Range, encoding::ascii> && std::uses_allocator_v<Container, Allocator>
+        [[nodiscard]] static constexpr basic_ascii_string from_ascii_unchecked(Range&& range, const Allocator& alloc);
+
         /// @brief Returns a `const` reference to the underlying container.
         ///
         /// It is intended for interoperability with APIs that expect the underlying container as an input.
@@ -257,6 +355,17 @@ namespace upp
         {
         }
 
+        // Implementations of the factories. `alloc` is either empty or the allocator for the underlying container.
+
+        template<typename Range, typename... Allocator>
+        [[nodiscard]] static constexpr std::expected<basic_ascii_string, from_ascii_error> from_ascii_impl(Range&& range, const Allocator&... alloc);
+
+        template<typename Range, typename... Allocator>
+        [[nodiscard]] static constexpr basic_ascii_string from_ascii_lossy_impl(Range&& range, const Allocator&... alloc);
+
+        template<typename Range, typename... Allocator>
+        [[nodiscard]] static constexpr basic_ascii_string from_ascii_unchecked_impl(Range&& range, const Allocator&... alloc);
+
         /// @brief Appends a single code unit to the end of the string.
         ///
         template<typename T>
@@ -293,6 +402,46 @@ namespace upp
         /// the `basic_ustring`, which could cause unnecessarily many template instantiations of those functions.
         ///
         class basic_ustring_impl;
+
+        template<typename T, encoding Encoding>
+        inline constexpr bool is_basic_ustring_of = false;
+
+        template<encoding Encoding, typename Container>
+        inline constexpr bool is_basic_ustring_of<basic_ustring<Encoding, Container>, Encoding> = true;
+
+        /// Needles of the search functions of `basic_ustring`: a code point, a string in the same encoding,
+        /// or a contiguous sized range of valid code units (e.g. a span marked with `views::mark_as_valid_encoding`).
+        template<typename Needle, encoding Encoding>
+        concept search_needle = std::same_as<Needle, uchar> || is_basic_ustring_of<Needle, Encoding> ||
+                                (ranges::valid_code_unit_range<const Needle&, Encoding> && std::ranges::contiguous_range<const Needle&> &&
+                                 std::ranges::sized_range<const Needle&>);
+
+        /// The encoding of a piece that `basic_ustring::append` and `concat` accept, other than a `uchar`.
+        template<typename Piece>
+        struct string_piece_encoding
+        {
+        };
+
+        template<encoding Encoding, typename Container>
+        struct string_piece_encoding<basic_ustring<Encoding, Container>> : std::integral_constant<encoding, Encoding>
+        {
+        };
+
+        template<typename Container>
+        struct string_piece_encoding<basic_ascii_string<Container>> : std::integral_constant<encoding, encoding::ascii>
+        {
+        };
+
+        // Forward ranges only, because the size of a piece is counted before it's written.
+        template<std::ranges::forward_range View, encoding Encoding>
+        struct string_piece_encoding<ranges::valid_code_unit_view<View, Encoding>> : std::integral_constant<encoding, Encoding>
+        {
+        };
+
+        /// Pieces of `basic_ustring::append` and `concat`: a code point, a string in any encoding,
+        /// or a forward range marked as valid (e.g. with `views::mark_as_valid_utf16`).
+        template<typename Piece>
+        concept string_piece = std::same_as<Piece, uchar> || requires { string_piece_encoding<Piece>::value; };
     } // namespace impl
 
     template<encoding Encoding, string_compatible_container<Encoding> Container>
@@ -308,6 +457,9 @@ namespace upp
         using code_unit_type = Container::value_type;
         using char_type      = uchar;
 
+        /// @brief Returned by `find` and `rfind` when there is no match.
+        static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
     public:
         /// @brief Default constructor. Constructs an empty string.
         ///
@@ -400,6 +552,10 @@ namespace upp
         ///
         /// @return `std::expected` containing the string on success, or a `from_utf8_error` on failure.
         ///
+        /// If `Container` is a `fixed_capacity_container` (e.g. for `basic_inplace_ustring`) and the string doesn't fit into it,
+        /// the error code is `utf8_error_code::capacity_exceeded`, and `valid_up_to` is the length of
+        /// the longest prefix of whole code points that fits.
+        ///
         /// If you are absolutely certain that `range` is valid UTF-8, you can use `from_utf8_unchecked` instead.
         ///
         /// @see from_utf8_lossy, from_utf8_unchecked
@@ -411,6 +567,18 @@ namespace upp
             requires ranges::code_unit_range_for<Range, encoding::utf8>
         [[nodiscard]] static constexpr std::expected<basic_ustring, from_utf8_error> from_utf8(Range&& range);
 
+        /// @brief Same as `from_utf8(range)`, but the underlying container is constructed with the allocator `alloc`.
+        ///
+        /// All memory of the result is allocated with `alloc`, so with e.g. a `std::pmr::polymorphic_allocator`
+        /// the string can be constructed in a per-request arena.
+        ///
+        /// @note This function participates in overload resolution only if the underlying container type
+        /// is allocator-aware and `std::uses_allocator_v<container_type, Allocator>` is `true`.
+        ///
+        template<std::ranges::input_range Range, typename Allocator>
+            requires ranges::code_unit_range_for<Range, encoding::utf8> && std::uses_allocator_v<Container, Allocator>
+        [[nodiscard]] static constexpr std::expected<basic_ustring, from_utf8_error> from_utf8(Range&& range, const Allocator& alloc);
+
         /// @brief Constructs a `basic_ustring` from UTF-8 encoded data, replacing decoding errors with `uchar::replacement_character()`s.
         ///
         /// @see from_utf8, from_utf8_unchecked
@@ -422,6 +590,18 @@ namespace upp
             requires ranges::code_unit_range_for<Range, encoding::utf8>
         [[nodiscard]] static constexpr basic_ustring from_utf8_lossy(Range&& range);
 
+        /// @brief Same as `from_utf8_lossy(range)`, but the underlying container is constructed with the allocator `alloc`.
+        ///
+        /// All memory of the result is allocated with `alloc`, so with e.g. a `std::pmr::polymorphic_allocator`
+        /// the string can be constructed in a per-request arena.
+        ///
+        /// @note This function participates in overload resolution only if the underlying container type
+        /// is allocator-aware and `std::uses_allocator_v<container_type, Allocator>` is `true`.
+        ///
+        template<std::ranges::input_range Range, typename Allocator>
+            requires ranges::code_unit_range_for<Range, encoding::utf8> && std::uses_allocator_v<Container, Allocator>
+        [[nodiscard]] static constexpr basic_ustring from_utf8_lossy(Range&& range, const Allocator& alloc);
+
         /// @brief Constructs a `basic_ustring` from UTF-8 encoded data without error checking.
         ///
         /// @pre `range` MUST be valid UTF-8.
@@ -438,10 +618,26 @@ namespace upp
             requires ranges::code_unit_range_for<Range, encoding::utf8>
         [[nodiscard]] static constexpr basic_ustring from_utf8_unchecked(Range&& range);
 
+        /// @brief Same as `from_utf8_unchecked(range)`, but the underlying container is constructed with the allocator `alloc`.
+        ///
+        /// All memory of the result is allocated with `alloc`, so with e.g. a `std::pmr::polymorphic_allocator`
+        /// the string can be constructed in a per-request arena.
+        ///
+        /// @note This function participates in overload resolution only if the underlying container type
+        /// is allocator-aware and `std::uses_allocator_v<container_type, Allocator>` is `true`.
+        ///
+        template<std::ranges::input_range Range, typename Allocator>
+            requires ranges::code_unit_range_for<Range, encoding::utf8> && std::uses_allocator_v<Container, Allocator>
+        [[nodiscard]] static constexpr basic_ustring from_utf8_unchecked(Range&& range, const Allocator& alloc);
+
         /// @brief Constructs a `basic_ustring` from UTF-16 encoded data with error checking.
         ///
         /// @return `std::expected` containing the string on success, or a `from_utf16_error` on failure.
         ///
+        /// If `Container` is a `fixed_capacity_container` (e.g. for `basic_inplace_ustring`) and the string doesn't fit into it,
+        /// the error code is `utf16_error_code::capacity_exceeded`, and `valid_up_to` is the length of
+        /// the longest prefix of whole code points that fits.
+        ///
         /// If you are absolutely certain that `range` is valid UTF-16, you can use `from_utf16_unchecked` instead.
         ///
         /// @see from_utf16_lossy, from_utf16_unchecked
@@ -453,6 +649,18 @@ namespace upp
             requires ranges::code_unit_range_for<Range, encoding::utf16>
         [[nodiscard]] static constexpr std::expected<basic_ustring, from_utf16_error> from_utf16(Range&& range);
 
+        /// @brief Same as `from_utf16(range)`, but the underlying container is constructed with the allocator `alloc`.
+        ///
+        /// All memory of the result is allocated with `alloc`, so with e.g. a `std::pmr::polymorphic_allocator`
+        /// the string can be constructed in a per-request arena.
+        ///
+        /// @note This function participates in overload resolution only if the underlying container type
+        /// is allocator-aware and `std::uses_allocator_v<container_type, Allocator>` is `true`.
+        ///
+        template<std::ranges::input_range Range, typename Allocator>
+            requires ranges::code_unit_range_for<Range, encoding::utf16> && std::uses_allocator_v<Container, Allocator>
+        [[nodiscard]] static constexpr std::expected<basic_ustring, from_utf16_error> from_utf16(Range&& range, const Allocator& alloc);
+
         /// @brief Constructs a `basic_ustring` from UTF-16 encoded data, replacing decoding errors with `uchar::replacement_character()`s.
         ///
         /// @see from_utf16, from_utf16_unchecked
@@ -464,6 +672,18 @@ namespace upp
             requires ranges::code_unit_range_for<Range, encoding::utf16>
         [[nodiscard]] static constexpr basic_ustring from_utf16_lossy(Range&& range);
 
+        /// @brief Same as `from_utf16_lossy(range)`, but the underlying container is constructed with the allocator `alloc`.
+        ///
+        /// All memory of the result is allocated with `alloc`, so with e.g. a `std::pmr::polymorphic_allocator`
+        /// the string can be constructed in a per-request arena.
+        ///
+        /// @note This function participates in overload resolution only if the underlying container type
+        /// is allocator-aware and `std::uses_allocator_v<container_type, Allocator>` is `true`.
+        ///
+        template<std::ranges::input_range Range, typename Allocator>
+            requires ranges::code_unit_range_for<Range, encoding::utf16> && std::uses_allocator_v<Container, Allocator>
+        [[nodiscard]] static constexpr basic_ustring from_utf16_lossy(Range&& range, const Allocator& alloc);
+
         /// @brief Constructs a `basic_ustring` from UTF-16 encoded data without error checking.
         ///
         /// @pre `range` MUST be valid UTF-16.
@@ -480,10 +700,26 @@ namespace upp
             requires ranges::code_unit_range_for<Range, encoding::utf16>
         [[nodiscard]] static constexpr basic_ustring from_utf16_unchecked(Range&& range);
 
+        /// @brief Same as `from_utf16_unchecked(range)`, but the underlying container is constructed with the allocator `alloc`.
+        ///
+        /// All memory of the result is allocated with `alloc`, so with e.g. a `std::pmr::polymorphic_allocator`
+        /// the string can be constructed in a per-request arena.
+        ///
+        /// @note This function participates in overload resolution only if the underlying container type
+        /// is allocator-aware and `std::uses_allocator_v<container_type, Allocator>` is `true`.
+        ///
+        template<std::ranges::input_range Range, typename Allocator>
+            requires ranges::code_unit_range_for<Range, encoding::utf16> && std::uses_allocator_v<Container, Allocator>
+        [[nodiscard]] static constexpr basic_ustring from_utf16_unchecked(Range&& range, const Allocator& alloc);
+
         /// @brief Constructs a `basic_ustring` from UTF-32 encoded data with error checking.
         ///
         /// @return `std::expected` containing the string on success, or a `from_utf32_error` on failure.
         ///
+        /// If `Container` is a `fixed_capacity_container` (e.g. for `basic_inplace_ustring`) and the string doesn't fit into it,
+        /// the error code is `utf32_error_code::capacity_exceeded`, and `valid_up_to` is the length of
+        /// the longest prefix of whole code points that fits.
+        ///
         /// If you are absolutely certain that `range` is valid UTF-32, you can use `from_utf32_unchecked` instead.
         ///
         /// @see from_utf32_lossy, from_utf32_unchecked
@@ -495,6 +731,18 @@ namespace upp
             requires ranges::code_unit_range_for<Range, encoding::utf32>
         [[nodiscard]] static constexpr std::expected<basic_ustring, from_utf32_error> from_utf32(Range&& range);
 
+        /// @brief Same as `from_utf32(range)`, but the underlying container is constructed with the allocator `alloc`.
+        ///
+        /// All memory of the result is allocated with `alloc`, so with e.g. a `std::pmr::polymorphic_allocator`
+        /// the string can be constructed in a per-request arena.
+        ///
+        /// @note This function participates in overload resolution only if the underlying container type
+        /// is allocator-aware and `std::uses_allocator_v<container_type, Allocator>` is `true`.
+        ///
+        template<std::ranges::input_range Range, typename Allocator>
+            requires ranges::code_unit_range_for<Range, encoding::utf32> && std::uses_allocator_v<Container, Allocator>
+        [[nodiscard]] static constexpr std::expected<basic_ustring, from_utf32_error> from_utf32(Range&& range, const Allocator& alloc);
+
         /// @brief Constructs a `basic_ustring` from UTF-32 encoded data, replacing decoding errors with `uchar::replacement_character()`s.
         ///
         /// @see from_utf32, from_utf32_unchecked
@@ -506,6 +754,18 @@ namespace upp
             requires ranges::code_unit_range_for<Range, encoding::utf32>
         [[nodiscard]] static constexpr basic_ustring from_utf32_lossy(Range&& range);
 
+        /// @brief Same as `from_utf32_lossy(range)`, but the underlying container is constructed with the allocator `alloc`.
+        ///
+        /// All memory of the result is allocated with `alloc`, so with e.g. a `std::pmr::polymorphic_allocator`
+        /// the string can be constructed in a per-request arena.
+        ///
+        /// @note This function participates in overload resolution only if the underlying container type
+        /// is allocator-aware and `std::uses_allocator_v<container_type, Allocator>` is `true`.
+        ///
+        template<std::ranges::input_range Range, typename Allocator>
+            requires ranges::code_unit_range_for<Range, encoding::utf32> && std::uses_allocator_v<Container, Allocator>
+        [[nodiscard]] static constexpr basic_ustring from_utf32_lossy(Range&& range, const Allocator& alloc);
+
         /// @brief Constructs a `basic_ustring` from UTF-32 encoded data without error checking.
         ///
         /// @pre `range` MUST be valid UTF-32.
@@ -522,6 +782,18 @@ namespace upp
             requires ranges::code_unit_range_for<Range, encoding::utf32>
         [[nodiscard]] static constexpr basic_ustring from_utf32_unchecked(Range&& range);
 
+        /// @brief Same as `from_utf32_unchecked(range)`, but the underlying container is constructed with the allocator `alloc`.
+        ///
+        /// All memory of the result is allocated with `alloc`, so with e.g. a `std::pmr::polymorphic_allocator`
+        /// the string can be constructed in a per-request arena.
+        ///
+        /// @note This function participates in overload resolution only if the underlying container type
+        /// is allocator-aware and `std::uses_allocator_v<container_type, Allocator>` is `true`.
+        ///
+        template<std::ranges::input_range Range, typename Allocator>
+            requires ranges::code_unit_range_for<Range, encoding::utf32> && std::uses_allocator_v<Container, Allocator>
+        [[nodiscard]] static constexpr basic_ustring from_utf32_unchecked(Range&& range, const Allocator& alloc);
+
         /// @brief Returns a `const` reference to the underlying container.
         ///
         /// It is intended for interoperability with APIs that expect the underlying container as an input.
@@ -578,6 +850,347 @@ namespace upp
         ///
         constexpr void clear() noexcept { m_container.clear(); }
 
+        /// @brief Appends `piece` to the end of the string, transcoded to `Encoding`.
+        ///
+        /// `piece` is a `uchar`, a `basic_ustring` in any encoding, a `basic_ascii_string`, or a forward range marked as valid
+        /// (a `ranges::valid_code_unit_view`, e.g. the result of `views::mark_as_valid_utf16`).
+        ///
+        /// The exact number of code units that `piece` converts to is counted first, so the string grows at most once,
+        /// and the code units are then transcoded straight into the end of the string, without a temporary string.
+        /// Pieces in the same encoding, and ASCII pieces, are appended as a single range of code units.
+        ///
+        /// If the container has a fixed capacity that `piece` doesn't fit into, `std::bad_alloc` is thrown and the string is unchanged.
+        ///
+        /// The string itself can be appended (`text.append(text)`), and so can a view of its own code units
+        /// (`text.append(text.code_units() | views::mark_as_valid_utf8)`), which is read by index while the string grows.
+        ///
+        /// @par Example
+        ///
+        /// @code{.cpp}
+        ///
+        /// using namespace std::string_view_literals;
+        /// using namespace upp::string_literals;
+        ///
+        /// auto line = u8"[worker 3] "_us;
+        ///
+        /// line.append(upp::utf16_string::from_utf16_unchecked(u"r\u00E9sum\u00E9"sv)).append(U'\u2713'_uc);
+        ///
+        /// @endcode
+        ///
+        /// @see concat
+        ///
+        /// @return `*this`
+        ///
+        template<impl::string_piece Piece>
+        constexpr basic_ustring& append(const Piece& piece);
+
+        /// @brief Returns the number of code points in the string.
+        ///
+        /// O(1) if the underlying container caches the count (like `small_text_buffer` and `with_text_metadata`).
+        /// Otherwise the code units that start a code point are counted, a word at a time in UTF-8.
+        ///
+        [[nodiscard]] constexpr size_type code_point_count() const noexcept
+        {
+            if constexpr (impl::text_metadata_container<Container>)
+            {
+                return m_container.code_point_count();
+            }
+            else
+            {
+                const auto units = code_units();
+
+                return static_cast<size_type>(impl::text_metadata::count_code_points(units.data(), units.size()));
+            }
+        }
+
+        /// @brief Checks whether all characters of the string are ASCII.
+        ///
+        /// O(1) if the underlying container caches it (like `small_text_buffer` and `with_text_metadata`).
+        ///
+        [[nodiscard]] constexpr bool is_ascii() const noexcept
+        {
+            if constexpr (impl::text_metadata_container<Container>)
+            {
+                return m_container.is_ascii();
+            }
+            else
+            {
+                const auto units = code_units();
+
+                return impl::text_metadata::is_ascii(units.data(), units.size());
+            }
+        }
+
+        /// @brief Returns the code unit position of the first occurrence of `needle` that starts at or after the code unit position `pos`,
+        ///        or `npos` if there is none.
+        ///
+        /// `needle` is a `uchar`, a `basic_ustring` of the same encoding, or a contiguous sized range of valid code units
+        /// (see `ranges::valid_code_unit_range`). An empty needle is found at `pos`, if `pos <= code_units().size()`.
+        ///
+        /// The haystack is scanned a word of code units at a time for the first and the last code unit of the encoded needle,
+        /// and only those candidates are compared in full. Because both the string and the needle are valid, every match
+        /// starts and ends on a code point boundary, so no boundaries are checked.
+        ///
+        /// @par Example
+        ///
+        /// @code{.cpp}
+        ///
+        /// using namespace upp::string_literals;
+        ///
+        /// const auto text = u8"caf\u00E9 au lait, caf\u00E9 noir"_us;
+        ///
+        /// text.find(u8"caf\u00E9"_us);     // 0
+        /// text.find(u8"caf\u00E9"_us, 1);  // 15
+        /// text.find(U'\u00E9'_uc);        // 3
+        /// text.rfind(u8"caf\u00E9"_us);    // 15
+        /// text.count(U'\u00E9'_uc);       // 2
+        ///
+        /// @endcode
+        ///
+        template<impl::search_needle<Encoding> Needle>
+        [[nodiscard]] constexpr size_type find(const Needle& needle, const size_type pos = 0) const noexcept;
+
+        /// @brief Returns the code unit position of the last occurrence of `needle` that starts at or before the code unit position `pos`,
+        ///        or `npos` if there is none.
+        ///
+        /// Accepts the same needles as `find`. An empty needle is found at `min(pos, code_units().size())`.
+        ///
+        template<impl::search_needle<Encoding> Needle>
+        [[nodiscard]] constexpr size_type rfind(const Needle& needle, const size_type pos = npos) const noexcept;
+
+        /// @brief Checks whether the string contains `needle`. Same as `find(needle) != npos`.
+        ///
+        template<impl::search_needle<Encoding> Needle>
+        [[nodiscard]] constexpr bool contains(const Needle& needle) const noexcept;
+
+        /// @brief Returns the number of non-overlapping occurrences of `needle`, counted from the beginning of the string.
+        ///
+        /// An empty needle occurs at every code point boundary, i.e. `code_point_count() + 1` times.
+        ///
+        template<impl::search_needle<Encoding> Needle>
+        [[nodiscard]] constexpr size_type count(const Needle& needle) const noexcept;
+
+        /// @brief Checks whether the string begins with `needle`.
+        ///
+        template<impl::search_needle<Encoding> Needle>
+        [[nodiscard]] constexpr bool starts_with(const Needle& needle) const noexcept;
+
+        /// @brief Checks whether the string ends with `needle`.
+        ///
+        template<impl::search_needle<Encoding> Needle>
+        [[nodiscard]] constexpr bool ends_with(const Needle& needle) const noexcept;
+
+        /// @brief Returns the string with every non-overlapping occurrence of `from` replaced by `to`, scanning from the beginning.
+        ///
+        /// `from` and `to` are needles like the ones that `find` accepts. An empty `from` doesn't occur anywhere,
+        /// so the string is returned unchanged.
+        ///
+        /// The occurrences are found with the same search as `find`. If `from` and `to` differ in length, the occurrences
+        /// are counted first, so that the result is allocated once with its exact size.
+        ///
+        /// @par Example
+        ///
+        /// @code{.cpp}
+        ///
+        /// using namespace upp::char_literals;
+        /// using namespace upp::string_literals;
+        ///
+        /// const auto text = u8"a\u00A0b\u00A0c"_us;
+        ///
+        /// text.replace_all(U'\u00A0'_uc, U' '_uc);    // u8"a b c"
+        /// text.replace_all(U'\u00A0'_uc, u8", "_us);  // u8"a, b, c"
+        ///
+        /// @endcode
+        ///
+        template<impl::search_needle<Encoding> From, impl::search_needle<Encoding> To>
+        [[nodiscard]] constexpr basic_ustring replace_all(const From& from, const To& to) const&;
+
+        /// @brief Returns the string with every non-overlapping occurrence of `from` replaced by `to`, scanning from the beginning.
+        ///
+        /// Same as `replace_all(from, to) const&`, except that the string is moved into the result if `from` doesn't occur,
+        /// and that if `from` and `to` have the same length, the occurrences are overwritten in place, without any allocation.
+        ///
+        template<impl::search_needle<Encoding> From, impl::search_needle<Encoding> To>
+        [[nodiscard]] constexpr basic_ustring replace_all(const From& from, const To& to) &&;
+
+        /// @brief Returns a view of the string without the White_Space code points at its beginning and at its end.
+        ///
+        /// Nothing is copied: the view refers to the code units of the string, so it's invalidated like them.
+        /// Only the stripped code points and the first and last remaining ones are decoded.
+        ///
+        /// @par Example
+        ///
+        /// @code{.cpp}
+        ///
+        /// using namespace upp::string_literals;
+        ///
+        /// const auto text = u8"\u3000 name\t\n"_us;
+        ///
+        /// text.trim();        // The code units of u8"name"
+        /// text.trim_start();  // The code units of u8"name\t\n"
+        /// text.trim_end();    // The code units of u8"\u3000 name"
+        ///
+        /// @endcode
+        ///
+        /// @see ranges::views::trim
+        ///
+        [[nodiscard]] constexpr ranges::valid_code_unit_view<std::span<const code_unit_type>, Encoding> trim() const noexcept;
+
+        /// @brief Returns a view of the string without the White_Space code points at its beginning.
+        ///
+        /// @see trim
+        ///
+        [[nodiscard]] constexpr ranges::valid_code_unit_view<std::span<const code_unit_type>, Encoding> trim_start() const noexcept;
+
+        /// @brief Returns a view of the string without the White_Space code points at its end.
+        ///
+        /// @see trim
+        ///
+        [[nodiscard]] constexpr ranges::valid_code_unit_view<std::span<const code_unit_type>, Encoding> trim_end() const noexcept;
+
+        /// @brief Returns the string with every character replaced by its lowercase mapping.
+        ///
+        /// Every code point is mapped by `uchar::to_lowercase`, so context-sensitive mappings (like the final sigma) are not applied.
+        ///
+        /// ASCII strings are mapped code unit by code unit, without looking up any case mapping tables.
+        /// ASCII characters in other strings are mapped without table lookups too.
+        /// An ASCII string without uppercase letters is returned unchanged.
+        ///
+        /// @see to_uppercase
+        ///
+        [[nodiscard]] constexpr basic_ustring to_lowercase() const&;
+
+        /// @brief Returns the string with every character replaced by its lowercase mapping.
+        ///
+        /// Same as `to_lowercase() const&`, except that a string which the mapping leaves unchanged is moved into the result instead of being copied.
+        ///
+        [[nodiscard]] constexpr basic_ustring to_lowercase() &&;
+
+        /// @brief Returns the string with every character replaced by its uppercase mapping.
+        ///
+        /// Every code point is mapped by `uchar::to_uppercase`, which can map one code point to several (e.g. U+00DF to "SS").
+        ///
+        /// ASCII strings are mapped code unit by code unit, without looking up any case mapping tables.
+        /// ASCII characters in other strings are mapped without table lookups too.
+        /// An ASCII string without lowercase letters is returned unchanged.
+        ///
+        /// @see to_lowercase
+        ///
+        [[nodiscard]] constexpr basic_ustring to_uppercase() const&;
+
+        /// @brief Returns the string with every character replaced by its uppercase mapping.
+        ///
+        /// Same as `to_uppercase() const&`, except that a string which the mapping leaves unchanged is moved into the result instead of being copied.
+        ///
+        [[nodiscard]] constexpr basic_ustring to_uppercase() &&;
+
+        /// @brief Returns the string converted to `TargetEncoding`, stored in a `TargetContainer`.
+        ///
+        /// The code units of ASCII strings are only widened or narrowed, without decoding them.
+        /// If the underlying container caches metadata about the text (like `with_text_metadata`), the result is allocated
+        /// with its exact size whenever the metadata determines it: for ASCII text, for conversions to UTF-32,
+        /// and for conversions to UTF-16 of text without supplementary code points.
+        ///
+        /// @par Example
+        ///
+        /// @code{.cpp}
+        ///
+        /// using namespace upp::string_literals;
+        ///
+        /// const auto utf8  = u8"Gr\u00FC\u00DFe"_us;
+        /// const auto utf16 = utf8.transcode<upp::encoding::utf16>(); // upp::utf16_string
+        ///
+        /// @endcode
+        ///
+        /// @tparam TargetEncoding The encoding of the result.
+        /// @tparam TargetContainer The underlying container of the result.
+        ///         Default value is `std::basic_string<typename encoding_traits<TargetEncoding>::default_code_unit_type>`.
+        ///
+        template<encoding TargetEncoding,
+                 string_compatible_container<TargetEncoding> TargetContainer =
+                     std::basic_string<typename encoding_traits<TargetEncoding>::default_code_unit_type>>
+            requires unicode_encoding<TargetEncoding>
+        [[nodiscard]] constexpr basic_ustring<TargetEncoding, TargetContainer> transcode() const&;
+
+        /// @brief Same as `transcode<TargetEncoding, TargetContainer>() const&`, but reuses the storage of the string where possible.
+        ///
+        /// - If the encoding and the container stay the same, the string is moved into the result.
+        /// - If `TargetContainer` satisfies `storage_adopting_container<TargetContainer, Container>`, the string is transcoded
+        ///   front to back inside its own storage, which is then handed over to the result, without allocating. That's done
+        ///   when the encoded code units can never overtake the ones that aren't read yet: always from UTF-32, and otherwise
+        ///   after checking that no prefix of the string grows (e.g. UTF-16 text that is mostly ASCII, converted to UTF-8).
+        /// - Otherwise, the result is allocated like with the `const&` overload.
+        ///
+        /// The in-place transcoding isn't done in constant evaluation. After the call, the string is in a valid but unspecified state.
+        ///
+        /// @par Example
+        ///
+        /// @code{.cpp}
+        ///
+        /// upp::basic_utf32_string<byte_buffer<char32_t>> text = load_export();
+        ///
+        /// // With `byte_buffer<char8_t>::adopt_storage(byte_buffer<char32_t>&&, std::size_t)`, no second buffer is allocated.
+        /// auto utf8 = std::move(text).transcode<upp::encoding::utf8, byte_buffer<char8_t>>();
+        ///
+        /// @endcode
+        ///
+        template<encoding TargetEncoding,
+                 string_compatible_container<TargetEncoding> TargetContainer =
+                     std::basic_string<typename encoding_traits<TargetEncoding>::default_code_unit_type>>
+            requires unicode_encoding<TargetEncoding>
+        [[nodiscard]] constexpr basic_ustring<TargetEncoding, TargetContainer> transcode() &&;
+
+        /// @brief Same as `transcode<TargetEncoding, TargetContainer>()`, but the container of the result is constructed with the allocator `alloc`.
+        ///
+        /// @note This function participates in overload resolution only if the container type of the result
+        /// is allocator-aware and `std::uses_allocator_v<TargetContainer, Allocator>` is `true`.
+        ///
+        template<encoding TargetEncoding, string_compatible_container<TargetEncoding> TargetContainer, typename Allocator>
+            requires unicode_encoding<TargetEncoding> && std::uses_allocator_v<TargetContainer, Allocator>
+        [[nodiscard]] constexpr basic_ustring<TargetEncoding, TargetContainer> transcode(const Allocator& alloc) const&;
+
+        /// @brief Checks whether the string is in the normalization form `Form`.
+        ///
+        /// Segments of the string that pass the Unicode quick check are accepted without normalizing them.
+        /// Only the segments for which the quick check is inconclusive (or negative) are normalized and compared.
+        ///
+        /// @see normalize
+        ///
+        template<normalization_form Form>
+        [[nodiscard]] constexpr bool is_normalized() const;
+
+        /// @brief Returns the string converted to the normalization form `Form`.
+        ///
+        /// The string is first scanned using the Unicode quick check properties, which skips ASCII a word at a time in UTF-8.
+        /// If the whole string passes, it is returned unchanged. Otherwise only the segments that fail the quick check
+        /// are decomposed, reordered and (for NFC and NFKC) recomposed, while the rest is copied as it is.
+        ///
+        /// @par Example
+        ///
+        /// @code{.cpp}
+        ///
+        /// using namespace upp::string_literals;
+        ///
+        /// // "e" followed by U+0301 COMBINING ACUTE ACCENT
+        /// const auto decomposed = u8"e\u0301"_us;
+        ///
+        /// // U+00E9 LATIN SMALL LETTER E WITH ACUTE
+        /// const auto composed = decomposed.normalize<upp::normalization_form::nfc>();
+        ///
+        /// @endcode
+        ///
+        /// @see is_normalized, views::normalize
+        ///
+        template<normalization_form Form>
+        [[nodiscard]] constexpr basic_ustring normalize() const&;
+
+        /// @brief Returns the string converted to the normalization form `Form`.
+        ///
+        /// Same as `normalize() const&`, except that a string which is already normalized is moved into the result instead of being copied.
+        ///
+        template<normalization_form Form>
+        [[nodiscard]] constexpr basic_ustring normalize() &&;
+
     private:
         /// @brief Constructs the string directly from the underlying container type.
         ///
@@ -664,6 +1277,15 @@ namespace upp
             }
         }
 
+        /// @brief Reserve space for transcoding the string `source` to `Encoding`.
+        ///
+        /// Reserves the exact size of the converted string if the metadata cached by the container of `source` determines it.
+        /// Otherwise reserves the same as `reserve_for_transcoding_from<SourceEncoding>(source_size)`.
+        ///
+        template<encoding SourceEncoding, typename SourceContainer>
+        constexpr void reserve_for_transcoding_from(const basic_ustring<SourceEncoding, SourceContainer>& source)
+            requires reservable_container<Container>;
+
         /// @brief Appends a single code unit to the end of the string.
         ///
         template<typename T>
@@ -733,12 +1355,68 @@ namespace upp
             }
         }
 
+        /// @brief Encodes the `code_point` and appends it to the end of the string, if the whole encoded code point fits into the container.
+        ///
+        /// @return `false` if there is not enough room left, in which case the string is unchanged.
+        ///
+        [[nodiscard]] constexpr bool try_push_back(const uchar code_point)
+            requires fixed_capacity_container<Container>
+        {
+            std::size_t length = 1;
+
+            if constexpr (Encoding == encoding::utf8)
+                length = code_point.length_utf8();
+            else if constexpr (Encoding == encoding::utf16)
+                length = code_point.length_utf16();
+
+            if (m_container.capacity() - m_container.size() < length)
+                return false;
+
+            push_back(code_point);
+            return true;
+        }
+
     private:
         Container m_container;
 
         friend impl::basic_ustring_impl;
     };
 
+    /// @brief Concatenates `pieces` into a new string in the encoding `Encoding`, with a single allocation.
+    ///
+    /// Every piece is anything that `basic_ustring::append` accepts: a `uchar`, a `basic_ustring` in any encoding,
+    /// a `basic_ascii_string`, or a forward range marked as valid. The exact sizes of all pieces in `Encoding` are summed first
+    /// (in O(1) for strings whose container caches their metadata, and a word at a time in UTF-8 otherwise), the result
+    /// is reserved once, and then every piece is transcoded straight into it.
+    ///
+    /// @par Example
+    ///
+    /// @code{.cpp}
+    ///
+    /// using namespace std::string_view_literals;
+    /// using namespace upp::string_literals;
+    ///
+    /// const auto user = upp::utf16_string::from_utf16_unchecked(u"Zo\u00EB"sv);
+    ///
+    /// // u8"login: Zo\u00EB (ok)"
+    /// const auto line = upp::concat<upp::encoding::utf8>(u8"login: "_as, user, u8" (ok)"_as);
+    ///
+    /// @endcode
+    ///
+    /// @tparam Encoding The encoding of the result.
+    /// @tparam Container The underlying container of the result.
+    ///         Default value is `std::basic_string<typename encoding_traits<Encoding>::default_code_unit_type>`.
+    ///
+    /// @see basic_ustring::append
+    ///
+    /// @headerfile "" <uni-cpp/string.hpp>
+    ///
+    template<encoding Encoding,
+             string_compatible_container<Encoding> Container = std::basic_string<typename encoding_traits<Encoding>::default_code_unit_type>,
+             impl::string_piece... Pieces>
+        requires unicode_encoding<Encoding>
+    [[nodiscard]] constexpr basic_ustring<Encoding, Container> concat(const Pieces&... pieces);
+
     namespace impl
     {
         template<encoding Encoding, typename StringType, typename FromUnchecked, auto StringLiteral>
@@ -11,8 +11,26 @@
 
 #include "../ranges/base.hpp"
 #include "../ranges/approximately_sized_range.hpp"
-
+#include "../ranges/trim.hpp"
+#include "../decode_valid.hpp"
+#include "../search.hpp"
+#include "../swar.hpp"
+#include "../text_metadata.hpp"
+
+#include "../../normalization.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
 #include <type_traits>
 
 namespace upp
@@ -22,22 +40,101 @@ namespace upp
         class basic_ustring_impl
         {
         public:
-            template<encoding SourceEncoding, typename ErrorType, encoding TargetEncoding, typename Container, std::ranges::input_range Range>
+            template<encoding Encoding>
+                requires unicode_encoding<Encoding>
+            [[nodiscard]] static constexpr std::size_t code_point_length(const uchar code_point) noexcept
+            {
+                if constexpr (Encoding == encoding::utf8)
+                    return code_point.length_utf8();
+                else if constexpr (Encoding == encoding::utf16)
+                    return code_point.length_utf16();
+                else
+                    return 1uz;
+            }
+
+            template<typename ErrorType>
+            [[nodiscard]] static constexpr ErrorType capacity_exceeded_error(const std::size_t valid_up_to) noexcept
+            {
+                if constexpr (std::same_as<ErrorType, from_utf8_error>)
+                    return {.valid_up_to = valid_up_to, .error = utf8_error{.length = {std::nullopt}, .code = utf8_error_code::capacity_exceeded}};
+                else if constexpr (std::same_as<ErrorType, from_utf16_error>)
+                    return {.valid_up_to = valid_up_to, .error = utf16_error{.length = {std::nullopt}, .code = utf16_error_code::capacity_exceeded}};
+                else
+                    return {.valid_up_to = valid_up_to, .error = utf32_error{.code = utf32_error_code::capacity_exceeded}};
+            }
+
+            /// @brief Returns `container` as is, or constructed with the allocator `alloc` if one is given.
+            ///
+            template<typename Container, typename Range, typename... Allocator>
+                requires std::same_as<Container, std::remove_cvref_t<Range>> && (sizeof...(Allocator) <= 1)
+            [[nodiscard]] static constexpr Container container_with_allocator(Range&& container, const Allocator&... alloc)
+            {
+                if constexpr (sizeof...(Allocator) == 0)
+                    return std::forward<Range>(container);
+                else
+                    return std::make_obj_using_allocator<Container>(alloc..., std::forward<Range>(container));
+            }
+
+            // The `alloc` parameter packs below are either empty or a single allocator for the result's container.
+
+            template<encoding SourceEncoding,
+                     typename ErrorType,
+                     encoding TargetEncoding,
+                     typename Container,
+                     std::ranges::input_range Range,
+                     typename... Allocator>
                 requires unicode_encoding<SourceEncoding> && unicode_encoding<TargetEncoding> && ranges::code_unit_range_for<Range, SourceEncoding>
-            [[nodiscard]] static constexpr std::expected<basic_ustring<TargetEncoding, Container>, ErrorType> from_utf(Range&& range)
+            [[nodiscard]] static constexpr std::expected<basic_ustring<TargetEncoding, Container>, ErrorType> from_utf(Range&& range,
+                                                                                                                        const Allocator&... alloc)
             {
                 using string_type            = basic_ustring<TargetEncoding, Container>;
                 using expected_type          = std::expected<string_type, ErrorType>;
                 using traits_type            = encoding_traits<SourceEncoding>;
                 using default_code_unit_type = traits_type::default_code_unit_type;
 
-                if constexpr (TargetEncoding != SourceEncoding)
+                if constexpr (fixed_capacity_container<Container> && !std::same_as<Container, std::remove_cvref_t<Range>>)
+                {
+                    // Decode even if the encodings are the same, so that the input can be cut at a code point boundary once the container is full.
+
+                    string_type result(alloc...);
+
+                    std::size_t fitting_size       = 0;
+                    bool        capacity_exceeded = false;
+
+                    auto expected = traits_type::decode_range(std::forward<Range>(range), [&](uchar code_point) {
+                        if (capacity_exceeded)
+                            return;
+
+                        if (!result.try_push_back(code_point))
+                        {
+                            capacity_exceeded = true;
+                            return;
+                        }
+
+                        fitting_size += code_point_length<SourceEncoding>(code_point);
+                    });
+
+                    // Report whichever error comes first in the input. Decoding stops at an encoding error,
+                    // so if the capacity was exceeded, it was exceeded before that error.
+                    if (capacity_exceeded)
+                    {
+                        return expected_type{std::unexpect, capacity_exceeded_error<ErrorType>(fitting_size)};
+                    }
+
+                    if (!expected.has_value())
+                    {
+                        return expected_type{std::unexpect, std::move(expected).error()};
+                    }
+
+                    return expected_type{std::in_place, std::move(result)};
+                }
+                else if constexpr (TargetEncoding != SourceEncoding)
                 {
                     // Transcode.
 
-                    string_type result;
+                    string_type result(alloc...);
 
-                    if constexpr (ranges::approximately_sized_range<Range> && reservable_container<Container>)
+                    if constexpr (ranges::approximately_sized_range<Range> && impl::reserves_for_size_hint<Container>)
                     {
                         result.template reserve_for_transcoding_from<SourceEncoding>(ranges::reserve_hint(range));
                     }
@@ -67,15 +164,44 @@ namespace upp
                         return expected_type{std::unexpect, std::move(expected).error()};
                     }
 
-                    return expected_type{std::in_place, string_type{impl::from_container, std::forward<Range>(range)}};
+                    Container container = container_with_allocator<Container>(std::forward<Range>(range), alloc...);
+
+                    return expected_type{std::in_place, string_type{impl::from_container, std::move(container)}};
+                }
+                else if constexpr (counted_metadata_container<Container>)
+                {
+                    // Validate into the underlying container, counting the metadata of the code units on the way,
+                    // and install both at once, so that the text isn't scanned again.
+
+                    using underlying_string_type = basic_ustring<TargetEncoding, typename Container::container_type>;
+
+                    underlying_string_type code_units(alloc...);
+                    text_metadata::counts  counts;
+
+                    if constexpr (ranges::approximately_sized_range<Range> && impl::reserves_for_size_hint<typename Container::container_type>)
+                    {
+                        code_units.template reserve_for_transcoding_from<SourceEncoding>(ranges::reserve_hint(range));
+                    }
+
+                    auto expected = traits_type::validate_range(std::forward<Range>(range), [&](default_code_unit_type code_unit) {
+                        code_units.push_back_code_unit(code_unit);
+                        counts.add(code_unit);
+                    });
+
+                    if (!expected.has_value())
+                    {
+                        return expected_type{std::unexpect, std::move(expected).error()};
+                    }
+
+                    return expected_type{std::in_place, string_type{impl::from_container, Container(std::move(code_units.m_container), counts)}};
                 }
                 else
                 {
                     // Validate.
 
-                    string_type result;
+                    string_type result(alloc...);
 
-                    if constexpr (ranges::approximately_sized_range<Range> && reservable_container<Container>)
+                    if constexpr (ranges::approximately_sized_range<Range> && impl::reserves_for_size_hint<Container>)
                     {
                         result.template reserve_for_transcoding_from<SourceEncoding>(ranges::reserve_hint(range));
                     }
@@ -92,16 +218,16 @@ namespace upp
                 }
             }
 
-            template<encoding SourceEncoding, encoding TargetEncoding, typename Container, std::ranges::input_range Range>
+            template<encoding SourceEncoding, encoding TargetEncoding, typename Container, std::ranges::input_range Range, typename... Allocator>
                 requires unicode_encoding<SourceEncoding> && unicode_encoding<TargetEncoding> && ranges::code_unit_range_for<Range, SourceEncoding>
-            [[nodiscard]] static constexpr basic_ustring<TargetEncoding, Container> from_utf_lossy(Range&& range)
+            [[nodiscard]] static constexpr basic_ustring<TargetEncoding, Container> from_utf_lossy(Range&& range, const Allocator&... alloc)
             {
                 using string_type = basic_ustring<TargetEncoding, Container>;
                 using traits_type = encoding_traits<SourceEncoding>;
 
-                string_type result;
+                string_type result(alloc...);
 
-                if constexpr (ranges::approximately_sized_range<Range> && reservable_container<Container>)
+                if constexpr (ranges::approximately_sized_range<Range> && impl::reserves_for_size_hint<Container>)
                 {
                     result.template reserve_for_transcoding_from<SourceEncoding>(ranges::reserve_hint(range));
                 }
@@ -116,22 +242,22 @@ namespace upp
                 return result;
             }
 
-            template<encoding SourceEncoding, encoding TargetEncoding, typename Container, std::ranges::input_range Range>
+            template<encoding SourceEncoding, encoding TargetEncoding, typename Container, std::ranges::input_range Range, typename... Allocator>
                 requires unicode_encoding<SourceEncoding> && unicode_encoding<TargetEncoding> && ranges::code_unit_range_for<Range, SourceEncoding>
-            [[nodiscard]] static constexpr basic_ustring<TargetEncoding, Container> from_utf_unchecked(Range&& range)
+            [[nodiscard]] static constexpr basic_ustring<TargetEncoding, Container> from_utf_unchecked(Range&& range, const Allocator&... alloc)
             {
                 using string_type = basic_ustring<TargetEncoding, Container>;
                 using traits_type = encoding_traits<SourceEncoding>;
 
                 if constexpr (TargetEncoding == SourceEncoding)
                 {
-                    return utfx_from_utfx_unchecked<TargetEncoding, Container>(std::forward<Range>(range));
+                    return utfx_from_utfx_unchecked<TargetEncoding, Container>(std::forward<Range>(range), alloc...);
                 }
                 else
                 {
-                    string_type result;
+                    string_type result(alloc...);
 
-                    if constexpr (ranges::approximately_sized_range<Range> && reservable_container<Container>)
+                    if constexpr (ranges::approximately_sized_range<Range> && impl::reserves_for_size_hint<Container>)
                     {
                         result.template reserve_for_transcoding_from<SourceEncoding>(ranges::reserve_hint(range));
                     }
@@ -147,17 +273,17 @@ namespace upp
                 }
             }
 
-            template<encoding Encoding, typename Container, typename Range>
+            template<encoding Encoding, typename Container, typename Range, typename... Allocator>
                 requires unicode_encoding<Encoding> && ranges::code_unit_range_for<Range, Encoding> &&
                          (!std::same_as<Container, std::remove_cvref_t<Range>>) // there is another overload for this case below
-            [[nodiscard]] static constexpr basic_ustring<Encoding, Container> utfx_from_utfx_unchecked(Range&& range)
+            [[nodiscard]] static constexpr basic_ustring<Encoding, Container> utfx_from_utfx_unchecked(Range&& range, const Allocator&... alloc)
             {
                 using result_type = basic_ustring<Encoding, Container>;
                 using size_type   = result_type::size_type;
 
-                result_type result;
+                result_type result(alloc...);
 
-                if constexpr (ranges::approximately_sized_range<Range> && reservable_container<Container>)
+                if constexpr (ranges::approximately_sized_range<Range> && impl::reserves_for_size_hint<Container>)
                 {
                     result.reserve(static_cast<size_type>(ranges::reserve_hint(range)));
                 }
@@ -172,182 +298,1308 @@ namespace upp
             }
 
             // If Range is the underlying container type, we just construct the string from the container.
-            template<encoding Encoding, typename Container, typename Range>
+            template<encoding Encoding, typename Container, typename Range, typename... Allocator>
                 requires unicode_encoding<Encoding> && std::same_as<Container, std::remove_cvref_t<Range>>
-            [[nodiscard]] static constexpr basic_ustring<Encoding, Container> utfx_from_utfx_unchecked(Range&& container)
+            [[nodiscard]] static constexpr basic_ustring<Encoding, Container> utfx_from_utfx_unchecked(Range&& container, const Allocator&... alloc)
             {
-                return {from_container, std::forward<Range>(container)};
+                return {from_container, container_with_allocator<Container>(std::forward<Range>(container), alloc...)};
             }
-        };
-    } // namespace impl
 
-    // Doxygen doesn't handle well static method definitions outside of class definitions
-    /// @cond
+            /// @brief Normalizes `string`, whose code units before `first_unnormalized` are known to pass the quick check.
+            ///
+            template<normalization_form Form, encoding Encoding, typename Container>
+                requires unicode_encoding<Encoding>
+            [[nodiscard]] static constexpr basic_ustring<Encoding, Container> normalize(const basic_ustring<Encoding, Container>& string,
+                                                                                        std::size_t                                first_unnormalized)
+            {
+                using result_type    = basic_ustring<Encoding, Container>;
+                using size_type      = result_type::size_type;
+                using code_unit_type = result_type::code_unit_type;
 
-    template<string_compatible_container<encoding::ascii> Container>
-    template<std::ranges::input_range Range>
-        requires ranges::code_unit_range_for<Range, encoding::ascii>
-    [[nodiscard]] constexpr std::expected<basic_ascii_string<Container>, from_ascii_error> basic_ascii_string<Container>::from_ascii(Range&& range)
-    {
-        using expected_type = std::expected<basic_ascii_string<Container>, from_ascii_error>;
+                const auto code_units = string.code_units();
 
-        if constexpr (std::same_as<Container, std::remove_cvref_t<Range>>)
-        {
-            // Use the underlying container's copy/move constructor.
+                result_type result;
 
-            auto expected = traits_type::validate_range(range);
+                if constexpr (reserves_for_size_hint<Container>)
+                {
+                    // Normalization rarely changes the length of the text much.
+                    result.reserve(static_cast<size_type>(code_units.size()));
+                }
 
-            if (!expected.has_value())
-            {
-                return expected_type{std::unexpect, std::move(expected).error()};
-            }
+                normalization::normalize<Form, Encoding>(
+                    code_units.data(), code_units.size(), first_unnormalized,
+                    [&](std::span<const code_unit_type> unchanged) { result.append_code_units_range(unchanged); },
+                    [&](std::uint32_t code_point) { result.push_back(uchar::from_unchecked(code_point)); });
 
-            return expected_type{std::in_place, basic_ascii_string{impl::from_container, std::forward<Range>(range)}};
-        }
-        else
-        {
-            basic_ascii_string result;
+                return result;
+            }
 
-            if constexpr (ranges::approximately_sized_range<Range> && reservable_container<Container>)
+            template<to_case_enum Case, typename T>
+            [[nodiscard]] static constexpr T ascii_to_case(const T code_unit) noexcept
             {
-                result.reserve(static_cast<size_type>(ranges::reserve_hint(range)));
+                const auto value = static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<T>>(code_unit));
+
+                if constexpr (Case == to_case_enum::lower)
+                    return (value >= 0x41U && value <= 0x5AU) ? static_cast<T>(value + 0x20U) : code_unit;
+                else
+                    return (value >= 0x61U && value <= 0x7AU) ? static_cast<T>(value - 0x20U) : code_unit;
             }
 
-            auto expected = traits_type::validate_range(std::forward<Range>(range), [&](char ch) { result.push_back_code_unit(ch); });
+            /// @brief What `to_case` needs to know about a string before mapping it, found with at most two scans of the string.
+            ///
+            struct case_mapping_check
+            {
+                bool is_ascii;  ///< All characters are ASCII.
+                bool unchanged; ///< All characters are ASCII, and none of them is a letter that the mapping changes.
+            };
+
+            /// @brief Checks whether `string` is ASCII, and if so, whether it has any letters that the `Case` mapping changes.
+            ///
+            template<to_case_enum Case, encoding Encoding, typename Container>
+                requires unicode_encoding<Encoding>
+            [[nodiscard]] static constexpr case_mapping_check check_case_mapping(const basic_ustring<Encoding, Container>& string) noexcept
+            {
+                if (!string.is_ascii())
+                    return case_mapping_check{.is_ascii = false, .unchanged = false};
 
-            if (!expected.has_value())
+                const auto code_units = string.code_units();
+
+                // The letters that the mapping changes: 'A'..'Z' for lowercase, 'a'..'z' for uppercase.
+                constexpr std::uint8_t first_letter = Case == to_case_enum::lower ? 0x41U : 0x61U;
+                constexpr std::uint8_t last_letter  = Case == to_case_enum::lower ? 0x5AU : 0x7AU;
+
+                const bool has_mapped_letters = text_metadata::ascii_contains_range(code_units.data(), code_units.size(), first_letter, last_letter);
+
+                return case_mapping_check{.is_ascii = true, .unchanged = !has_mapped_letters};
+            }
+
+            template<to_case_enum Case, encoding Encoding, typename Container>
+                requires unicode_encoding<Encoding>
+            [[nodiscard]] static constexpr basic_ustring<Encoding, Container> to_case(const basic_ustring<Encoding, Container>& string)
             {
-                return expected_type{std::unexpect, std::move(expected).error()};
+                return to_case<Case>(string, check_case_mapping<Case>(string));
             }
 
-            return expected_type{std::in_place, std::move(result)};
-        }
-    }
+            /// @brief Same as `to_case(string)`, with `check` being the result of `check_case_mapping<Case>(string)`.
+            ///
+            template<to_case_enum Case, encoding Encoding, typename Container>
+                requires unicode_encoding<Encoding>
+            [[nodiscard]] static constexpr basic_ustring<Encoding, Container> to_case(const basic_ustring<Encoding, Container>& string,
+                                                                                     const case_mapping_check                  check)
+            {
+                using result_type    = basic_ustring<Encoding, Container>;
+                using size_type      = result_type::size_type;
+                using code_unit_type = result_type::code_unit_type;
 
-    template<string_compatible_container<encoding::ascii> Container>
-    template<std::ranges::input_range Range>
-        requires ranges::code_unit_range_for<Range, encoding::ascii>
-    [[nodiscard]] constexpr basic_ascii_string<Container> basic_ascii_string<Container>::from_ascii_lossy(Range&& range)
-    {
-        basic_ascii_string result;
+                const auto code_units = string.code_units();
 
-        if constexpr (ranges::approximately_sized_range<Range> && reservable_container<Container>)
-        {
-            result.reserve(static_cast<size_type>(ranges::reserve_hint(range)));
-        }
+                if (check.unchanged)
+                    return string;
 
-        traits_type::decode_range_lossy(std::forward<Range>(range), [&](ascii_char ch) { result.push_back(ch); });
+                result_type result;
 
-        return result;
-    }
+                if constexpr (reserves_for_size_hint<Container>)
+                {
+                    // Most characters map to a character with an encoded sequence of the same length.
+                    result.reserve(static_cast<size_type>(code_units.size()));
+                }
 
-    template<string_compatible_container<encoding::ascii> Container>
-    template<std::ranges::input_range Range>
-        requires ranges::code_unit_range_for<Range, encoding::ascii>
-    [[nodiscard]] constexpr basic_ascii_string<Container> basic_ascii_string<Container>::from_ascii_unchecked(Range&& range)
-    {
-        if constexpr (std::same_as<Container, std::remove_cvref_t<Range>>)
-        {
-            return {impl::from_container, std::forward<Range>(range)};
-        }
-        else
-        {
-            basic_ascii_string result;
+                if (check.is_ascii)
+                {
+                    // The case mappings of ASCII characters are ASCII characters.
+                    result.append_code_units_range(
+                        code_units | std::views::transform([](const code_unit_type code_unit) static { return ascii_to_case<Case>(code_unit); }));
+
+                    return result;
+                }
+
+                for (auto it = code_units.begin(); it != code_units.end();)
+                {
+                    const std::uint32_t code_point = decode_valid_code_point_and_advance<Encoding>(it);
+
+                    if (code_point < 0x80U)
+                    {
+                        result.push_back_code_unit(ascii_to_case<Case>(static_cast<code_unit_type>(code_point)));
+                        continue;
+                    }
+
+                    const uchar ch = uchar::from_unchecked(code_point);
+
+                    if constexpr (Case == to_case_enum::lower)
+                    {
+                        for (const uchar mapped : ch.to_lowercase())
+                            result.push_back(mapped);
+                    }
+                    else
+                    {
+                        for (const uchar mapped : ch.to_uppercase())
+                            result.push_back(mapped);
+                    }
+                }
+
+                return result;
+            }
 
-            if constexpr (ranges::approximately_sized_range<Range> && reservable_container<Container>)
+            /// @brief Returns the number of `TargetEncoding` code units that `source` converts to,
+            /// if the metadata cached by the container of `source` determines it.
+            ///
+            template<encoding TargetEncoding, encoding SourceEncoding, typename SourceContainer>
+                requires unicode_encoding<TargetEncoding> && unicode_encoding<SourceEncoding>
+            [[nodiscard]] static constexpr std::optional<std::size_t>
+                exact_transcoded_size(const basic_ustring<SourceEncoding, SourceContainer>& source) noexcept
             {
-                result.reserve(static_cast<size_type>(ranges::reserve_hint(range)));
+                const std::size_t size = source.code_units().size();
+
+                if constexpr (TargetEncoding == SourceEncoding)
+                {
+                    return size;
+                }
+                else if constexpr (text_metadata_container<SourceContainer>)
+                {
+                    // Every ASCII character is encoded as a single code unit in all encodings.
+                    if (source.is_ascii())
+                        return size;
+
+                    if constexpr (TargetEncoding == encoding::utf32)
+                    {
+                        return static_cast<std::size_t>(source.code_point_count());
+                    }
+                    else if constexpr (TargetEncoding == encoding::utf16 && supplementary_metadata_container<SourceContainer>)
+                    {
+                        // Only supplementary code points are encoded with a surrogate pair.
+                        if (!source.m_container.has_supplementary_code_points())
+                            return static_cast<std::size_t>(source.code_point_count());
+                    }
+
+                    return std::nullopt;
+                }
+                else
+                {
+                    return std::nullopt;
+                }
             }
 
-            auto       it       = std::ranges::begin(range);
-            const auto sentinel = std::ranges::end(range);
+            template<encoding TargetEncoding, typename TargetContainer, encoding SourceEncoding, typename SourceContainer, typename... Allocator>
+                requires unicode_encoding<TargetEncoding> && unicode_encoding<SourceEncoding>
+            [[nodiscard]] static constexpr basic_ustring<TargetEncoding, TargetContainer>
+                transcode(const basic_ustring<SourceEncoding, SourceContainer>& source, const Allocator&... alloc)
+            {
+                using result_type           = basic_ustring<TargetEncoding, TargetContainer>;
+                using target_code_unit_type = result_type::code_unit_type;
 
-            for (; it != sentinel; ++it)
-                result.push_back_code_unit(*it);
+                const auto code_units = source.code_units();
 
-            return result;
-        }
-    }
+                result_type result(alloc...);
 
-    template<encoding E, string_compatible_container<E> C>
-        requires unicode_encoding<E>
-    template<std::ranges::input_range Range>
-        requires ranges::code_unit_range_for<Range, encoding::utf8>
-    [[nodiscard]] constexpr std::expected<basic_ustring<E, C>, from_utf8_error> basic_ustring<E, C>::from_utf8(Range&& range)
-    {
-        return impl::basic_ustring_impl::from_utf<encoding::utf8, from_utf8_error, E, C>(std::forward<Range>(range));
-    }
+                if constexpr (reserves_for_size_hint<TargetContainer>)
+                {
+                    result.reserve_for_transcoding_from(source);
+                }
 
-    template<encoding E, string_compatible_container<E> C>
-        requires unicode_encoding<E>
-    template<std::ranges::input_range Range>
-        requires ranges::code_unit_range_for<Range, encoding::utf8>
-    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf8_lossy(Range&& range)
-    {
-        return impl::basic_ustring_impl::from_utf_lossy<encoding::utf8, E, C>(std::forward<Range>(range));
-    }
+                if (TargetEncoding == SourceEncoding || source.is_ascii())
+                {
+                    // Either the code units stay the same, or all of them are ASCII, which every encoding represents with the same value.
+                    result.append_code_units_range(code_units | std::views::transform([](const auto code_unit) static {
+                                                       return static_cast<target_code_unit_type>(code_unit);
+                                                   }));
 
-    template<encoding E, string_compatible_container<E> C>
-        requires unicode_encoding<E>
-    template<std::ranges::input_range Range>
-        requires ranges::code_unit_range_for<Range, encoding::utf8>
-    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf8_unchecked(Range&& range)
-    {
-        return impl::basic_ustring_impl::from_utf_unchecked<encoding::utf8, E, C>(std::forward<Range>(range));
-    }
+                    return result;
+                }
 
-    template<encoding E, string_compatible_container<E> C>
-        requires unicode_encoding<E>
-    template<std::ranges::input_range Range>
-        requires ranges::code_unit_range_for<Range, encoding::utf16>
-    [[nodiscard]] constexpr std::expected<basic_ustring<E, C>, from_utf16_error> basic_ustring<E, C>::from_utf16(Range&& range)
-    {
-        return impl::basic_ustring_impl::from_utf<encoding::utf16, from_utf16_error, E, C>(std::forward<Range>(range));
-    }
+                for (auto it = code_units.begin(); it != code_units.end();)
+                    result.push_back(uchar::from_unchecked(decode_valid_code_point_and_advance<SourceEncoding>(it)));
 
-    template<encoding E, string_compatible_container<E> C>
-        requires unicode_encoding<E>
-    template<std::ranges::input_range Range>
-        requires ranges::code_unit_range_for<Range, encoding::utf16>
-    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf16_lossy(Range&& range)
-    {
-        return impl::basic_ustring_impl::from_utf_lossy<encoding::utf16, E, C>(std::forward<Range>(range));
-    }
+                return result;
+            }
 
-    template<encoding E, string_compatible_container<E> C>
-        requires unicode_encoding<E>
-    template<std::ranges::input_range Range>
-        requires ranges::code_unit_range_for<Range, encoding::utf16>
-    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf16_unchecked(Range&& range)
-    {
-        return impl::basic_ustring_impl::from_utf_unchecked<encoding::utf16, E, C>(std::forward<Range>(range));
-    }
+            /// Returns the code units of a string piece other than a `uchar`, as a range.
+            template<typename Piece>
+            [[nodiscard]] static constexpr auto piece_code_units(const Piece& piece) noexcept
+            {
+                if constexpr (requires { piece.code_units(); })
+                    return piece.code_units();
+                else
+                    return std::ranges::ref_view{piece};
+            }
 
-    template<encoding E, string_compatible_container<E> C>
-        requires unicode_encoding<E>
-    template<std::ranges::input_range Range>
-        requires ranges::code_unit_range_for<Range, encoding::utf32>
-    [[nodiscard]] constexpr std::expected<basic_ustring<E, C>, from_utf32_error> basic_ustring<E, C>::from_utf32(Range&& range)
-    {
-        return impl::basic_ustring_impl::from_utf<encoding::utf32, from_utf32_error, E, C>(std::forward<Range>(range));
-    }
+            /// Returns the number of `TargetEncoding` code units that the valid `SourceEncoding` code units `[data, data + size)` convert to.
+            template<encoding TargetEncoding, encoding SourceEncoding, typename T>
+            [[nodiscard]] static constexpr std::size_t transcoded_size(const T* const data, const std::size_t size) noexcept
+            {
+                if constexpr (SourceEncoding == TargetEncoding || SourceEncoding == encoding::ascii)
+                {
+                    return size;
+                }
+                else if constexpr (TargetEncoding == encoding::utf32)
+                {
+                    return text_metadata::count_code_points(data, size);
+                }
+                else if constexpr (TargetEncoding == encoding::utf16)
+                {
+                    return text_metadata::count_code_points(data, size) + text_metadata::count_supplementary(data, size);
+                }
+                else
+                {
+                    // Every code unit of a surrogate pair contributes 2 of the 4 bytes of its code point.
+                    std::size_t result = 0;
 
-    template<encoding E, string_compatible_container<E> C>
-        requires unicode_encoding<E>
-    template<std::ranges::input_range Range>
-        requires ranges::code_unit_range_for<Range, encoding::utf32>
-    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf32_lossy(Range&& range)
-    {
-        return impl::basic_ustring_impl::from_utf_lossy<encoding::utf32, E, C>(std::forward<Range>(range));
-    }
+                    for (std::size_t i = 0; i < size; ++i)
+                    {
+                        const std::uint32_t value = text_metadata::code_unit_value(data[i]);
+
+                        if (value < 0x80U)
+                            result += 1;
+                        else if (value < 0x800U || (SourceEncoding == encoding::utf16 && value >= 0xD800U && value < 0xE000U))
+                            result += 2;
+                        else if (value < 0x10000U)
+                            result += 3;
+                        else
+                            result += 4;
+                    }
 
-    template<encoding E, string_compatible_container<E> C>
-        requires unicode_encoding<E>
-    template<std::ranges::input_range Range>
-        requires ranges::code_unit_range_for<Range, encoding::utf32>
-    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf32_unchecked(Range&& range)
-    {
-        return impl::basic_ustring_impl::from_utf_unchecked<encoding::utf32, E, C>(std::forward<Range>(range));
+                    return result;
+                }
+            }
+
+            /// Returns the number of `TargetEncoding` code units that a string piece converts to.
+            template<encoding TargetEncoding, typename Piece>
+            [[nodiscard]] static constexpr std::size_t transcoded_size(const Piece& piece) noexcept
+            {
+                if constexpr (std::same_as<Piece, uchar>)
+                {
+                    return code_point_length<TargetEncoding>(piece);
+                }
+                else
+                {
+                    constexpr encoding piece_encoding = string_piece_encoding<Piece>::value;
+
+                    if constexpr (is_basic_ustring_of<Piece, piece_encoding>)
+                    {
+                        if (const auto exact_size = exact_transcoded_size<TargetEncoding>(piece))
+                            return *exact_size;
+                    }
+
+                    const auto code_units = piece_code_units(piece);
+
+                    if constexpr (std::ranges::contiguous_range<decltype(code_units)> && std::ranges::sized_range<decltype(code_units)>)
+                    {
+                        return transcoded_size<TargetEncoding, piece_encoding>(std::ranges::data(code_units),
+                                                                               static_cast<std::size_t>(std::ranges::size(code_units)));
+                    }
+                    else if constexpr (piece_encoding == TargetEncoding || piece_encoding == encoding::ascii)
+                    {
+                        return static_cast<std::size_t>(std::ranges::distance(code_units));
+                    }
+                    else
+                    {
+                        std::size_t result = 0;
+
+                        for (auto it = std::ranges::begin(code_units); it != std::ranges::end(code_units);)
+                        {
+                            const std::uint32_t code_point = decode_valid_code_point_and_advance<piece_encoding>(it);
+
+                            result += code_point_length<TargetEncoding>(uchar::from_unchecked(code_point));
+                        }
+
+                        return result;
+                    }
+                }
+            }
+
+            /// Makes room for `added` more code units at the end of `string`.
+            /// Containers that reserve grow at least geometrically, so that appending in a loop stays amortized O(1) per code unit.
+            template<encoding Encoding, typename Container>
+            static constexpr void reserve_for_append(basic_ustring<Encoding, Container>& string, const std::size_t added)
+            {
+                const std::size_t size = string.code_units().size();
+
+                if constexpr (fixed_capacity_container<Container>)
+                {
+                    if (static_cast<std::size_t>(Container::capacity()) - size < added)
+                        throw std::bad_alloc{};
+                }
+                else if constexpr (reserves_for_size_hint<Container>)
+                {
+                    using size_type = basic_ustring<Encoding, Container>::size_type;
+
+                    const std::size_t capacity = static_cast<std::size_t>(string.capacity());
+
+                    if (capacity - size < added)
+                        string.reserve(static_cast<size_type>(std::max(size + added, 2 * capacity)));
+                }
+            }
+
+            /// Transcodes a string piece into the end of `string`, which has room for it.
+            template<encoding Encoding, typename Container, typename Piece>
+            static constexpr void append_piece(basic_ustring<Encoding, Container>& string, const Piece& piece)
+            {
+                using code_unit_type = basic_ustring<Encoding, Container>::code_unit_type;
+
+                if constexpr (std::same_as<Piece, uchar>)
+                {
+                    string.push_back(piece);
+                }
+                else
+                {
+                    constexpr encoding piece_encoding = string_piece_encoding<Piece>::value;
+
+                    constexpr auto to_code_unit = [](const auto code_unit) static { return static_cast<code_unit_type>(code_unit); };
+
+                    const auto code_units = piece_code_units(piece);
+
+                    if constexpr (piece_encoding == Encoding || piece_encoding == encoding::ascii)
+                    {
+                        // The code units stay the same, or they're ASCII, which every encoding represents with the same value.
+                        string.append_code_units_range(code_units | std::views::transform(to_code_unit));
+                    }
+                    else if constexpr (piece_encoding == encoding::utf8 && std::ranges::contiguous_range<decltype(code_units)> &&
+                                       std::ranges::sized_range<decltype(code_units)>)
+                    {
+                        // Runs of ASCII are found a word at a time and appended as a whole.
+                        const auto* const data = std::ranges::data(code_units);
+                        const auto        size = static_cast<std::size_t>(std::ranges::size(code_units));
+
+                        for (std::size_t index = 0; index < size;)
+                        {
+                            const std::size_t ascii_length = swar::ascii_prefix_length(data + index, size - index);
+
+                            string.append_code_units_range(std::span{data + index, ascii_length} | std::views::transform(to_code_unit));
+
+                            index += ascii_length;
+
+                            if (index < size)
+                            {
+                                const auto [code_point, length] = decode_valid_code_point<encoding::utf8>(data + index);
+
+                                string.push_back(uchar::from_unchecked(code_point));
+                                index += length;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        for (auto it = std::ranges::begin(code_units); it != std::ranges::end(code_units);)
+                        {
+                            const std::uint32_t code_point = decode_valid_code_point_and_advance<piece_encoding>(it);
+
+                            if (code_point < 0x80U)
+                                string.push_back_code_unit(static_cast<code_unit_type>(code_point));
+                            else
+                                string.push_back(uchar::from_unchecked(code_point));
+                        }
+                    }
+                }
+            }
+
+            /// Returns the code units of a search needle, as an object with `data()` and `size()`.
+            template<encoding Encoding, typename Needle>
+            [[nodiscard]] static constexpr auto needle_code_units(const Needle& needle) noexcept
+            {
+                if constexpr (std::same_as<Needle, uchar>)
+                {
+                    if constexpr (Encoding == encoding::utf8)
+                        return needle.encode_utf8();
+                    else if constexpr (Encoding == encoding::utf16)
+                        return needle.encode_utf16();
+                    else
+                        return std::array<char32_t, 1>{static_cast<char32_t>(needle.value())};
+                }
+                else if constexpr (is_basic_ustring_of<Needle, Encoding>)
+                {
+                    return needle.code_units();
+                }
+                else
+                {
+                    return std::span{std::ranges::data(needle), std::ranges::size(needle)};
+                }
+            }
+
+            template<typename SizeType>
+            [[nodiscard]] static constexpr SizeType to_position(const std::size_t index) noexcept
+            {
+                return index == search::not_found ? std::numeric_limits<SizeType>::max() : static_cast<SizeType>(index);
+            }
+
+            template<encoding Encoding, typename SizeType, typename CodeUnit, typename Needle>
+            [[nodiscard]] static constexpr SizeType find(const std::span<const CodeUnit> haystack, const Needle& needle, const SizeType pos) noexcept
+            {
+                const auto        units = needle_code_units<Encoding>(needle);
+                const std::size_t index = search::find(haystack.data(), haystack.size(), units.data(), units.size(), static_cast<std::size_t>(pos));
+
+                return to_position<SizeType>(index);
+            }
+
+            template<encoding Encoding, typename SizeType, typename CodeUnit, typename Needle>
+            [[nodiscard]] static constexpr SizeType rfind(const std::span<const CodeUnit> haystack, const Needle& needle, const SizeType pos) noexcept
+            {
+                const auto        units = needle_code_units<Encoding>(needle);
+                const std::size_t from  = pos == std::numeric_limits<SizeType>::max() ? search::not_found : static_cast<std::size_t>(pos);
+
+                return to_position<SizeType>(search::rfind(haystack.data(), haystack.size(), units.data(), units.size(), from));
+            }
+
+            template<encoding Encoding, typename SizeType, typename CodeUnit, typename Needle>
+            [[nodiscard]] static constexpr SizeType count(const std::span<const CodeUnit> haystack, const Needle& needle,
+                                                          const SizeType code_point_count) noexcept
+            {
+                const auto units = needle_code_units<Encoding>(needle);
+
+                if (units.size() == 0)
+                    return code_point_count + 1;
+
+                return static_cast<SizeType>(search::count(haystack.data(), haystack.size(), units.data(), units.size()));
+            }
+
+            template<encoding Encoding, typename CodeUnit, typename Needle>
+            [[nodiscard]] static constexpr bool starts_with(const std::span<const CodeUnit> haystack, const Needle& needle) noexcept
+            {
+                const auto units = needle_code_units<Encoding>(needle);
+
+                return units.size() <= haystack.size() && search::equal_code_units(haystack.data(), units.data(), units.size());
+            }
+
+            template<encoding Encoding, typename CodeUnit, typename Needle>
+            [[nodiscard]] static constexpr bool ends_with(const std::span<const CodeUnit> haystack, const Needle& needle) noexcept
+            {
+                const auto units = needle_code_units<Encoding>(needle);
+
+                return units.size() <= haystack.size() &&
+                       search::equal_code_units(haystack.data() + (haystack.size() - units.size()), units.data(), units.size());
+            }
+
+            /// Returns the index of the first occurrence of `needle` for `replace_all`, where an empty needle doesn't occur.
+            template<encoding Encoding, typename CodeUnit, typename Needle>
+            [[nodiscard]] static constexpr std::size_t first_occurrence(const std::span<const CodeUnit> haystack, const Needle& needle) noexcept
+            {
+                const auto units = needle_code_units<Encoding>(needle);
+
+                if (units.size() == 0)
+                    return search::not_found;
+
+                return search::find(haystack.data(), haystack.size(), units.data(), units.size(), 0);
+            }
+
+            /// Builds the result of `replace_all` with a single allocation. `index` is the first occurrence of `from`.
+            template<encoding Encoding, typename Container, typename From, typename To>
+                requires unicode_encoding<Encoding>
+            [[nodiscard]] static constexpr basic_ustring<Encoding, Container>
+                replace_all(const basic_ustring<Encoding, Container>& string, const From& from, const To& to, std::size_t index)
+            {
+                const auto code_units = string.code_units();
+                const auto from_units = needle_code_units<Encoding>(from);
+                const auto to_units   = needle_code_units<Encoding>(to);
+
+                std::size_t size = code_units.size();
+
+                if (from_units.size() != to_units.size())
+                {
+                    const std::size_t occurrences =
+                        search::count(code_units.data() + index, code_units.size() - index, from_units.data(), from_units.size());
+
+                    size = size - occurrences * from_units.size() + occurrences * to_units.size();
+                }
+
+                basic_ustring<Encoding, Container> result;
+
+                reserve_for_append(result, size);
+
+                std::size_t copied = 0;
+
+                for (; index != search::not_found;
+                     index = search::find(code_units.data(), code_units.size(), from_units.data(), from_units.size(), copied))
+                {
+                    result.append_code_units_range(code_units.subspan(copied, index - copied));
+                    result.append_code_units_range(std::span{to_units.data(), to_units.size()});
+
+                    copied = index + from_units.size();
+                }
+
+                result.append_code_units_range(code_units.subspan(copied));
+
+                return result;
+            }
+
+            /// Checks whether `data` points to one of the code units of `string`.
+            template<encoding Encoding, typename Container, typename T>
+                requires unicode_encoding<Encoding>
+            [[nodiscard]] static constexpr bool is_stored_in_string(const basic_ustring<Encoding, Container>& string, const T* const data) noexcept
+            {
+                const auto code_units = string.code_units();
+                const auto address    = static_cast<const void*>(data);
+
+                if consteval
+                {
+                    // Pointers into different objects can only be compared for equality during constant evaluation.
+                    return std::ranges::any_of(code_units, [&](const auto& code_unit) { return static_cast<const void*>(&code_unit) == address; });
+                }
+                else
+                {
+                    return !std::less<const void*>{}(address, code_units.data()) &&
+                           std::less<const void*>{}(address, code_units.data() + code_units.size());
+                }
+            }
+
+            /// Overwrites the occurrences of `from` with `to` inside the storage of `string`. `index` is the first occurrence of `from`.
+            /// Returns `false`, with `string` unchanged, if `from` and `to` differ in length or if either of them is stored in `string`.
+            template<encoding Encoding, typename Container, typename From, typename To>
+                requires unicode_encoding<Encoding>
+            [[nodiscard]] static bool try_replace_all_in_place(basic_ustring<Encoding, Container>& string, const From& from, const To& to,
+                                                               std::size_t index)
+            {
+                using code_unit_type = basic_ustring<Encoding, Container>::code_unit_type;
+
+                const auto code_units = string.code_units();
+                const auto from_units = needle_code_units<Encoding>(from);
+                const auto to_units   = needle_code_units<Encoding>(to);
+
+                if (from_units.size() != to_units.size() || is_stored_in_string(string, from_units.data()) ||
+                    is_stored_in_string(string, to_units.data()))
+                    return false;
+
+                // Writing through `data()` makes containers like `with_text_metadata` discard their cached metadata.
+                code_unit_type* const data = string.m_container.data();
+
+                for (; index != search::not_found;
+                     index = search::find(data, code_units.size(), from_units.data(), from_units.size(), index + from_units.size()))
+                {
+                    std::ranges::transform(std::span{to_units.data(), to_units.size()}, data + index,
+                                           [](const auto code_unit) static { return std::bit_cast<code_unit_type>(code_unit); });
+                }
+
+                return true;
+            }
+
+            /// Transcodes `source` front to back inside its own storage and hands the storage over to a `TargetContainer`.
+            /// Returns `std::nullopt`, with `source` unchanged, if the written code units could overtake the ones that aren't read yet.
+            template<encoding TargetEncoding, typename TargetContainer, encoding SourceEncoding, typename SourceContainer>
+                requires unicode_encoding<TargetEncoding> && unicode_encoding<SourceEncoding> &&
+                         storage_adopting_container<TargetContainer, SourceContainer>
+            [[nodiscard]] static std::optional<basic_ustring<TargetEncoding, TargetContainer>>
+                try_transcode_in_place(basic_ustring<SourceEncoding, SourceContainer>& source)
+            {
+                using source_code_unit_type = basic_ustring<SourceEncoding, SourceContainer>::code_unit_type;
+                using target_code_unit_type = basic_ustring<TargetEncoding, TargetContainer>::code_unit_type;
+
+                const auto code_units = source.code_units();
+
+                // A UTF-32 code unit is at least as large as any encoding of its code point, and re-encoding into the
+                // same encoding keeps the number of code units.
+                constexpr bool never_grows = (SourceEncoding == encoding::utf32 || SourceEncoding == TargetEncoding) &&
+                                             sizeof(target_code_unit_type) <= sizeof(source_code_unit_type);
+
+                const auto encoded_length = [](const std::uint32_t code_point) static -> std::size_t {
+                    if constexpr (TargetEncoding == encoding::utf8)
+                        return uchar::from_unchecked(code_point).length_utf8();
+                    else if constexpr (TargetEncoding == encoding::utf16)
+                        return uchar::from_unchecked(code_point).length_utf16();
+                    else
+                        return 1;
+                };
+
+                if constexpr (!never_grows)
+                {
+                    // Slack check: after every code point, no more bytes may have been written than read.
+                    std::size_t read_bytes    = 0;
+                    std::size_t written_bytes = 0;
+
+                    for (std::size_t i = 0; i < code_units.size();)
+                    {
+                        const auto [code_point, length] = decode_valid_code_point<SourceEncoding>(code_units.data() + i);
+
+                        i += length;
+                        read_bytes += length * sizeof(source_code_unit_type);
+                        written_bytes += encoded_length(code_point) * sizeof(target_code_unit_type);
+
+                        if (written_bytes > read_bytes)
+                            return std::nullopt;
+                    }
+                }
+
+                // The code units are written through `std::memcpy`, which may alias the code units that are still read.
+                auto* const bytes = reinterpret_cast<unsigned char*>(source.m_container.data());
+
+                std::size_t target_size = 0;
+
+                const auto write = [&](const auto code_unit) {
+                    const auto target_code_unit = static_cast<target_code_unit_type>(code_unit);
+
+                    std::memcpy(bytes + target_size * sizeof(target_code_unit_type), &target_code_unit, sizeof(target_code_unit_type));
+                    ++target_size;
+                };
+
+                for (std::size_t i = 0; i < code_units.size();)
+                {
+                    const auto [code_point, length] = decode_valid_code_point<SourceEncoding>(code_units.data() + i);
+
+                    i += length;
+
+                    if constexpr (TargetEncoding == encoding::utf8)
+                    {
+                        for (const char8_t code_unit : uchar::from_unchecked(code_point).encode_utf8())
+                            write(code_unit);
+                    }
+                    else if constexpr (TargetEncoding == encoding::utf16)
+                    {
+                        for (const char16_t code_unit : uchar::from_unchecked(code_point).encode_utf16())
+                            write(code_unit);
+                    }
+                    else
+                    {
+                        write(code_point);
+                    }
+                }
+
+                TargetContainer container =
+                    TargetContainer::adopt_storage(std::move(source.m_container), static_cast<typename TargetContainer::size_type>(target_size));
+
+                return basic_ustring<TargetEncoding, TargetContainer>{from_container, std::move(container)};
+            }
+        };
+    } // namespace impl
+
+    // Doxygen doesn't handle well static method definitions outside of class definitions
+    /// @cond
+
+    template<string_compatible_container<encoding::ascii> Container>
+    template<std::ranges::input_range Range>
+        requires ranges::code_unit_range_for<Range, encoding::ascii>
+    [[nodiscard]] constexpr std::expected<basic_ascii_string<Container>, from_ascii_error> basic_ascii_string<Container>::from_ascii(Range&& range)
+    {
+        return from_ascii_impl(std::forward<Range>(range));
+    }
+
+    template<string_compatible_container<encoding::ascii> Container>
+    template<std::ranges::input_range Range, typename Allocator>
+        requires ranges::code_unit_range_for<Range, encoding::ascii> && std::uses_allocator_v<Container, Allocator>
+    [[nodiscard]] constexpr std::expected<basic_ascii_string<Container>, from_ascii_error>
+        basic_ascii_string<Container>::from_ascii(Range&& range, const Allocator& alloc)
+    {
+        return from_ascii_impl(std::forward<Range>(range), alloc);
+    }
+
+    template<string_compatible_container<encoding::ascii> Container>
+    template<std::ranges::input_range Range>
+        requires ranges::code_unit_range_for<Range, encoding::ascii>
+    [[nodiscard]] constexpr basic_ascii_string<Container> basic_ascii_string<Container>::from_ascii_lossy(Range&& range)
+    {
+        return from_ascii_lossy_impl(std::forward<Range>(range));
+    }
+
+    template<string_compatible_container<encoding::ascii> Container>
+    template<std::ranges::input_range Range, typename Allocator>
+        requires ranges::code_unit_range_for<Range, encoding::ascii> && std::uses_allocator_v<Container, Allocator>
+    [[nodiscard]] constexpr basic_ascii_string<Container> basic_ascii_string<Container>::from_ascii_lossy(Range&& range, const Allocator& alloc)
+    {
+        return from_ascii_lossy_impl(std::forward<Range>(range), alloc);
+    }
+
+    template<string_compatible_container<encoding::ascii> Container>
+    template<std::ranges::input_range Range>
+        requires ranges::code_unit_range_for<Range, encoding::ascii>
+    [[nodiscard]] constexpr basic_ascii_string<Container> basic_ascii_string<Container>::from_ascii_unchecked(Range&& range)
+    {
+        return from_ascii_unchecked_impl(std::forward<Range>(range));
+    }
+
+    template<string_compatible_container<encoding::ascii> Container>
+    template<std::ranges::input_range Range, typename Allocator>
+        requires ranges::code_unit_range_for<Range, encoding::ascii> && std::uses_allocator_v<Container, Allocator>
+    [[nodiscard]] constexpr basic_ascii_string<Container> basic_ascii_string<Container>::from_ascii_unchecked(Range&& range, const Allocator& alloc)
+    {
+        return from_ascii_unchecked_impl(std::forward<Range>(range), alloc);
+    }
+
+    template<string_compatible_container<encoding::ascii> Container>
+    template<typename Range, typename... Allocator>
+    [[nodiscard]] constexpr std::expected<basic_ascii_string<Container>, from_ascii_error>
+        basic_ascii_string<Container>::from_ascii_impl(Range&& range, const Allocator&... alloc)
+    {
+        using expected_type = std::expected<basic_ascii_string<Container>, from_ascii_error>;
+
+        if constexpr (std::same_as<Container, std::remove_cvref_t<Range>>)
+        {
+            // Use the underlying container's copy/move constructor.
+
+            auto expected = traits_type::validate_range(range);
+
+            if (!expected.has_value())
+            {
+                return expected_type{std::unexpect, std::move(expected).error()};
+            }
+
+            Container container = impl::basic_ustring_impl::container_with_allocator<Container>(std::forward<Range>(range), alloc...);
+
+            return expected_type{std::in_place, basic_ascii_string{impl::from_container, std::move(container)}};
+        }
+        else if constexpr (fixed_capacity_container<Container>)
+        {
+            basic_ascii_string result(alloc...);
+
+            bool capacity_exceeded = false;
+
+            auto expected = traits_type::validate_range(std::forward<Range>(range), [&](char ch) {
+                if (!capacity_exceeded && result.m_container.try_push_back(std::bit_cast<code_unit_type>(ch)) == nullptr)
+                    capacity_exceeded = true;
+            });
+
+            // Every ASCII character is a single code unit, so the capacity is exceeded at `valid_up_to == capacity()`,
+            // which comes before any encoding error.
+            if (capacity_exceeded)
+            {
+                return expected_type{std::unexpect, from_ascii_error{.valid_up_to = result.m_container.size(),
+                                                                     .error       = ascii_error{.code = ascii_error_code::capacity_exceeded}}};
+            }
+
+            if (!expected.has_value())
+            {
+                return expected_type{std::unexpect, std::move(expected).error()};
+            }
+
+            return expected_type{std::in_place, std::move(result)};
+        }
+        else
+        {
+            basic_ascii_string result(alloc...);
+
+            if constexpr (ranges::approximately_sized_range<Range> && impl::reserves_for_size_hint<Container>)
+            {
+                result.reserve(static_cast<size_type>(ranges::reserve_hint(range)));
+            }
+
+            auto expected = traits_type::validate_range(std::forward<Range>(range), [&](char ch) { result.push_back_code_unit(ch); });
+
+            if (!expected.has_value())
+            {
+                return expected_type{std::unexpect, std::move(expected).error()};
+            }
+
+            return expected_type{std::in_place, std::move(result)};
+        }
+    }
+
+    template<string_compatible_container<encoding::ascii> Container>
+    template<typename Range, typename... Allocator>
+    [[nodiscard]] constexpr basic_ascii_string<Container>
+        basic_ascii_string<Container>::from_ascii_lossy_impl(Range&& range, const Allocator&... alloc)
+    {
+        basic_ascii_string result(alloc...);
+
+        if constexpr (ranges::approximately_sized_range<Range> && impl::reserves_for_size_hint<Container>)
+        {
+            result.reserve(static_cast<size_type>(ranges::reserve_hint(range)));
+        }
+
+        traits_type::decode_range_lossy(std::forward<Range>(range), [&](ascii_char ch) { result.push_back(ch); });
+
+        return result;
+    }
+
+    template<string_compatible_container<encoding::ascii> Container>
+    template<typename Range, typename... Allocator>
+    [[nodiscard]] constexpr basic_ascii_string<Container>
+        basic_ascii_string<Container>::from_ascii_unchecked_impl(Range&& range, const Allocator&... alloc)
+    {
+        if constexpr (std::same_as<Container, std::remove_cvref_t<Range>>)
+        {
+            return {impl::from_container, impl::basic_ustring_impl::container_with_allocator<Container>(std::forward<Range>(range), alloc...)};
+        }
+        else
+        {
+            basic_ascii_string result(alloc...);
+
+            if constexpr (ranges::approximately_sized_range<Range> && impl::reserves_for_size_hint<Container>)
+            {
+                result.reserve(static_cast<size_type>(ranges::reserve_hint(range)));
+            }
+
+            auto       it       = std::ranges::begin(range);
+            const auto sentinel = std::ranges::end(range);
+
+            for (; it != sentinel; ++it)
+                result.push_back_code_unit(*it);
+
+            return result;
+        }
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range>
+        requires ranges::code_unit_range_for<Range, encoding::utf8>
+    [[nodiscard]] constexpr std::expected<basic_ustring<E, C>, from_utf8_error> basic_ustring<E, C>::from_utf8(Range&& range)
+    {
+        return impl::basic_ustring_impl::from_utf<encoding::utf8, from_utf8_error, E, C>(std::forward<Range>(range));
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range, typename Allocator>
+        requires ranges::code_unit_range_for<Range, encoding::utf8> && std::uses_allocator_v<C, Allocator>
+    [[nodiscard]] constexpr std::expected<basic_ustring<E, C>, from_utf8_error> basic_ustring<E, C>::from_utf8(Range&& range, const Allocator& alloc)
+    {
+        return impl::basic_ustring_impl::from_utf<encoding::utf8, from_utf8_error, E, C>(std::forward<Range>(range), alloc);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range>
+        requires ranges::code_unit_range_for<Range, encoding::utf8>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf8_lossy(Range&& range)
+    {
+        return impl::basic_ustring_impl::from_utf_lossy<encoding::utf8, E, C>(std::forward<Range>(range));
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range, typename Allocator>
+        requires ranges::code_unit_range_for<Range, encoding::utf8> && std::uses_allocator_v<C, Allocator>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf8_lossy(Range&& range, const Allocator& alloc)
+    {
+        return impl::basic_ustring_impl::from_utf_lossy<encoding::utf8, E, C>(std::forward<Range>(range), alloc);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range>
+        requires ranges::code_unit_range_for<Range, encoding::utf8>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf8_unchecked(Range&& range)
+    {
+        return impl::basic_ustring_impl::from_utf_unchecked<encoding::utf8, E, C>(std::forward<Range>(range));
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range, typename Allocator>
+        requires ranges::code_unit_range_for<Range, encoding::utf8> && std::uses_allocator_v<C, Allocator>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf8_unchecked(Range&& range, const Allocator& alloc)
+    {
+        return impl::basic_ustring_impl::from_utf_unchecked<encoding::utf8, E, C>(std::forward<Range>(range), alloc);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range>
+        requires ranges::code_unit_range_for<Range, encoding::utf16>
+    [[nodiscard]] constexpr std::expected<basic_ustring<E, C>, from_utf16_error> basic_ustring<E, C>::from_utf16(Range&& range)
+    {
+        return impl::basic_ustring_impl::from_utf<encoding::utf16, from_utf16_error, E, C>(std::forward<Range>(range));
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range, typename Allocator>
+        requires ranges::code_unit_range_for<Range, encoding::utf16> && std::uses_allocator_v<C, Allocator>
+    [[nodiscard]] constexpr std::expected<basic_ustring<E, C>, from_utf16_error>
+        basic_ustring<E, C>::from_utf16(Range&& range, const Allocator& alloc)
+    {
+        return impl::basic_ustring_impl::from_utf<encoding::utf16, from_utf16_error, E, C>(std::forward<Range>(range), alloc);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range>
+        requires ranges::code_unit_range_for<Range, encoding::utf16>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf16_lossy(Range&& range)
+    {
+        return impl::basic_ustring_impl::from_utf_lossy<encoding::utf16, E, C>(std::forward<Range>(range));
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range, typename Allocator>
+        requires ranges::code_unit_range_for<Range, encoding::utf16> && std::uses_allocator_v<C, Allocator>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf16_lossy(Range&& range, const Allocator& alloc)
+    {
+        return impl::basic_ustring_impl::from_utf_lossy<encoding::utf16, E, C>(std::forward<Range>(range), alloc);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range>
+        requires ranges::code_unit_range_for<Range, encoding::utf16>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf16_unchecked(Range&& range)
+    {
+        return impl::basic_ustring_impl::from_utf_unchecked<encoding::utf16, E, C>(std::forward<Range>(range));
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range, typename Allocator>
+        requires ranges::code_unit_range_for<Range, encoding::utf16> && std::uses_allocator_v<C, Allocator>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf16_unchecked(Range&& range, const Allocator& alloc)
+    {
+        return impl::basic_ustring_impl::from_utf_unchecked<encoding::utf16, E, C>(std::forward<Range>(range), alloc);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range>
+        requires ranges::code_unit_range_for<Range, encoding::utf32>
+    [[nodiscard]] constexpr std::expected<basic_ustring<E, C>, from_utf32_error> basic_ustring<E, C>::from_utf32(Range&& range)
+    {
+        return impl::basic_ustring_impl::from_utf<encoding::utf32, from_utf32_error, E, C>(std::forward<Range>(range));
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range, typename Allocator>
+        requires ranges::code_unit_range_for<Range, encoding::utf32> && std::uses_allocator_v<C, Allocator>
+    [[nodiscard]] constexpr std::expected<basic_ustring<E, C>, from_utf32_error>
+        basic_ustring<E, C>::from_utf32(Range&& range, const Allocator& alloc)
+    {
+        return impl::basic_ustring_impl::from_utf<encoding::utf32, from_utf32_error, E, C>(std::forward<Range>(range), alloc);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range>
+        requires ranges::code_unit_range_for<Range, encoding::utf32>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf32_lossy(Range&& range)
+    {
+        return impl::basic_ustring_impl::from_utf_lossy<encoding::utf32, E, C>(std::forward<Range>(range));
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range, typename Allocator>
+        requires ranges::code_unit_range_for<Range, encoding::utf32> && std::uses_allocator_v<C, Allocator>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf32_lossy(Range&& range, const Allocator& alloc)
+    {
+        return impl::basic_ustring_impl::from_utf_lossy<encoding::utf32, E, C>(std::forward<Range>(range), alloc);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range>
+        requires ranges::code_unit_range_for<Range, encoding::utf32>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf32_unchecked(Range&& range)
+    {
+        return impl::basic_ustring_impl::from_utf_unchecked<encoding::utf32, E, C>(std::forward<Range>(range));
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<std::ranges::input_range Range, typename Allocator>
+        requires ranges::code_unit_range_for<Range, encoding::utf32> && std::uses_allocator_v<C, Allocator>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::from_utf32_unchecked(Range&& range, const Allocator& alloc)
+    {
+        return impl::basic_ustring_impl::from_utf_unchecked<encoding::utf32, E, C>(std::forward<Range>(range), alloc);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<normalization_form Form>
+    [[nodiscard]] constexpr bool basic_ustring<E, C>::is_normalized() const
+    {
+        const auto units = code_units();
+
+        return impl::normalization::is_normalized<Form, E>(units.data(), units.size());
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<normalization_form Form>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::normalize() const&
+    {
+        const auto units = code_units();
+
+        const std::size_t first_unnormalized = impl::normalization::find_first_unnormalized_segment<Form, E>(units.data(), units.size(), 0).begin;
+
+        if (first_unnormalized == units.size())
+            return *this;
+
+        return impl::basic_ustring_impl::normalize<Form>(*this, first_unnormalized);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<normalization_form Form>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::normalize() &&
+    {
+        const auto units = code_units();
+
+        const std::size_t first_unnormalized = impl::normalization::find_first_unnormalized_segment<Form, E>(units.data(), units.size(), 0).begin;
+
+        if (first_unnormalized == units.size())
+            return std::move(*this);
+
+        return impl::basic_ustring_impl::normalize<Form>(*this, first_unnormalized);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::to_lowercase() const&
+    {
+        return impl::basic_ustring_impl::to_case<impl::to_case_enum::lower>(*this);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::to_lowercase() &&
+    {
+        const auto check = impl::basic_ustring_impl::check_case_mapping<impl::to_case_enum::lower>(*this);
+
+        if (check.unchanged)
+            return std::move(*this);
+
+        return impl::basic_ustring_impl::to_case<impl::to_case_enum::lower>(*this, check);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::to_uppercase() const&
+    {
+        return impl::basic_ustring_impl::to_case<impl::to_case_enum::upper>(*this);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::to_uppercase() &&
+    {
+        const auto check = impl::basic_ustring_impl::check_case_mapping<impl::to_case_enum::upper>(*this);
+
+        if (check.unchanged)
+            return std::move(*this);
+
+        return impl::basic_ustring_impl::to_case<impl::to_case_enum::upper>(*this, check);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<encoding TargetEncoding, string_compatible_container<TargetEncoding> TargetContainer>
+        requires unicode_encoding<TargetEncoding>
+    [[nodiscard]] constexpr basic_ustring<TargetEncoding, TargetContainer> basic_ustring<E, C>::transcode() const&
+    {
+        return impl::basic_ustring_impl::transcode<TargetEncoding, TargetContainer>(*this);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<encoding TargetEncoding, string_compatible_container<TargetEncoding> TargetContainer>
+        requires unicode_encoding<TargetEncoding>
+    [[nodiscard]] constexpr basic_ustring<TargetEncoding, TargetContainer> basic_ustring<E, C>::transcode() &&
+    {
+        if constexpr (TargetEncoding == E && std::same_as<TargetContainer, C>)
+        {
+            return std::move(*this);
+        }
+        else
+        {
+            if constexpr (storage_adopting_container<TargetContainer, C>)
+            {
+                if !consteval
+                {
+                    if (auto result = impl::basic_ustring_impl::try_transcode_in_place<TargetEncoding, TargetContainer>(*this))
+                        return *std::move(result);
+                }
+            }
+
+            return impl::basic_ustring_impl::transcode<TargetEncoding, TargetContainer>(*this);
+        }
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<encoding TargetEncoding, string_compatible_container<TargetEncoding> TargetContainer, typename Allocator>
+        requires unicode_encoding<TargetEncoding> && std::uses_allocator_v<TargetContainer, Allocator>
+    [[nodiscard]] constexpr basic_ustring<TargetEncoding, TargetContainer> basic_ustring<E, C>::transcode(const Allocator& alloc) const&
+    {
+        return impl::basic_ustring_impl::transcode<TargetEncoding, TargetContainer>(*this, alloc);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<impl::search_needle<E> Needle>
+    [[nodiscard]] constexpr typename basic_ustring<E, C>::size_type
+        basic_ustring<E, C>::find(const Needle& needle, const size_type pos) const noexcept
+    {
+        return impl::basic_ustring_impl::find<E, size_type>(code_units(), needle, pos);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<impl::search_needle<E> Needle>
+    [[nodiscard]] constexpr typename basic_ustring<E, C>::size_type
+        basic_ustring<E, C>::rfind(const Needle& needle, const size_type pos) const noexcept
+    {
+        return impl::basic_ustring_impl::rfind<E, size_type>(code_units(), needle, pos);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<impl::search_needle<E> Needle>
+    [[nodiscard]] constexpr bool basic_ustring<E, C>::contains(const Needle& needle) const noexcept
+    {
+        return find(needle) != npos;
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<impl::search_needle<E> Needle>
+    [[nodiscard]] constexpr typename basic_ustring<E, C>::size_type
+        basic_ustring<E, C>::count(const Needle& needle) const noexcept
+    {
+        return impl::basic_ustring_impl::count<E, size_type>(code_units(), needle, code_point_count());
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<impl::search_needle<E> Needle>
+    [[nodiscard]] constexpr bool basic_ustring<E, C>::starts_with(const Needle& needle) const noexcept
+    {
+        return impl::basic_ustring_impl::starts_with<E>(code_units(), needle);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<impl::search_needle<E> Needle>
+    [[nodiscard]] constexpr bool basic_ustring<E, C>::ends_with(const Needle& needle) const noexcept
+    {
+        return impl::basic_ustring_impl::ends_with<E>(code_units(), needle);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<impl::search_needle<E> From, impl::search_needle<E> To>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::replace_all(const From& from, const To& to) const&
+    {
+        const std::size_t index = impl::basic_ustring_impl::first_occurrence<E>(code_units(), from);
+
+        if (index == impl::search::not_found)
+            return *this;
+
+        return impl::basic_ustring_impl::replace_all(*this, from, to, index);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<impl::search_needle<E> From, impl::search_needle<E> To>
+    [[nodiscard]] constexpr basic_ustring<E, C> basic_ustring<E, C>::replace_all(const From& from, const To& to) &&
+    {
+        const std::size_t index = impl::basic_ustring_impl::first_occurrence<E>(code_units(), from);
+
+        if (index == impl::search::not_found)
+            return std::move(*this);
+
+        if !consteval
+        {
+            if (impl::basic_ustring_impl::try_replace_all_in_place(*this, from, to, index))
+                return std::move(*this);
+        }
+
+        return impl::basic_ustring_impl::replace_all(*this, from, to, index);
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    [[nodiscard]] constexpr ranges::valid_code_unit_view<std::span<const typename basic_ustring<E, C>::code_unit_type>, E>
+        basic_ustring<E, C>::trim() const noexcept
+    {
+        const auto units = code_units();
+        const auto first = ranges::impl::trim_start_position<E>(units.begin(), units.end());
+
+        return ranges::valid_code_unit_view<std::span<const code_unit_type>, E>(
+            std::span<const code_unit_type>(first, ranges::impl::trim_end_position<E>(first, units.end())));
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    [[nodiscard]] constexpr ranges::valid_code_unit_view<std::span<const typename basic_ustring<E, C>::code_unit_type>, E>
+        basic_ustring<E, C>::trim_start() const noexcept
+    {
+        const auto units = code_units();
+
+        return ranges::valid_code_unit_view<std::span<const code_unit_type>, E>(
+            std::span<const code_unit_type>(ranges::impl::trim_start_position<E>(units.begin(), units.end()), units.end()));
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    [[nodiscard]] constexpr ranges::valid_code_unit_view<std::span<const typename basic_ustring<E, C>::code_unit_type>, E>
+        basic_ustring<E, C>::trim_end() const noexcept
+    {
+        const auto units = code_units();
+
+        return ranges::valid_code_unit_view<std::span<const code_unit_type>, E>(
+            std::span<const code_unit_type>(units.begin(), ranges::impl::trim_end_position<E>(units.begin(), units.end())));
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<encoding SourceEncoding, typename SourceContainer>
+    constexpr void basic_ustring<E, C>::reserve_for_transcoding_from(const basic_ustring<SourceEncoding, SourceContainer>& source)
+        requires reservable_container<C>
+    {
+        if (const auto exact_size = impl::basic_ustring_impl::exact_transcoded_size<E>(source))
+            m_container.reserve(static_cast<size_type>(*exact_size));
+        else
+            reserve_for_transcoding_from<SourceEncoding>(source.code_units().size());
+    }
+
+    template<encoding E, string_compatible_container<E> C>
+        requires unicode_encoding<E>
+    template<impl::string_piece Piece>
+    constexpr basic_ustring<E, C>& basic_ustring<E, C>::append(const Piece& piece)
+    {
+        // Read the code units of `*this` by index, because appending can move them.
+        const auto append_own_code_units = [this](const size_type offset, const size_type size) {
+            impl::basic_ustring_impl::reserve_for_append(*this, size);
+
+            for (size_type i = 0; i < size; ++i)
+                push_back_code_unit(code_units()[offset + i]);
+        };
+
+        if constexpr (std::same_as<Piece, basic_ustring>)
+        {
+            if (&piece == this)
+            {
+                append_own_code_units(0, code_units().size());
+                return *this;
+            }
+        }
+        else if constexpr (!std::same_as<Piece, uchar>)
+        {
+            const auto piece_units = impl::basic_ustring_impl::piece_code_units(piece);
+
+            using piece_units_type = decltype(piece_units);
+
+            if constexpr (impl::string_piece_encoding<Piece>::value == E && std::ranges::contiguous_range<piece_units_type> &&
+                          std::ranges::sized_range<piece_units_type> && std::same_as<std::ranges::range_value_t<piece_units_type>, code_unit_type>)
+            {
+                // A view of the code units of this string, e.g. `code_units() | views::mark_as_valid_utf8`.
+                if (!std::ranges::empty(piece_units) && impl::basic_ustring_impl::is_stored_in_string(*this, std::ranges::data(piece_units)))
+                {
+                    append_own_code_units(static_cast<size_type>(std::ranges::data(piece_units) - code_units().data()),
+                                          static_cast<size_type>(std::ranges::size(piece_units)));
+                    return *this;
+                }
+            }
+        }
+
+        impl::basic_ustring_impl::reserve_for_append(*this, impl::basic_ustring_impl::transcoded_size<E>(piece));
+        impl::basic_ustring_impl::append_piece(*this, piece);
+
+        return *this;
+    }
+
+    template<encoding Encoding, string_compatible_container<Encoding> Container, impl::string_piece... Pieces>
+        requires unicode_encoding<Encoding>
+    [[nodiscard]] constexpr basic_ustring<Encoding, Container> concat(const Pieces&... pieces)
+    {
+        using size_type = basic_ustring<Encoding, Container>::size_type;
+
+        basic_ustring<Encoding, Container> result;
+
+        const std::size_t size = (0uz + ... + impl::basic_ustring_impl::transcoded_size<Encoding>(pieces));
+
+        if constexpr (fixed_capacity_container<Container>)
+            impl::basic_ustring_impl::reserve_for_append(result, size);
+        else if constexpr (impl::reserves_for_size_hint<Container>)
+            result.reserve(static_cast<size_type>(size));
+
+        (impl::basic_ustring_impl::append_piece(result, pieces), ...);
+
+        return result;
     }
 
     /// @endcond
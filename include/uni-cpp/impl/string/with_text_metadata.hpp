@@ -0,0 +1,383 @@
+#ifndef UNI_CPP_IMPL_STRING_WITH_TEXT_METADATA_HPP
+#define UNI_CPP_IMPL_STRING_WITH_TEXT_METADATA_HPP
+
+/// @file
+///
+/// @brief Defines `with_text_metadata`, a container adaptor that caches metadata about the code units it holds.
+///
+
+#include "fwd.hpp"
+
+#include "../text_metadata.hpp"
+
+#include <cstddef>
+#include <concepts>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+namespace upp
+{
+    /// @brief Container adaptor that caches whether all code units are ASCII, whether there are any supplementary code points
+    /// (above U+FFFF) and the number of code points.
+    ///
+    /// Use it as the container of a string type to opt into the cached metadata, for example
+    /// `basic_utf8_string<with_text_metadata<std::u8string>>`. The default string types don't pay for it.
+    ///
+    /// The metadata is kept as counts of code points, non-ASCII code units and supplementary code points. The member functions
+    /// that insert and erase code units add or subtract the counts of only the code units they insert or erase, so no edit
+    /// rescans the whole container. The validating factories (`from_utf8` etc.) collect the counts while they validate
+    /// and install them together with the code units, without another pass over the text. `basic_ustring` then uses
+    /// the metadata for these fast paths:
+    /// - `code_point_count()` and `is_ascii()` are O(1),
+    /// - `transcode()` of ASCII text only widens or narrows the code units,
+    /// - `reserve_for_transcoding_from()` reserves the exact size when the metadata determines it,
+    /// - case mapping of ASCII text without letters to map returns the string unchanged.
+    ///
+    /// The non-`const` overloads of the element access functions give write access to the code units, so they discard
+    /// the cached metadata. After that, the metadata is computed by scanning the code units on every query,
+    /// until the container is cleared or reassigned. `basic_ustring` only ever reads the container through `const` references.
+    ///
+    /// Code units of 1 byte are counted as UTF-8, code units of 2 bytes as UTF-16 and code units of 4 bytes as UTF-32.
+    /// The metadata is only meaningful if the container holds a valid code unit sequence.
+    ///
+    /// @tparam Container The underlying container. Must satisfy the `contiguous_sequence_container` concept.
+    ///
+    /// @see small_text_buffer
+    ///
+    /// @headerfile "" <uni-cpp/string.hpp>
+    ///
+    template<contiguous_sequence_container Container>
+        requires code_unit_type<typename Container::value_type>
+    class with_text_metadata
+    {
+    public:
+        using container_type  = Container;
+        using value_type      = Container::value_type;
+        using size_type       = Container::size_type;
+        using difference_type = std::ranges::range_difference_t<Container>;
+        using reference       = value_type&;
+        using const_reference = const value_type&;
+        using iterator        = Container::iterator;
+        using const_iterator  = Container::const_iterator;
+
+    public:
+        /// @brief Constructs an empty container.
+        ///
+        constexpr with_text_metadata() noexcept(std::is_nothrow_default_constructible_v<Container>) = default;
+
+        /// @brief Constructs an empty container that uses the allocator `alloc`.
+        ///
+        template<typename Allocator>
+            requires std::constructible_from<Container, const Allocator&>
+        explicit constexpr with_text_metadata(const Allocator& alloc) noexcept(std::is_nothrow_constructible_v<Container, const Allocator&>)
+            : m_container(alloc)
+        {
+        }
+
+        /// @brief Constructs the container from the underlying container, computing the metadata.
+        ///
+        explicit constexpr with_text_metadata(Container container)
+            : m_container(std::move(container))
+        {
+            recompute();
+        }
+
+        /// @brief Constructs the container from the underlying container and its already known metadata `counts`, without scanning it.
+        ///
+        /// @pre `counts` are the counts of the code units of `container`.
+        ///
+        constexpr with_text_metadata(Container container, const impl::text_metadata::counts& counts) noexcept(
+            std::is_nothrow_move_constructible_v<Container>)
+            : m_container(std::move(container)), m_counts(counts), m_has_metadata(true)
+        {
+        }
+
+        /// @brief Constructs the container with the contents of the range `[first, last)`.
+        ///
+        template<std::input_iterator It>
+            requires std::constructible_from<Container, It, It>
+        constexpr with_text_metadata(It first, It last)
+            : m_container(std::move(first), std::move(last))
+        {
+            recompute();
+        }
+
+        /// @brief Constructs the container with the contents of the initializer list `init`.
+        ///
+        constexpr with_text_metadata(const std::initializer_list<value_type> init)
+            : m_container(init)
+        {
+            recompute();
+        }
+
+        /// @brief Constructs the container by copying `other` with the allocator `alloc`.
+        ///
+        template<typename Allocator>
+            requires std::constructible_from<Container, const Container&, const Allocator&>
+        constexpr with_text_metadata(const with_text_metadata& other, const Allocator& alloc)
+            : m_container(other.m_container, alloc), m_counts(other.m_counts), m_has_metadata(other.m_has_metadata)
+        {
+        }
+
+        /// @brief Constructs the container by moving `other` with the allocator `alloc`.
+        ///
+        template<typename Allocator>
+            requires std::constructible_from<Container, Container&&, const Allocator&>
+        constexpr with_text_metadata(with_text_metadata&& other, const Allocator& alloc)
+            : m_container(std::move(other.m_container), alloc), m_counts(other.m_counts), m_has_metadata(other.m_has_metadata)
+        {
+        }
+
+        constexpr void assign(const size_type count, const value_type& value)
+        {
+            m_container.assign(count, value);
+            recompute();
+        }
+
+        template<std::input_iterator It>
+        constexpr void assign(It first, It last)
+        {
+            m_container.assign(std::move(first), std::move(last));
+            recompute();
+        }
+
+        constexpr void assign(const std::initializer_list<value_type> init)
+        {
+            m_container.assign(init);
+            recompute();
+        }
+
+        /// @brief Returns a `const` reference to the underlying container.
+        ///
+        [[nodiscard]] constexpr const Container& underlying() const noexcept { return m_container; }
+
+        /// @name Element access and iterators
+        ///
+        /// The non-`const` overloads discard the cached metadata.
+        ///
+        /// @{
+
+        [[nodiscard]] constexpr reference operator[](const size_type index)
+        {
+            discard_metadata();
+            return m_container[index];
+        }
+
+        [[nodiscard]] constexpr const_reference operator[](const size_type index) const { return m_container[index]; }
+
+        [[nodiscard]] constexpr value_type* data()
+        {
+            discard_metadata();
+            return m_container.data();
+        }
+
+        [[nodiscard]] constexpr const value_type* data() const { return m_container.data(); }
+
+        [[nodiscard]] constexpr iterator begin()
+        {
+            discard_metadata();
+            return m_container.begin();
+        }
+
+        [[nodiscard]] constexpr const_iterator begin() const { return m_container.begin(); }
+
+        [[nodiscard]] constexpr iterator end()
+        {
+            discard_metadata();
+            return m_container.end();
+        }
+
+        [[nodiscard]] constexpr const_iterator end() const { return m_container.end(); }
+
+        /// @}
+
+        [[nodiscard]] constexpr bool empty() const { return m_container.empty(); }
+
+        [[nodiscard]] constexpr size_type size() const { return m_container.size(); }
+
+        [[nodiscard]] constexpr size_type max_size() const noexcept
+            requires requires(const Container& c) { c.max_size(); }
+        {
+            return m_container.max_size();
+        }
+
+        [[nodiscard]] constexpr size_type capacity() const noexcept
+            requires requires(const Container& c) { c.capacity(); }
+        {
+            return m_container.capacity();
+        }
+
+        constexpr void reserve(const size_type new_capacity)
+            requires requires(Container& c, size_type n) { c.reserve(n); }
+        {
+            m_container.reserve(new_capacity);
+        }
+
+        constexpr void shrink_to_fit()
+            requires requires(Container& c) { c.shrink_to_fit(); }
+        {
+            m_container.shrink_to_fit();
+        }
+
+        /// @name Cached metadata
+        ///
+        /// @{
+
+        /// @brief Checks whether all code units are ASCII. O(1) unless the metadata was discarded.
+        ///
+        [[nodiscard]] constexpr bool is_ascii() const noexcept
+        {
+            if (m_has_metadata)
+                return m_counts.non_ascii == 0;
+
+            return impl::text_metadata::is_ascii(std::to_address(m_container.begin()), m_container.size());
+        }
+
+        /// @brief Checks whether there are any supplementary code points (above U+FFFF). O(1) unless the metadata was discarded.
+        ///
+        [[nodiscard]] constexpr bool has_supplementary_code_points() const noexcept
+        {
+            if (m_has_metadata)
+                return m_counts.supplementary != 0;
+
+            return impl::text_metadata::has_supplementary(std::to_address(m_container.begin()), m_container.size());
+        }
+
+        /// @brief Returns the number of code points. O(1) unless the metadata was discarded.
+        ///
+        [[nodiscard]] constexpr size_type code_point_count() const noexcept
+        {
+            if (m_has_metadata)
+                return static_cast<size_type>(m_counts.code_points);
+
+            return static_cast<size_type>(impl::text_metadata::count_code_points(std::to_address(m_container.begin()), m_container.size()));
+        }
+
+        /// @}
+
+        /// @name Modifiers
+        ///
+        /// @{
+
+        constexpr void clear() noexcept
+        {
+            m_container.clear();
+
+            m_counts       = {};
+            m_has_metadata = true;
+        }
+
+        constexpr iterator insert(const const_iterator pos, const value_type& value)
+        {
+            const iterator it = m_container.insert(pos, value);
+
+            note_inserted(it, 1);
+            return it;
+        }
+
+        constexpr iterator insert(const const_iterator pos, const size_type count, const value_type& value)
+        {
+            const iterator it = m_container.insert(pos, count, value);
+
+            note_inserted(it, count);
+            return it;
+        }
+
+        template<std::input_iterator It>
+        constexpr iterator insert(const const_iterator pos, It first, It last)
+        {
+            const size_type size = m_container.size();
+            const iterator  it   = m_container.insert(pos, std::move(first), std::move(last));
+
+            note_inserted(it, m_container.size() - size);
+            return it;
+        }
+
+        constexpr iterator insert(const const_iterator pos, const std::initializer_list<value_type> init)
+        {
+            const iterator it = m_container.insert(pos, init);
+
+            note_inserted(it, init.size());
+            return it;
+        }
+
+        constexpr void push_back(const value_type& value)
+        {
+            if constexpr (requires { m_container.push_back(value); })
+                m_container.push_back(value);
+            else
+                m_container.insert(std::as_const(m_container).end(), value);
+
+            note_inserted(std::prev(m_container.end()), 1);
+        }
+
+        template<std::ranges::input_range Range>
+        constexpr void append_range(Range&& range)
+        {
+            const size_type size = m_container.size();
+
+            if constexpr (requires { m_container.append_range(std::forward<Range>(range)); })
+            {
+                m_container.append_range(std::forward<Range>(range));
+            }
+            else
+            {
+                auto common_range = std::views::common(std::forward<Range>(range));
+
+                m_container.insert(std::as_const(m_container).end(), std::ranges::begin(common_range), std::ranges::end(common_range));
+            }
+
+            note_inserted(m_container.begin() + static_cast<difference_type>(size), m_container.size() - size);
+        }
+
+        constexpr iterator erase(const const_iterator pos) { return erase(pos, std::next(pos)); }
+
+        constexpr iterator erase(const const_iterator first, const const_iterator last)
+        {
+            if (m_has_metadata)
+                m_counts -= impl::text_metadata::count(std::to_address(first), static_cast<std::size_t>(last - first));
+
+            return m_container.erase(first, last);
+        }
+
+        /// @}
+
+        [[nodiscard]] friend constexpr bool operator==(const with_text_metadata& x, const with_text_metadata& y)
+        {
+            return x.m_container == y.m_container;
+        }
+
+        [[nodiscard]] friend constexpr auto operator<=>(const with_text_metadata& x, const with_text_metadata& y)
+            requires std::three_way_comparable<Container>
+        {
+            return x.m_container <=> y.m_container;
+        }
+
+    private:
+        constexpr void discard_metadata() noexcept { m_has_metadata = false; }
+
+        constexpr void recompute() noexcept
+        {
+            m_counts       = impl::text_metadata::count(std::to_address(std::as_const(m_container).begin()), m_container.size());
+            m_has_metadata = true;
+        }
+
+        /// @brief Updates the metadata after `count` code units were inserted at `pos`.
+        ///
+        constexpr void note_inserted(const const_iterator pos, const size_type count) noexcept
+        {
+            if (m_has_metadata)
+                m_counts += impl::text_metadata::count(std::to_address(pos), count);
+        }
+
+    private:
+        Container                   m_container;
+        impl::text_metadata::counts m_counts;
+        bool                        m_has_metadata = true;
+    };
+} // namespace upp
+
+#endif // UNI_CPP_IMPL_STRING_WITH_TEXT_METADATA_HPP
\ No newline at end of file
@@ -0,0 +1,84 @@
+#ifndef UNI_CPP_IMPL_SWAR_HPP
+#define UNI_CPP_IMPL_SWAR_HPP
+
+/// @file
+///
+/// @brief SIMD-within-a-register helpers for scanning byte sequences a word at a time.
+///
+/// The scanners of the library (ASCII runs, searching, line breaks, delimiters, the normalization quick check etc.)
+/// use these 64-bit word operations where a vectorized implementation would use SIMD intrinsics.
+/// The library is header-only, portable and usable in constant evaluation, so it has no SIMD code of its own.
+///
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <bit>
+
+namespace upp::impl::swar
+{
+    using word_type = std::uint64_t;
+
+    inline constexpr std::size_t word_size = sizeof(word_type);
+
+    /// The most significant bit of every byte in a word.
+    inline constexpr word_type high_bits = 0x8080'8080'8080'8080ULL;
+
+    /// @brief Loads `word_size` bytes starting at `ptr` into a word, with the first byte in the least significant position.
+    ///
+    template<typename T>
+        requires(sizeof(T) == 1)
+    [[nodiscard]] constexpr word_type load_word(const T* ptr) noexcept
+    {
+        word_type word = 0;
+
+        if consteval
+        {
+            for (std::size_t i = 0; i < word_size; ++i)
+                word |= static_cast<word_type>(std::bit_cast<std::uint8_t>(ptr[i])) << (8U * i);
+        }
+        else
+        {
+            std::memcpy(&word, ptr, word_size);
+
+            if constexpr (std::endian::native == std::endian::big)
+                word = std::byteswap(word);
+        }
+
+        return word;
+    }
+
+    /// @brief Checks whether every byte of `word` is within the ASCII range.
+    ///
+    [[nodiscard]] constexpr bool is_ascii_word(word_type word) noexcept
+    {
+        return (word & high_bits) == 0;
+    }
+
+    /// @brief Returns the length of the longest prefix of `[data, data + size)` that consists of ASCII bytes only.
+    ///
+    template<typename T>
+        requires(sizeof(T) == 1)
+    [[nodiscard]] constexpr std::size_t ascii_prefix_length(const T* data, std::size_t size) noexcept
+    {
+        std::size_t index = 0;
+
+        for (; index + word_size <= size; index += word_size)
+        {
+            const word_type non_ascii = load_word(data + index) & high_bits;
+
+            if (non_ascii != 0)
+                return index + static_cast<std::size_t>(std::countr_zero(non_ascii)) / 8uz;
+        }
+
+        for (; index < size; ++index)
+        {
+            if (std::bit_cast<std::uint8_t>(data[index]) >= 0x80U)
+                return index;
+        }
+
+        return size;
+    }
+} // namespace upp::impl::swar
+
+#endif // UNI_CPP_IMPL_SWAR_HPP
\ No newline at end of file
@@ -0,0 +1,343 @@
+#ifndef UNI_CPP_IMPL_TEXT_METADATA_HPP
+#define UNI_CPP_IMPL_TEXT_METADATA_HPP
+
+/// @file
+///
+/// @brief Scanning code unit sequences for the metadata that string types cache (ASCII-only flag, code point count, line count).
+///
+/// The functions only look at the size of the code unit type: 1 byte code units are treated as UTF-8 (or ASCII),
+/// 2 byte code units as UTF-16 and 4 byte code units as UTF-32.
+///
+
+#include "swar.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <bit>
+
+namespace upp::impl::text_metadata
+{
+    template<typename T>
+    [[nodiscard]] constexpr std::uint32_t code_unit_value(const T code_unit) noexcept
+    {
+        return static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<T>>(code_unit));
+    }
+
+    /// @brief Checks whether `code_unit` starts a code point, i.e. it's not a UTF-8 continuation byte or a UTF-16 low surrogate.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr bool is_leading_code_unit(const T code_unit) noexcept
+    {
+        if constexpr (sizeof(T) == 1)
+            return (code_unit_value(code_unit) & 0xC0U) != 0x80U;
+        else if constexpr (sizeof(T) == 2)
+            return (code_unit_value(code_unit) & 0xFC00U) != 0xDC00U;
+        else
+            return true;
+    }
+
+    /// @brief Checks whether all code units in `[data, data + size)` are ASCII.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr bool is_ascii(const T* data, const std::size_t size) noexcept
+    {
+        if constexpr (sizeof(T) == 1)
+        {
+            return swar::ascii_prefix_length(data, size) == size;
+        }
+        else
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (code_unit_value(data[i]) >= 0x80U)
+                    return false;
+            }
+
+            return true;
+        }
+    }
+
+    /// @brief Returns the number of code units in `[data, data + size)` that are not ASCII.
+    ///
+    /// UTF-8 is counted a word at a time, by counting the bytes with the most significant bit set.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr std::size_t count_non_ascii(const T* data, const std::size_t size) noexcept
+    {
+        std::size_t count = 0;
+        std::size_t index = 0;
+
+        if constexpr (sizeof(T) == 1)
+        {
+            for (; index + swar::word_size <= size; index += swar::word_size)
+                count += static_cast<std::size_t>(std::popcount(swar::load_word(data + index) & swar::high_bits));
+        }
+
+        for (; index < size; ++index)
+        {
+            if (code_unit_value(data[index]) >= 0x80U)
+                ++count;
+        }
+
+        return count;
+    }
+
+    /// @brief Returns the number of code points in the valid code unit sequence `[data, data + size)`.
+    ///
+    /// Counts the code units that start a code point. UTF-8 is counted a word at a time: a continuation byte is
+    /// the only kind of byte that has the most significant bit set and the next bit clear.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr std::size_t count_code_points(const T* data, const std::size_t size) noexcept
+    {
+        if constexpr (sizeof(T) == 4)
+        {
+            return size;
+        }
+        else
+        {
+            std::size_t count = 0;
+            std::size_t index = 0;
+
+            if constexpr (sizeof(T) == 1)
+            {
+                for (; index + swar::word_size <= size; index += swar::word_size)
+                {
+                    const swar::word_type word         = swar::load_word(data + index);
+                    const swar::word_type continuation = word & ~(word << 1U) & swar::high_bits;
+
+                    count += swar::word_size - static_cast<std::size_t>(std::popcount(continuation));
+                }
+            }
+
+            for (; index < size; ++index)
+            {
+                if (is_leading_code_unit(data[index]))
+                    ++count;
+            }
+
+            return count;
+        }
+    }
+
+    /// @brief Checks whether the valid code unit sequence `[data, data + size)` contains a supplementary code point (above U+FFFF).
+    ///
+    /// Those are the code points encoded with 4 bytes in UTF-8 and with a surrogate pair in UTF-16.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr bool has_supplementary(const T* data, const std::size_t size) noexcept
+    {
+        std::size_t index = 0;
+
+        if constexpr (sizeof(T) == 1)
+        {
+            for (; index + swar::word_size <= size; index += swar::word_size)
+            {
+                // Leading bytes of 4 byte sequences are the only bytes with the 4 most significant bits set.
+                const swar::word_type word = swar::load_word(data + index);
+
+                if ((word & (word << 1U) & (word << 2U) & (word << 3U) & swar::high_bits) != 0)
+                    return true;
+            }
+        }
+
+        for (; index < size; ++index)
+        {
+            const std::uint32_t value = code_unit_value(data[index]);
+
+            if constexpr (sizeof(T) == 1)
+            {
+                if (value >= 0xF0U)
+                    return true;
+            }
+            else if constexpr (sizeof(T) == 2)
+            {
+                if ((value & 0xFC00U) == 0xD800U)
+                    return true;
+            }
+            else
+            {
+                if (value >= 0x10000U)
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// @brief Returns the number of supplementary code points (above U+FFFF) in the valid code unit sequence `[data, data + size)`.
+    ///
+    /// UTF-8 is counted a word at a time, with the same test for leading bytes of 4 byte sequences as `has_supplementary`.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr std::size_t count_supplementary(const T* data, const std::size_t size) noexcept
+    {
+        std::size_t count = 0;
+        std::size_t index = 0;
+
+        if constexpr (sizeof(T) == 1)
+        {
+            for (; index + swar::word_size <= size; index += swar::word_size)
+            {
+                const swar::word_type word = swar::load_word(data + index);
+
+                count += static_cast<std::size_t>(std::popcount(word & (word << 1U) & (word << 2U) & (word << 3U) & swar::high_bits));
+            }
+        }
+
+        for (; index < size; ++index)
+        {
+            const std::uint32_t value = code_unit_value(data[index]);
+
+            if constexpr (sizeof(T) == 1)
+                count += value >= 0xF0U ? 1 : 0;
+            else if constexpr (sizeof(T) == 2)
+                count += (value & 0xFC00U) == 0xD800U ? 1 : 0;
+            else
+                count += value >= 0x10000U ? 1 : 0;
+        }
+
+        return count;
+    }
+
+    /// @brief The number of code points, of non-ASCII code units and of supplementary code points of a valid code unit sequence.
+    ///
+    struct counts
+    {
+        std::size_t code_points   = 0;
+        std::size_t non_ascii     = 0;
+        std::size_t supplementary = 0;
+
+        /// @brief Adds `code_unit` to the counts, for collecting them one code unit at a time, e.g. while validating the sequence.
+        ///
+        template<typename T>
+        constexpr void add(const T code_unit) noexcept
+        {
+            const std::uint32_t value = code_unit_value(code_unit);
+
+            if (value < 0x80U)
+            {
+                ++code_points;
+                return;
+            }
+
+            ++non_ascii;
+
+            if (is_leading_code_unit(code_unit))
+                ++code_points;
+
+            if constexpr (sizeof(T) == 1)
+                supplementary += value >= 0xF0U ? 1 : 0;
+            else if constexpr (sizeof(T) == 2)
+                supplementary += (value & 0xFC00U) == 0xD800U ? 1 : 0;
+            else
+                supplementary += value >= 0x10000U ? 1 : 0;
+        }
+
+        constexpr counts& operator+=(const counts& other) noexcept
+        {
+            code_points   += other.code_points;
+            non_ascii     += other.non_ascii;
+            supplementary += other.supplementary;
+            return *this;
+        }
+
+        constexpr counts& operator-=(const counts& other) noexcept
+        {
+            code_points   -= other.code_points;
+            non_ascii     -= other.non_ascii;
+            supplementary -= other.supplementary;
+            return *this;
+        }
+    };
+
+    /// @brief Returns the counts of the valid code unit sequence `[data, data + size)`. ASCII sequences are only scanned once.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr counts count(const T* data, const std::size_t size) noexcept
+    {
+        const std::size_t non_ascii = count_non_ascii(data, size);
+
+        if (non_ascii == 0)
+            return {.code_points = size, .non_ascii = 0, .supplementary = 0};
+
+        return {.code_points = count_code_points(data, size), .non_ascii = non_ascii, .supplementary = count_supplementary(data, size)};
+    }
+
+    /// @brief Returns the number of line feeds (U+000A) in the code unit sequence `[data, data + size)`.
+    ///
+    /// UTF-8 is counted a word at a time: a byte of `word ^ 0x0A0A...` is zero exactly where `word` has a line feed.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr std::size_t count_line_feeds(const T* data, const std::size_t size) noexcept
+    {
+        std::size_t count = 0;
+        std::size_t index = 0;
+
+        if constexpr (sizeof(T) == 1)
+        {
+            constexpr swar::word_type ones     = 0x0101'0101'0101'0101ULL;
+            constexpr swar::word_type low_bits = 0x7F7F'7F7F'7F7F'7F7FULL;
+
+            for (; index + swar::word_size <= size; index += swar::word_size)
+            {
+                const swar::word_type word = swar::load_word(data + index) ^ (0x0AU * ones);
+
+                // The most significant bit of a byte of `(word & low_bits) + low_bits` is set if any of the lower 7 bits is set.
+                // No byte can carry into the next one, so the bit stays clear exactly for the zero bytes.
+                const swar::word_type nonzero = ((word & low_bits) + low_bits) | word;
+
+                count += static_cast<std::size_t>(std::popcount(~nonzero & swar::high_bits));
+            }
+        }
+
+        for (; index < size; ++index)
+        {
+            if (code_unit_value(data[index]) == 0x0AU)
+                ++count;
+        }
+
+        return count;
+    }
+
+    /// @brief Checks whether the ASCII code unit sequence `[data, data + size)` contains a code unit in the range `[low, high]`.
+    ///
+    /// @pre `0 < low <= high < 0x80`
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr bool ascii_contains_range(const T* data, const std::size_t size, const std::uint8_t low, const std::uint8_t high) noexcept
+    {
+        std::size_t index = 0;
+
+        if constexpr (sizeof(T) == 1)
+        {
+            constexpr swar::word_type ones = 0x0101'0101'0101'0101ULL;
+
+            // Adding `0x80 - low` to an ASCII byte sets its most significant bit if the byte is at least `low`,
+            // and adding `0x7F - high` sets it if the byte is greater than `high`. Neither can carry into the next byte.
+            const swar::word_type add_low  = (0x80U - low) * ones;
+            const swar::word_type add_high = (0x7FU - high) * ones;
+
+            for (; index + swar::word_size <= size; index += swar::word_size)
+            {
+                const swar::word_type word = swar::load_word(data + index);
+
+                if (((word + add_low) & ~(word + add_high) & swar::high_bits) != 0)
+                    return true;
+            }
+        }
+
+        for (; index < size; ++index)
+        {
+            const std::uint32_t value = code_unit_value(data[index]);
+
+            if (value >= low && value <= high)
+                return true;
+        }
+
+        return false;
+    }
+} // namespace upp::impl::text_metadata
+
+#endif // UNI_CPP_IMPL_TEXT_METADATA_HPP
\ No newline at end of file
@@ -25,8 +25,8 @@ namespace upp::impl::unicode_data::case_mapping::impl
     {
         // See `dev/docs/multistage-lookup-tables.md`.
 
-        const std::uint32_t quot = code_point / 64;
-        const std::uint32_t rem  = code_point % 64;
+        const std::uint32_t quot = code_point >> 6U;
+        const std::uint32_t rem  = code_point & 0x3FU;
 
         const std::uint32_t stage2_offset = stage2_offsets[stage1[quot]];
 
@@ -0,0 +1,32 @@
+// DO NOT EDIT THIS FILE! THIS FILE WAS GENERATED BY `dev/tools/unicode_data_generator`.
+// Unicode version: 16.0.0
+
+#ifndef UNI_CPP_IMPL_UNICODE_DATA_DATA_DISPLAY_WIDTH_DATA_HPP
+#define UNI_CPP_IMPL_UNICODE_DATA_DATA_DISPLAY_WIDTH_DATA_HPP
+
+#include <cstdint>
+
+#include "../../embed/support.hpp"
+
+#ifdef UNI_CPP_IMPL_HAS_EMBED
+#include "data_embed.hpp"
+#else
+#include "data_inline.hpp"
+#endif
+
+namespace upp::impl::unicode_data::display_width::impl
+{
+    [[nodiscard]] constexpr std::uint8_t lookup(const std::uint32_t code_point) noexcept
+    {
+        // See `dev/docs/multistage-lookup-tables.md`.
+
+        const std::uint32_t quot = code_point >> 7U;
+        const std::uint32_t rem  = code_point & 0x7FU;
+
+        const std::uint32_t stage2_offset = stage2_offsets[stage1[quot]];
+
+        return stage2[stage2_offset + rem];
+    }
+} // namespace upp::impl::unicode_data::display_width::impl
+
+#endif // UNI_CPP_IMPL_UNICODE_DATA_DATA_DISPLAY_WIDTH_DATA_HPP
@@ -0,0 +1,36 @@
+// DO NOT EDIT THIS FILE! THIS FILE WAS GENERATED BY `dev/tools/unicode_data_generator`.
+// Unicode version: 16.0.0
+
+// Display Width data: 20'572 bytes
+
+#ifndef UNI_CPP_IMPL_UNICODE_DATA_DATA_DISPLAY_WIDTH_DATA_EMBED_HPP
+#define UNI_CPP_IMPL_UNICODE_DATA_DATA_DISPLAY_WIDTH_DATA_EMBED_HPP
+
+#include <cstdint>
+#include <array>
+
+#include "../../embed/parse.hpp"
+
+#include "../../embed/start_embed_code.hpp"
+
+namespace upp::impl::unicode_data::display_width::impl
+{
+    // 8'704 bytes
+    inline constexpr std::array<std::uint8_t, 8704> stage1{
+        #embed "data/stage1.dat"
+    };
+
+    // 11'554 bytes
+    inline constexpr std::array<std::uint8_t, 11554> stage2{
+        #embed "data/stage2.dat"
+    };
+
+    // 314 bytes
+    inline constexpr std::array<std::uint16_t, 157> stage2_offsets = embed::parse<std::uint16_t, 314>(std::array<std::uint8_t, 314>{
+        #embed "data/stage2_offsets.dat"
+    });
+} // namespace upp::impl::unicode_data::display_width::impl
+
+#include "../../embed/end_embed_code.hpp"
+
+#endif // UNI_CPP_IMPL_UNICODE_DATA_DATA_DISPLAY_WIDTH_DATA_EMBED_HPP
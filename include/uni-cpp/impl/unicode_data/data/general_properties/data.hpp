@@ -0,0 +1,33 @@
+// DO NOT EDIT THIS FILE! THIS FILE WAS GENERATED BY `dev/tools/unicode_data_generator`.
+// Unicode version: 16.0.0
+
+#ifndef UNI_CPP_IMPL_UNICODE_DATA_DATA_GENERAL_PROPERTIES_DATA_HPP
+#define UNI_CPP_IMPL_UNICODE_DATA_DATA_GENERAL_PROPERTIES_DATA_HPP
+
+#include <cstdint>
+
+#include "../../embed/support.hpp"
+
+#ifdef UNI_CPP_IMPL_HAS_EMBED
+#include "data_embed.hpp"
+#else
+#include "data_inline.hpp"
+#endif
+
+namespace upp::impl::unicode_data::general_properties::impl
+{
+    [[nodiscard]] constexpr std::uint16_t lookup(const std::uint32_t code_point) noexcept
+    {
+        // See `dev/docs/multistage-lookup-tables.md`.
+
+        const std::uint32_t quot = code_point >> 8U;
+        const std::uint32_t rem  = code_point & 0xFFU;
+
+        const std::uint32_t stage2_offset = stage1[quot];
+
+        const auto stage2_value = stage2[stage2_offset + rem];
+        return stage3[stage2_value];
+    }
+} // namespace upp::impl::unicode_data::general_properties::impl
+
+#endif // UNI_CPP_IMPL_UNICODE_DATA_DATA_GENERAL_PROPERTIES_DATA_HPP
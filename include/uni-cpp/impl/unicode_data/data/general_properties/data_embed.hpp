@@ -0,0 +1,36 @@
+// DO NOT EDIT THIS FILE! THIS FILE WAS GENERATED BY `dev/tools/unicode_data_generator`.
+// Unicode version: 16.0.0
+
+// General Properties data: 41'776 bytes
+
+#ifndef UNI_CPP_IMPL_UNICODE_DATA_DATA_GENERAL_PROPERTIES_DATA_EMBED_HPP
+#define UNI_CPP_IMPL_UNICODE_DATA_DATA_GENERAL_PROPERTIES_DATA_EMBED_HPP
+
+#include <cstdint>
+#include <array>
+
+#include "../../embed/parse.hpp"
+
+#include "../../embed/start_embed_code.hpp"
+
+namespace upp::impl::unicode_data::general_properties::impl
+{
+    // 8'704 bytes
+    inline constexpr std::array<std::uint16_t, 4352> stage1 = embed::parse<std::uint16_t, 8704>(std::array<std::uint8_t, 8704>{
+        #embed "data/stage1.dat"
+    });
+
+    // 32'984 bytes
+    inline constexpr std::array<std::uint8_t, 32984> stage2{
+        #embed "data/stage2.dat"
+    };
+
+    // 88 bytes
+    inline constexpr std::array<std::uint16_t, 44> stage3 = embed::parse<std::uint16_t, 88>(std::array<std::uint8_t, 88>{
+        #embed "data/stage3.dat"
+    });
+} // namespace upp::impl::unicode_data::general_properties::impl
+
+#include "../../embed/end_embed_code.hpp"
+
+#endif // UNI_CPP_IMPL_UNICODE_DATA_DATA_GENERAL_PROPERTIES_DATA_EMBED_HPP
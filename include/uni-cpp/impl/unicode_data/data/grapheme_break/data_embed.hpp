@@ -0,0 +1,36 @@
+// DO NOT EDIT THIS FILE! THIS FILE WAS GENERATED BY `dev/tools/unicode_data_generator`.
+// Unicode version: 16.0.0
+
+// Grapheme Cluster Break Properties data: 21'168 bytes
+
+#ifndef UNI_CPP_IMPL_UNICODE_DATA_DATA_GRAPHEME_BREAK_DATA_EMBED_HPP
+#define UNI_CPP_IMPL_UNICODE_DATA_DATA_GRAPHEME_BREAK_DATA_EMBED_HPP
+
+#include <cstdint>
+#include <array>
+
+#include "../../embed/parse.hpp"
+
+#include "../../embed/start_embed_code.hpp"
+
+namespace upp::impl::unicode_data::grapheme_break::impl
+{
+    // 8'704 bytes
+    inline constexpr std::array<std::uint8_t, 8704> stage1{
+        #embed "data/stage1.dat"
+    };
+
+    // 12'152 bytes
+    inline constexpr std::array<std::uint8_t, 12152> stage2{
+        #embed "data/stage2.dat"
+    };
+
+    // 312 bytes
+    inline constexpr std::array<std::uint16_t, 156> stage2_offsets = embed::parse<std::uint16_t, 312>(std::array<std::uint8_t, 312>{
+        #embed "data/stage2_offsets.dat"
+    });
+} // namespace upp::impl::unicode_data::grapheme_break::impl
+
+#include "../../embed/end_embed_code.hpp"
+
+#endif // UNI_CPP_IMPL_UNICODE_DATA_DATA_GRAPHEME_BREAK_DATA_EMBED_HPP
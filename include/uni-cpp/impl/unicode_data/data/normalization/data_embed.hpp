@@ -0,0 +1,51 @@
+// DO NOT EDIT THIS FILE! THIS FILE WAS GENERATED BY `dev/tools/unicode_data_generator`.
+// Unicode version: 16.0.0
+
+// Normalization data: 99'538 bytes
+
+#ifndef UNI_CPP_IMPL_UNICODE_DATA_DATA_NORMALIZATION_DATA_EMBED_HPP
+#define UNI_CPP_IMPL_UNICODE_DATA_DATA_NORMALIZATION_DATA_EMBED_HPP
+
+#include <cstdint>
+#include <array>
+
+#include "../../embed/parse.hpp"
+
+#include "../../embed/start_embed_code.hpp"
+
+namespace upp::impl::unicode_data::normalization::impl
+{
+    // 6'098 bytes
+    inline constexpr std::array<std::uint16_t, 3049> stage1 = embed::parse<std::uint16_t, 6098>(std::array<std::uint8_t, 6098>{
+        #embed "data/stage1.dat"
+    });
+
+    // 23'728 bytes
+    inline constexpr std::array<std::uint16_t, 11864> stage2 = embed::parse<std::uint16_t, 23728>(std::array<std::uint8_t, 23728>{
+        #embed "data/stage2.dat"
+    });
+
+    // 31'088 bytes
+    inline constexpr std::array<std::uint64_t, 3886> stage3 = embed::parse<std::uint64_t, 31088>(std::array<std::uint8_t, 31088>{
+        #embed "data/stage3.dat"
+    });
+
+    // 7'688 bytes
+    inline constexpr std::array<std::uint64_t, 961> composition_keys = embed::parse<std::uint64_t, 7688>(std::array<std::uint8_t, 7688>{
+        #embed "data/composition_keys.dat"
+    });
+
+    // 3'844 bytes
+    inline constexpr std::array<std::uint32_t, 961> composition_values = embed::parse<std::uint32_t, 3844>(std::array<std::uint8_t, 3844>{
+        #embed "data/composition_values.dat"
+    });
+
+    // 27'092 bytes
+    inline constexpr std::array<std::uint32_t, 6773> decompositions = embed::parse<std::uint32_t, 27092>(std::array<std::uint8_t, 27092>{
+        #embed "data/decompositions.dat"
+    });
+} // namespace upp::impl::unicode_data::normalization::impl
+
+#include "../../embed/end_embed_code.hpp"
+
+#endif // UNI_CPP_IMPL_UNICODE_DATA_DATA_NORMALIZATION_DATA_EMBED_HPP
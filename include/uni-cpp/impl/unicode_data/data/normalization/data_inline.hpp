@@ -0,0 +1,45 @@
+// DO NOT EDIT THIS FILE! THIS FILE WAS GENERATED BY `dev/tools/unicode_data_generator`.
+// Unicode version: 16.0.0
+
+// Normalization data: 99'538 bytes
+
+#ifndef UNI_CPP_IMPL_UNICODE_DATA_DATA_NORMALIZATION_DATA_INLINE_HPP
+#define UNI_CPP_IMPL_UNICODE_DATA_DATA_NORMALIZATION_DATA_INLINE_HPP
+
+#include <cstdint>
+#include <array>
+
+namespace upp::impl::unicode_data::normalization::impl
+{
+    // 6'098 bytes
+    inline constexpr std::array<std::uint16_t, 3049> stage1{
+        0x1B22, 0x1B22, 0x1015, 0x00, 0x40, 0x80, 0x061F, 0x2BA8, 0xC0, 0x1B22, 0x094C, 0x1BD1, 0x026D, 0x0380, 0x1114, 0x02EE, 0x05C5, 0x0E6E, 0x2102, 0x1054, 0x1B22, 0x1B22, 0x0985, 0x03BF, 0x249E, 0x2696, 0x1B22, 0x06CA, 0x0BFF, 0x02AB, 0x1B22, 0x137A, 0x07E2, 0x0428, 0x2644, 0x01B4, 0x0A15, 0x0FF5, 0x04CA, 0x15AE, 0x109B, 0x2AD9, 0x228D, 0x20BF, 0x04CA, 0x0EA6, 0x0EF6, 0x26CF, 0x228D, 0x09FE, 0x228D, 0x07A1, 0x1B27, 0x0328, 0x1B22, 0x05FF, 0x0485, 0x108E, 0x1D7E, 0x012E, 0xF4, 0x0A52, 0x0850, 0x2B65, 0x1AE7, 0x1B22, 0x2B5E, 0x0F75, 0x1B22, 0x2AF8, 0x26E7, 0x2B2B, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x0F55, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x2AB2, 0x1B22, 0x1B22, 0x06F8, 0x1B22, 0x1B22, 0x07B8, 0x1B22, 0x2B6C, 0x1B22, 0x1B22, 0x1B22, 0x2895, 0x233A, 0x0761, 0x01EA, 0x088A, 0x0908, 0x2A9C, 0x0444, 0x2292, 0x1B22, 0x1B22, 0x0650, 0x0340, 0x09C5, 0x1BF6, 0x0C3E, 0x0AD6, 0x0B16, 0x0B56, 0x0B96, 0x0C7E, 0x0CBE, 0x0CFE, 0x0D3E, 0x0D7E, 0x068A, 0x261B, 0x1145, 0x0DBE, 0x0DFE, 0x0BD0, 0x093C, 0x27D1, 0x0509, 0x0E3E, 0x24E5, 0x28AE, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x16CD, 0x11B6, 0x2408, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x0478, 0x02B7, 0x1B22, 0x0568, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x0A96, 0x1B22, 0x0F43, 0x1B22, 0x0FC3, 0x1B22, 0x2923, 0x1B22, 0x1B22, 0x24C5, 0x01F9, 0x12A4, 0x12E4, 0x1324, 0x1364, 0x14DA, 0x022D, 0x2A09, 0x162D, 0x2BFA, 0x166D, 0x16AD, 0x1B22, 0x170D, 0x174D, 0x178D, 0x17CD, 0x180D, 0x184D, 0x188D, 0x18CD, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x0585, 0x2903, 0x0EC4, 0x1B22, 0x014C, 0x1B22, 0x0716, 0x20A0, 0x1B22, 0x1B22, 0x1412, 0x0416, 0x20B9, 0x2296, 0x1B21, 0x1B22, 0x1B22, 0x1D37, 0x2324, 0x1B22, 0x28D9, 0x1B22, 0x232D, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x190D, 0x194D, 0x198D, 0x19CD, 0x1A0D, 0x1A4D, 0x1A8D, 0x1ACD, 0x1C36, 0x1C76, 0x1CB4, 0x0810, 0x1E36, 0x1E76, 0x1EB6, 0x1EF6, 0x1F36, 0x1176, 0x1F76, 0x1FB6, 0x2802, 0x214A, 0x218A, 0x21C9, 0x15ED, 0x2209, 0x2249, 0x13B8, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x2B2E, 0x1B22, 0x1B22, 0x1B22, 0x2B4B, 0x1B22, 0x20CF, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x0543, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B66, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x22CA, 0x1B22, 0x1B22, 0x2887, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1BA9, 0x20DC, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x0EC9, 0x0404, 0x1B22, 0x0750, 0x0A90, 0x1B22, 0x1B22, 0x2067, 0x2433, 0x1B22, 0x2661, 0x2296, 0x1B22, 0x04BF, 0x03CB, 0x1B22, 0x1B22, 0x146F, 0x210A, 0x1579, 0x10D8, 0x0F32, 0x1B22, 0x2307, 0x149A, 0x03FE, 0x1B22, 0x1B22, 0x2513, 0x0401, 0x1B23, 0x1B22, 0x03CA, 0x1B22, 0x232F, 0x1B22, 0x1B22, 0x1B22, 0x03C7, 0x1B22, 0x1B22, 0x1B22, 0x2755, 0x04C6, 0x1B22, 0x20AC, 0x2326, 0x20C5, 0x20B3, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B23, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B1C, 0x20B5, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B1F, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x13E7, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1544, 0x017D, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1444, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1CE6, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1D18, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x202D, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1DB9, 0x1DF6, 0x2289, 0x1B22, 0x0F70, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x23CA, 0x122C, 0x237A, 0x23BA, 0x2553, 0x11F4, 0x23DE, 0x23EA, 0x23C2, 0x23CE, 0x1264, 0x2593, 0x2599, 0x259F, 0x25A5, 0x25E5, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x295C, 0x2727, 0x2316, 0x1B22, 0x017D, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1515, 0x1BA1, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x246E, 0x1B22, 0x1B22, 0x1B22, 0x287E, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x2A85, 0x1B22, 0x1D71, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x2795, 0x08C8, 0x2842, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x299C, 0x29DC, 0x0FB2, 0x1B22, 0x2A49, 0x2BE8, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1FF3, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x1B22, 0x2C3A, 0x2C7A, 0x2CBA, 0x2CFA, 0x2D3A, 0x2D7A, 0x2DBA, 0x2DFA, 0x2E3A
+    };
+
+    // 23'728 bytes
+    inline constexpr std::array<std::uint16_t, 11864> stage2{
+        0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x00, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x00, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x00, 0x00, 0x24, 0x25, 0x26, 0x27, 0x28, 0x00, 0x00, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x00, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x00, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x00, 0x00, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x00, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x00, 0x00, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x00, 0x00, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x00, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x00, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x00, 0x00, 0x7F, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x00, 0x00, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x00, 0x00, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x00, 0x00, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF, 0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0109, 0x010A, 0x010B, 0x010C, 0x00, 0x00, 0x010D, 0x010E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x010F, 0x0110, 0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116, 0x0117, 0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01FF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0133, 0x0133, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0133, 0x00, 0x0133, 0x00, 0x0200, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01FD, 0x01FE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x089A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x0133, 0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x0131, 0x0133, 0x0133, 0x0133, 0x01B6, 0x01B7, 0x01B8, 0x0131, 0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x0133, 0x0133, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0540, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x061B, 0x00, 0x061C, 0x00, 0x061D, 0x00, 0x061E, 0x00, 0x061F, 0x00, 0x0620, 0x00, 0x0621, 0x00, 0x0622, 0x00, 0x0623, 0x00, 0x0624, 0x00, 0x0625, 0x00, 0x0626, 0x00, 0x00, 0x0627, 0x00, 0x0628, 0x00, 0x0629, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x062A, 0x062B, 0x00, 0x062C, 0x062D, 0x00, 0x062E, 0x062F, 0x00, 0x0630, 0x0631, 0x00, 0x0632, 0x0633, 0x00, 0x00, 0x0130, 0x0130, 0x0130, 0x0130, 0x0130, 0x0131, 0x0130, 0x0130, 0x0130, 0x0130, 0x0130, 0x0130, 0x0130, 0x0131, 0x0131, 0x0130, 0x0131, 0x0130, 0x0131, 0x0130, 0x0130, 0x0132, 0x0133, 0x0133, 0x0133, 0x0133, 0x0132, 0x0134, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0135, 0x0135, 0x0136, 0x0136, 0x0136, 0x0136, 0x0137, 0x0137, 0x0133, 0x0133, 0x0133, 0x0133, 0x0136, 0x0136, 0x0133, 0x0136, 0x0136, 0x0133, 0x0133, 0x0138, 0x0138, 0x0138, 0x0138, 0x0139, 0x0133, 0x0133, 0x0133, 0x0133, 0x0131, 0x0131, 0x0131, 0x0133, 0x0131, 0x0133, 0x0131, 0x0133, 0x0131, 0x0133, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x053A, 0x053B, 0x053C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0155, 0x0156, 0x0157, 0x0158, 0x0159, 0x00, 0x015A, 0x015B, 0x015C, 0x015D, 0x015E, 0x015F, 0x0160, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0161, 0x0162, 0x0163, 0x00, 0x0164, 0x0165, 0x00, 0x00, 0x00, 0x0166, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01EF, 0x01F0, 0x01F1, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0224, 0x0225, 0x0226, 0x00, 0x0227, 0x0228, 0x0229, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x00, 0x0232, 0x0233, 0x0234, 0x0235, 0x013A, 0x013B, 0x0130, 0x013C, 0x013D, 0x013E, 0x0131, 0x0133, 0x0133, 0x0133, 0x0131, 0x0131, 0x0131, 0x0133, 0x0133, 0x00, 0x0131, 0x0131, 0x0131, 0x0133, 0x0133, 0x0133, 0x0133, 0x0131, 0x0132, 0x0133, 0x0133, 0x0131, 0x013F, 0x0140, 0x0140, 0x013F, 0x0140, 0x0140, 0x013F, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x0141, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0142, 0x00, 0x00, 0x00, 0x0143, 0x00, 0x01AC, 0x01AD, 0x00, 0x0131, 0x0133, 0x00, 0x01A6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x01D1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0133, 0x0133, 0x0133, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0539, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01F7, 0x00, 0x00, 0x00, 0x00, 0x01F8, 0x01F8, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D1, 0x00, 0x01D2, 0x00, 0x04C6, 0x00, 0x00, 0x04C7, 0x00, 0x00, 0x04C8, 0x00, 0x04C9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04CA, 0x00, 0x04CB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04CC, 0x04CD, 0x04CE, 0x04CF, 0x04D0, 0x00, 0x00, 0x04D1, 0x04D2, 0x00, 0x00, 0x04D3, 0x04D4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x053D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x0167, 0x0168, 0x00, 0x0169, 0x00, 0x00, 0x00, 0x016A, 0x00, 0x00, 0x00, 0x00, 0x016B, 0x016C, 0x016D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x016E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x016F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01F2, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01F3, 0x00, 0x01F4, 0x01F5, 0x01F6, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x00, 0x0138, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0131, 0x0131, 0x0133, 0x0133, 0x0133, 0x0133, 0x0131, 0x00, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x00, 0x00, 0x00, 0x00, 0x0133, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0465, 0x0466, 0x0467, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0468, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0469, 0x0253, 0x00, 0x00, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x0470, 0x0471, 0x0472, 0x0473, 0x0474, 0x0475, 0x01C0, 0x00, 0x01C1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C2, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0131, 0x00, 0x00, 0x0131, 0x0131, 0x00, 0x0133, 0x0131, 0x0131, 0x0133, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0479, 0x0489, 0x0481, 0x00, 0x00, 0x00, 0x089B, 0x089C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0133, 0x0133, 0x0131, 0x0131, 0x0131, 0x0133, 0x0131, 0x0133, 0x0133, 0x0133, 0x0133, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0131, 0x0131, 0x0133, 0x00, 0x0133, 0x01EA, 0x00, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x01EB, 0x01EC, 0x00, 0x01ED, 0x01EE, 0x00, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x019D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x0131, 0x0131, 0x0131, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A9F, 0x0A9F, 0x0A9F, 0x0A9F, 0x0AA0, 0x0AA0, 0x0AA1, 0x0AA1, 0x0AA2, 0x0AA2, 0x01BE, 0x0AA3, 0x0AA3, 0x0AA4, 0x0AA4, 0x0AA5, 0x0AA5, 0x0AA6, 0x0AA6, 0x0AA6, 0x0AA6, 0x0AA7, 0x0AA7, 0x0AA8, 0x0AA8, 0x0AA9, 0x0AA9, 0x0AAA, 0x0AAA, 0x0AAB, 0x0AAB, 0x0AAC, 0x0AAC, 0x0AAD, 0x0AAD, 0x0AAE, 0x0AAE, 0x0AAE, 0x0AAF, 0x0AAF, 0x0AAF, 0x0AB0, 0x0AB0, 0x0AB0, 0x0AB0, 0x0208, 0x0210, 0x0131, 0x0131, 0x01C8, 0x00, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0211, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0212, 0x00, 0x00, 0x00, 0x00, 0x0213, 0x00, 0x00, 0x00, 0x00, 0x0214, 0x00, 0x00, 0x00, 0x00, 0x0215, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0216, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0219, 0x00, 0x021A, 0x00, 0x021B, 0x00, 0x021C, 0x00, 0x021D, 0x00, 0x00, 0x00, 0x021E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D1, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x021F, 0x00, 0x0220, 0x00, 0x00, 0x0BFD, 0x00, 0x00, 0x00, 0x00, 0x0BFE, 0x00, 0x0C14, 0x00, 0x0C0F, 0x00, 0x0C11, 0x0C04, 0x0C0A, 0x00, 0x0C06, 0x0C0D, 0x00, 0x0C05, 0x00, 0x00, 0x0BFF, 0x00, 0x0C07, 0x00, 0x0C0B, 0x00, 0x0A98, 0x00, 0x0CF2, 0x00, 0x0BF9, 0x0BFD, 0x00, 0x0C12, 0x00, 0x00, 0x0BFE, 0x0C08, 0x0C14, 0x0C0E, 0x00, 0x0C10, 0x0C11, 0x0C04, 0x0C0A, 0x0C0C, 0x0C06, 0x0C0D, 0x00, 0x0C05, 0x0BFB, 0x0BFC, 0x0BFF, 0x00, 0x0C07, 0x0C09, 0x0C0B, 0x0CF0, 0x00, 0x0CF1, 0x00, 0x0221, 0x0222, 0x00, 0x0223, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0133, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04BA, 0x04BB, 0x04BC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x011D, 0x011E, 0x011F, 0x0120, 0x0121, 0x0122, 0x0123, 0x0124, 0x0125, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x019B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0133, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x0131, 0x019C, 0x0133, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x019C, 0x019D, 0x0131, 0x019E, 0x019F, 0x01A0, 0x01A1, 0x01A2, 0x01A3, 0x01A4, 0x01A5, 0x01A6, 0x01A7, 0x01A7, 0x01A8, 0x01A9, 0x01AA, 0x00, 0x01AB, 0x0236, 0x0237, 0x0238, 0x03, 0x0239, 0x023A, 0x023B, 0x023C, 0x023D, 0x023E, 0x023F, 0x0240, 0x0241, 0x0242, 0x00, 0x0243, 0x0244, 0x0245, 0x0B, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x015A, 0x0250, 0x0251, 0x015F, 0x0252, 0x0253, 0x0120, 0x024B, 0x024E, 0x015A, 0x0250, 0x0162, 0x015F, 0x0252, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0254, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01E7, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01E8, 0x01E9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C5, 0x00, 0x00, 0x01C6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C7, 0x00, 0x00, 0x00, 0x0201, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0202, 0x00, 0x00, 0x00, 0x00, 0x0203, 0x00, 0x00, 0x00, 0x00, 0x0204, 0x00, 0x00, 0x00, 0x00, 0x0205, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0206, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0207, 0x0208, 0x0209, 0x020A, 0x020B, 0x020C, 0x020D, 0x020E, 0x020F, 0x0208, 0x0208, 0x0208, 0x0208, 0x00, 0x00, 0x0131, 0x0133, 0x0131, 0x0133, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x011F, 0x04A5, 0x00, 0x00, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0x028B, 0x028C, 0x028D, 0x028E, 0x028F, 0x0290, 0x0291, 0x0292, 0x0293, 0x0294, 0x0295, 0x0296, 0x0297, 0x0298, 0x0299, 0x029A, 0x029B, 0x029C, 0x029D, 0x029E, 0x029F, 0x02A0, 0x02A1, 0x02A2, 0x02A3, 0x02A4, 0x02A5, 0x02A6, 0x02A7, 0x02A8, 0x02A9, 0x02AA, 0x02AB, 0x02AC, 0x02AD, 0x02AE, 0x02AF, 0x02B0, 0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0, 0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0, 0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0, 0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0, 0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300, 0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310, 0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0x00, 0x00, 0x00, 0x00, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F, 0x0320, 0x0321, 0x0322, 0x0323, 0x0324, 0x0325, 0x0326, 0x0327, 0x0328, 0x0329, 0x032A, 0x032B, 0x032C, 0x032D, 0x032E, 0x032F, 0x0330, 0x0331, 0x0332, 0x0333, 0x0334, 0x0335, 0x0336, 0x0337, 0x0338, 0x0339, 0x033A, 0x033B, 0x033C, 0x033D, 0x033E, 0x033F, 0x0340, 0x0341, 0x0342, 0x0343, 0x0344, 0x0345, 0x0346, 0x0347, 0x0348, 0x0349, 0x034A, 0x034B, 0x034C, 0x034D, 0x034E, 0x034F, 0x0350, 0x0351, 0x0352, 0x0353, 0x0354, 0x0355, 0x0356, 0x0357, 0x0358, 0x0359, 0x035A, 0x035B, 0x035C, 0x035D, 0x035E, 0x035F, 0x0360, 0x0361, 0x0362, 0x0363, 0x0364, 0x0365, 0x0366, 0x0367, 0x0368, 0x0369, 0x036A, 0x036B, 0x036C, 0x036D, 0x036E, 0x036F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04B6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04B7, 0x04B8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04B9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0133, 0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x0133, 0x0133, 0x0133, 0x0131, 0x0133, 0x0133, 0x0131, 0x0133, 0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x0140, 0x0278, 0x0133, 0x0135, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0132, 0x019D, 0x019D, 0x0133, 0x0279, 0x0131, 0x013F, 0x0133, 0x0131, 0x0133, 0x0370, 0x0371, 0x0372, 0x0373, 0x0374, 0x0375, 0x0376, 0x0377, 0x0378, 0x0379, 0x037A, 0x037B, 0x037C, 0x037D, 0x037E, 0x037F, 0x0380, 0x0381, 0x0382, 0x0383, 0x0384, 0x0385, 0x00, 0x00, 0x0386, 0x0387, 0x0388, 0x0389, 0x038A, 0x038B, 0x00, 0x00, 0x038C, 0x038D, 0x038E, 0x038F, 0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1, 0x03A2, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF, 0x03B0, 0x03B1, 0x00, 0x00, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x00, 0x00, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x00, 0x03C0, 0x00, 0x03C1, 0x00, 0x03C2, 0x00, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0x03CF, 0x03D0, 0x03D1, 0x03D2, 0x03D3, 0x03D4, 0x03D5, 0x03D6, 0x03D7, 0x03D8, 0x03D9, 0x03DA, 0x03DB, 0x03DC, 0x03DD, 0x03DE, 0x03DF, 0x03E0, 0x03E1, 0x00, 0x00, 0x03E2, 0x03E3, 0x03E4, 0x03E5, 0x03E6, 0x03E7, 0x03E8, 0x03E9, 0x03EA, 0x03EB, 0x03EC, 0x03ED, 0x03EE, 0x03EF, 0x03F0, 0x03F1, 0x03F2, 0x03F3, 0x03F4, 0x03F5, 0x03F6, 0x03F7, 0x03F8, 0x03F9, 0x03FA, 0x03FB, 0x03FC, 0x03FD, 0x03FE, 0x03FF, 0x0400, 0x0401, 0x0402, 0x0403, 0x0404, 0x0405, 0x0406, 0x0407, 0x0408, 0x0409, 0x040A, 0x040B, 0x040C, 0x040D, 0x040E, 0x040F, 0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x00, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F, 0x041E, 0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x00, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F, 0x0430, 0x0431, 0x0432, 0x00, 0x00, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x00, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x00, 0x00, 0x044C, 0x044D, 0x044E, 0x00, 0x044F, 0x0450, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457, 0x00, 0x0458, 0x0459, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x045A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x045B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x045C, 0x045D, 0x045E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x045F, 0x0460, 0x00, 0x0461, 0x0462, 0x00, 0x00, 0x00, 0x00, 0x0463, 0x00, 0x0464, 0x00, 0x0477, 0x0478, 0x0479, 0x047A, 0x00, 0x047B, 0x047C, 0x047D, 0x00, 0x047E, 0x0242, 0x022B, 0x022B, 0x022B, 0x011D, 0x047F, 0x022C, 0x022C, 0x022F, 0x012D, 0x00, 0x0231, 0x0480, 0x00, 0x00, 0x0234, 0x0481, 0x0235, 0x0235, 0x0235, 0x00, 0x00, 0x0482, 0x0483, 0x0484, 0x00, 0x0485, 0x00, 0x0486, 0x00, 0x0485, 0x00, 0x0487, 0x0488, 0x0226, 0x0479, 0x00, 0x023E, 0x0228, 0x0489, 0x00, 0x0230, 0x0B, 0x048A, 0x048B, 0x048C, 0x048D, 0x0253, 0x00, 0x048E, 0x0160, 0x0250, 0x048F, 0x0490, 0x0491, 0x00, 0x00, 0x00, 0x00, 0x0227, 0x023D, 0x023E, 0x0253, 0x011F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0492, 0x0493, 0x0494, 0x0495, 0x0496, 0x0497, 0x0498, 0x0499, 0x049A, 0x049B, 0x049C, 0x049D, 0x049E, 0x049F, 0x04A0, 0x04A1, 0x022C, 0x04A2, 0x04A3, 0x04A4, 0x04A5, 0x04A6, 0x04A7, 0x04A8, 0x04A9, 0x04AA, 0x04AB, 0x04AC, 0x022F, 0x0479, 0x0227, 0x0230, 0x0253, 0x04AD, 0x04AE, 0x04AF, 0x024E, 0x04B0, 0x04B1, 0x04B2, 0x04B3, 0x012E, 0x04B4, 0x04B5, 0x012D, 0x0256, 0x023D, 0x0244, 0x04D5, 0x04D6, 0x00, 0x00, 0x04D7, 0x04D8, 0x00, 0x00, 0x04D9, 0x04DA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04DB, 0x04DC, 0x04DD, 0x04DE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0170, 0x0171, 0x00, 0x0172, 0x00, 0x00, 0x00, 0x0173, 0x00, 0x00, 0x00, 0x00, 0x0174, 0x0175, 0x0176, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0177, 0x0178, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01DE, 0x00, 0x00, 0x01DF, 0x01E0, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x01E1, 0x01E2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01E3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x00, 0x00, 0x0C80, 0x00, 0x0C81, 0x0C82, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x01C8, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0218, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x053E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x00, 0x00, 0x00, 0x0131, 0x0133, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x01C9, 0x01CA, 0x01CB, 0x01CC, 0x01CD, 0x01CE, 0x01CF, 0x01D0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x05, 0x06, 0x07, 0x08, 0x00, 0x00, 0x09, 0x0A, 0x0B, 0x00, 0x0C, 0x0D, 0x0E, 0x00, 0x0179, 0x017A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x017B, 0x017C, 0x017D, 0x017E, 0x00, 0x00, 0x017F, 0x0180, 0x00, 0x00, 0x0181, 0x0182, 0x0183, 0x0184, 0x0185, 0x0186, 0x00, 0x00, 0x0187, 0x0188, 0x0189, 0x018A, 0x018B, 0x018C, 0x00, 0x00, 0x018D, 0x018E, 0x018F, 0x0190, 0x0191, 0x0192, 0x0193, 0x0194, 0x0195, 0x0196, 0x0197, 0x0198, 0x00, 0x00, 0x0199, 0x019A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01F9, 0x01F9, 0x01F9, 0x01F9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D8, 0x00, 0x00, 0x01D9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D1, 0x00, 0x00, 0x00, 0x0C7C, 0x00, 0x0C7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C7E, 0x00, 0x00, 0x0C7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x00, 0x00, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0144, 0x0145, 0x0146, 0x0147, 0x0148, 0x0149, 0x00, 0x014A, 0x00, 0x014B, 0x014C, 0x014D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x014E, 0x014F, 0x0150, 0x0151, 0x0152, 0x0153, 0x0154, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0138, 0x0138, 0x0131, 0x0131, 0x0131, 0x0131, 0x0138, 0x0138, 0x0138, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x00, 0x00, 0x00, 0x0138, 0x0138, 0x0131, 0x0133, 0x0131, 0x0138, 0x0138, 0x0133, 0x0133, 0x0133, 0x0133, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B53, 0x0B54, 0x0B54, 0x0B55, 0x0B56, 0x0B57, 0x0B58, 0x0B59, 0x0B5A, 0x0B5A, 0x0B5B, 0x0B5C, 0x0B5D, 0x0B5E, 0x0B5F, 0x0B60, 0x0B60, 0x0B61, 0x0B62, 0x0B62, 0x0B63, 0x0B63, 0x0B64, 0x0B65, 0x0B65, 0x0B66, 0x0B67, 0x0B67, 0x0B68, 0x0B68, 0x0B69, 0x0B6A, 0x0B6A, 0x0B6B, 0x0B6B, 0x0B6C, 0x0B6D, 0x0B6E, 0x0B6F, 0x0B6F, 0x0B70, 0x0B71, 0x0B72, 0x0B73, 0x0B74, 0x0B74, 0x0B75, 0x0B76, 0x0500, 0x0501, 0x0502, 0x0503, 0x0504, 0x0505, 0x0506, 0x0507, 0x0508, 0x0509, 0x050A, 0x050B, 0x050C, 0x050D, 0x050E, 0x050F, 0x0510, 0x0511, 0x0512, 0x0513, 0x0514, 0x0515, 0x0516, 0x0517, 0x0518, 0x0519, 0x051A, 0x051B, 0x051C, 0x051D, 0x051E, 0x051F, 0x0520, 0x0521, 0x0522, 0x0523, 0x0524, 0x0525, 0x0526, 0x0527, 0x0528, 0x0529, 0x052A, 0x052B, 0x052C, 0x052D, 0x052E, 0x052F, 0x0530, 0x0531, 0x0532, 0x0533, 0x0534, 0x0535, 0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x00, 0x0232, 0x00, 0x00, 0x00, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x00, 0x03, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475, 0x0B, 0x0249, 0x0538, 0x0120, 0xB5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274, 0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0235, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x03, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x00, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475, 0x0B, 0x0249, 0x0538, 0x0120, 0xB5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274, 0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0235, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x03, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475, 0x0B, 0x0249, 0x0538, 0x0120, 0xB5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274, 0x0CA3, 0x0CA4, 0x00, 0x00, 0x0CA5, 0x0CA6, 0x048F, 0x0CA7, 0x0CA8, 0x0CA9, 0x0CAA, 0x0164, 0x0CAB, 0x0CAC, 0x0CAD, 0x0CAE, 0x0CAF, 0x0CB0, 0x0CB1, 0x0490, 0x0CB2, 0x0164, 0x0166, 0x0CB3, 0x015C, 0x0CB4, 0x0CB5, 0x0CB6, 0x0541, 0x0542, 0x0543, 0x0544, 0x0545, 0x0546, 0x0547, 0x0548, 0x0549, 0x054A, 0x054B, 0x054C, 0x054D, 0x054E, 0x054F, 0x0550, 0x0551, 0x0552, 0x0553, 0x0554, 0x0555, 0x0556, 0x0557, 0x0558, 0x0559, 0x055A, 0x055B, 0x055C, 0x055D, 0x055E, 0x055F, 0x0560, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567, 0x0568, 0x0569, 0x056A, 0x056B, 0x056C, 0x056D, 0x056E, 0x056F, 0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577, 0x0578, 0x0579, 0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F, 0x0580, 0x0581, 0x0582, 0x0583, 0x0584, 0x0585, 0x0586, 0x0587, 0x0588, 0x0589, 0x058A, 0x058B, 0x058C, 0x058D, 0x058E, 0x058F, 0x0590, 0x0591, 0x0592, 0x0593, 0x0594, 0x0595, 0x0596, 0x0597, 0x0598, 0x0599, 0x059A, 0x059B, 0x059C, 0x059D, 0x059E, 0x059F, 0x05A0, 0x05A1, 0x05A2, 0x05A3, 0x05A4, 0x05A5, 0x05A6, 0x05A7, 0x05A8, 0x05A9, 0x05AA, 0x05AB, 0x05AC, 0x05AD, 0x05AE, 0x05AF, 0x05B0, 0x05B1, 0x05B2, 0x05B3, 0x05B4, 0x05B5, 0x05B6, 0x05B7, 0x05B8, 0x05B9, 0x05BA, 0x05BB, 0x05BC, 0x05BD, 0x05BE, 0x05BF, 0x05C0, 0x05C1, 0x05C2, 0x05C3, 0x05C4, 0x05C5, 0x05C6, 0x05C7, 0x05C8, 0x05C9, 0x05CA, 0x05CB, 0x05CC, 0x05CD, 0x05CE, 0x05CF, 0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7, 0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF, 0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7, 0x05E8, 0x05E9, 0x05EA, 0x05EB, 0x05EC, 0x05ED, 0x05EE, 0x05EF, 0x05F0, 0x05F1, 0x05F2, 0x05F3, 0x05F4, 0x05F5, 0x05F6, 0x05F7, 0x05F8, 0x05F9, 0x05FA, 0x05FB, 0x05FC, 0x05FD, 0x05FE, 0x05FF, 0x0600, 0x0601, 0x0602, 0x0603, 0x0604, 0x0605, 0x0606, 0x0607, 0x0608, 0x0609, 0x060A, 0x060B, 0x060C, 0x060D, 0x060E, 0x060F, 0x0610, 0x0611, 0x0612, 0x0613, 0x0614, 0x0615, 0x0616, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0133, 0x00, 0x00, 0x0678, 0x0679, 0x067A, 0x067B, 0x067C, 0x067D, 0x00, 0x00, 0x067E, 0x067F, 0x0680, 0x0681, 0x0682, 0x0683, 0x00, 0x00, 0x0684, 0x0685, 0x0686, 0x0687, 0x0688, 0x0689, 0x00, 0x00, 0x068A, 0x068B, 0x068C, 0x00, 0x00, 0x00, 0x0C30, 0x0C31, 0x0C32, 0x04, 0x0C33, 0x0C34, 0x0C35, 0x00, 0x0C36, 0x0C37, 0x0C38, 0x0C39, 0x0C3A, 0x0C3B, 0x0C3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x01D2, 0x01D2, 0x0C89, 0x0C8A, 0x0C8B, 0x0C8C, 0x0C8D, 0x0C8E, 0x0C8F, 0x0C90, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x0C91, 0x0C92, 0x0C93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D1, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x0C83, 0x0C84, 0x01D2, 0x0C85, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0279, 0x019D, 0x0132, 0x019C, 0x0617, 0x0617, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0618, 0x00, 0x0558, 0x0619, 0x061A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C7A, 0x0C7B, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D3, 0x01D4, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x01D5, 0x01D6, 0x00, 0x01D7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x00, 0x0BC3, 0x0C19, 0x0BDA, 0x0BE1, 0x0BE2, 0x0BDB, 0x0C1A, 0x0473, 0x0474, 0x0BDC, 0x0470, 0x0BBE, 0x0BDD, 0x045C, 0x0C1B, 0x0469, 0x0A, 0x05, 0x06, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x0BC1, 0x0BC2, 0x0BDE, 0x0472, 0x0BDF, 0x0BC4, 0x0BE3, 0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0235, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x0BD8, 0x0BE0, 0x0BD9, 0x0C1C, 0x0BC9, 0x0644, 0x00, 0x0645, 0x00, 0x00, 0x0646, 0x00, 0x0647, 0x00, 0x0648, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0649, 0x064A, 0x00, 0x064B, 0x064C, 0x00, 0x064D, 0x064E, 0x00, 0x064F, 0x0650, 0x00, 0x0651, 0x0652, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0653, 0x00, 0x00, 0x0654, 0x0655, 0x0656, 0x0657, 0x00, 0x00, 0x00, 0x0658, 0x0659, 0x0669, 0x066A, 0x066B, 0x066C, 0x066D, 0x066E, 0x066F, 0x0670, 0x0671, 0x0672, 0x0673, 0x0674, 0x0675, 0x0676, 0x0677, 0x0678, 0x0679, 0x067A, 0x067B, 0x067C, 0x067D, 0x067E, 0x067F, 0x0680, 0x0681, 0x0682, 0x0683, 0x0684, 0x0685, 0x0686, 0x0687, 0x0688, 0x0689, 0x068A, 0x068B, 0x068C, 0x068D, 0x068E, 0x068F, 0x0690, 0x0691, 0x0692, 0x0693, 0x0694, 0x0695, 0x0696, 0x0697, 0x0698, 0x0699, 0x069A, 0x069B, 0x069C, 0x069D, 0x069E, 0x069F, 0x06A0, 0x06A1, 0x06A2, 0x06A3, 0x06A4, 0x06A5, 0x06A6, 0x06A7, 0x06A8, 0x06A9, 0x06AA, 0x06AB, 0x06AC, 0x06AD, 0x06AE, 0x06AF, 0x06B0, 0x06B1, 0x06B2, 0x06B3, 0x06B4, 0x06B5, 0x06B6, 0x06B7, 0x00, 0x00, 0x00, 0x0541, 0x0547, 0x06B8, 0x06B9, 0x06BA, 0x06BB, 0x06BC, 0x06BD, 0x0545, 0x06BE, 0x06BF, 0x06C0, 0x06C1, 0x0549, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x05, 0x06, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x04E9, 0x04EA, 0x04EB, 0x04EC, 0x04ED, 0x04EE, 0x04EF, 0x04F0, 0x04F1, 0x04F2, 0x04F3, 0x04F4, 0x04F5, 0x04F6, 0x04F7, 0x04F8, 0x04F9, 0x04FA, 0x04FB, 0x04FC, 0x04FD, 0x04FE, 0x04FF, 0x06C2, 0x06C3, 0x06C4, 0x06C5, 0x06C6, 0x06C7, 0x06C8, 0x06C9, 0x06CA, 0x06CB, 0x06CC, 0x06CD, 0x06CE, 0x06CF, 0x06D0, 0x06D1, 0x06D2, 0x06D3, 0x06D4, 0x06D5, 0x06D6, 0x06D7, 0x06D8, 0x06D9, 0x06DA, 0x06DB, 0x06DC, 0x06DD, 0x06DE, 0x06DF, 0x06E0, 0x00, 0x06E1, 0x06E2, 0x06E3, 0x06E4, 0x06E5, 0x06E6, 0x06E7, 0x06E8, 0x06E9, 0x06EA, 0x06EB, 0x06EC, 0x06ED, 0x06EE, 0x06EF, 0x06F0, 0x06F1, 0x06F2, 0x06F3, 0x06F4, 0x06F5, 0x06F6, 0x06F7, 0x06F8, 0x06F9, 0x06FA, 0x06FB, 0x06FC, 0x06FD, 0x06FE, 0x06FF, 0x0700, 0x0701, 0x0702, 0x0703, 0x0704, 0x0705, 0x0706, 0x0583, 0x0707, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0708, 0x0709, 0x070A, 0x070B, 0x070C, 0x070D, 0x070E, 0x070F, 0x0710, 0x0711, 0x0712, 0x0713, 0x0714, 0x0715, 0x0716, 0x0717, 0x065A, 0x065D, 0x0660, 0x0662, 0x066A, 0x066B, 0x066E, 0x0670, 0x0671, 0x0673, 0x0674, 0x0675, 0x0676, 0x0677, 0x0718, 0x0719, 0x071A, 0x071B, 0x071C, 0x071D, 0x071E, 0x071F, 0x0720, 0x0721, 0x0722, 0x0723, 0x0724, 0x0725, 0x0726, 0x0727, 0x0728, 0x00, 0x0541, 0x0547, 0x06B8, 0x06B9, 0x0729, 0x072A, 0x072B, 0x054C, 0x072C, 0x0558, 0x058A, 0x0596, 0x0595, 0x058B, 0x05E7, 0x0560, 0x0588, 0x072D, 0x072E, 0x072F, 0x0730, 0x0731, 0x0732, 0x0733, 0x0734, 0x0735, 0x0736, 0x0566, 0x0737, 0x0738, 0x0739, 0x073A, 0x073B, 0x073C, 0x073D, 0x073E, 0x06BA, 0x06BB, 0x06BC, 0x073F, 0x0740, 0x0741, 0x0742, 0x0743, 0x0744, 0x0745, 0x0746, 0x0747, 0x0748, 0x0749, 0x074A, 0x074B, 0x074C, 0x074D, 0x074E, 0x074F, 0x0750, 0x0751, 0x0752, 0x0753, 0x0754, 0x0755, 0x0756, 0x0757, 0x0758, 0x0759, 0x075A, 0x075B, 0x075C, 0x075D, 0x075E, 0x075F, 0x0760, 0x0761, 0x0762, 0x0763, 0x0764, 0x0765, 0x0766, 0x0767, 0x0768, 0x0769, 0x076A, 0x076B, 0x076C, 0x076D, 0x076E, 0x076F, 0x0770, 0x0771, 0x0772, 0x0773, 0x0774, 0x0775, 0x0776, 0x0777, 0x0778, 0x0779, 0x077A, 0x077B, 0x077C, 0x077D, 0x077E, 0x077F, 0x0780, 0x0781, 0x0782, 0x0783, 0x0784, 0x0785, 0x0786, 0x0787, 0x0788, 0x0789, 0x078A, 0x078B, 0x078C, 0x078D, 0x078E, 0x078F, 0x0790, 0x0791, 0x0792, 0x0793, 0x0794, 0x0795, 0x0796, 0x0797, 0x0798, 0x0799, 0x079A, 0x079B, 0x079C, 0x079D, 0x079E, 0x079F, 0x07A0, 0x07A1, 0x07A2, 0x07A3, 0x07A4, 0x07A5, 0x07A6, 0x07A7, 0x07A8, 0x07A9, 0x07AA, 0x07AB, 0x07AC, 0x07AD, 0x07AE, 0x07AF, 0x07B0, 0x07B1, 0x07B2, 0x07B3, 0x07B4, 0x07B5, 0x07B6, 0x07B7, 0x07B8, 0x07B9, 0x07BA, 0x07BB, 0x07BC, 0x07BD, 0x07BE, 0x07BF, 0x07C0, 0x07C1, 0x07C2, 0x07C3, 0x07C4, 0x07C5, 0x07C6, 0x07C7, 0x07C8, 0x07C9, 0x07CA, 0x07CB, 0x07CC, 0x07CD, 0x07CE, 0x07CF, 0x07D0, 0x07D1, 0x07D2, 0x07D3, 0x07D4, 0x07D5, 0x07D6, 0x07D7, 0x07D8, 0x07D9, 0x07DA, 0x07DB, 0x07DC, 0x07DD, 0x07DE, 0x07DF, 0x07E0, 0x07E1, 0x07E2, 0x07E3, 0x07E4, 0x07E5, 0x07E6, 0x07E7, 0x07E8, 0x07E9, 0x07EA, 0x07EB, 0x07EC, 0x07ED, 0x07EE, 0x07EF, 0x07F0, 0x07F1, 0x07F2, 0x07F3, 0x07F4, 0x07F5, 0x07F6, 0x07F7, 0x07F8, 0x07F9, 0x07FA, 0x07FB, 0x07FC, 0x07FD, 0x07FE, 0x07FF, 0x0800, 0x0801, 0x0802, 0x0803, 0x0804, 0x0805, 0x0806, 0x0807, 0x0808, 0x0809, 0x080A, 0x080B, 0x080C, 0x080D, 0x080E, 0x080F, 0x0810, 0x0811, 0x0812, 0x0813, 0x0814, 0x0815, 0x0816, 0x0817, 0x0818, 0x0819, 0x081A, 0x081B, 0x081C, 0x081D, 0x081E, 0x081F, 0x0820, 0x0821, 0x0822, 0x0823, 0x0824, 0x0825, 0x0826, 0x0827, 0x0828, 0x0829, 0x082A, 0x082B, 0x082C, 0x082D, 0x082E, 0x082F, 0x0830, 0x0831, 0x0832, 0x0833, 0x0834, 0x0835, 0x0836, 0x0837, 0x0838, 0x0839, 0x083A, 0x083B, 0x083C, 0x083D, 0x083E, 0x083F, 0x0840, 0x0841, 0x0842, 0x0843, 0x0844, 0x0845, 0x0846, 0x0847, 0x0848, 0x0849, 0x084A, 0x084B, 0x084C, 0x084D, 0x084E, 0x084F, 0x0850, 0x0851, 0x0852, 0x0853, 0x0854, 0x0855, 0x0856, 0x0857, 0x0858, 0x0859, 0x085A, 0x085B, 0x085C, 0x085D, 0x085E, 0x085F, 0x0860, 0x0861, 0x0862, 0x0863, 0x0864, 0x0865, 0x0866, 0x0867, 0x0868, 0x0869, 0x086A, 0x086B, 0x086C, 0x086D, 0x086E, 0x086F, 0x0870, 0x0871, 0x0872, 0x0873, 0x0874, 0x0875, 0x0876, 0x0877, 0x0878, 0x0879, 0x087A, 0x087B, 0x087C, 0x087D, 0x087E, 0x087F, 0x0880, 0x0881, 0x0882, 0x0883, 0x0884, 0x0885, 0x0886, 0x0887, 0x0888, 0x0889, 0x088A, 0x088B, 0x088C, 0x088D, 0x088E, 0x088F, 0x0890, 0x0891, 0x0892, 0x0893, 0x0894, 0x0895, 0x0896, 0x0897, 0x08A2, 0x08A3, 0x08A4, 0x08A5, 0x08A6, 0x08A7, 0x08A8, 0x08A9, 0x08A9, 0x08AA, 0x08AB, 0x08AC, 0x08AD, 0x08AE, 0x08AF, 0x08B0, 0x08B1, 0x08B2, 0x08B3, 0x08B4, 0x08B5, 0x08B6, 0x08B7, 0x08B8, 0x08B9, 0x08BA, 0x08BB, 0x08BC, 0x08BD, 0x08BE, 0x08BF, 0x08C0, 0x08C1, 0x08C2, 0x08C3, 0x08C4, 0x08C5, 0x08C6, 0x08C7, 0x08C8, 0x08C9, 0x08CA, 0x08CB, 0x08CC, 0x08CD, 0x08CE, 0x08CF, 0x08D0, 0x08D1, 0x08D2, 0x08D3, 0x08D4, 0x08D5, 0x08D6, 0x08D7, 0x08D8, 0x08D9, 0x08DA, 0x08DB, 0x08DC, 0x08DD, 0x08DE, 0x08DF, 0x08E0, 0x08E1, 0x08E2, 0x08E3, 0x08E4, 0x08E5, 0x08E6, 0x08E7, 0x08E8, 0x08E9, 0x08EA, 0x08EB, 0x08EC, 0x08ED, 0x08EE, 0x08EF, 0x08F0, 0x08F1, 0x08F2, 0x08F3, 0x08F4, 0x08F5, 0x08F6, 0x08F7, 0x08F8, 0x08F9, 0x08FA, 0x08FB, 0x08FC, 0x08B5, 0x08FD, 0x08FE, 0x08FF, 0x0900, 0x0901, 0x0902, 0x0903, 0x0904, 0x0905, 0x0906, 0x0907, 0x0908, 0x0909, 0x090A, 0x090B, 0x090C, 0x090D, 0x090E, 0x090F, 0x0910, 0x0911, 0x0912, 0x0913, 0x0914, 0x0915, 0x0916, 0x0917, 0x0918, 0x0919, 0x091A, 0x091B, 0x091C, 0x091D, 0x091E, 0x091F, 0x0920, 0x0921, 0x0922, 0x0923, 0x0924, 0x0925, 0x0926, 0x0927, 0x0928, 0x0929, 0x092A, 0x092B, 0x092C, 0x092D, 0x092E, 0x092F, 0x0930, 0x0931, 0x0932, 0x0933, 0x0934, 0x0935, 0x0936, 0x0937, 0x0938, 0x0939, 0x093A, 0x093B, 0x093C, 0x093D, 0x093E, 0x093F, 0x0940, 0x090F, 0x0941, 0x0942, 0x0943, 0x0944, 0x0945, 0x0946, 0x0947, 0x0948, 0x08FF, 0x0949, 0x094A, 0x094B, 0x094C, 0x094D, 0x094E, 0x094F, 0x0950, 0x0951, 0x0952, 0x0953, 0x0954, 0x0955, 0x0956, 0x0957, 0x0958, 0x0959, 0x095A, 0x095B, 0x095C, 0x08B5, 0x095D, 0x095E, 0x095F, 0x0960, 0x0961, 0x0962, 0x0963, 0x0964, 0x0965, 0x0966, 0x0967, 0x0968, 0x0969, 0x096A, 0x096B, 0x096C, 0x096D, 0x096E, 0x096F, 0x0970, 0x0971, 0x0972, 0x0973, 0x0974, 0x0975, 0x0976, 0x0977, 0x0901, 0x0978, 0x0979, 0x097A, 0x097B, 0x097C, 0x097D, 0x097E, 0x097F, 0x0980, 0x0981, 0x0982, 0x0983, 0x0984, 0x0985, 0x0986, 0x0987, 0x0988, 0x0989, 0x098A, 0x098B, 0x098C, 0x098D, 0x098E, 0x098F, 0x0990, 0x0991, 0x0992, 0x0993, 0x0994, 0x0995, 0x0996, 0x0997, 0x0998, 0x0999, 0x099A, 0x099B, 0x099C, 0x099D, 0x099E, 0x099F, 0x09A0, 0x09A1, 0x09A2, 0x09A3, 0x09A4, 0x09A5, 0x09A6, 0x09A7, 0x09A8, 0x09A9, 0x00, 0x00, 0x09AA, 0x00, 0x09AB, 0x00, 0x00, 0x09AC, 0x09AD, 0x09AE, 0x09AF, 0x09B0, 0x09B1, 0x09B2, 0x09B3, 0x09B4, 0x09B5, 0x00, 0x09B6, 0x00, 0x09B7, 0x00, 0x00, 0x09B8, 0x09B9, 0x00, 0x00, 0x00, 0x09BA, 0x09BB, 0x09BC, 0x09BD, 0x09BE, 0x09BF, 0x09C0, 0x09C1, 0x09C2, 0x09C3, 0x09C4, 0x09C5, 0x09C6, 0x09C7, 0x09C8, 0x09C9, 0x09CA, 0x09CB, 0x09CC, 0x09CD, 0x09CE, 0x09CF, 0x09D0, 0x09D1, 0x09D2, 0x09D3, 0x09D4, 0x09D5, 0x09D6, 0x09D7, 0x09D8, 0x09D9, 0x09DA, 0x09DB, 0x09DC, 0x09DD, 0x09DE, 0x09DF, 0x09E0, 0x09E1, 0x09E2, 0x09E3, 0x09E4, 0x09E5, 0x09E6, 0x0936, 0x09E7, 0x09E8, 0x09E9, 0x09EA, 0x09EB, 0x09EC, 0x09EC, 0x09ED, 0x09EE, 0x09EF, 0x09F0, 0x09F1, 0x09F2, 0x09F3, 0x09F4, 0x09B8, 0x09F5, 0x09F6, 0x09F7, 0x09F8, 0x09F9, 0x09FA, 0x00, 0x00, 0x09FB, 0x09FC, 0x09FD, 0x09FE, 0x09FF, 0x0A00, 0x0A01, 0x0A02, 0x09C6, 0x0A03, 0x0A04, 0x0A05, 0x09AA, 0x0A06, 0x0A07, 0x0A08, 0x0A09, 0x0A0A, 0x0A0B, 0x0A0C, 0x0A0D, 0x0A0E, 0x0A0F, 0x0A10, 0x0A11, 0x09CF, 0x0A12, 0x09D0, 0x0A13, 0x0A14, 0x0A15, 0x0A16, 0x0A17, 0x09AB, 0x08CA, 0x0A18, 0x0A19, 0x0A1A, 0x0910, 0x0967, 0x0A1B, 0x0A1C, 0x09D7, 0x0A1D, 0x09D8, 0x0A1E, 0x0A1F, 0x0A20, 0x09AD, 0x0A21, 0x0A22, 0x0A23, 0x0A24, 0x0A25, 0x09AE, 0x0A26, 0x0A27, 0x0A28, 0x0A29, 0x0A2A, 0x0A2B, 0x09E6, 0x0A2C, 0x0A2D, 0x0936, 0x0A2E, 0x09EA, 0x0A2F, 0x0A30, 0x0A31, 0x0A32, 0x0A33, 0x09EF, 0x0A34, 0x09B7, 0x0A35, 0x09F0, 0x08FD, 0x0A36, 0x09F1, 0x0A37, 0x09F3, 0x0A38, 0x0A39, 0x0A3A, 0x0A3B, 0x0A3C, 0x09F5, 0x09B3, 0x0A3D, 0x09F6, 0x0A3E, 0x09F7, 0x0A3F, 0x08A9, 0x0A40, 0x0A41, 0x0A42, 0x0A43, 0x0A44, 0x0A45, 0x0A46, 0x0A47, 0x0A48, 0x0A49, 0x0A4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0217, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D1, 0x00, 0x01C8, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x01C8, 0x00, 0x01D2, 0x00, 0x0C3F, 0x0C40, 0x0C41, 0x0C42, 0x0C43, 0x00, 0x0C44, 0x0C45, 0x0C46, 0x0C47, 0x0C48, 0x0C49, 0x0C4A, 0x0C4B, 0x0C4C, 0x0C4D, 0x0C4E, 0x0C4F, 0x0C50, 0x0C51, 0x047F, 0x0C52, 0x0C53, 0x0C54, 0x0C55, 0x0C56, 0x0C57, 0x0C58, 0x0C59, 0x0C5A, 0x0C5B, 0x0C5C, 0x0C5D, 0x0C5E, 0x0C5F, 0x0C60, 0x0538, 0x0C61, 0x0C62, 0x0C63, 0x0C64, 0x0C65, 0x0C66, 0x0C67, 0x0C68, 0x0C69, 0x0C6A, 0x0C6B, 0x00, 0x0C6C, 0x0C6D, 0x0C6E, 0x0C6F, 0x0C70, 0x0C71, 0x0C72, 0x0C73, 0x0C74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0126, 0x0127, 0x0128, 0x0129, 0x012A, 0x012B, 0x00, 0x00, 0x012C, 0x012D, 0xB5, 0x012E, 0x012F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0255, 0x0256, 0x0257, 0x0258, 0x0241, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x015B, 0x0A4B, 0x0A4C, 0x0A4D, 0x0A4E, 0x0A4F, 0x0A50, 0x0A50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A51, 0x0A52, 0x0A53, 0x0A54, 0x0A55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A56, 0x0A57, 0x0A58, 0x0A59, 0x048A, 0x048D, 0x0A5A, 0x0A5B, 0x0A5C, 0x0A5D, 0x0A5E, 0x0A5F, 0x0470, 0x0A60, 0x0A61, 0x0A62, 0x0A63, 0x0A64, 0x0A65, 0x0A66, 0x0A67, 0x0A68, 0x0A69, 0x0A6A, 0x0A6B, 0x0A6C, 0x00, 0x0A6D, 0x0A6E, 0x0A6F, 0x0A70, 0x0A71, 0x00, 0x0A72, 0x00, 0x0A73, 0x0A74, 0x00, 0x0A75, 0x0A76, 0x00, 0x0A77, 0x0A78, 0x0A79, 0x0A7A, 0x0A7B, 0x0A7C, 0x0A7D, 0x0A7E, 0x0A7F, 0x0A80, 0x0A81, 0x0A81, 0x0A82, 0x0A82, 0x0A82, 0x0A82, 0x0A83, 0x0A83, 0x0A83, 0x0A83, 0x0A84, 0x0A84, 0x0A84, 0x0A84, 0x0A85, 0x0A85, 0x0A85, 0x0A85, 0x0A86, 0x0A86, 0x0A86, 0x0A86, 0x0A87, 0x0A87, 0x0A87, 0x0A87, 0x0A88, 0x0A88, 0x0A88, 0x0A88, 0x0A89, 0x0A89, 0x0A89, 0x0A89, 0x0A8A, 0x0A8A, 0x0A8A, 0x0A8A, 0x0A8B, 0x0A8B, 0x0A8B, 0x0A8B, 0x0A8C, 0x0A8C, 0x0A8C, 0x0A8C, 0x0A8D, 0x0A8D, 0x0A8E, 0x0A8E, 0x0A8F, 0x0A8F, 0x0A90, 0x0A90, 0x0A91, 0x0A91, 0x0A92, 0x0A92, 0x0A93, 0x0A93, 0x0A94, 0x0A94, 0x0A94, 0x0A94, 0x0A95, 0x0A95, 0x0A95, 0x0A95, 0x0A96, 0x0A96, 0x0A96, 0x0A96, 0x0A97, 0x0A97, 0x0A97, 0x0A97, 0x0A98, 0x0A98, 0x0A99, 0x0A99, 0x0A99, 0x0A99, 0x0A9A, 0x0A9A, 0x0A9B, 0x0A9B, 0x0A9B, 0x0A9B, 0x0A9C, 0x0A9C, 0x0A9C, 0x0A9C, 0x0A9D, 0x0A9D, 0x0A9E, 0x0A9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C94, 0x0C94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0138, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x00, 0x0131, 0x0131, 0x0133, 0x00, 0x00, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x01D1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01FA, 0x00, 0x00, 0x00, 0x00, 0x01FB, 0x01FB, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C95, 0x0C96, 0x0C97, 0x0C98, 0x0C99, 0x0C9A, 0x0C9B, 0x0200, 0x0200, 0x0138, 0x0138, 0x0138, 0x00, 0x00, 0x00, 0x0C9C, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0133, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C9D, 0x0C9E, 0x0C9F, 0x0CA0, 0x0CA1, 0x0AB1, 0x0AB2, 0x0AB3, 0x0AAF, 0x0AB4, 0x0AB5, 0x0AB6, 0x0AB7, 0x0AB8, 0x0AB9, 0x0ABA, 0x0ABB, 0x0ABC, 0x0ABD, 0x0ABE, 0x0ABF, 0x0AC0, 0x0AC1, 0x0AC2, 0x0AC3, 0x0AC4, 0x0AC5, 0x0AC6, 0x0AC7, 0x0AC8, 0x0AC9, 0x0ACA, 0x0ACB, 0x0ACC, 0x0ACD, 0x0ACE, 0x0ACF, 0x0AD0, 0x0AD1, 0x0AD2, 0x0AD3, 0x0AD4, 0x0AD5, 0x0AD6, 0x0AD7, 0x0AD8, 0x0AD9, 0x0ADA, 0x0ADB, 0x0ADC, 0x0ADD, 0x0ADE, 0x0ADF, 0x0AE0, 0x0AE1, 0x0AE2, 0x0AE3, 0x0AE4, 0x0AE5, 0x0AE6, 0x0AE7, 0x0AE8, 0x0AE9, 0x0AEA, 0x0AEB, 0x0AEC, 0x0AED, 0x0AEE, 0x0AEF, 0x0AF0, 0x0AF1, 0x0AF2, 0x0AF3, 0x0AF4, 0x0AF5, 0x0AF6, 0x0AF7, 0x0AF8, 0x0AF9, 0x0AFA, 0x0AFB, 0x0AFC, 0x0AFD, 0x0AFE, 0x0AFF, 0x0B00, 0x0B01, 0x0B02, 0x0B03, 0x0B04, 0x0B05, 0x0B06, 0x0B07, 0x0B08, 0x0B09, 0x0B0A, 0x0B0B, 0x0B0C, 0x0B0D, 0x0B0E, 0x0B0F, 0x0B10, 0x0B11, 0x0B12, 0x0B13, 0x0B14, 0x0B15, 0x0AB3, 0x0B16, 0x0AAF, 0x0AB4, 0x0B17, 0x0B18, 0x0AB8, 0x0B19, 0x0AB9, 0x0ABA, 0x0B1A, 0x0B1B, 0x0ABE, 0x0B1C, 0x0ABF, 0x0AC0, 0x0B1D, 0x0B1E, 0x0AC2, 0x0B1F, 0x0AC3, 0x0AC4, 0x0AE1, 0x0AE2, 0x0AE5, 0x0AE6, 0x0AE7, 0x0AEB, 0x0AEC, 0x0AED, 0x0AEE, 0x0AF2, 0x0AF3, 0x0AF4, 0x0B20, 0x0AF8, 0x0B21, 0x0B22, 0x0AFE, 0x0B23, 0x0AFF, 0x0B00, 0x0B0D, 0x0B24, 0x0B25, 0x0B08, 0x0B26, 0x0B09, 0x0B0A, 0x0AB1, 0x0AB2, 0x0B27, 0x0AB3, 0x0B28, 0x0AB5, 0x0AB6, 0x0AB7, 0x0AB8, 0x0B29, 0x0ABB, 0x0ABC, 0x0ABD, 0x0ABE, 0x0B2A, 0x0AC2, 0x0AC5, 0x0AC6, 0x0AC7, 0x0AC8, 0x0AC9, 0x0ACB, 0x0ACC, 0x0ACD, 0x0ACE, 0x0ACF, 0x0AD0, 0x0B2B, 0x0AD1, 0x0AD2, 0x0AD3, 0x0AD4, 0x0AD5, 0x0AD6, 0x0AD8, 0x0AD9, 0x0ADA, 0x0ADB, 0x0ADC, 0x0ADD, 0x0ADE, 0x0ADF, 0x0AE0, 0x0AE3, 0x0AE4, 0x0AE8, 0x0AE9, 0x0AEA, 0x0AEB, 0x0AEC, 0x0AEF, 0x0AF0, 0x0AF1, 0x0AF2, 0x0B2C, 0x0AF5, 0x0AF6, 0x0AF7, 0x0AF8, 0x0AFB, 0x0AFC, 0x0AFD, 0x0AFE, 0x0B2D, 0x0B01, 0x0B02, 0x0B2E, 0x0B05, 0x0B06, 0x0B07, 0x0B08, 0x0B2F, 0x0AB3, 0x0B28, 0x0AB8, 0x0B29, 0x0ABE, 0x0B2A, 0x0AC2, 0x0B30, 0x0ACF, 0x0B31, 0x0B32, 0x0B33, 0x0AEB, 0x0AEC, 0x0AF2, 0x0AFE, 0x0B2D, 0x0B08, 0x0B2F, 0x0B34, 0x0B35, 0x0B36, 0x0B37, 0x0B38, 0x0B39, 0x0B3A, 0x0B3B, 0x0B3C, 0x0B3D, 0x0B3E, 0x0B3F, 0x0B40, 0x0B41, 0x0B42, 0x0B43, 0x0B44, 0x0B45, 0x0B46, 0x0B47, 0x0B48, 0x0B49, 0x0B4A, 0x0B4B, 0x0B4C, 0x0B4D, 0x0B32, 0x0B4E, 0x0B4F, 0x0B50, 0x0B51, 0x0B37, 0x0B38, 0x0B39, 0x0B3A, 0x0B3B, 0x0B3C, 0x0B3D, 0x0B3E, 0x0B3F, 0x0B40, 0x0B41, 0x0B42, 0x0B43, 0x0B44, 0x0B45, 0x0B46, 0x0B47, 0x0B48, 0x0B49, 0x0B4A, 0x0B4B, 0x0B4C, 0x0B4D, 0x0B32, 0x0B4E, 0x0B4F, 0x0B50, 0x0B51, 0x0B4B, 0x0B4C, 0x0B4D, 0x0B32, 0x0B31, 0x0B33, 0x0AD7, 0x0ACC, 0x0ACD, 0x0ACE, 0x0B4B, 0x0B4C, 0x0B4D, 0x0AD7, 0x0AD8, 0x0B52, 0x0B52, 0x00, 0x00, 0x0B77, 0x0B78, 0x0B79, 0x0B7A, 0x0B7A, 0x0B7B, 0x0B7B, 0x0B7C, 0x0B7C, 0x0B7D, 0x0B7E, 0x0B7F, 0x0B80, 0x0B81, 0x0B82, 0x0B83, 0x00, 0x00, 0x0B84, 0x0B85, 0x0B86, 0x0B87, 0x0B88, 0x0B89, 0x0B89, 0x0B8A, 0x0B8B, 0x0B8C, 0x0B8D, 0x0B8D, 0x0B8E, 0x0B8F, 0x0B90, 0x0B91, 0x0B92, 0x0B93, 0x0B94, 0x0B95, 0x0B96, 0x0B97, 0x0B98, 0x0B99, 0x0B9A, 0x0B9B, 0x0B9C, 0x0B9D, 0x0B9E, 0x0B9F, 0x0BA0, 0x0BA1, 0x0BA2, 0x0BA3, 0x0B75, 0x0B77, 0x0BA4, 0x0BA5, 0x0BA6, 0x0BA7, 0x0BA8, 0x0BA9, 0x0BA8, 0x0BA6, 0x0BAA, 0x0BAB, 0x0BAC, 0x0BAD, 0x0BAE, 0x0BA9, 0x0B6E, 0x0B64, 0x0BAF, 0x0BB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0BB1, 0x0BB2, 0x0BB3, 0x0BB4, 0x0BB5, 0x0BB6, 0x0BB7, 0x0BB8, 0x0BB9, 0x0BBA, 0x0BBB, 0x0BBC, 0x0BBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0469, 0x0A, 0x05, 0x06, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0235, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x0469, 0x0A, 0x05, 0x06, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D1, 0x01D1, 0x00, 0x01D2, 0x00, 0x0BD3, 0x0BD4, 0x0BD5, 0x0BD6, 0x0BD7, 0x00, 0x00, 0x0BD8, 0x0BD9, 0x0464, 0x0464, 0x0464, 0x0464, 0x0BC9, 0x0BC9, 0x0BC9, 0x0BBE, 0x0BBF, 0x045C, 0x00, 0x0BC2, 0x0BC1, 0x0BC4, 0x0BC3, 0x0BC7, 0x0473, 0x0474, 0x0BCA, 0x0BCB, 0x0BCC, 0x0BCD, 0x0BDA, 0x0BDB, 0x0BDC, 0x0470, 0x0BDD, 0x0BDE, 0x0BDF, 0x0472, 0x00, 0x0BE0, 0x0BE1, 0x0BE2, 0x0BE3, 0x00, 0x00, 0x00, 0x00, 0x0BE4, 0x0BE5, 0x0BE6, 0x00, 0x0BE7, 0x00, 0x0BE8, 0x0BE9, 0x0BEA, 0x0BEB, 0x0BEC, 0x0BED, 0x0BEE, 0x0BEF, 0x0BF0, 0x0BF1, 0x0BF2, 0x0BF3, 0x0BF3, 0x0BF4, 0x0BF4, 0x0BF5, 0x0BF5, 0x0BF6, 0x0BF6, 0x0BF7, 0x0BF7, 0x0BF7, 0x0BF7, 0x0BF8, 0x0BF8, 0x0BF9, 0x0BF9, 0x0BF9, 0x0BF9, 0x0BFA, 0x0BFA, 0x0BFB, 0x0BFB, 0x0BFB, 0x0BFB, 0x0BFC, 0x0BFC, 0x0BFC, 0x0BFC, 0x0BFD, 0x0BFD, 0x0BFD, 0x0BFD, 0x0BFE, 0x0BFE, 0x0BFE, 0x0BFE, 0x0BFF, 0x0BFF, 0x0BFF, 0x0BFF, 0x0C00, 0x0C00, 0x0C01, 0x0C01, 0x0C02, 0x0C02, 0x0C03, 0x0C03, 0x0C04, 0x0C04, 0x0C04, 0x0C04, 0x0C05, 0x0C05, 0x0C05, 0x0C05, 0x0C06, 0x0C06, 0x0C06, 0x0C06, 0x0C07, 0x0C07, 0x0C07, 0x0C08, 0x0C08, 0x0C08, 0x0C08, 0x0C09, 0x0C09, 0x0C09, 0x0C09, 0x0C0A, 0x0C0A, 0x0C0A, 0x0C0A, 0x0C0B, 0x0C0B, 0x0C0B, 0x0C0B, 0x0C0C, 0x0C0C, 0x0C0C, 0x0C0C, 0x0C0D, 0x0C0D, 0x0C0D, 0x0C0D, 0x0C0E, 0x0C0E, 0x0C0E, 0x0C0E, 0x0C0F, 0x0C0F, 0x0C0F, 0x0C0F, 0x0C10, 0x0C10, 0x0C10, 0x0C10, 0x0C11, 0x0C11, 0x0C11, 0x0C11, 0x0C12, 0x0C12, 0x0C12, 0x0C12, 0x0C13, 0x0C13, 0x0AA7, 0x0AA7, 0x0C14, 0x0C14, 0x0C14, 0x0C14, 0x0C15, 0x0C15, 0x0C16, 0x0C16, 0x0C17, 0x0C17, 0x0C18, 0x0C18, 0x00, 0x00, 0x00, 0x0C1D, 0x03, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475, 0x0B, 0x0249, 0x0538, 0x0120, 0xB5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274, 0x0BCA, 0x0C1E, 0x0BCB, 0x0C1F, 0x0C20, 0x0C21, 0x0BC0, 0x0BD4, 0x0BD5, 0x0BBF, 0x0C22, 0x0796, 0x0C23, 0x0C24, 0x0C25, 0x0C26, 0x0C27, 0x0C28, 0x0C29, 0x0C2A, 0x0C2B, 0x0C2C, 0x0768, 0x0769, 0x076A, 0x076B, 0x076C, 0x076D, 0x076E, 0x076F, 0x0770, 0x0771, 0x0772, 0x0773, 0x0774, 0x0775, 0x0776, 0x0777, 0x0778, 0x0779, 0x077A, 0x077B, 0x077C, 0x077D, 0x077E, 0x077F, 0x0780, 0x0781, 0x0782, 0x0783, 0x0784, 0x0785, 0x0786, 0x0787, 0x0788, 0x0789, 0x078A, 0x078B, 0x078C, 0x078D, 0x078E, 0x078F, 0x0790, 0x0791, 0x0792, 0x0793, 0x0C2D, 0x0C2E, 0x0C2F, 0x068D, 0x065A, 0x065B, 0x065C, 0x065D, 0x065E, 0x065F, 0x0660, 0x0661, 0x0662, 0x0663, 0x0664, 0x0665, 0x0666, 0x0667, 0x0668, 0x0669, 0x066A, 0x066B, 0x066C, 0x066D, 0x066E, 0x066F, 0x0670, 0x0671, 0x0672, 0x0673, 0x0674, 0x0675, 0x0676, 0x0677, 0x00, 0x0CA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0133, 0x00, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0138, 0x0133, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x00, 0x00, 0x00, 0x01D1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x0133, 0x0537, 0x0485, 0x03, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475, 0x0B, 0x0249, 0x0538, 0x0120, 0xB5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274, 0x0224, 0x00, 0x0479, 0x0227, 0x00, 0x00, 0x022A, 0x00, 0x00, 0x022D, 0x022E, 0x00, 0x00, 0x0231, 0x0232, 0x0234, 0x0481, 0x00, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x03, 0x023C, 0x0256, 0x023D, 0x00, 0x0259, 0x00, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475, 0x00, 0x0249, 0x0538, 0x0120, 0xB5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274, 0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0235, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x03, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475, 0x0B, 0x0249, 0x0538, 0x0120, 0xB5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274, 0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0235, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x03, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475, 0x0B, 0x0249, 0x0538, 0x0120, 0xB5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274, 0x0469, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C75, 0x00, 0x0C76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x01C7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0132, 0x0132, 0x0133, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x01AE, 0x01AF, 0x01B0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01B1, 0x01B2, 0x01B3, 0x01B4, 0x01B5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x053F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04DF, 0x04E0, 0x04E1, 0x04E2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04E3, 0x04E4, 0x04E5, 0x04E6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C86, 0x0C87, 0x00, 0x00, 0x00, 0x01C8, 0x0124, 0x012E, 0x0125, 0x0274, 0x0224, 0x0226, 0x00, 0x0227, 0x0228, 0x0489, 0x022A, 0x00, 0x00, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x00, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x00, 0x03, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475, 0x0B, 0x0249, 0x0538, 0x0120, 0xB5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274, 0x0224, 0x0226, 0x00, 0x0227, 0x0228, 0x0489, 0x022A, 0x00, 0x0CB7, 0x0CB8, 0x0CB9, 0x015A, 0x0250, 0x0251, 0x0165, 0x0CBA, 0x0CBB, 0x015B, 0x0CBC, 0x0161, 0x0CBD, 0x08, 0x0CBE, 0x0CBF, 0x0CC0, 0x0160, 0x0162, 0x0163, 0x0CC1, 0x0CC2, 0x0CC3, 0x015F, 0x0252, 0x0CC4, 0x0CC5, 0x0CC6, 0x0165, 0x015B, 0x0161, 0x015F, 0x0162, 0x0160, 0x0CA5, 0x0CA6, 0x048F, 0x0CA7, 0x0CA8, 0x0CA9, 0x0CAA, 0x0164, 0x0CAB, 0x0CAC, 0x0CAD, 0x0CAE, 0x0CAF, 0x0CB0, 0x0CB1, 0x0490, 0x0CB2, 0x0164, 0x0166, 0x0CB3, 0x015C, 0x0CB4, 0x0CB5, 0x0CB6, 0x0CB7, 0x0CB8, 0x0CB9, 0x015A, 0x0250, 0x0251, 0x0165, 0x0CBA, 0x0CBB, 0x015B, 0x0CBC, 0x0161, 0x0CBD, 0x08, 0x0CBE, 0x0CBF, 0x0CC0, 0x0160, 0x0162, 0x0163, 0x0CC1, 0x0CC2, 0x0CC3, 0x015F, 0x0252, 0x0CC4, 0x0CC5, 0x0CC6, 0x0165, 0x015B, 0x0161, 0x015F, 0x0162, 0x0160, 0x0CC7, 0x0CC8, 0x00, 0x00, 0x0469, 0x0A, 0x05, 0x06, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x0469, 0x0A, 0x05, 0x06, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x0469, 0x0A, 0x05, 0x06, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x0469, 0x0A, 0x05, 0x06, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x0469, 0x0A, 0x05, 0x06, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x0470, 0x0471, 0x0472, 0x0473, 0x0474, 0x00, 0x03, 0x023E, 0x0B, 0x012E, 0x023F, 0x011D, 0x0243, 0x012D, 0x0244, 0x0475, 0x0249, 0xB5, 0x024A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0476, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0133, 0x0133, 0x0133, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C78, 0x0C79, 0x00, 0x00, 0x00, 0x01C8, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01B6, 0x01B7, 0x01B8, 0x01AE, 0x01AF, 0x01B0, 0x01B9, 0x01BA, 0x0130, 0x0130, 0x0136, 0x0133, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x0133, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01BB, 0x00, 0x00, 0x00, 0x00, 0x01BC, 0x01BD, 0x01BE, 0x01BF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01E4, 0x01E5, 0x01E6, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x0CD9, 0x0CDA, 0x0CDB, 0x0CDC, 0x0CDD, 0x0CDE, 0x0CDF, 0x0CE0, 0x0CE1, 0x0CE2, 0x0CE3, 0x0CE4, 0x0CE5, 0x0CE6, 0x0CE7, 0x0CE8, 0x0CE9, 0x0CC9, 0x0CCA, 0x0CCB, 0x0CCC, 0x0CCD, 0x0CCE, 0x0CCF, 0x0CD0, 0x0CD1, 0x0CD2, 0x0CD3, 0x0CD5, 0x0CD6, 0x0CD8, 0x0CDA, 0x0CDB, 0x0CDC, 0x0CDD, 0x0CDE, 0x0CDF, 0x0898, 0x0CE0, 0x0CEA, 0x0CE5, 0x0CEB, 0x0CEC, 0x0CED, 0x0CEE, 0x0CEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C88, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x01C8, 0x00, 0x0BF8, 0x0BF9, 0x0BFD, 0x0C00, 0x00, 0x0C13, 0x0C03, 0x0BFE, 0x0C08, 0x0C14, 0x0C0E, 0x0C0F, 0x0C10, 0x0C11, 0x0C04, 0x0C0A, 0x0C0C, 0x0C06, 0x0C0D, 0x0C02, 0x0C05, 0x0BFB, 0x0BFC, 0x0BFF, 0x0C01, 0x0C07, 0x0C09, 0x0C0B, 0x0CF0, 0x0A98, 0x0CF1, 0x0CF2, 0x00, 0x0BF9, 0x0BFD, 0x00, 0x0C12, 0x00, 0x00, 0x0BFE, 0x00, 0x0C14, 0x0C0E, 0x0C0F, 0x0C10, 0x0C11, 0x0C04, 0x0C0A, 0x0C0C, 0x0C06, 0x0C0D, 0x00, 0x0C05, 0x0BFB, 0x0BFC, 0x0BFF, 0x00, 0x0C07, 0x00, 0x0C0B, 0x00, 0x00, 0x00, 0x00, 0x04BD, 0x00, 0x00, 0x00, 0x00, 0x04BE, 0x00, 0x00, 0x04BF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04C0, 0x00, 0x04C1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04C2, 0x04C3, 0x00, 0x04C4, 0x04C5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0BBE, 0x0BBF, 0x0BC0, 0x0BC1, 0x0BC2, 0x0BC3, 0x0BC4, 0x0BC5, 0x0BC6, 0x045E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0131, 0x0131, 0x045D, 0x0BC7, 0x0BC8, 0x0BC9, 0x0BC9, 0x0473, 0x0474, 0x0BCA, 0x0BCB, 0x0BCC, 0x0BCD, 0x0BCE, 0x0BCF, 0x0BD0, 0x0BD1, 0x0BD2, 0x0BF8, 0x0BF9, 0x0BFD, 0x0C00, 0x0C12, 0x0C13, 0x0C03, 0x0BFE, 0x0C08, 0x0C14, 0x00, 0x0C0F, 0x0C10, 0x0C11, 0x0C04, 0x0C0A, 0x0C0C, 0x0C06, 0x0C0D, 0x0C02, 0x0C05, 0x0BFB, 0x0BFC, 0x0BFF, 0x0C01, 0x0C07, 0x0C09, 0x0C0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0BF9, 0x0BFD, 0x0C00, 0x00, 0x0C13, 0x0C03, 0x0BFE, 0x0C08, 0x0C14, 0x00, 0x0C0F, 0x0C10, 0x0C11, 0x0C04, 0x0C0A, 0x0C0C, 0x0C06, 0x0C0D, 0x0C02, 0x0C05, 0x0BFB, 0x0BFC, 0x0BFF, 0x0C01, 0x0C07, 0x0C09, 0x0C0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0133, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04E7, 0x04E8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x089D, 0x089E, 0x089F, 0x08A0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08A1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0898, 0x0899, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x0131, 0x0131, 0x00, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0CC9, 0x0CCA, 0x0CCB, 0x0CCC, 0x0CCD, 0x0CCE, 0x0CCF, 0x0CD0, 0x0CD1, 0x0CD2, 0x0CD3, 0x0CD4, 0x0CD5, 0x0CD6, 0x0CD7, 0x0CD8, 0x0CF3, 0x0CF4, 0x0CF5, 0x0CF6, 0x0CF7, 0x0CF8, 0x0CF9, 0x0CFA, 0x0CFB, 0x0CFC, 0x0CFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0CFE, 0x0CFF, 0x0D00, 0x0D01, 0x0D02, 0x0D03, 0x0D04, 0x0D05, 0x0D06, 0x0D07, 0x0D08, 0x0D09, 0x0D0A, 0x0D0B, 0x0D0C, 0x0D0D, 0x0D0E, 0x0D0F, 0x0D10, 0x0D11, 0x0D12, 0x0D13, 0x0D14, 0x0D15, 0x0D16, 0x0D17, 0x0D18, 0x0479, 0x0235, 0x0D19, 0x0D1A, 0x00, 0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0235, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x0D1B, 0x0851, 0x0D1C, 0x0D1D, 0x0D1E, 0x0D1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D20, 0x0D21, 0x0D22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0634, 0x00, 0x00, 0x00, 0x00, 0x0635, 0x0635, 0x0636, 0x0637, 0x00, 0x0638, 0x0639, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x063A, 0x00, 0x063B, 0x00, 0x063C, 0x00, 0x063D, 0x00, 0x063E, 0x00, 0x063F, 0x00, 0x0640, 0x00, 0x0641, 0x00, 0x0642, 0x00, 0x0643, 0x00, 0x0D24, 0x0D25, 0x0772, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0580, 0x0D26, 0x0D27, 0x0D28, 0x0547, 0x0D29, 0x0D2A, 0x06C0, 0x0D2B, 0x0D2C, 0x0D2D, 0x0D2E, 0x0D2F, 0x0D30, 0x0D31, 0x0D32, 0x0D33, 0x0D34, 0x05A4, 0x0D35, 0x0D36, 0x0D37, 0x0D38, 0x0D39, 0x0D3A, 0x0541, 0x06B8, 0x0D3B, 0x073F, 0x06BB, 0x0740, 0x0D3C, 0x05DC, 0x0D3D, 0x0D3E, 0x0D3F, 0x0D40, 0x0D41, 0x072E, 0x058A, 0x0D42, 0x0D43, 0x0D44, 0x0D45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01C8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01DA, 0x01DB, 0x01DC, 0x00, 0x00, 0x01DD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0133, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x019C, 0x0131, 0x0133, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0x00, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0x00, 0x00, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF, 0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0x00, 0x00, 0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0x0D46, 0x0D47, 0x0D48, 0x0D49, 0x0D4A, 0x0D4B, 0x0D4C, 0x0D4D, 0x0D4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D4F, 0x0D50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x065A, 0x065B, 0x065C, 0x065D, 0x065E, 0x065F, 0x0660, 0x0661, 0x0662, 0x0663, 0x0664, 0x0665, 0x0666, 0x0667, 0x0668, 0x0D51, 0x0D52, 0x0D53, 0x0D54, 0x0D55, 0x09C0, 0x0D56, 0x0D57, 0x0D58, 0x0D59, 0x09C1, 0x0D5A, 0x0D5B, 0x0D5C, 0x09C2, 0x0D5D, 0x0D5E, 0x0D5F, 0x0D60, 0x0D61, 0x0D62, 0x0D63, 0x0D64, 0x0D65, 0x0D66, 0x0D67, 0x0D68, 0x09FC, 0x0D69, 0x0D6A, 0x0D6B, 0x0D6C, 0x0D6D, 0x0D6E, 0x0D6F, 0x0D70, 0x0D71, 0x0A01, 0x09C3, 0x09C4, 0x0A02, 0x0D72, 0x0D73, 0x0903, 0x0D74, 0x09C5, 0x0D75, 0x0D76, 0x0D77, 0x0D78, 0x0D78, 0x0D78, 0x0D79, 0x0D7A, 0x0D7B, 0x0D7C, 0x0D7D, 0x0D7E, 0x0D7F, 0x0D80, 0x0D81, 0x0D82, 0x0D83, 0x0D84, 0x0D85, 0x0D86, 0x0D87, 0x0D88, 0x0D89, 0x0D8A, 0x0D8A, 0x0A04, 0x0D8B, 0x0D8C, 0x0D8D, 0x0D8E, 0x09C7, 0x0D8F, 0x0D90, 0x0D91, 0x099C, 0x0D92, 0x0D93, 0x0D94, 0x0D95, 0x0D96, 0x0D97, 0x0D98, 0x0D99, 0x0D9A, 0x0D9B, 0x0D9C, 0x0D9D, 0x0D9E, 0x0D9F, 0x0DA0, 0x0DA1, 0x0DA2, 0x0DA3, 0x0DA4, 0x0DA5, 0x0DA6, 0x0DA7, 0x0DA8, 0x0DA9, 0x0DAA, 0x0DAB, 0x0DAB, 0x0DAC, 0x0DAD, 0x0DAE, 0x08FF, 0x0DAF, 0x0DB0, 0x0DB1, 0x0DB2, 0x0DB3, 0x0DB4, 0x0DB5, 0x0DB6, 0x09CC, 0x0DB7, 0x0DB8, 0x0DB9, 0x0DBA, 0x0DBB, 0x0DBC, 0x0DBD, 0x0DBE, 0x0DBF, 0x0DC0, 0x0DC1, 0x0DC2, 0x0DC3, 0x0DC4, 0x0DC5, 0x0DC6, 0x0DC7, 0x0DC8, 0x0DC9, 0x0DCA, 0x0DCB, 0x08C9, 0x0DCC, 0x0DCD, 0x0DCE, 0x0DCE, 0x0DCF, 0x0DD0, 0x0DD0, 0x0DD1, 0x0DD2, 0x0DD3, 0x0DD4, 0x0DD5, 0x0DD6, 0x0DD7, 0x0DD8, 0x0DD9, 0x0DDA, 0x0DDB, 0x0DDC, 0x0DDD, 0x09CD, 0x0DDE, 0x0DDF, 0x0DE0, 0x0DE1, 0x0A10, 0x0DE1, 0x0DE2, 0x09CF, 0x0DE3, 0x0DE4, 0x0DE5, 0x0DE6, 0x09D0, 0x08AE, 0x0DE7, 0x0DE8, 0x0DE9, 0x0DEA, 0x0DEB, 0x0DEC, 0x0DED, 0x0DEE, 0x0DEF, 0x0DF0, 0x0DF1, 0x0DF2, 0x0DF3, 0x0DF4, 0x0DF5, 0x0DF6, 0x0DF7, 0x0DF8, 0x0DF9, 0x0DFA, 0x0DFB, 0x0DFC, 0x09D1, 0x0DFD, 0x0DFE, 0x0DFF, 0x0E00, 0x0E01, 0x0E02, 0x09D3, 0x0E03, 0x0E04, 0x0E05, 0x0E06, 0x0E07, 0x0E08, 0x0E09, 0x0E0A, 0x08CA, 0x0A18, 0x0E0B, 0x0E0C, 0x0E0D, 0x0E0E, 0x0E0F, 0x0E10, 0x0E11, 0x0E12, 0x09D4, 0x0E13, 0x0E14, 0x0E15, 0x0E16, 0x0A43, 0x0E17, 0x0E18, 0x0E19, 0x0E1A, 0x0E1B, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F, 0x0E20, 0x0E21, 0x0E22, 0x0E23, 0x0910, 0x0E24, 0x0E25, 0x0E26, 0x0E27, 0x0E28, 0x0E29, 0x0E2A, 0x0E2B, 0x0E2C, 0x0E2D, 0x0E2E, 0x09D5, 0x0967, 0x0E2F, 0x0E30, 0x0E31, 0x0E32, 0x0E33, 0x0E34, 0x0E35, 0x0E36, 0x0A1C, 0x0E37, 0x0E38, 0x0E39, 0x0E3A, 0x0E3B, 0x0E3C, 0x0E3D, 0x0E3E, 0x0A1D, 0x0E3F, 0x0E40, 0x0E41, 0x0E42, 0x0E43, 0x0E44, 0x0E45, 0x0E46, 0x0E47, 0x0E48, 0x0E49, 0x0E4A, 0x0A1F, 0x0E4B, 0x0E4C, 0x0E4D, 0x0E4E, 0x0E4F, 0x0E50, 0x0E51, 0x0E52, 0x0E53, 0x0E54, 0x0E55, 0x0E55, 0x0E56, 0x0E57, 0x0A21, 0x0E58, 0x0E59, 0x0E5A, 0x0E5B, 0x0E5C, 0x0E5D, 0x0E5E, 0x0902, 0x0E5F, 0x0E60, 0x0E61, 0x0E62, 0x0E63, 0x0E64, 0x0E65, 0x0A27, 0x0E66, 0x0E67, 0x0E68, 0x0E69, 0x0E6A, 0x0E6B, 0x0E6B, 0x0A28, 0x0A45, 0x0E6C, 0x0E6D, 0x0E6E, 0x0E6F, 0x0E70, 0x08DC, 0x0A2A, 0x0E71, 0x0E72, 0x09E0, 0x0E73, 0x0E74, 0x09B2, 0x0E75, 0x0E76, 0x09E4, 0x0E77, 0x0E78, 0x0E79, 0x0E7A, 0x0E7A, 0x0E7B, 0x0E7C, 0x0E7D, 0x0E7E, 0x0E7F, 0x0E80, 0x0E81, 0x0E82, 0x0E83, 0x0E84, 0x0E85, 0x0E86, 0x0E87, 0x0E88, 0x0E89, 0x0E8A, 0x0E8B, 0x0E8C, 0x0E8D, 0x0E8E, 0x0E8F, 0x0E90, 0x0E91, 0x0E92, 0x0E93, 0x0E94, 0x0E95, 0x09EA, 0x0E96, 0x0E97, 0x0E98, 0x0E99, 0x0E9A, 0x0E9B, 0x0E9C, 0x0E9D, 0x0E9E, 0x0E9F, 0x0EA0, 0x0EA1, 0x0EA2, 0x0EA3, 0x0EA4, 0x0EA5, 0x0DCF, 0x0EA6, 0x0EA7, 0x0EA8, 0x0EA9, 0x0EAA, 0x0EAB, 0x0EAC, 0x0EAD, 0x0EAE, 0x0EAF, 0x0EB0, 0x0EB1, 0x0914, 0x0EB2, 0x0EB3, 0x0EB4, 0x0EB5, 0x0EB6, 0x0EB7, 0x09ED, 0x0EB8, 0x0EB9, 0x0EBA, 0x0EBB, 0x0EBC, 0x0EBD, 0x0EBE, 0x0EBF, 0x0EC0, 0x0EC1, 0x0EC2, 0x0EC3, 0x0EC4, 0x0EC5, 0x0EC6, 0x0EC7, 0x0EC8, 0x0EC9, 0x0ECA, 0x0ECB, 0x08D7, 0x0ECC, 0x0ECD, 0x0ECE, 0x0ECF, 0x0ED0, 0x0ED1, 0x0A31, 0x0ED2, 0x0ED3, 0x0ED4, 0x0ED5, 0x0ED6, 0x0ED7, 0x0ED8, 0x0ED9, 0x0EDA, 0x0EDB, 0x0EDC, 0x0EDD, 0x0EDE, 0x0EDF, 0x0EE0, 0x0EE1, 0x0EE2, 0x0EE3, 0x0EE4, 0x0EE5, 0x0A36, 0x0A37, 0x0EE6, 0x0EE7, 0x0EE8, 0x0EE9, 0x0EEA, 0x0EEB, 0x0EEC, 0x0EED, 0x0EEE, 0x0EEF, 0x0EF0, 0x0EF1, 0x0EF2, 0x0A38, 0x0EF3, 0x0EF4, 0x0EF5, 0x0EF6, 0x0EF7, 0x0EF8, 0x0EF9, 0x0EFA, 0x0EFB, 0x0EFC, 0x0EFD, 0x0EFE, 0x0EFF, 0x0F00, 0x0F01, 0x0F02, 0x0F03, 0x0F04, 0x0F05, 0x0F06, 0x0F07, 0x0F08, 0x0F09, 0x0F0A, 0x0F0B, 0x0F0C, 0x0F0D, 0x0F0E, 0x0F0F, 0x0F10, 0x0A3E, 0x0A3E, 0x0F11, 0x0F12, 0x0F13, 0x0F14, 0x0F15, 0x0F16, 0x0F17, 0x0F18, 0x0F19, 0x0F1A, 0x0A3F, 0x0F1B, 0x0F1C, 0x0F1D, 0x0F1E, 0x0F1F, 0x0F20, 0x0F21, 0x0F22, 0x0F23, 0x0F24, 0x0F25, 0x0F26, 0x0F27, 0x0F28, 0x0F29, 0x0F2A, 0x0F2B, 0x0F2C, 0x0F2D
+    };
+
+    // 31'088 bytes
+    inline constexpr std::array<std::uint64_t, 3886> stage3{
+        0x00, 0x8800, 0x00210800, 0x00608800, 0x00810800, 0x00C08800, 0x00E08800, 0x01010800, 0x01408800, 0x01610800, 0x01A08800, 0x01C08800, 0x01E18800, 0x02418800, 0x02A18800, 0x03112000, 0x03512000, 0x03912000, 0x03D12000, 0x04112000, 0x04512000, 0x04912000, 0x04D12000, 0x05112000, 0x05512000, 0x05912000, 0x05D12000, 0x06112000, 0x06512000, 0x06912000, 0x06D12000, 0x07112000, 0x07512000, 0x07912000, 0x07D12000, 0x08112000, 0x08512000, 0x08912000, 0x08D12000, 0x09112000, 0x09512000, 0x09912000, 0x09D12000, 0x0A112000, 0x0A512000, 0x0A912000, 0x0AD12000, 0x0B112000, 0x0B512000, 0x0B912000, 0x0BD12000, 0x0C112000, 0x0C512000, 0x0C912000, 0x0CD12000, 0x0D112000, 0x0D512000, 0x0D912000, 0x0DD12000, 0x0E112000, 0x0E512000, 0x0E912000, 0x0ED12000, 0x0F112000, 0x0F512000, 0x0F912000, 0x0FD12000, 0x10112000, 0x10512000, 0x10912000, 0x10D12000, 0x11112000, 0x11512000, 0x11912000, 0x11D12000, 0x12112000, 0x12512000, 0x12912000, 0x12D12000, 0x13112000, 0x13512000, 0x13912000, 0x13D12000, 0x14112000, 0x14512000, 0x14912000, 0x14D12000, 0x15112000, 0x15512000, 0x15912000, 0x15D12000, 0x16112000, 0x16512000, 0x16912000, 0x16D12000, 0x17112000, 0x17512000, 0x17912000, 0x17D12000, 0x18112000, 0x18512000, 0x18912000, 0x18D12000, 0x19112000, 0x19512000, 0x19912000, 0x19D12000, 0x1A112000, 0x1A512000, 0x1A912000, 0x1AD12000, 0x1B112000, 0x1B512000, 0x1B810800, 0x1BC10800, 0x1C112000, 0x1C512000, 0x1C912000, 0x1CD12000, 0x1D112000, 0x1D512000, 0x1D912000, 0x1DD12000, 0x1E112000, 0x1E512000, 0x1E810800, 0x1EC10800, 0x1F112000, 0x1F512000, 0x1F912000, 0x1FD12000, 0x20112000, 0x20512000, 0x20810800, 0x20D12000, 0x21112000, 0x21512000, 0x21912000, 0x21D12000, 0x22112000, 0x22512000, 0x22912000, 0x22D12000, 0x23112000, 0x23512000, 0x23912000, 0x23D12000, 0x24112000, 0x24512000, 0x24912000, 0x24D12000, 0x25112000, 0x25512000, 0x25912000, 0x25D12000, 0x26112000, 0x26512000, 0x26912000, 0x26D12000, 0x27112000, 0x27512000, 0x27912000, 0x27D12000, 0x28112000, 0x28512000, 0x28912000, 0x28D12000, 0x29112000, 0x29512000, 0x29912000, 0x29D12000, 0x2A112000, 0x2A512000, 0x2A912000, 0x2AD12000, 0x2B112000, 0x2B512000, 0x2B912000, 0x2BD12000, 0x2C112000, 0x2C512000, 0x2C808800, 0x2CB12000, 0x2CF12000, 0x2D312000, 0x2D712000, 0x2DA18800, 0x2E018800, 0x2E618800, 0x2EC10800, 0x2F010800, 0x2F410800, 0x2F810800, 0x2FC10800, 0x30010800, 0x30512000, 0x30912000, 0x30D12000, 0x31112000, 0x31512000, 0x31912000, 0x31D12000, 0x32112000, 0x3251B000, 0x32B1B000, 0x3311B000, 0x3371B000, 0x33D1B000, 0x3431B000, 0x3491B000, 0x34F1B000, 0x3551B000, 0x35B1B000, 0x3611B000, 0x3671B000, 0x36D12000, 0x37112000, 0x37512000, 0x37912000, 0x37D12000, 0x38112000, 0x38512000, 0x38912000, 0x38D1B000, 0x3931B000, 0x39912000, 0x39D12000, 0x3A112000, 0x3A410800, 0x3A810800, 0x3AC10800, 0x3B112000, 0x3B512000, 0x3B912000, 0x3BD12000, 0x3C11B000, 0x3C71B000, 0x3CD12000, 0x3D112000, 0x3D512000, 0x3D912000, 0x3DD12000, 0x3E112000, 0x3E512000, 0x3E912000, 0x3ED12000, 0x3F112000, 0x3F512000, 0x3F912000, 0x3FD12000, 0x40112000, 0x40512000, 0x40912000, 0x40D12000, 0x41112000, 0x41512000, 0x41912000, 0x41D12000, 0x42112000, 0x42512000, 0x42912000, 0x42D12000, 0x43112000, 0x43512000, 0x43912000, 0x43D12000, 0x44112000, 0x44512000, 0x44912000, 0x44D12000, 0x45112000, 0x45512000, 0x45912000, 0x45D12000, 0x46112000, 0x4651B000, 0x46B1B000, 0x4711B000, 0x4771B000, 0x47D12000, 0x48112000, 0x4851B000, 0x48B1B000, 0x49112000, 0x49512000, 0x49808800, 0x49A08800, 0x49C08800, 0x49E08800, 0x4A008800, 0x4A208800, 0x4A408800, 0x4A608800, 0x4A808800, 0x4AA10800, 0x4AE10800, 0x4B210800, 0x4B610800, 0x4BA10800, 0x4BE10800, 0x4C208800, 0x4C408800, 0x4C608800, 0x4C808800, 0x05E6, 0xE6, 0xE8, 0xDC, 0x05D8, 0xCA, 0x05DC, 0x05CA, 0x01, 0x0501, 0x4CB09AE6, 0x4CD09AE6, 0x4CF09AE6, 0x4D112AE6, 0x05F0, 0xE9, 0xEA, 0x4D509A00, 0x4D610800, 0x4DB09A00, 0x4DC1A800, 0x4E712000, 0x4EB09A00, 0x4ED12000, 0x4F112000, 0x4F512000, 0x4F912000, 0x4FD12000, 0x50112000, 0x5051B000, 0x50B12000, 0x50F12000, 0x51312000, 0x51712000, 0x51B12000, 0x51F12000, 0x5231B000, 0x52912000, 0x52D12000, 0x53112000, 0x53512000, 0x53912000, 0x53C08800, 0x53E08800, 0x54008800, 0x54212800, 0x54A12800, 0x55208800, 0x55408800, 0x55608800, 0x55808800, 0x55A08800, 0x55C08800, 0x55E08800, 0x56008800, 0x56312000, 0x56712000, 0x56B12000, 0x56F12000, 0x57312000, 0x57712000, 0x57B12000, 0x57F12000, 0x58312000, 0x58712000, 0x58B12000, 0x58F12000, 0x59312000, 0x59712000, 0x59B12000, 0x59F12000, 0x5A312000, 0x5A712000, 0x5AB12000, 0x5AF12000, 0x5B312000, 0x5B712000, 0x5BB12000, 0x5BF12000, 0x5C312000, 0x5C712000, 0x5CB12000, 0x5CF12000, 0x5D312000, 0x5D712000, 0x5DB12000, 0x5DF12000, 0x5E312000, 0x5E712000, 0x5EB12000, 0x5EF12000, 0x5F312000, 0x5F712000, 0x5FB12000, 0x5FF12000, 0x60312000, 0x60712000, 0x60B12000, 0x60F12000, 0x61312000, 0x61712000, 0x61B12000, 0x61F12000, 0x62312000, 0x62712000, 0x62B12000, 0x62F12000, 0x63210800, 0xDE, 0xE4, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1E, 0x1F, 0x20, 0x63712000, 0x63B12000, 0x63F12000, 0x64312000, 0x64712000, 0x1B, 0x1C, 0x1D, 0x21, 0x22, 0x23, 0x64A10800, 0x64E10800, 0x65210800, 0x65610800, 0x65B12000, 0x65F12000, 0x66312000, 0x24, 0x66712000, 0x66B12000, 0x66F12000, 0x0507, 0x09, 0x67312A00, 0x67712A00, 0x67B12A00, 0x67F12A00, 0x68312A00, 0x68712A00, 0x68B12A00, 0x68F12A00, 0x07, 0x0500, 0x69312000, 0x69712000, 0x69B12A00, 0x69F12A00, 0x6A312A00, 0x6A712A00, 0x6AB12A00, 0x6AF12A00, 0x6B312A00, 0x6B712A00, 0x6BB12A00, 0x6BF12000, 0x6C312000, 0x6C712000, 0x6CB12A00, 0x6CF12A00, 0x6D312000, 0x6D712000, 0x6DB12000, 0x6DF12000, 0x6E312000, 0x54, 0x055B, 0x6E712000, 0x6EB12000, 0x6EF12000, 0x6F312000, 0x6F71B000, 0x6FD12000, 0x70112000, 0x70512000, 0x0509, 0x70912000, 0x70D12000, 0x7111B000, 0x71712000, 0x71A10800, 0x67, 0x6B, 0x71E10800, 0x76, 0x7A, 0x72210800, 0x72610800, 0x72A08800, 0xD8, 0x72D12A00, 0x73112A00, 0x73512A00, 0x73912A00, 0x73D12A00, 0x74112A00, 0x81, 0x82, 0x74512A00, 0x84, 0x74912A00, 0x74D12A00, 0x75018800, 0x75712A00, 0x75A18800, 0x76112A00, 0x76512A00, 0x76912A00, 0x76D12A00, 0x77112A00, 0x77512A00, 0x77912A00, 0x77D12000, 0x78008800, 0x78312000, 0x78712000, 0x78B12000, 0x78F12000, 0x79312000, 0x79712000, 0x79B12000, 0x79F12000, 0x7A312000, 0x7A712000, 0x7AB12000, 0x7AE08800, 0x7B008800, 0x7B208800, 0x7B408800, 0x7B608800, 0x7B808800, 0x7BA08800, 0x7BC08800, 0x7BE08800, 0x7C008800, 0x7C208800, 0x7C408800, 0x7C608800, 0x7C808800, 0x7CA08800, 0x7CC08800, 0x7CE08800, 0x7D008800, 0x7D208800, 0x7D408800, 0x7D608800, 0x7D808800, 0x7DA08800, 0x7DC08800, 0x7DE08800, 0x7E008800, 0x7E208800, 0x7E408800, 0x7E608800, 0x7E808800, 0x7EA08800, 0x7EC08800, 0x7EE08800, 0x7F008800, 0x7F208800, 0x7F408800, 0x7F608800, 0x7F808800, 0x7FA08800, 0x7FC08800, 0x7FE08800, 0x80008800, 0x80208800, 0x80408800, 0x80608800, 0x80808800, 0x80A08800, 0x80C08800, 0x80E08800, 0x81008800, 0x81208800, 0x81408800, 0x81608800, 0x81808800, 0x81A08800, 0x81C08800, 0x81E08800, 0x82008800, 0x82208800, 0x82408800, 0x82608800, 0x82808800, 0x82A08800, 0x82C08800, 0x82E08800, 0x83008800, 0x83208800, 0x83408800, 0x83608800, 0x83808800, 0x83A08800, 0x83C08800, 0x83E08800, 0x84008800, 0x84208800, 0x84408800, 0x84608800, 0x84808800, 0x84A08800, 0x84C08800, 0x84E08800, 0x85008800, 0x85208800, 0x85408800, 0xD6, 0xDA, 0x85712000, 0x85B12000, 0x85F12000, 0x86312000, 0x86712000, 0x86B12000, 0x86F12000, 0x87312000, 0x8771B000, 0x87D1B000, 0x88312000, 0x88712000, 0x88B12000, 0x88F12000, 0x89312000, 0x89712000, 0x89B12000, 0x89F12000, 0x8A312000, 0x8A712000, 0x8AB1B000, 0x8B11B000, 0x8B71B000, 0x8BD1B000, 0x8C312000, 0x8C712000, 0x8CB12000, 0x8CF12000, 0x8D31B000, 0x8D91B000, 0x8DF12000, 0x8E312000, 0x8E712000, 0x8EB12000, 0x8EF12000, 0x8F312000, 0x8F712000, 0x8FB12000, 0x8FF12000, 0x90312000, 0x90712000, 0x90B12000, 0x90F12000, 0x91312000, 0x91712000, 0x91B12000, 0x91F1B000, 0x9251B000, 0x92B12000, 0x92F12000, 0x93312000, 0x93712000, 0x93B12000, 0x93F12000, 0x94312000, 0x94712000, 0x94B1B000, 0x9511B000, 0x95712000, 0x95B12000, 0x95F12000, 0x96312000, 0x96712000, 0x96B12000, 0x96F12000, 0x97312000, 0x97712000, 0x97B12000, 0x97F12000, 0x98312000, 0x98712000, 0x98B12000, 0x98F12000, 0x99312000, 0x99712000, 0x99B12000, 0x99F1B000, 0x9A51B000, 0x9AB1B000, 0x9B11B000, 0x9B71B000, 0x9BD1B000, 0x9C31B000, 0x9C91B000, 0x9CF12000, 0x9D312000, 0x9D712000, 0x9DB12000, 0x9DF12000, 0x9E312000, 0x9E712000, 0x9EB12000, 0x9EF1B000, 0x9F51B000, 0x9FB12000, 0x9FF12000, 0xA0312000, 0xA0712000, 0xA0B12000, 0xA0F12000, 0xA131B000, 0xA191B000, 0xA1F1B000, 0xA251B000, 0xA2B1B000, 0xA311B000, 0xA3712000, 0xA3B12000, 0xA3F12000, 0xA4312000, 0xA4712000, 0xA4B12000, 0xA4F12000, 0xA5312000, 0xA5712000, 0xA5B12000, 0xA5F12000, 0xA6312000, 0xA6712000, 0xA6B12000, 0xA6F1B000, 0xA751B000, 0xA7B1B000, 0xA811B000, 0xA8712000, 0xA8B12000, 0xA8F12000, 0xA9312000, 0xA9712000, 0xA9B12000, 0xA9F12000, 0xAA312000, 0xAA712000, 0xAAB12000, 0xAAF12000, 0xAB312000, 0xAB712000, 0xABB12000, 0xABF12000, 0xAC312000, 0xAC712000, 0xACB12000, 0xACF12000, 0xAD312000, 0xAD712000, 0xADB12000, 0xADF12000, 0xAE312000, 0xAE712000, 0xAEB12000, 0xAEF12000, 0xAF312000, 0xAF712000, 0xAFB12000, 0xAFE10800, 0xB0212800, 0xB0B12000, 0xB0F12000, 0xB1312000, 0xB1712000, 0xB1B1B000, 0xB211B000, 0xB271B000, 0xB2D1B000, 0xB331B000, 0xB391B000, 0xB3F1B000, 0xB451B000, 0xB4B1B000, 0xB511B000, 0xB571B000, 0xB5D1B000, 0xB631B000, 0xB691B000, 0xB6F1B000, 0xB751B000, 0xB7B1B000, 0xB811B000, 0xB871B000, 0xB8D1B000, 0xB9312000, 0xB9712000, 0xB9B12000, 0xB9F12000, 0xBA312000, 0xBA712000, 0xBAB1B000, 0xBB11B000, 0xBB71B000, 0xBBD1B000, 0xBC31B000, 0xBC91B000, 0xBCF1B000, 0xBD51B000, 0xBDB1B000, 0xBE11B000, 0xBE712000, 0xBEB12000, 0xBEF12000, 0xBF312000, 0xBF712000, 0xBFB12000, 0xBFF12000, 0xC0312000, 0xC071B000, 0xC0D1B000, 0xC131B000, 0xC191B000, 0xC1F1B000, 0xC251B000, 0xC2B1B000, 0xC311B000, 0xC371B000, 0xC3D1B000, 0xC431B000, 0xC491B000, 0xC4F1B000, 0xC551B000, 0xC5B1B000, 0xC611B000, 0xC671B000, 0xC6D1B000, 0xC731B000, 0xC791B000, 0xC7F12000, 0xC8312000, 0xC8712000, 0xC8B12000, 0xC8F1B000, 0xC951B000, 0xC9B1B000, 0xCA11B000, 0xCA71B000, 0xCAD1B000, 0xCB31B000, 0xCB91B000, 0xCBF1B000, 0xCC51B000, 0xCCB12000, 0xCCF12000, 0xCD312000, 0xCD712000, 0xCDB12000, 0xCDF12000, 0xCE312000, 0xCE712000, 0xCEB12000, 0xCEF12000, 0xCF31B000, 0xCF91B000, 0xCFF1B000, 0xD051B000, 0xD0B1B000, 0xD111B000, 0xD1712000, 0xD1B12000, 0xD1F1B000, 0xD251B000, 0xD2B1B000, 0xD311B000, 0xD371B000, 0xD3D1B000, 0xD4312000, 0xD4712000, 0xD4B1B000, 0xD511B000, 0xD571B000, 0xD5D1B000, 0xD6312000, 0xD6712000, 0xD6B1B000, 0xD711B000, 0xD771B000, 0xD7D1B000, 0xD8312000, 0xD8712000, 0xD8B1B000, 0xD911B000, 0xD971B000, 0xD9D1B000, 0xDA31B000, 0xDA91B000, 0xDAF12000, 0xDB312000, 0xDB71B000, 0xDBD1B000, 0xDC31B000, 0xDC91B000, 0xDCF1B000, 0xDD51B000, 0xDDB12000, 0xDDF12000, 0xDE31B000, 0xDE91B000, 0xDEF1B000, 0xDF51B000, 0xDFB1B000, 0xE011B000, 0xE0712000, 0xE0B12000, 0xE0F1B000, 0xE151B000, 0xE1B1B000, 0xE211B000, 0xE271B000, 0xE2D1B000, 0xE3312000, 0xE3712000, 0xE3B1B000, 0xE411B000, 0xE471B000, 0xE4D1B000, 0xE5312000, 0xE5712000, 0xE5B1B000, 0xE611B000, 0xE671B000, 0xE6D1B000, 0xE7312000, 0xE7712000, 0xE7B1B000, 0xE811B000, 0xE871B000, 0xE8D1B000, 0xE931B000, 0xE991B000, 0xE9F12000, 0xEA31B000, 0xEA91B000, 0xEAF1B000, 0xEB512000, 0xEB912000, 0xEBD1B000, 0xEC31B000, 0xEC91B000, 0xECF1B000, 0xED51B000, 0xEDB1B000, 0xEE112000, 0xEE512000, 0xEE91B000, 0xEEF1B000, 0xEF51B000, 0xEFB1B000, 0xF011B000, 0xF071B000, 0xF0D12000, 0x51312A00, 0xF1112000, 0x51712A00, 0xF1512000, 0x51B12A00, 0xF1912000, 0x51F12A00, 0xF1D12000, 0x53112A00, 0xF2112000, 0x53512A00, 0xF2512000, 0x53912A00, 0xF291B000, 0xF2F1B000, 0xF3524000, 0xF3D24000, 0xF4524000, 0xF4D24000, 0xF5524000, 0xF5D24000, 0xF651B000, 0xF6B1B000, 0xF7124000, 0xF7924000, 0xF8124000, 0xF8924000, 0xF9124000, 0xF9924000, 0xFA11B000, 0xFA71B000, 0xFAD24000, 0xFB524000, 0xFBD24000, 0xFC524000, 0xFCD24000, 0xFD524000, 0xFDD1B000, 0xFE31B000, 0xFE924000, 0xFF124000, 0xFF924000, 0x0000000100124000, 0x0000000100924000, 0x0000000101124000, 0x000000010191B000, 0x0000000101F1B000, 0x0000000102524000, 0x0000000102D24000, 0x0000000103524000, 0x0000000103D24000, 0x0000000104524000, 0x0000000104D24000, 0x000000010551B000, 0x0000000105B1B000, 0x0000000106124000, 0x0000000106924000, 0x0000000107124000, 0x0000000107924000, 0x0000000108124000, 0x0000000108924000, 0x0000000109112000, 0x0000000109512000, 0x000000010991B000, 0x0000000109F12000, 0x000000010A31B000, 0x000000010A912000, 0x000000010AD1B000, 0x000000010B312000, 0x000000010B712000, 0x000000010BB12000, 0x4E712A00, 0x000000010BF12000, 0x000000010C210800, 0x000000010C709A00, 0x000000010C810800, 0x000000010CC1A800, 0x000000010D71B000, 0x000000010DD12000, 0x000000010E11B000, 0x000000010E712000, 0x000000010EB1B000, 0x000000010F112000, 0x4ED12A00, 0x000000010F512000, 0x4F112A00, 0x000000010F912000, 0x000000010FC1A800, 0x000000011061A800, 0x000000011101A800, 0x0000000111B12000, 0x0000000111F12000, 0x000000011231B000, 0x5051BA00, 0x0000000112912000, 0x0000000112D1B000, 0x0000000113312000, 0x0000000113712000, 0x0000000113B12000, 0x4F512A00, 0x0000000113E1A800, 0x000000011481A800, 0x000000011521A800, 0x0000000115D12000, 0x0000000116112000, 0x000000011651B000, 0x5231BA00, 0x0000000116B12000, 0x0000000116F12000, 0x0000000117312000, 0x000000011771B000, 0x0000000117D12000, 0x0000000118112000, 0x0000000118512000, 0x4FD12A00, 0x0000000118912000, 0x0000000118C1A800, 0x4DC1AA00, 0x0000000119709A00, 0x000000011991B000, 0x0000000119F12000, 0x000000011A31B000, 0x000000011A912000, 0x000000011AD1B000, 0x000000011B312000, 0x4F912A00, 0x000000011B712000, 0x50112A00, 0x000000011BB12000, 0x000000011BE11A00, 0x000000011C410800, 0x000000011C809A00, 0x000000011CC09A00, 0x000000011D008800, 0x000000011D210800, 0x000000011D608800, 0x000000011D810800, 0x000000011DC18800, 0x000000011E210800, 0x000000011E618800, 0x000000011EC10800, 0x000000011F018800, 0x000000011F610800, 0x000000011FA10800, 0x000000011FE10800, 0x0000000120210800, 0x0000000120610800, 0x0000000120A20800, 0x0000000121208800, 0x0000000121408800, 0x0000000121608800, 0x0000000121808800, 0x0000000121A08800, 0x0000000121C08800, 0x0000000121E08800, 0x0000000122008800, 0x0000000122208800, 0x0000000122408800, 0x0000000122608800, 0x0000000122808800, 0x0000000122A08800, 0x0000000122C10800, 0x0000000123018800, 0x0000000123618800, 0x0000000123C08800, 0x0000000123E10800, 0x0000000124218800, 0x0000000124818800, 0x0000000124E08800, 0x0000000125010800, 0x0000000125408800, 0x0000000125610800, 0x0000000125A08800, 0x0000000125C10800, 0x0000000126018800, 0x0000000126610800, 0x0000000126A08800, 0x0000000126D09A00, 0x7C309A00, 0x04512A00, 0x0000000126E08800, 0x0000000127008800, 0x0000000127208800, 0x0000000127408800, 0x0000000127608800, 0x0000000127818800, 0x0000000127E08800, 0x0000000128008800, 0x0000000128208800, 0x0000000128418800, 0x0000000128A18800, 0x0000000129020800, 0x0000000129818800, 0x0000000129E18800, 0x000000012A418800, 0x000000012AA18800, 0x000000012B018800, 0x000000012B618800, 0x000000012BC18800, 0x000000012C218800, 0x000000012C818800, 0x000000012CE18800, 0x000000012D418800, 0x000000012DA18800, 0x000000012E010800, 0x000000012E410800, 0x000000012E818800, 0x000000012EE10800, 0x000000012F208800, 0x000000012F410800, 0x000000012F818800, 0x000000012FE20800, 0x0000000130610800, 0x0000000130A08800, 0x0000000130C10800, 0x0000000131018800, 0x0000000131610800, 0x0000000131A18800, 0x0000000132010800, 0x0000000132410800, 0x0000000132818800, 0x0000000132E20800, 0x0000000133610800, 0x0000000133A10800, 0x0000000133E18800, 0x0000000134418800, 0x0000000134B12000, 0x0000000134F12000, 0x0000000135312000, 0x0000000135712000, 0x0000000135B12000, 0x0000000135F12000, 0x0000000136312000, 0x0000000136712000, 0x0000000136B12000, 0x0000000136F12000, 0x0000000137312000, 0x0000000137610800, 0x0000000137A18800, 0x0000000138010800, 0x0000000138418800, 0x0000000138B12000, 0x0000000138F12000, 0x0000000139312000, 0x0000000139712000, 0x0000000139B12000, 0x0000000139F12000, 0x000000013A312000, 0x000000013A712000, 0x000000013AB12000, 0x000000013AF12000, 0x000000013B312000, 0x000000013B712000, 0x000000013BB12000, 0x000000013BF12000, 0x000000013C312000, 0x000000013C712000, 0x000000013CB12000, 0x000000013CF12000, 0x000000013D312000, 0x000000013D712000, 0x000000013DB12000, 0x000000013DF12000, 0x000000013E312000, 0x000000013E712000, 0x000000013EB12000, 0x000000013EF12000, 0x000000013F312000, 0x000000013F712000, 0x000000013FB12000, 0x000000013FF12000, 0x0000000140312000, 0x0000000140712000, 0x0000000140B12000, 0x0000000140F09A00, 0x0000000141109A00, 0x0000000141210800, 0x0000000141610800, 0x0000000141A10800, 0x0000000141E10800, 0x0000000142210800, 0x0000000142610800, 0x0000000142A10800, 0x0000000142E10800, 0x0000000143210800, 0x0000000143610800, 0x0000000143A10800, 0x0000000143E18800, 0x0000000144418800, 0x0000000144A18800, 0x0000000145018800, 0x0000000145618800, 0x0000000145C18800, 0x0000000146218800, 0x0000000146818800, 0x0000000146E18800, 0x0000000147420800, 0x0000000147C20800, 0x0000000148420800, 0x0000000148C20800, 0x0000000149420800, 0x0000000149C20800, 0x000000014A420800, 0x000000014AC20800, 0x000000014B420800, 0x000000014BC20800, 0x000000014C420800, 0x000000014CC10800, 0x000000014D010800, 0x000000014D410800, 0x000000014D810800, 0x000000014DC10800, 0x000000014E010800, 0x000000014E410800, 0x000000014E810800, 0x000000014EC10800, 0x000000014F018800, 0x000000014F618800, 0x000000014FC18800, 0x0000000150218800, 0x0000000150818800, 0x0000000150E18800, 0x0000000151418800, 0x0000000151A18800, 0x0000000152018800, 0x0000000152618800, 0x0000000152C18800, 0x0000000153218800, 0x0000000153818800, 0x0000000153E18800, 0x0000000154418800, 0x0000000154A18800, 0x0000000155018800, 0x0000000155618800, 0x0000000155C18800, 0x0000000156218800, 0x0000000156818800, 0x0000000156E18800, 0x0000000157418800, 0x0000000157A18800, 0x0000000158018800, 0x0000000158618800, 0x0000000158C18800, 0x0000000159218800, 0x0000000159818800, 0x0000000159E18800, 0x000000015A418800, 0x000000015AA18800, 0x000000015B018800, 0x000000015B618800, 0x000000015BC18800, 0x000000015C218800, 0x000000015C818800, 0x000000015CE08800, 0x000000015D008800, 0x000000015D208800, 0x000000015D420800, 0x000000015DC18800, 0x000000015E210800, 0x000000015E618800, 0x000000015ED12A00, 0x000000015F008800, 0x000000015F208800, 0x000000015F408800, 0x000000015F608800, 0x000000015F808800, 0x000000015FA08800, 0x000000015FC08800, 0x000000015FE08800, 0x0000000160008800, 0x0000000160208800, 0x0000000160408800, 0x0000000160608800, 0x0000000160808800, 0x0000000160A08800, 0x0000000160C08800, 0x0000000160E08800, 0x0000000161008800, 0x0000000161208800, 0x0000000161408800, 0x0000000161608800, 0x0000000161808800, 0x0000000161A08800, 0x0000000161C08800, 0x0000000161E08800, 0x0000000162008800, 0x0000000162208800, 0x0000000162408800, 0x0000000162608800, 0x0000000162808800, 0x0000000162A08800, 0x0000000162C08800, 0x0000000162E08800, 0x0000000163008800, 0x0000000163208800, 0x0000000163408800, 0x0000000163608800, 0x0000000163808800, 0x0000000163A08800, 0x0000000163C08800, 0x0000000163E08800, 0x0000000164008800, 0x0000000164208800, 0x0000000164408800, 0x0000000164608800, 0x0000000164808800, 0x0000000164A08800, 0x0000000164C08800, 0x0000000164E08800, 0x0000000165008800, 0x0000000165208800, 0x0000000165408800, 0x0000000165608800, 0x0000000165808800, 0x0000000165A08800, 0x0000000165C08800, 0x0000000165E08800, 0x0000000166008800, 0x0000000166208800, 0x0000000166408800, 0x0000000166608800, 0x0000000166808800, 0x0000000166A08800, 0x0000000166C08800, 0x0000000166E08800, 0x0000000167008800, 0x0000000167208800, 0x0000000167408800, 0x0000000167608800, 0x0000000167808800, 0x0000000167A08800, 0x0000000167C08800, 0x0000000167E08800, 0x0000000168008800, 0x0000000168208800, 0x0000000168408800, 0x0000000168608800, 0x0000000168808800, 0x0000000168A08800, 0x0000000168C08800, 0x0000000168E08800, 0x0000000169008800, 0x0000000169208800, 0x0000000169408800, 0x0000000169608800, 0x0000000169808800, 0x0000000169A08800, 0x0000000169C08800, 0x0000000169E08800, 0x000000016A008800, 0x000000016A208800, 0x000000016A408800, 0x000000016A608800, 0x000000016A808800, 0x000000016AA08800, 0x000000016AC08800, 0x000000016AE08800, 0x000000016B008800, 0x000000016B208800, 0x000000016B408800, 0x000000016B608800, 0x000000016B808800, 0x000000016BA08800, 0x000000016BC08800, 0x000000016BE08800, 0x000000016C008800, 0x000000016C208800, 0x000000016C408800, 0x000000016C608800, 0x000000016C808800, 0x000000016CA08800, 0x000000016CC08800, 0x000000016CE08800, 0x000000016D008800, 0x000000016D208800, 0x000000016D408800, 0x000000016D608800, 0x000000016D808800, 0x000000016DA08800, 0x000000016DC08800, 0x000000016DE08800, 0x000000016E008800, 0x000000016E208800, 0x000000016E408800, 0x000000016E608800, 0x000000016E808800, 0x000000016EA08800, 0x000000016EC08800, 0x000000016EE08800, 0x000000016F008800, 0x000000016F208800, 0x000000016F408800, 0x000000016F608800, 0x000000016F808800, 0x000000016FA08800, 0x000000016FC08800, 0x000000016FE08800, 0x0000000170008800, 0x0000000170208800, 0x0000000170408800, 0x0000000170608800, 0x0000000170808800, 0x0000000170A08800, 0x0000000170C08800, 0x0000000170E08800, 0x0000000171008800, 0x0000000171208800, 0x0000000171408800, 0x0000000171608800, 0x0000000171808800, 0x0000000171A08800, 0x0000000171C08800, 0x0000000171E08800, 0x0000000172008800, 0x0000000172208800, 0x0000000172408800, 0x0000000172608800, 0x0000000172808800, 0x0000000172A08800, 0x0000000172C08800, 0x0000000172E08800, 0x0000000173008800, 0x0000000173208800, 0x0000000173408800, 0x0000000173608800, 0x0000000173808800, 0x0000000173A08800, 0x0000000173C08800, 0x0000000173E08800, 0x0000000174008800, 0x0000000174208800, 0x0000000174408800, 0x0000000174608800, 0x0000000174808800, 0x0000000174A08800, 0x0000000174C08800, 0x0000000174E08800, 0x0000000175008800, 0x0000000175208800, 0x0000000175408800, 0x0000000175608800, 0x0000000175808800, 0x0000000175A08800, 0x0000000175C08800, 0x0000000175E08800, 0x0000000176008800, 0x0000000176208800, 0x0000000176408800, 0x0000000176608800, 0x0000000176808800, 0x0000000176A08800, 0x0000000176C08800, 0x0000000176E08800, 0x0000000177008800, 0x0000000177208800, 0x0000000177408800, 0x0000000177608800, 0x0000000177808800, 0x0000000177A08800, 0x0000000177C08800, 0x0000000177E08800, 0x0000000178008800, 0x0000000178208800, 0x0000000178408800, 0x0000000178608800, 0x0000000178808800, 0x0000000178A08800, 0x0000000178C08800, 0x0000000178E08800, 0x0000000179008800, 0x0000000179208800, 0x0000000179408800, 0x0000000179608800, 0x0000000179808800, 0x0000000179A08800, 0x0000000179C08800, 0x0000000179E08800, 0x000000017A008800, 0xE0, 0x000000017A208800, 0x000000017A408800, 0x000000017A608800, 0x000000017A912000, 0x000000017AD12000, 0x000000017B112000, 0x000000017B512000, 0x000000017B912000, 0x000000017BD12000, 0x000000017C112000, 0x000000017C512000, 0x000000017C912000, 0x000000017CD12000, 0x000000017D112000, 0x000000017D512000, 0x000000017D912000, 0x000000017DD12000, 0x000000017E112000, 0x000000017E512000, 0x000000017E912000, 0x000000017ED12000, 0x000000017F112000, 0x000000017F512000, 0x000000017F912000, 0x000000017FD12000, 0x0000000180112000, 0x0000000180512000, 0x0000000180912000, 0x0000000180D12000, 0x0508, 0x0000000181010800, 0x0000000181410800, 0x0000000181912000, 0x0000000181C10800, 0x0000000182112000, 0x0000000182512000, 0x0000000182912000, 0x0000000182D12000, 0x0000000183112000, 0x0000000183512000, 0x0000000183912000, 0x0000000183D12000, 0x0000000184112000, 0x0000000184512000, 0x0000000184912000, 0x0000000184D12000, 0x0000000185112000, 0x0000000185512000, 0x0000000185912000, 0x0000000185D12000, 0x0000000186112000, 0x0000000186512000, 0x0000000186912000, 0x0000000186D12000, 0x0000000187112000, 0x0000000187512000, 0x0000000187912000, 0x0000000187D12000, 0x0000000188112000, 0x0000000188512000, 0x0000000188912000, 0x0000000188D12000, 0x0000000189112000, 0x0000000189512000, 0x0000000189912000, 0x0000000189C10800, 0x000000018A008800, 0x000000018A208800, 0x000000018A408800, 0x000000018A608800, 0x000000018A808800, 0x000000018AA08800, 0x000000018AC08800, 0x000000018AE08800, 0x000000018B008800, 0x000000018B208800, 0x000000018B408800, 0x000000018B608800, 0x000000018B808800, 0x000000018BA08800, 0x000000018BC08800, 0x000000018BE08800, 0x000000018C008800, 0x000000018C208800, 0x000000018C408800, 0x000000018C608800, 0x000000018C808800, 0x000000018CA08800, 0x000000018CC08800, 0x000000018CE08800, 0x000000018D008800, 0x000000018D208800, 0x000000018D408800, 0x000000018D608800, 0x000000018D808800, 0x000000018DA08800, 0x000000018DC08800, 0x000000018DE08800, 0x000000018E008800, 0x000000018E208800, 0x000000018E408800, 0x000000018E608800, 0x000000018E808800, 0x000000018EA08800, 0x000000018EC08800, 0x000000018EE08800, 0x000000018F008800, 0x000000018F208800, 0x000000018F408800, 0x000000018F608800, 0x000000018F808800, 0x000000018FA08800, 0x000000018FC08800, 0x000000018FE08800, 0x0000000190008800, 0x0000000190208800, 0x0000000190408800, 0x0000000190608800, 0x0000000190808800, 0x0000000190A08800, 0x0000000190C08800, 0x0000000190E08800, 0x0000000191008800, 0x0000000191208800, 0x0000000191408800, 0x0000000191608800, 0x0000000191808800, 0x0000000191A08800, 0x0000000191C08800, 0x0000000191E08800, 0x0000000192008800, 0x0000000192208800, 0x0000000192408800, 0x0000000192608800, 0x0000000192808800, 0x0000000192A08800, 0x0000000192C08800, 0x0000000192E08800, 0x0000000193008800, 0x0000000193208800, 0x0000000193408800, 0x0000000193608800, 0x0000000193808800, 0x0000000193A08800, 0x0000000193C08800, 0x0000000193E08800, 0x0000000194008800, 0x0000000194208800, 0x0000000194408800, 0x0000000194608800, 0x0000000194808800, 0x0000000194A08800, 0x0000000194C08800, 0x0000000194E08800, 0x0000000195008800, 0x0000000195208800, 0x0000000195408800, 0x0000000195608800, 0x0000000195808800, 0x0000000195A08800, 0x0000000195C08800, 0x0000000195E08800, 0x0000000196008800, 0x0000000196208800, 0x0000000196408800, 0x0000000196608800, 0x0000000196808800, 0x0000000196A08800, 0x0000000196C08800, 0x0000000196E08800, 0x0000000197018800, 0x0000000197618800, 0x0000000197C18800, 0x0000000198218800, 0x0000000198818800, 0x0000000198E18800, 0x0000000199418800, 0x0000000199A18800, 0x000000019A018800, 0x000000019A618800, 0x000000019AC18800, 0x000000019B218800, 0x000000019B818800, 0x000000019BE18800, 0x000000019C420800, 0x000000019CC20800, 0x000000019D420800, 0x000000019DC20800, 0x000000019E420800, 0x000000019EC20800, 0x000000019F420800, 0x000000019FC20800, 0x00000001A0420800, 0x00000001A0C20800, 0x00000001A1420800, 0x00000001A1C20800, 0x00000001A2420800, 0x00000001A2C20800, 0x00000001A3420800, 0x00000001A3C38800, 0x00000001A4A30800, 0x00000001A5618800, 0x00000001A5C18800, 0x00000001A6218800, 0x00000001A6818800, 0x00000001A6E18800, 0x00000001A7418800, 0x00000001A7A18800, 0x00000001A8018800, 0x00000001A8618800, 0x00000001A8C18800, 0x00000001A9218800, 0x00000001A9818800, 0x00000001A9E18800, 0x00000001AA418800, 0x00000001AAA18800, 0x00000001AB018800, 0x00000001AB618800, 0x00000001ABC18800, 0x00000001AC218800, 0x00000001AC818800, 0x00000001ACE18800, 0x00000001AD418800, 0x00000001ADA18800, 0x00000001AE018800, 0x00000001AE618800, 0x00000001AEC18800, 0x00000001AF218800, 0x00000001AF818800, 0x00000001AFE18800, 0x00000001B0418800, 0x00000001B0A18800, 0x00000001B1018800, 0x00000001B1618800, 0x00000001B1C18800, 0x00000001B2218800, 0x00000001B2818800, 0x00000001B2E08800, 0x00000001B3008800, 0x00000001B3208800, 0x00000001B3418800, 0x00000001B3A10800, 0x00000001B3E10800, 0x00000001B4210800, 0x00000001B4610800, 0x00000001B4A10800, 0x00000001B4E10800, 0x00000001B5210800, 0x00000001B5610800, 0x00000001B5A10800, 0x00000001B5E10800, 0x00000001B6210800, 0x00000001B6610800, 0x00000001B6A10800, 0x00000001B6E10800, 0x00000001B7210800, 0x00000001B7610800, 0x00000001B7A10800, 0x00000001B7E10800, 0x00000001B8210800, 0x00000001B8610800, 0x00000001B8A10800, 0x00000001B8E10800, 0x00000001B9210800, 0x00000001B9610800, 0x00000001B9A10800, 0x00000001B9E10800, 0x00000001BA210800, 0x00000001BA610800, 0x00000001BAA10800, 0x00000001BAE28800, 0x00000001BB820800, 0x00000001BC010800, 0x00000001BC408800, 0x00000001BC608800, 0x00000001BC808800, 0x00000001BCA08800, 0x00000001BCC08800, 0x00000001BCE08800, 0x00000001BD008800, 0x00000001BD208800, 0x00000001BD408800, 0x00000001BD608800, 0x00000001BD808800, 0x00000001BDA08800, 0x00000001BDC08800, 0x00000001BDE08800, 0x00000001BE008800, 0x00000001BE208800, 0x00000001BE408800, 0x00000001BE608800, 0x00000001BE808800, 0x00000001BEA08800, 0x00000001BEC08800, 0x00000001BEE08800, 0x00000001BF008800, 0x00000001BF208800, 0x00000001BF408800, 0x00000001BF608800, 0x00000001BF808800, 0x00000001BFA08800, 0x00000001BFC08800, 0x00000001BFE08800, 0x00000001C0008800, 0x00000001C0208800, 0x00000001C0410800, 0x00000001C0810800, 0x00000001C0C10800, 0x00000001C1010800, 0x00000001C1410800, 0x00000001C1810800, 0x00000001C1C10800, 0x00000001C2010800, 0x00000001C2410800, 0x00000001C2810800, 0x00000001C2C10800, 0x00000001C3010800, 0x00000001C3410800, 0x00000001C3810800, 0x00000001C3C10800, 0x00000001C4010800, 0x00000001C4410800, 0x00000001C4810800, 0x00000001C4C10800, 0x00000001C5010800, 0x00000001C5410800, 0x00000001C5810800, 0x00000001C5C10800, 0x00000001C6010800, 0x00000001C6418800, 0x00000001C6A18800, 0x00000001C7018800, 0x00000001C7610800, 0x00000001C7A18800, 0x00000001C8010800, 0x00000001C8418800, 0x00000001C8A08800, 0x00000001C8C08800, 0x00000001C8E08800, 0x00000001C9008800, 0x00000001C9208800, 0x00000001C9408800, 0x00000001C9608800, 0x00000001C9808800, 0x00000001C9A08800, 0x00000001C9C08800, 0x00000001C9E08800, 0x00000001CA008800, 0x00000001CA208800, 0x00000001CA408800, 0x00000001CA608800, 0x00000001CA808800, 0x00000001CAA08800, 0x00000001CAC08800, 0x00000001CAE08800, 0x00000001CB008800, 0x00000001CB208800, 0x00000001CB408800, 0x00000001CB608800, 0x00000001CB808800, 0x00000001CBA08800, 0x00000001CBC08800, 0x00000001CBE08800, 0x00000001CC008800, 0x00000001CC208800, 0x00000001CC408800, 0x00000001CC608800, 0x00000001CC808800, 0x00000001CCA08800, 0x00000001CCC08800, 0x00000001CCE08800, 0x00000001CD008800, 0x00000001CD208800, 0x00000001CD408800, 0x00000001CD608800, 0x00000001CD808800, 0x00000001CDA08800, 0x00000001CDC08800, 0x00000001CDE08800, 0x00000001CE008800, 0x00000001CE208800, 0x00000001CE408800, 0x00000001CE608800, 0x00000001CE810800, 0x00000001CEC28800, 0x00000001CF620800, 0x00000001CFE28800, 0x00000001D0818800, 0x00000001D0E28800, 0x00000001D1818800, 0x00000001D1E18800, 0x00000001D2430800, 0x00000001D3020800, 0x00000001D3818800, 0x00000001D3E18800, 0x00000001D4418800, 0x00000001D4A20800, 0x00000001D5220800, 0x00000001D5A20800, 0x00000001D6220800, 0x00000001D6A20800, 0x00000001D7220800, 0x00000001D7A20800, 0x00000001D8230800, 0x00000001D8E10800, 0x00000001D9230800, 0x00000001D9E30800, 0x00000001DAA28800, 0x00000001DB420800, 0x00000001DBC30800, 0x00000001DC830800, 0x00000001DD420800, 0x00000001DDC18800, 0x00000001DE218800, 0x00000001DE820800, 0x00000001DF020800, 0x00000001DF828800, 0x00000001E0228800, 0x00000001E0C18800, 0x00000001E1218800, 0x00000001E1820800, 0x00000001E2018800, 0x00000001E2618800, 0x00000001E2C10800, 0x00000001E3010800, 0x00000001E3418800, 0x00000001E3A18800, 0x00000001E4030800, 0x00000001E4C20800, 0x00000001E5428800, 0x00000001E5E30800, 0x00000001E6A20800, 0x00000001E7218800, 0x00000001E7818800, 0x00000001E7E30800, 0x00000001E8A20800, 0x00000001E9230800, 0x00000001E9E18800, 0x00000001EA428800, 0x00000001EAE18800, 0x00000001EB420800, 0x00000001EBC18800, 0x00000001EC220800, 0x00000001ECA28800, 0x00000001ED420800, 0x00000001EDC28800, 0x00000001EE620800, 0x00000001EEE10800, 0x00000001EF228800, 0x00000001EFC18800, 0x00000001F0218800, 0x00000001F0820800, 0x00000001F1018800, 0x00000001F1618800, 0x00000001F1C18800, 0x00000001F2228800, 0x00000001F2C20800, 0x00000001F3410800, 0x00000001F3830800, 0x00000001F4418800, 0x00000001F4A28800, 0x00000001F5420800, 0x00000001F5C20800, 0x00000001F6418800, 0x00000001F6A18800, 0x00000001F7020800, 0x00000001F7810800, 0x00000001F7C20800, 0x00000001F8428800, 0x00000001F8E10800, 0x00000001F9230800, 0x00000001F9E18800, 0x00000001FA410800, 0x00000001FA810800, 0x00000001FAC10800, 0x00000001FB010800, 0x00000001FB410800, 0x00000001FB810800, 0x00000001FBC10800, 0x00000001FC010800, 0x00000001FC410800, 0x00000001FC810800, 0x00000001FCC18800, 0x00000001FD218800, 0x00000001FD818800, 0x00000001FDE18800, 0x00000001FE418800, 0x00000001FEA18800, 0x00000001FF018800, 0x00000001FF618800, 0x00000001FFC18800, 0x0000000200218800, 0x0000000200818800, 0x0000000200E18800, 0x0000000201418800, 0x0000000201A18800, 0x0000000202018800, 0x0000000202618800, 0x0000000202C10800, 0x0000000203010800, 0x0000000203418800, 0x0000000203A10800, 0x0000000203E10800, 0x0000000204210800, 0x0000000204618800, 0x0000000204C18800, 0x0000000205210800, 0x0000000205610800, 0x0000000205A10800, 0x0000000205E10800, 0x0000000206210800, 0x0000000206620800, 0x0000000206E10800, 0x0000000207210800, 0x0000000207610800, 0x0000000207A10800, 0x0000000207E10800, 0x0000000208210800, 0x0000000208610800, 0x0000000208A10800, 0x0000000208E18800, 0x0000000209420800, 0x0000000209C10800, 0x000000020A010800, 0x000000020A410800, 0x000000020A810800, 0x000000020AC10800, 0x000000020B010800, 0x000000020B410800, 0x000000020B818800, 0x000000020BE18800, 0x000000020C418800, 0x000000020CA18800, 0x000000020D010800, 0x000000020D410800, 0x000000020D810800, 0x000000020DC10800, 0x000000020E010800, 0x000000020E410800, 0x000000020E810800, 0x000000020EC10800, 0x000000020F010800, 0x000000020F410800, 0x000000020F818800, 0x000000020FE18800, 0x0000000210410800, 0x0000000210818800, 0x0000000210E18800, 0x0000000211418800, 0x0000000211A10800, 0x0000000211E18800, 0x0000000212418800, 0x0000000212A20800, 0x0000000213210800, 0x0000000213618800, 0x0000000213C18800, 0x0000000214218800, 0x0000000214818800, 0x0000000214E28800, 0x0000000215830800, 0x0000000216410800, 0x0000000216810800, 0x0000000216C10800, 0x0000000217010800, 0x0000000217410800, 0x0000000217810800, 0x0000000217C10800, 0x0000000218010800, 0x0000000218410800, 0x0000000218810800, 0x0000000218C10800, 0x0000000219010800, 0x0000000219410800, 0x0000000219810800, 0x0000000219C10800, 0x000000021A010800, 0x000000021A410800, 0x000000021A810800, 0x000000021AC20800, 0x000000021B410800, 0x000000021B810800, 0x000000021BC10800, 0x000000021C020800, 0x000000021C818800, 0x000000021CE10800, 0x000000021D210800, 0x000000021D610800, 0x000000021DA10800, 0x000000021DE10800, 0x000000021E210800, 0x000000021E610800, 0x000000021EA10800, 0x000000021EE10800, 0x000000021F210800, 0x000000021F618800, 0x000000021FC10800, 0x0000000220010800, 0x0000000220418800, 0x0000000220A18800, 0x0000000221010800, 0x0000000221420800, 0x0000000221C18800, 0x0000000222210800, 0x0000000222610800, 0x0000000222A10800, 0x0000000222E10800, 0x0000000223218800, 0x0000000223818800, 0x0000000223E10800, 0x0000000224210800, 0x0000000224610800, 0x0000000224A10800, 0x0000000224E10800, 0x0000000225210800, 0x0000000225610800, 0x0000000225A10800, 0x0000000225E10800, 0x0000000226218800, 0x0000000226818800, 0x0000000226E18800, 0x0000000227418800, 0x0000000227A18800, 0x0000000228018800, 0x0000000228618800, 0x0000000228C18800, 0x0000000229218800, 0x0000000229818800, 0x0000000229E18800, 0x000000022A418800, 0x000000022AA18800, 0x000000022B018800, 0x000000022B618800, 0x000000022BC18800, 0x000000022C218800, 0x000000022C818800, 0x000000022CE18800, 0x000000022D418800, 0x000000022DA18800, 0x000000022E018800, 0x000000022E618800, 0x000000022EC08800, 0x000000022EE08800, 0x000000022F008800, 0x000000022F208800, 0x000000022F408800, 0x000000022F608800, 0x000000022F808800, 0x000000022FA08800, 0x000000022FC08800, 0x000000022FE08800, 0x0000000230109A00, 0x0000000230309A00, 0x0000000173309A00, 0x0000000230509A00, 0x0000000230709A00, 0x0000000230909A00, 0x0000000230B09A00, 0x0000000179F09A00, 0x0000000230D09A00, 0x0000000174309A00, 0x0000000230F09A00, 0x0000000231109A00, 0x0000000231309A00, 0x0000000231509A00, 0x0000000231709A00, 0x0000000231909A00, 0x0000000231B09A00, 0x0000000231D09A00, 0x0000000231F09A00, 0x0000000232109A00, 0x0000000232309A00, 0x0000000232509A00, 0x0000000232709A00, 0x0000000232909A00, 0x0000000232B09A00, 0x0000000232D09A00, 0x0000000232F09A00, 0x0000000233109A00, 0x0000000233309A00, 0x0000000233509A00, 0x0000000233709A00, 0x0000000233909A00, 0x0000000233B09A00, 0x0000000233D09A00, 0x0000000233F09A00, 0x0000000234109A00, 0x0000000234309A00, 0x0000000234509A00, 0x0000000234709A00, 0x0000000234909A00, 0x0000000234B09A00, 0x0000000234D09A00, 0x0000000234F09A00, 0x0000000235109A00, 0x0000000235309A00, 0x0000000235509A00, 0x0000000235709A00, 0x0000000235909A00, 0x0000000235B09A00, 0x0000000235D09A00, 0x0000000235F09A00, 0x000000016EF09A00, 0x0000000236109A00, 0x0000000236309A00, 0x0000000236509A00, 0x0000000236709A00, 0x0000000236909A00, 0x0000000236B09A00, 0x0000000236D09A00, 0x0000000236F09A00, 0x0000000237109A00, 0x0000000237309A00, 0x0000000237509A00, 0x0000000178109A00, 0x0000000237709A00, 0x0000000237909A00, 0x0000000237B09A00, 0x0000000237D09A00, 0x0000000237F09A00, 0x0000000238109A00, 0x0000000238309A00, 0x0000000238509A00, 0x0000000238709A00, 0x0000000238909A00, 0x0000000238B09A00, 0x0000000238D09A00, 0x0000000238F09A00, 0x0000000239109A00, 0x0000000239309A00, 0x0000000239509A00, 0x0000000239709A00, 0x0000000239909A00, 0x0000000239B09A00, 0x0000000239D09A00, 0x0000000239F09A00, 0x000000023A109A00, 0x000000023A309A00, 0x000000023A509A00, 0x000000023A709A00, 0x000000023A909A00, 0x000000023AB09A00, 0x000000023AD09A00, 0x000000023AF09A00, 0x000000023B109A00, 0x000000023B309A00, 0x000000023B509A00, 0x000000023B709A00, 0x000000023B909A00, 0x000000023BB09A00, 0x000000023BD09A00, 0x000000023BF09A00, 0x000000023C109A00, 0x000000023C309A00, 0x000000023C509A00, 0x000000023C709A00, 0x000000023C909A00, 0x000000023CB09A00, 0x000000023CD09A00, 0x000000023CF09A00, 0x000000023D109A00, 0x000000023D309A00, 0x0000000173709A00, 0x000000023D509A00, 0x000000023D709A00, 0x000000023D909A00, 0x000000023DB09A00, 0x000000023DD09A00, 0x000000023DF09A00, 0x000000023E109A00, 0x000000023E309A00, 0x000000023E509A00, 0x000000023E709A00, 0x000000023E909A00, 0x000000023EB09A00, 0x000000023ED09A00, 0x000000023EF09A00, 0x000000023F109A00, 0x0000000164109A00, 0x000000023F309A00, 0x000000023F509A00, 0x000000023F709A00, 0x000000023F909A00, 0x000000023FB09A00, 0x000000023FD09A00, 0x000000023FF09A00, 0x0000000240109A00, 0x0000000161B09A00, 0x0000000240309A00, 0x0000000240509A00, 0x0000000240709A00, 0x0000000240909A00, 0x0000000240B09A00, 0x0000000240D09A00, 0x0000000240F09A00, 0x0000000241109A00, 0x0000000241309A00, 0x0000000241509A00, 0x0000000241709A00, 0x0000000241909A00, 0x0000000241B09A00, 0x0000000241D09A00, 0x0000000241F09A00, 0x0000000242109A00, 0x0000000242309A00, 0x0000000242509A00, 0x0000000242709A00, 0x0000000242909A00, 0x0000000242B09A00, 0x0000000242D09A00, 0x0000000242F09A00, 0x0000000243109A00, 0x0000000243309A00, 0x0000000243509A00, 0x0000000243709A00, 0x0000000243909A00, 0x0000000243B09A00, 0x0000000243D09A00, 0x0000000243F09A00, 0x0000000244109A00, 0x0000000244309A00, 0x0000000244509A00, 0x0000000244709A00, 0x0000000244909A00, 0x0000000244B09A00, 0x0000000244D09A00, 0x0000000244F09A00, 0x0000000245109A00, 0x0000000245309A00, 0x0000000245509A00, 0x0000000245709A00, 0x0000000245909A00, 0x0000000245B09A00, 0x0000000245D09A00, 0x0000000245F09A00, 0x0000000246109A00, 0x0000000246309A00, 0x0000000246509A00, 0x0000000246709A00, 0x0000000246909A00, 0x0000000246B09A00, 0x0000000246D09A00, 0x0000000179D09A00, 0x0000000246F09A00, 0x0000000247109A00, 0x0000000247309A00, 0x0000000247509A00, 0x0000000247709A00, 0x0000000247909A00, 0x0000000247B09A00, 0x0000000247D09A00, 0x0000000247F09A00, 0x0000000248109A00, 0x0000000248309A00, 0x0000000248509A00, 0x00000001BC709A00, 0x0000000248709A00, 0x0000000248909A00, 0x0000000248B09A00, 0x0000000248D09A00, 0x0000000248F09A00, 0x0000000249109A00, 0x0000000249309A00, 0x0000000249509A00, 0x0000000249709A00, 0x0000000249909A00, 0x0000000249B09A00, 0x0000000249D09A00, 0x0000000249F09A00, 0x000000024A109A00, 0x000000024A309A00, 0x000000024A509A00, 0x000000024A709A00, 0x000000024A909A00, 0x000000024AB09A00, 0x000000024AD09A00, 0x000000024AF09A00, 0x000000024B109A00, 0x0000000174109A00, 0x000000024B309A00, 0x000000024B509A00, 0x000000024B709A00, 0x000000024B909A00, 0x000000024BB09A00, 0x000000024BD09A00, 0x000000024BF09A00, 0x000000024C109A00, 0x000000024C309A00, 0x000000024C509A00, 0x000000024C709A00, 0x000000024C909A00, 0x000000024CB09A00, 0x000000016DF09A00, 0x000000024CD09A00, 0x000000024CF09A00, 0x000000024D109A00, 0x000000024D309A00, 0x000000024D509A00, 0x000000024D709A00, 0x000000024D909A00, 0x000000024DB09A00, 0x000000024DD09A00, 0x000000024DF09A00, 0x000000024E109A00, 0x000000024E309A00, 0x000000024E509A00, 0x000000024E709A00, 0x000000024E909A00, 0x000000024EB09A00, 0x0000000171509A00, 0x000000024ED09A00, 0x0000000171B09A00, 0x000000024EF09A00, 0x000000024F109A00, 0x000000024F309A00, 0x000000024F509A00, 0x000000024F709A00, 0x000000024F909A00, 0x000000024FB09A00, 0x000000024FD09A00, 0x000000024FF09A00, 0x0000000250109A00, 0x0000000250309A00, 0x0000000250509A00, 0x0000000250709A00, 0x0000000250909A00, 0x000000016ED09A00, 0x0000000250B09A00, 0x0000000250D09A00, 0x0000000250F09A00, 0x0000000251109A00, 0x0000000251309A00, 0x0000000251509A00, 0x0000000251709A00, 0x0000000251909A00, 0x0000000251B09A00, 0x0000000251D09A00, 0x0000000251F09A00, 0x0000000252109A00, 0x0000000252309A00, 0x0000000252509A00, 0x0000000252709A00, 0x0000000252909A00, 0x0000000252B09A00, 0x0000000252D09A00, 0x0000000252F09A00, 0x0000000253109A00, 0x0000000253309A00, 0x0000000253509A00, 0x0000000164F09A00, 0x0000000253709A00, 0x0000000253909A00, 0x0000000253B09A00, 0x0000000253D09A00, 0x0000000253F09A00, 0x0000000254109A00, 0x0000000254309A00, 0x0000000254509A00, 0x0000000254709A00, 0x0000000254909A00, 0x0000000254B09A00, 0x0000000254D09A00, 0x0000000254F09A00, 0x0000000255109A00, 0x0000000255309A00, 0x00000001BD109A00, 0x0000000255509A00, 0x0000000255709A00, 0x0000000255909A00, 0x0000000255B09A00, 0x00000001BD909A00, 0x0000000255D09A00, 0x0000000255F09A00, 0x0000000256109A00, 0x0000000256309A00, 0x0000000256509A00, 0x0000000256709A00, 0x0000000256909A00, 0x0000000256B09A00, 0x0000000256D09A00, 0x0000000256F09A00, 0x0000000257109A00, 0x0000000257309A00, 0x0000000257509A00, 0x0000000257709A00, 0x0000000257909A00, 0x0000000257B09A00, 0x0000000257D09A00, 0x0000000257F09A00, 0x0000000258109A00, 0x0000000258309A00, 0x0000000258509A00, 0x0000000258709A00, 0x0000000258909A00, 0x0000000258B09A00, 0x0000000258D09A00, 0x0000000258F09A00, 0x0000000259109A00, 0x0000000259309A00, 0x0000000259509A00, 0x0000000259709A00, 0x0000000259909A00, 0x0000000259B09A00, 0x0000000259D09A00, 0x0000000259F09A00, 0x000000025A109A00, 0x000000025A309A00, 0x000000025A509A00, 0x000000025A709A00, 0x000000025A909A00, 0x000000025AB09A00, 0x000000025AD09A00, 0x000000025AF09A00, 0x000000025B109A00, 0x000000025B309A00, 0x000000025B509A00, 0x000000025B709A00, 0x000000025B909A00, 0x000000025BB09A00, 0x000000025BD09A00, 0x000000025BF09A00, 0x000000025C109A00, 0x000000025C309A00, 0x000000025C509A00, 0x000000025C709A00, 0x000000025C909A00, 0x000000025CB09A00, 0x0000000169109A00, 0x000000025CD09A00, 0x000000025CF09A00, 0x000000025D109A00, 0x000000025D309A00, 0x000000025D509A00, 0x000000025D709A00, 0x000000025D909A00, 0x000000025DB09A00, 0x000000025DD09A00, 0x000000025DF09A00, 0x000000025E109A00, 0x000000025E309A00, 0x000000025E509A00, 0x000000025E709A00, 0x000000025E909A00, 0x000000025EB09A00, 0x000000025ED09A00, 0x000000025EF09A00, 0x000000025F109A00, 0x000000025F309A00, 0x000000025F509A00, 0x000000025F709A00, 0x000000025F909A00, 0x000000025FB09A00, 0x000000025FD09A00, 0x000000025FF09A00, 0x0000000260109A00, 0x0000000260309A00, 0x0000000260509A00, 0x0000000260709A00, 0x0000000260909A00, 0x0000000260B09A00, 0x0000000260D09A00, 0x0000000260F09A00, 0x0000000261109A00, 0x0000000261309A00, 0x0000000261509A00, 0x0000000261709A00, 0x0000000261909A00, 0x0000000261B09A00, 0x0000000261D09A00, 0x0000000261F09A00, 0x0000000262109A00, 0x0000000262309A00, 0x0000000262509A00, 0x0000000262709A00, 0x0000000262909A00, 0x0000000262B09A00, 0x0000000262C10800, 0x0000000263010800, 0x0000000263410800, 0x0000000263818800, 0x0000000263E18800, 0x0000000264410800, 0x0000000264810800, 0x0000000264C10800, 0x0000000265010800, 0x0000000265410800, 0x0000000265810800, 0x0000000265D12A00, 0x1A, 0x0000000266112A00, 0x0000000266408800, 0x0000000266608800, 0x0000000266808800, 0x0000000266A08800, 0x0000000266C08800, 0x0000000266E08800, 0x0000000267008800, 0x0000000267312A00, 0x0000000267712A00, 0x0000000267B1BA00, 0x000000026811BA00, 0x0000000268712A00, 0x0000000268B12A00, 0x0000000268F12A00, 0x0000000269312A00, 0x0000000269712A00, 0x0000000269B12A00, 0x0000000269F12A00, 0x000000026A312A00, 0x000000026A712A00, 0x000000026AB12A00, 0x000000026AF12A00, 0x000000026B312A00, 0x000000026B712A00, 0x000000026BB12A00, 0x000000026BF12A00, 0x000000026C312A00, 0x000000026C712A00, 0x000000026CB12A00, 0x000000026CF12A00, 0x000000026D312A00, 0x000000026D712A00, 0x000000026DB12A00, 0x000000026DF12A00, 0x000000026E312A00, 0x000000026E712A00, 0x000000026EB12A00, 0x000000026EF12A00, 0x000000026F312A00, 0x000000026F610800, 0x000000026FA08800, 0x000000026FC08800, 0x000000026FE08800, 0x0000000270008800, 0x0000000270208800, 0x0000000270408800, 0x0000000270608800, 0x0000000270808800, 0x0000000270A08800, 0x0000000270C08800, 0x0000000270E08800, 0x0000000271008800, 0x0000000271208800, 0x0000000271408800, 0x0000000271608800, 0x0000000271808800, 0x0000000271A08800, 0x0000000271C08800, 0x0000000271E08800, 0x0000000272008800, 0x0000000272208800, 0x0000000272408800, 0x0000000272608800, 0x0000000272808800, 0x0000000272A08800, 0x65A10800, 0x0000000272C08800, 0x0000000272E08800, 0x0000000273008800, 0x66210800, 0x0000000273208800, 0x0000000273408800, 0x0000000273608800, 0x0000000273808800, 0x0000000273A08800, 0x0000000273C08800, 0x0000000273E08800, 0x0000000274008800, 0x0000000274208800, 0x0000000274418800, 0x0000000274A18800, 0x0000000275018800, 0x0000000275618800, 0x0000000275C18800, 0x0000000276218800, 0x0000000276818800, 0x0000000276E18800, 0x0000000277408800, 0x0000000277618800, 0x0000000277C18800, 0x0000000278218800, 0x0000000278818800, 0x0000000278E10800, 0x0000000279210800, 0x0000000279610800, 0x0000000279A10800, 0x0000000279E10800, 0x000000027A210800, 0x000000027A610800, 0x000000027AA10800, 0x000000027AE10800, 0x000000027B210800, 0x000000027B610800, 0x000000027BA10800, 0x000000027BE10800, 0x000000027C210800, 0x000000027C610800, 0x000000027CA10800, 0x000000027CE10800, 0x000000027D210800, 0x000000027D610800, 0x000000027DA10800, 0x000000027DE10800, 0x000000027E210800, 0x000000027E610800, 0x000000027EA10800, 0x000000027EE10800, 0x000000027F210800, 0x000000027F610800, 0x000000027FA10800, 0x000000027FE10800, 0x0000000280210800, 0x0000000280610800, 0x0000000280A10800, 0x0000000280E10800, 0x0000000281210800, 0x0000000281610800, 0x0000000281A10800, 0x0000000281E10800, 0x0000000282210800, 0x0000000282610800, 0x0000000282A10800, 0x0000000282E10800, 0x0000000283210800, 0x0000000283610800, 0x0000000283A10800, 0x0000000283E10800, 0x0000000284210800, 0x0000000284610800, 0x0000000284A10800, 0x0000000284E10800, 0x0000000285210800, 0x0000000285610800, 0x0000000285A10800, 0x0000000285E10800, 0x0000000286210800, 0x0000000286610800, 0x0000000286A10800, 0x0000000286E10800, 0x0000000287210800, 0x0000000287610800, 0x0000000287A10800, 0x0000000287E10800, 0x0000000288210800, 0x0000000288610800, 0x0000000288A10800, 0x0000000288E10800, 0x0000000289210800, 0x0000000289610800, 0x0000000289A10800, 0x0000000289E10800, 0x000000028A210800, 0x000000028A610800, 0x000000028AA10800, 0x000000028AE10800, 0x000000028B210800, 0x000000028B610800, 0x000000028BA10800, 0x000000028BE10800, 0x000000028C210800, 0x000000028C610800, 0x000000028CA10800, 0x000000028CE10800, 0x000000028D210800, 0x000000028D610800, 0x000000028DA10800, 0x000000028DE10800, 0x000000028E210800, 0x000000028E610800, 0x000000028EA10800, 0x000000028EE10800, 0x000000028F218800, 0x000000028F818800, 0x000000028FE18800, 0x0000000290418800, 0x0000000290A18800, 0x0000000291018800, 0x0000000291618800, 0x0000000291C18800, 0x0000000292218800, 0x0000000292810800, 0x0000000292C10800, 0x0000000293010800, 0x0000000293410800, 0x0000000293810800, 0x0000000293C10800, 0x0000000294010800, 0x0000000294410800, 0x0000000294810800, 0x0000000294C10800, 0x0000000295010800, 0x0000000295410800, 0x0000000295810800, 0x0000000295C10800, 0x0000000296010800, 0x0000000296410800, 0x0000000296818800, 0x0000000296E18800, 0x0000000297410800, 0x0000000297810800, 0x0000000297C10800, 0x0000000298010800, 0x0000000298410800, 0x0000000298810800, 0x0000000298C10800, 0x0000000299010800, 0x0000000299410800, 0x0000000299810800, 0x0000000299C10800, 0x000000029A018800, 0x000000029A618800, 0x000000029AC18800, 0x000000029B210800, 0x000000029B610800, 0x000000029BA10800, 0x000000029BE10800, 0x000000029C210800, 0x000000029C610800, 0x000000029CA10800, 0x000000029CE10800, 0x000000029D210800, 0x000000029D610800, 0x000000029DA10800, 0x000000029DE10800, 0x000000029E210800, 0x000000029E610800, 0x000000029EA10800, 0x000000029EE10800, 0x000000029F210800, 0x000000029F610800, 0x000000029FA10800, 0x000000029FE10800, 0x00000002A0210800, 0x00000002A0610800, 0x00000002A0A10800, 0x00000002A0E10800, 0x00000002A1210800, 0x00000002A1610800, 0x00000002A1A10800, 0x00000002A1E10800, 0x00000002A2218800, 0x00000002A2818800, 0x00000002A2E18800, 0x00000002A3418800, 0x00000002A3A18800, 0x00000002A4018800, 0x00000002A4618800, 0x00000002A4C18800, 0x00000002A5218800, 0x00000002A5818800, 0x00000002A5E18800, 0x00000002A6418800, 0x00000002A6A18800, 0x00000002A7018800, 0x00000002A7618800, 0x00000002A7C18800, 0x00000002A8218800, 0x00000002A8818800, 0x00000002A8E18800, 0x00000002A9418800, 0x00000002A9A18800, 0x00000002AA018800, 0x00000002AA618800, 0x00000002AAC18800, 0x00000002AB218800, 0x00000002AB818800, 0x00000002ABE18800, 0x00000002AC418800, 0x00000002ACA18800, 0x00000002AD018800, 0x00000002AD618800, 0x00000002ADC18800, 0x00000002AE218800, 0x00000002AE818800, 0x00000002AEE18800, 0x00000002AF418800, 0x00000002AFA18800, 0x00000002B0018800, 0x00000002B0618800, 0x00000002B0C18800, 0x00000002B1218800, 0x00000002B1818800, 0x00000002B1E18800, 0x00000002B2418800, 0x00000002B2A18800, 0x00000002B3018800, 0x00000002B3618800, 0x00000002B3C18800, 0x00000002B4218800, 0x00000002B4818800, 0x00000002B4E18800, 0x00000002B5418800, 0x00000002B5A18800, 0x00000002B6018800, 0x00000002B6618800, 0x00000002B6C18800, 0x00000002B7218800, 0x00000002B7818800, 0x00000002B7E18800, 0x00000002B8418800, 0x00000002B8A18800, 0x00000002B9018800, 0x00000002B9618800, 0x00000002B9C18800, 0x00000002BA218800, 0x00000002BA818800, 0x00000002BAE18800, 0x00000002BB418800, 0x00000002BBA18800, 0x00000002BC018800, 0x00000002BC618800, 0x00000002BCC18800, 0x00000002BD218800, 0x00000002BD818800, 0x00000002BDE18800, 0x00000002BE418800, 0x00000002BEA18800, 0x00000002BF018800, 0x00000002BF618800, 0x00000002BFC18800, 0x00000002C0218800, 0x00000002C0818800, 0x00000002C0E18800, 0x00000002C1418800, 0x00000002C1A18800, 0x00000002C2018800, 0x00000002C2618800, 0x00000002C2C18800, 0x00000002C3218800, 0x00000002C3818800, 0x00000002C3E18800, 0x00000002C4418800, 0x00000002C4A18800, 0x00000002C5018800, 0x00000002C5618800, 0x00000002C5C18800, 0x00000002C6220800, 0x00000002C6A20800, 0x00000002C7220800, 0x00000002C7A20800, 0x00000002C8220800, 0x00000002C8A20800, 0x00000002C9220800, 0x00000002C9A18800, 0x00000002CA090800, 0x00000002CC440800, 0x00000002CD420800, 0x00000002CDC08800, 0x00000002CDE08800, 0x00000002CE008800, 0x00000002CE208800, 0x4DA08800, 0x00000002CE408800, 0x00000002CE608800, 0x00000002CE808800, 0x00000002CEA08800, 0x00000002CEC08800, 0x00000002CEE08800, 0x00000002CF008800, 0x00000002CF208800, 0x00000002CF408800, 0x00000002CF608800, 0x00000002CF808800, 0x00000002CFA08800, 0x00000002CFC08800, 0x00000002CFE08800, 0x00000002D0008800, 0x0000000140E08800, 0x0000000141008800, 0x00000002D0208800, 0x00000002D0408800, 0x00000002D0608800, 0x00000002D0808800, 0x00000002D0A08800, 0x00000002D0C08800, 0x00000002D0E08800, 0x00000002D1008800, 0x00000002D1208800, 0x00000002D1408800, 0x00000002D1608800, 0x00000002D1808800, 0x00000002D1A08800, 0x00000002D1C08800, 0x00000002D1E08800, 0x00000002D2008800, 0x00000002D2210800, 0x00000002D2610800, 0x00000002D2A10800, 0x00000002D2E10800, 0x00000002D3210800, 0x00000002D3610800, 0x00000002D3A10800, 0x00000002D3E10800, 0x00000002D4210800, 0x00000002D4610800, 0x00000002D4A10800, 0x00000002D4E10800, 0x00000002D5210800, 0x00000002D5610800, 0x00000002D5A08800, 0x63610800, 0x63A10800, 0x63E10800, 0x64210800, 0x64610800, 0x00000002D5C08800, 0x00000002D5E08800, 0x00000002D6008800, 0x00000002D6208800, 0x00000002D6408800, 0x00000002D6608800, 0x00000002D6808800, 0x00000002D6A08800, 0x00000002D6C08800, 0x00000002D6E08800, 0x00000002D7008800, 0x00000002D7208800, 0x00000002D7408800, 0x00000002D7608800, 0x00000002D7808800, 0x00000002D7A08800, 0x00000002D7C08800, 0x00000002D7E08800, 0x00000002D8008800, 0x00000002D8208800, 0x00000002D8408800, 0x00000002D8608800, 0x00000002D8808800, 0x00000002D8A08800, 0x00000002D8C08800, 0x00000002D8E08800, 0x00000002D9008800, 0x00000002D9208800, 0x00000002D9408800, 0x00000002D9618800, 0x00000002D9C18800, 0x00000002DA218800, 0x00000002DA810800, 0x00000002DAC08800, 0x00000002DAE08800, 0x00000002DB008800, 0x00000002DB208800, 0x0000000119608800, 0x00000002DB408800, 0x00000002DB608800, 0x00000002DB808800, 0x00000002DBA08800, 0x00000002DBC08800, 0x00000002DBE08800, 0x00000002DC008800, 0x00000002DC208800, 0x00000002DC408800, 0x00000002DC608800, 0x00000002DC808800, 0x00000002DCA08800, 0x00000002DCC08800, 0x00000002DCE08800, 0x00000002DD008800, 0x00000002DD208800, 0x00000002DD408800, 0x00000002DD608800, 0x00000002DD808800, 0x00000002DDA08800, 0x00000002DDC08800, 0x00000002DDE08800, 0x00000002DE008800, 0x00000002DE208800, 0x00000002DE408800, 0x00000002DE608800, 0x00000002DE808800, 0x00000002DEA08800, 0x00000002DEC08800, 0x00000002DEE08800, 0x00000002DF008800, 0x00000002DF312000, 0x00000002DF712000, 0x00000002DFA08800, 0x00000002DFC08800, 0x00000002DFE08800, 0x00000002E0008800, 0x00000002E0208800, 0x00000002E0408800, 0x00000002E0608800, 0x00000002E0808800, 0x00000002E0A08800, 0x00000002E0C08800, 0x00000002E0E08800, 0x00000002E1008800, 0x00000002E1208800, 0x00000002E1408800, 0x00000002E1608800, 0x00000002E1808800, 0x00000002E1A08800, 0x00000002E1C08800, 0x00000002E1E08800, 0x00000002E2008800, 0x00000002E2208800, 0x00000002E2408800, 0x00000002E2608800, 0x00000002E2808800, 0x00000002E2A08800, 0x00000002E2C08800, 0x00000002E2E08800, 0x00000002E3008800, 0x00000002E3208800, 0x00000002E3408800, 0x00000002E3608800, 0x00000002E3808800, 0x00000002E3A08800, 0x00000002E3C08800, 0x00000002E3E08800, 0x00000002E4008800, 0x00000002E4208800, 0x00000002E4408800, 0x00000002E4608800, 0x00000002E4808800, 0x00000002E4A08800, 0x00000002E4C08800, 0x00000002E4E08800, 0x00000002E5008800, 0x00000002E5208800, 0x00000002E5408800, 0x00000002E5608800, 0x00000002E5808800, 0x00000002E5A08800, 0x00000002E5C08800, 0x00000002E5E08800, 0x00000002E6008800, 0x00000002E6208800, 0x00000002E6408800, 0x00000002E6712000, 0x00000002E6B12000, 0x00000002E6F12000, 0x00000002E7312000, 0x00000002E7712000, 0x00000002E7B12000, 0x00000002E7F12000, 0x00000002E8312000, 0x00000002E8712000, 0x00000002E8B12000, 0x00000002E8F12000, 0x00000002E9312500, 0x00000002E9712500, 0x00000002E9B12500, 0x00000002E9F12000, 0x00000002EA312000, 0x00000002EA712000, 0x00000002EAB12000, 0x00000002EAF12000, 0x00000002EB312000, 0x00000002EB712500, 0x00000002EBB12500, 0x00000002EBF12500, 0x00000002EC312500, 0x00000002EC712500, 0x00000002ECB1B500, 0x00000002ED11B500, 0x00000002ED71B500, 0x00000002EDD12500, 0x00000002EE112000, 0x00000002EE51B000, 0x06, 0x00000002EEB12A00, 0x00000002EEF12A00, 0x00000002EF31BA00, 0x00000002EF91BA00, 0x00000002EFF1BA00, 0x00000002F051BA00, 0x00000002F0B1BA00, 0xE2, 0x00000002F1112A00, 0x00000002F1512A00, 0x00000002F191BA00, 0x00000002F1F1BA00, 0x00000002F251BA00, 0x00000002F2B1BA00, 0x00000002F3008800, 0x00000002F3208800, 0x00000002F3408800, 0x00000002F3608800, 0x00000002F3808800, 0x00000002F3A08800, 0x00000002F3C08800, 0x00000002F3E08800, 0x00000002F4008800, 0x00000002F4208800, 0x00000002F4408800, 0x00000002F4608800, 0x00000002F4808800, 0x00000002F4A08800, 0x00000002F4C08800, 0x00000002F4E08800, 0x00000002F5008800, 0x00000002F5208800, 0x00000002F5408800, 0x00000002F5608800, 0x0000000126C08800, 0x00000002F5808800, 0x00000002F5A08800, 0x00000002F5C08800, 0x00000002F5E08800, 0x000000010C608800, 0x00000002F6008800, 0x00000002F6208800, 0x00000002F6408800, 0x00000002F6608800, 0x00000002F6808800, 0x00000002F6A08800, 0x00000002F6C08800, 0x00000002F6E08800, 0x00000002F7008800, 0x00000002F7208800, 0x00000002F7408800, 0x00000002F7608800, 0x00000002F7808800, 0x00000002F7A08800, 0x00000002F7C08800, 0x00000002F7E08800, 0x00000002F8008800, 0x00000002F8208800, 0x00000002F8408800, 0x00000002F8608800, 0x00000002F8808800, 0x00000002F8A08800, 0x00000002F8C08800, 0x00000002F8E08800, 0x00000002F9008800, 0x00000002F9208800, 0x00000002F9408800, 0x00000002F9608800, 0x00000002F9808800, 0x00000002F9A08800, 0x00000002F9C08800, 0x00000002F9E08800, 0x00000002FA008800, 0x00000002FA208800, 0x00000002FA408800, 0x00000002FA608800, 0x00000002FA808800, 0x00000002FAA08800, 0x00000002FAC08800, 0x00000002FAE08800, 0x00000002FB008800, 0x00000002FB208800, 0x00000002FB408800, 0x00000002FB608800, 0x00000002FB808800, 0x00000002FBA08800, 0x00000002FBC08800, 0x00000002FBE08800, 0x00000002FC008800, 0x00000002FC208800, 0x00000002FC408800, 0x00000002FC608800, 0x00000002FC808800, 0x00000002FCA08800, 0x00000002FCC10800, 0x00000002FD010800, 0x00000002FD410800, 0x00000002FD810800, 0x00000002FDC10800, 0x00000002FE010800, 0x00000002FE410800, 0x00000002FE810800, 0x00000002FEC10800, 0x00000002FF010800, 0x00000002FF410800, 0x00000002FF818800, 0x00000002FFE18800, 0x0000000300418800, 0x0000000300A18800, 0x0000000301018800, 0x0000000301618800, 0x0000000301C18800, 0x0000000302218800, 0x0000000302818800, 0x0000000302E18800, 0x0000000303418800, 0x0000000303A18800, 0x0000000304018800, 0x0000000304618800, 0x0000000304C18800, 0x0000000305218800, 0x0000000305818800, 0x0000000305E18800, 0x0000000306418800, 0x0000000306A18800, 0x0000000307018800, 0x0000000307618800, 0x0000000307C18800, 0x0000000308218800, 0x0000000308818800, 0x0000000308E18800, 0x0000000309418800, 0x0000000309A10800, 0x0000000309E10800, 0x000000030A210800, 0x000000030A610800, 0x000000030AA10800, 0x000000030AE18800, 0x000000030B410800, 0x000000030B810800, 0x000000030BC10800, 0x000000030C010800, 0x000000030C410800, 0x000000030C810800, 0x000000030CC10800, 0x000000030D008800, 0x000000030D208800, 0x0000000185410800, 0x000000030D408800, 0x000000030D608800, 0x000000030D808800, 0x000000030DA08800, 0x000000030DC08800, 0x0000000246408800, 0x000000030DE08800, 0x000000030E008800, 0x000000030E208800, 0x000000030E408800, 0x000000030E608800, 0x000000030E808800, 0x000000030EA08800, 0x000000030EC08800, 0x000000030EE08800, 0x000000030F008800, 0x000000030F208800, 0x000000030F408800, 0x000000030F608800, 0x000000030F808800, 0x000000030FA08800, 0x000000030FC08800, 0x000000030FE08800, 0x0000000310008800, 0x0000000310208800, 0x0000000310408800, 0x0000000310608800, 0x0000000310808800, 0x0000000310A08800, 0x0000000310C18800, 0x0000000311218800, 0x0000000311818800, 0x0000000311E18800, 0x0000000312418800, 0x0000000312A18800, 0x0000000313018800, 0x0000000313618800, 0x0000000313C18800, 0x0000000314208800, 0x0000000314408800, 0x0000000314709A00, 0x0000000314909A00, 0x0000000314B09A00, 0x0000000314D09A00, 0x0000000314F09A00, 0x0000000315109A00, 0x0000000315309A00, 0x0000000315509A00, 0x0000000315709A00, 0x0000000315909A00, 0x0000000315B09A00, 0x0000000315D09A00, 0x0000000315F09A00, 0x0000000316109A00, 0x0000000316309A00, 0x0000000316509A00, 0x0000000316709A00, 0x0000000316909A00, 0x000000030E309A00, 0x0000000316B09A00, 0x0000000316D09A00, 0x0000000316F09A00, 0x0000000317109A00, 0x0000000317309A00, 0x0000000317509A00, 0x0000000161709A00, 0x0000000317709A00, 0x0000000317909A00, 0x0000000317B09A00, 0x0000000317D09A00, 0x0000000310709A00, 0x0000000317F09A00, 0x0000000318109A00, 0x0000000318309A00, 0x0000000318509A00, 0x0000000318709A00, 0x0000000318909A00, 0x0000000318B09A00, 0x0000000318D09A00, 0x0000000318F09A00, 0x0000000319109A00, 0x0000000319309A00, 0x0000000319509A00, 0x0000000319709A00, 0x0000000319909A00, 0x0000000319B09A00, 0x0000000319D09A00, 0x0000000319F09A00, 0x000000031A109A00, 0x000000031A309A00, 0x000000031A509A00, 0x000000031A709A00, 0x000000031A909A00, 0x000000031AB09A00, 0x000000031AD09A00, 0x000000031AF09A00, 0x000000031B109A00, 0x000000031B309A00, 0x000000031B509A00, 0x000000031B709A00, 0x000000031B909A00, 0x000000031BB09A00, 0x000000031BD09A00, 0x000000031BF09A00, 0x000000031C109A00, 0x000000031C309A00, 0x000000031C509A00, 0x000000031C709A00, 0x000000031C909A00, 0x000000031CB09A00, 0x000000031CD09A00, 0x000000031CF09A00, 0x000000031D109A00, 0x000000031D309A00, 0x000000031D509A00, 0x000000031D709A00, 0x000000031D909A00, 0x000000030D509A00, 0x000000031DB09A00, 0x000000031DD09A00, 0x000000031DF09A00, 0x000000031E109A00, 0x000000031E309A00, 0x000000031E509A00, 0x000000031E709A00, 0x000000031E909A00, 0x000000031EB09A00, 0x000000031ED09A00, 0x000000031EF09A00, 0x000000031F109A00, 0x000000031F309A00, 0x000000031F509A00, 0x000000031F709A00, 0x000000031F909A00, 0x000000031FB09A00, 0x000000031FD09A00, 0x000000031FF09A00, 0x0000000320109A00, 0x0000000320309A00, 0x0000000164B09A00, 0x0000000320509A00, 0x0000000320709A00, 0x0000000320909A00, 0x0000000320B09A00, 0x0000000320D09A00, 0x0000000320F09A00, 0x0000000321109A00, 0x0000000321309A00, 0x0000000321509A00, 0x0000000321709A00, 0x0000000321909A00, 0x0000000321B09A00, 0x0000000321D09A00, 0x0000000321F09A00, 0x0000000322109A00, 0x0000000322309A00, 0x0000000322509A00, 0x0000000322709A00, 0x0000000322909A00, 0x0000000322B09A00, 0x0000000322D09A00, 0x0000000322F09A00, 0x0000000323109A00, 0x0000000323309A00, 0x0000000166309A00, 0x0000000323509A00, 0x0000000323709A00, 0x0000000323909A00, 0x0000000323B09A00, 0x0000000323D09A00, 0x0000000323F09A00, 0x0000000324109A00, 0x0000000324309A00, 0x0000000324509A00, 0x0000000324709A00, 0x0000000324909A00, 0x0000000324B09A00, 0x0000000324D09A00, 0x0000000324F09A00, 0x0000000325109A00, 0x0000000325309A00, 0x0000000325509A00, 0x0000000325709A00, 0x0000000325909A00, 0x0000000325B09A00, 0x0000000325D09A00, 0x0000000325F09A00, 0x0000000326109A00, 0x0000000326309A00, 0x0000000326509A00, 0x0000000326709A00, 0x0000000326909A00, 0x0000000326B09A00, 0x0000000326D09A00, 0x0000000326F09A00, 0x0000000327109A00, 0x0000000327309A00, 0x0000000327509A00, 0x0000000327709A00, 0x0000000327909A00, 0x0000000327B09A00, 0x0000000327D09A00, 0x0000000327F09A00, 0x0000000328109A00, 0x0000000328309A00, 0x0000000328509A00, 0x0000000328709A00, 0x0000000328909A00, 0x0000000328B09A00, 0x0000000328D09A00, 0x0000000328F09A00, 0x0000000329109A00, 0x0000000329309A00, 0x0000000329509A00, 0x0000000329709A00, 0x0000000329909A00, 0x0000000329B09A00, 0x0000000329D09A00, 0x0000000329F09A00, 0x000000032A109A00, 0x000000032A309A00, 0x000000032A509A00, 0x000000032A709A00, 0x000000032A909A00, 0x000000032AB09A00, 0x000000032AD09A00, 0x000000032AF09A00, 0x000000032B109A00, 0x000000032B309A00, 0x000000032B509A00, 0x000000032B709A00, 0x000000032B909A00, 0x000000032BB09A00, 0x000000032BD09A00, 0x000000032BF09A00, 0x000000032C109A00, 0x000000032C309A00, 0x000000032C509A00, 0x000000032C709A00, 0x000000032C909A00, 0x000000032CB09A00, 0x000000032CD09A00, 0x000000032CF09A00, 0x000000032D109A00, 0x000000032D309A00, 0x000000032D509A00, 0x000000032D709A00, 0x000000032D909A00, 0x000000032DB09A00, 0x000000032DD09A00, 0x000000032DF09A00, 0x000000032E109A00, 0x000000032E309A00, 0x000000032E509A00, 0x000000032E709A00, 0x000000032E909A00, 0x000000032EB09A00, 0x000000032ED09A00, 0x000000032EF09A00, 0x000000032F109A00, 0x000000032F309A00, 0x000000032F509A00, 0x000000032F709A00, 0x000000032F909A00, 0x000000032FB09A00, 0x000000032FD09A00, 0x000000032FF09A00, 0x0000000330109A00, 0x0000000330309A00, 0x0000000330509A00, 0x0000000330709A00, 0x0000000330909A00, 0x0000000330B09A00, 0x0000000330D09A00, 0x0000000330F09A00, 0x0000000331109A00, 0x0000000331309A00, 0x0000000331509A00, 0x0000000331709A00, 0x0000000331909A00, 0x0000000331B09A00, 0x0000000331D09A00, 0x0000000331F09A00, 0x0000000332109A00, 0x0000000332309A00, 0x0000000332509A00, 0x0000000332709A00, 0x0000000332909A00, 0x0000000332B09A00, 0x0000000332D09A00, 0x0000000332F09A00, 0x0000000333109A00, 0x0000000333309A00, 0x0000000333509A00, 0x0000000333709A00, 0x0000000333909A00, 0x0000000333B09A00, 0x0000000333D09A00, 0x0000000333F09A00, 0x0000000334109A00, 0x0000000334309A00, 0x0000000334509A00, 0x0000000334709A00, 0x0000000334909A00, 0x0000000334B09A00, 0x0000000334D09A00, 0x0000000334F09A00, 0x0000000335109A00, 0x0000000335309A00, 0x0000000335509A00, 0x0000000335709A00, 0x0000000335909A00, 0x0000000335B09A00, 0x0000000335D09A00, 0x0000000335F09A00, 0x0000000336109A00, 0x0000000336309A00, 0x0000000336509A00, 0x0000000336709A00, 0x0000000336909A00, 0x0000000336B09A00, 0x0000000336D09A00, 0x0000000336F09A00, 0x0000000337109A00, 0x0000000337309A00, 0x0000000337509A00, 0x0000000337709A00, 0x0000000337909A00, 0x0000000337B09A00, 0x0000000337D09A00, 0x0000000337F09A00, 0x0000000338109A00, 0x0000000338309A00, 0x0000000338509A00, 0x0000000338709A00, 0x0000000338909A00, 0x0000000338B09A00, 0x0000000338D09A00, 0x0000000338F09A00, 0x0000000339109A00, 0x0000000339309A00, 0x0000000339509A00, 0x0000000339709A00, 0x0000000339909A00, 0x0000000339B09A00, 0x0000000339D09A00, 0x0000000339F09A00, 0x000000033A109A00, 0x000000033A309A00, 0x000000033A509A00, 0x000000033A709A00, 0x000000033A909A00, 0x000000033AB09A00, 0x000000033AD09A00, 0x000000033AF09A00, 0x000000033B109A00, 0x000000033B309A00, 0x000000033B509A00, 0x000000033B709A00, 0x000000033B909A00, 0x000000033BB09A00, 0x000000033BD09A00, 0x000000033BF09A00, 0x000000033C109A00, 0x000000033C309A00, 0x000000033C509A00, 0x000000033C709A00, 0x000000033C909A00, 0x000000033CB09A00, 0x000000033CD09A00, 0x000000033CF09A00, 0x000000033D109A00, 0x000000033D309A00, 0x000000033D509A00, 0x000000033D709A00, 0x000000033D909A00, 0x000000033DB09A00, 0x000000033DD09A00, 0x000000033DF09A00, 0x000000033E109A00, 0x000000033E309A00, 0x000000033E509A00, 0x000000033E709A00, 0x000000033E909A00, 0x000000033EB09A00, 0x000000033ED09A00, 0x000000033EF09A00, 0x000000033F109A00, 0x000000033F309A00, 0x000000033F509A00, 0x000000033F709A00, 0x000000033F909A00, 0x000000033FB09A00, 0x000000033FD09A00, 0x000000033FF09A00, 0x0000000340109A00, 0x0000000340309A00, 0x0000000340509A00, 0x0000000340709A00, 0x0000000340909A00, 0x0000000340B09A00, 0x0000000340D09A00, 0x0000000340F09A00, 0x0000000341109A00, 0x0000000341309A00, 0x0000000341509A00, 0x0000000341709A00, 0x0000000341909A00, 0x0000000341B09A00, 0x0000000341D09A00, 0x0000000341F09A00, 0x0000000342109A00, 0x0000000342309A00, 0x0000000342509A00, 0x0000000342709A00, 0x0000000342909A00, 0x0000000342B09A00, 0x0000000342D09A00, 0x0000000342F09A00, 0x0000000343109A00, 0x0000000343309A00, 0x0000000343509A00, 0x0000000343709A00, 0x0000000343909A00, 0x0000000343B09A00, 0x0000000343D09A00, 0x0000000343F09A00, 0x0000000344109A00, 0x0000000344309A00, 0x0000000344509A00, 0x0000000344709A00, 0x0000000344909A00, 0x0000000344B09A00, 0x0000000171709A00, 0x0000000344D09A00, 0x0000000344F09A00, 0x0000000345109A00, 0x0000000345309A00, 0x0000000345509A00, 0x0000000345709A00, 0x0000000345909A00, 0x0000000345B09A00, 0x0000000345D09A00, 0x0000000345F09A00, 0x0000000346109A00, 0x0000000172509A00, 0x0000000346309A00, 0x0000000346509A00, 0x0000000346709A00, 0x0000000346909A00, 0x0000000346B09A00, 0x0000000346D09A00, 0x0000000346F09A00, 0x0000000347109A00, 0x0000000347309A00, 0x0000000347509A00, 0x0000000347709A00, 0x0000000347909A00, 0x0000000347B09A00, 0x0000000347D09A00, 0x0000000347F09A00, 0x0000000348109A00, 0x0000000348309A00, 0x0000000348509A00, 0x0000000348709A00, 0x0000000348909A00, 0x0000000348B09A00, 0x0000000348D09A00, 0x0000000348F09A00, 0x0000000349109A00, 0x0000000349309A00, 0x0000000349509A00, 0x0000000349709A00, 0x0000000349909A00, 0x0000000349B09A00, 0x0000000349D09A00, 0x0000000349F09A00, 0x000000034A109A00, 0x000000034A309A00, 0x000000034A509A00, 0x000000034A709A00, 0x000000034A909A00, 0x000000034AB09A00, 0x000000034AD09A00, 0x000000034AF09A00, 0x000000034B109A00, 0x000000034B309A00, 0x000000034B509A00, 0x000000034B709A00, 0x000000034B909A00, 0x000000034BB09A00, 0x000000034BD09A00, 0x000000034BF09A00, 0x000000034C109A00, 0x000000034C309A00, 0x000000034C509A00, 0x000000034C709A00, 0x000000034C909A00, 0x000000034CB09A00, 0x000000034CD09A00, 0x000000034CF09A00, 0x000000034D109A00, 0x000000034D309A00, 0x000000034D509A00, 0x000000034D709A00, 0x000000034D909A00, 0x000000034DB09A00, 0x000000034DD09A00, 0x0000000178509A00, 0x000000034DF09A00, 0x0000000178D09A00, 0x000000034E109A00, 0x000000034E309A00, 0x000000034E509A00, 0x000000034E709A00, 0x0000000179709A00, 0x000000034E909A00
+    };
+
+    // 7'688 bytes
+    inline constexpr std::array<std::uint64_t, 961> composition_keys{
+        0x07800338, 0x07A00338, 0x07C00338, 0x08200300, 0x08200301, 0x08200302, 0x08200303, 0x08200304, 0x08200306, 0x08200307, 0x08200308, 0x08200309, 0x0820030A, 0x0820030C, 0x0820030F, 0x08200311, 0x08200323, 0x08200325, 0x08200328, 0x08400307, 0x08400323, 0x08400331, 0x08600301, 0x08600302, 0x08600307, 0x0860030C, 0x08600327, 0x08800307, 0x0880030C, 0x08800323, 0x08800327, 0x0880032D, 0x08800331, 0x08A00300, 0x08A00301, 0x08A00302, 0x08A00303, 0x08A00304, 0x08A00306, 0x08A00307, 0x08A00308, 0x08A00309, 0x08A0030C, 0x08A0030F, 0x08A00311, 0x08A00323, 0x08A00327, 0x08A00328, 0x08A0032D, 0x08A00330, 0x08C00307, 0x08E00301, 0x08E00302, 0x08E00304, 0x08E00306, 0x08E00307, 0x08E0030C, 0x08E00327, 0x09000302, 0x09000307, 0x09000308, 0x0900030C, 0x09000323, 0x09000327, 0x0900032E, 0x09200300, 0x09200301, 0x09200302, 0x09200303, 0x09200304, 0x09200306, 0x09200307, 0x09200308, 0x09200309, 0x0920030C, 0x0920030F, 0x09200311, 0x09200323, 0x09200328, 0x09200330, 0x09400302, 0x09600301, 0x0960030C, 0x09600323, 0x09600327, 0x09600331, 0x09800301, 0x0980030C, 0x09800323, 0x09800327, 0x0980032D, 0x09800331, 0x09A00301, 0x09A00307, 0x09A00323, 0x09C00300, 0x09C00301, 0x09C00303, 0x09C00307, 0x09C0030C, 0x09C00323, 0x09C00327, 0x09C0032D, 0x09C00331, 0x09E00300, 0x09E00301, 0x09E00302, 0x09E00303, 0x09E00304, 0x09E00306, 0x09E00307, 0x09E00308, 0x09E00309, 0x09E0030B, 0x09E0030C, 0x09E0030F, 0x09E00311, 0x09E0031B, 0x09E00323, 0x09E00328, 0x0A000301, 0x0A000307, 0x0A400301, 0x0A400307, 0x0A40030C, 0x0A40030F, 0x0A400311, 0x0A400323, 0x0A400327, 0x0A400331, 0x0A600301, 0x0A600302, 0x0A600307, 0x0A60030C, 0x0A600323, 0x0A600326, 0x0A600327, 0x0A800307, 0x0A80030C, 0x0A800323, 0x0A800326, 0x0A800327, 0x0A80032D, 0x0A800331, 0x0AA00300, 0x0AA00301, 0x0AA00302, 0x0AA00303, 0x0AA00304, 0x0AA00306, 0x0AA00308, 0x0AA00309, 0x0AA0030A, 0x0AA0030B, 0x0AA0030C, 0x0AA0030F, 0x0AA00311, 0x0AA0031B, 0x0AA00323, 0x0AA00324, 0x0AA00328, 0x0AA0032D, 0x0AA00330, 0x0AC00303, 0x0AC00323, 0x0AE00300, 0x0AE00301, 0x0AE00302, 0x0AE00307, 0x0AE00308, 0x0AE00323, 0x0B000307, 0x0B000308, 0x0B200300, 0x0B200301, 0x0B200302, 0x0B200303, 0x0B200304, 0x0B200307, 0x0B200308, 0x0B200309, 0x0B200323, 0x0B400301, 0x0B400302, 0x0B400307, 0x0B40030C, 0x0B400323, 0x0B400331, 0x0C200300, 0x0C200301, 0x0C200302, 0x0C200303, 0x0C200304, 0x0C200306, 0x0C200307, 0x0C200308, 0x0C200309, 0x0C20030A, 0x0C20030C, 0x0C20030F, 0x0C200311, 0x0C200323, 0x0C200325, 0x0C200328, 0x0C400307, 0x0C400323, 0x0C400331, 0x0C600301, 0x0C600302, 0x0C600307, 0x0C60030C, 0x0C600327, 0x0C800307, 0x0C80030C, 0x0C800323, 0x0C800327, 0x0C80032D, 0x0C800331, 0x0CA00300, 0x0CA00301, 0x0CA00302, 0x0CA00303, 0x0CA00304, 0x0CA00306, 0x0CA00307, 0x0CA00308, 0x0CA00309, 0x0CA0030C, 0x0CA0030F, 0x0CA00311, 0x0CA00323, 0x0CA00327, 0x0CA00328, 0x0CA0032D, 0x0CA00330, 0x0CC00307, 0x0CE00301, 0x0CE00302, 0x0CE00304, 0x0CE00306, 0x0CE00307, 0x0CE0030C, 0x0CE00327, 0x0D000302, 0x0D000307, 0x0D000308, 0x0D00030C, 0x0D000323, 0x0D000327, 0x0D00032E, 0x0D000331, 0x0D200300, 0x0D200301, 0x0D200302, 0x0D200303, 0x0D200304, 0x0D200306, 0x0D200308, 0x0D200309, 0x0D20030C, 0x0D20030F, 0x0D200311, 0x0D200323, 0x0D200328, 0x0D200330, 0x0D400302, 0x0D40030C, 0x0D600301, 0x0D60030C, 0x0D600323, 0x0D600327, 0x0D600331, 0x0D800301, 0x0D80030C, 0x0D800323, 0x0D800327, 0x0D80032D, 0x0D800331, 0x0DA00301, 0x0DA00307, 0x0DA00323, 0x0DC00300, 0x0DC00301, 0x0DC00303, 0x0DC00307, 0x0DC0030C, 0x0DC00323, 0x0DC00327, 0x0DC0032D, 0x0DC00331, 0x0DE00300, 0x0DE00301, 0x0DE00302, 0x0DE00303, 0x0DE00304, 0x0DE00306, 0x0DE00307, 0x0DE00308, 0x0DE00309, 0x0DE0030B, 0x0DE0030C, 0x0DE0030F, 0x0DE00311, 0x0DE0031B, 0x0DE00323, 0x0DE00328, 0x0E000301, 0x0E000307, 0x0E400301, 0x0E400307, 0x0E40030C, 0x0E40030F, 0x0E400311, 0x0E400323, 0x0E400327, 0x0E400331, 0x0E600301, 0x0E600302, 0x0E600307, 0x0E60030C, 0x0E600323, 0x0E600326, 0x0E600327, 0x0E800307, 0x0E800308, 0x0E80030C, 0x0E800323, 0x0E800326, 0x0E800327, 0x0E80032D, 0x0E800331, 0x0EA00300, 0x0EA00301, 0x0EA00302, 0x0EA00303, 0x0EA00304, 0x0EA00306, 0x0EA00308, 0x0EA00309, 0x0EA0030A, 0x0EA0030B, 0x0EA0030C, 0x0EA0030F, 0x0EA00311, 0x0EA0031B, 0x0EA00323, 0x0EA00324, 0x0EA00328, 0x0EA0032D, 0x0EA00330, 0x0EC00303, 0x0EC00323, 0x0EE00300, 0x0EE00301, 0x0EE00302, 0x0EE00307, 0x0EE00308, 0x0EE0030A, 0x0EE00323, 0x0F000307, 0x0F000308, 0x0F200300, 0x0F200301, 0x0F200302, 0x0F200303, 0x0F200304, 0x0F200307, 0x0F200308, 0x0F200309, 0x0F20030A, 0x0F200323, 0x0F400301, 0x0F400302, 0x0F400307, 0x0F40030C, 0x0F400323, 0x0F400331, 0x15000300, 0x15000301, 0x15000342, 0x18400300, 0x18400301, 0x18400303, 0x18400309, 0x18800304, 0x18A00301, 0x18C00301, 0x18C00304, 0x18E00301, 0x19400300, 0x19400301, 0x19400303, 0x19400309, 0x19E00301, 0x1A800300, 0x1A800301, 0x1A800303, 0x1A800309, 0x1AA00301, 0x1AA00304, 0x1AA00308, 0x1AC00304, 0x1B000301, 0x1B800300, 0x1B800301, 0x1B800304, 0x1B80030C, 0x1C400300, 0x1C400301, 0x1C400303, 0x1C400309, 0x1C800304, 0x1CA00301, 0x1CC00301, 0x1CC00304, 0x1CE00301, 0x1D400300, 0x1D400301, 0x1D400303, 0x1D400309, 0x1DE00301, 0x1E800300, 0x1E800301, 0x1E800303, 0x1E800309, 0x1EA00301, 0x1EA00304, 0x1EA00308, 0x1EC00304, 0x1F000301, 0x1F800300, 0x1F800301, 0x1F800304, 0x1F80030C, 0x20400300, 0x20400301, 0x20400303, 0x20400309, 0x20600300, 0x20600301, 0x20600303, 0x20600309, 0x22400300, 0x22400301, 0x22600300, 0x22600301, 0x29800300, 0x29800301, 0x29A00300, 0x29A00301, 0x2B400307, 0x2B600307, 0x2C000307, 0x2C200307, 0x2D000301, 0x2D200301, 0x2D400308, 0x2D600308, 0x2FE00307, 0x34000300, 0x34000301, 0x34000303, 0x34000309, 0x34000323, 0x34200300, 0x34200301, 0x34200303, 0x34200309, 0x34200323, 0x35E00300, 0x35E00301, 0x35E00303, 0x35E00309, 0x35E00323, 0x36000300, 0x36000301, 0x36000303, 0x36000309, 0x36000323, 0x36E0030C, 0x3D400304, 0x3D600304, 0x44C00304, 0x44E00304, 0x45000306, 0x45200306, 0x45C00304, 0x45E00304, 0x5240030C, 0x72200300, 0x72200301, 0x72200304, 0x72200306, 0x72200313, 0x72200314, 0x72200345, 0x72A00300, 0x72A00301, 0x72A00313, 0x72A00314, 0x72E00300, 0x72E00301, 0x72E00313, 0x72E00314, 0x72E00345, 0x73200300, 0x73200301, 0x73200304, 0x73200306, 0x73200308, 0x73200313, 0x73200314, 0x73E00300, 0x73E00301, 0x73E00313, 0x73E00314, 0x74200314, 0x74A00300, 0x74A00301, 0x74A00304, 0x74A00306, 0x74A00308, 0x74A00314, 0x75200300, 0x75200301, 0x75200313, 0x75200314, 0x75200345, 0x75800345, 0x75C00345, 0x76200300, 0x76200301, 0x76200304, 0x76200306, 0x76200313, 0x76200314, 0x76200342, 0x76200345, 0x76A00300, 0x76A00301, 0x76A00313, 0x76A00314, 0x76E00300, 0x76E00301, 0x76E00313, 0x76E00314, 0x76E00342, 0x76E00345, 0x77200300, 0x77200301, 0x77200304, 0x77200306, 0x77200308, 0x77200313, 0x77200314, 0x77200342, 0x77E00300, 0x77E00301, 0x77E00313, 0x77E00314, 0x78200313, 0x78200314, 0x78A00300, 0x78A00301, 0x78A00304, 0x78A00306, 0x78A00308, 0x78A00313, 0x78A00314, 0x78A00342, 0x79200300, 0x79200301, 0x79200313, 0x79200314, 0x79200342, 0x79200345, 0x79400300, 0x79400301, 0x79400342, 0x79600300, 0x79600301, 0x79600342, 0x79C00345, 0x7A400301, 0x7A400308, 0x80C00308, 0x82000306, 0x82000308, 0x82600301, 0x82A00300, 0x82A00306, 0x82A00308, 0x82C00306, 0x82C00308, 0x82E00308, 0x83000300, 0x83000304, 0x83000306, 0x83000308, 0x83400301, 0x83C00308, 0x84600304, 0x84600306, 0x84600308, 0x8460030B, 0x84E00308, 0x85600308, 0x85A00308, 0x86000306, 0x86000308, 0x86600301, 0x86A00300, 0x86A00306, 0x86A00308, 0x86C00306, 0x86C00308, 0x86E00308, 0x87000300, 0x87000304, 0x87000306, 0x87000308, 0x87400301, 0x87C00308, 0x88600304, 0x88600306, 0x88600308, 0x8860030B, 0x88E00308, 0x89600308, 0x89A00308, 0x8AC00308, 0x8E80030F, 0x8EA0030F, 0x9B000308, 0x9B200308, 0x9D000308, 0x9D200308, 0xC4E00653, 0xC4E00654, 0xC4E00655, 0xC9000654, 0xC9400654, 0xD8200654, 0xDA400654, 0xDAA00654, 0x000000012500093C, 0x000000012600093C, 0x000000012660093C, 0x0000000138E009BE, 0x0000000138E009D7, 0x0000000168E00B3E, 0x0000000168E00B56, 0x0000000168E00B57, 0x0000000172400BD7, 0x0000000178C00BBE, 0x0000000178C00BD7, 0x0000000178E00BBE, 0x0000000188C00C56, 0x0000000197E00CD5, 0x0000000198C00CC2, 0x0000000198C00CD5, 0x0000000198C00CD6, 0x0000000199400CD5, 0x00000001A8C00D3E, 0x00000001A8C00D57, 0x00000001A8E00D3E, 0x00000001BB200DCA, 0x00000001BB200DCF, 0x00000001BB200DDF, 0x00000001BB800DCA, 0x0000000204A0102E, 0x0000000360A01B35, 0x0000000360E01B35, 0x0000000361201B35, 0x0000000361601B35, 0x0000000361A01B35, 0x0000000362201B35, 0x0000000367401B35, 0x0000000367801B35, 0x0000000367C01B35, 0x0000000367E01B35, 0x0000000368401B35, 0x00000003C6C00304, 0x00000003C6E00304, 0x00000003CB400304, 0x00000003CB600304, 0x00000003CC400307, 0x00000003CC600307, 0x00000003D4000302, 0x00000003D4000306, 0x00000003D4200302, 0x00000003D4200306, 0x00000003D7000302, 0x00000003D7200302, 0x00000003D9800302, 0x00000003D9A00302, 0x00000003E0000300, 0x00000003E0000301, 0x00000003E0000342, 0x00000003E0000345, 0x00000003E0200300, 0x00000003E0200301, 0x00000003E0200342, 0x00000003E0200345, 0x00000003E0400345, 0x00000003E0600345, 0x00000003E0800345, 0x00000003E0A00345, 0x00000003E0C00345, 0x00000003E0E00345, 0x00000003E1000300, 0x00000003E1000301, 0x00000003E1000342, 0x00000003E1000345, 0x00000003E1200300, 0x00000003E1200301, 0x00000003E1200342, 0x00000003E1200345, 0x00000003E1400345, 0x00000003E1600345, 0x00000003E1800345, 0x00000003E1A00345, 0x00000003E1C00345, 0x00000003E1E00345, 0x00000003E2000300, 0x00000003E2000301, 0x00000003E2200300, 0x00000003E2200301, 0x00000003E3000300, 0x00000003E3000301, 0x00000003E3200300, 0x00000003E3200301, 0x00000003E4000300, 0x00000003E4000301, 0x00000003E4000342, 0x00000003E4000345, 0x00000003E4200300, 0x00000003E4200301, 0x00000003E4200342, 0x00000003E4200345, 0x00000003E4400345, 0x00000003E4600345, 0x00000003E4800345, 0x00000003E4A00345, 0x00000003E4C00345, 0x00000003E4E00345, 0x00000003E5000300, 0x00000003E5000301, 0x00000003E5000342, 0x00000003E5000345, 0x00000003E5200300, 0x00000003E5200301, 0x00000003E5200342, 0x00000003E5200345, 0x00000003E5400345, 0x00000003E5600345, 0x00000003E5800345, 0x00000003E5A00345, 0x00000003E5C00345, 0x00000003E5E00345, 0x00000003E6000300, 0x00000003E6000301, 0x00000003E6000342, 0x00000003E6200300, 0x00000003E6200301, 0x00000003E6200342, 0x00000003E7000300, 0x00000003E7000301, 0x00000003E7000342, 0x00000003E7200300, 0x00000003E7200301, 0x00000003E7200342, 0x00000003E8000300, 0x00000003E8000301, 0x00000003E8200300, 0x00000003E8200301, 0x00000003E9000300, 0x00000003E9000301, 0x00000003E9200300, 0x00000003E9200301, 0x00000003EA000300, 0x00000003EA000301, 0x00000003EA000342, 0x00000003EA200300, 0x00000003EA200301, 0x00000003EA200342, 0x00000003EB200300, 0x00000003EB200301, 0x00000003EB200342, 0x00000003EC000300, 0x00000003EC000301, 0x00000003EC000342, 0x00000003EC000345, 0x00000003EC200300, 0x00000003EC200301, 0x00000003EC200342, 0x00000003EC200345, 0x00000003EC400345, 0x00000003EC600345, 0x00000003EC800345, 0x00000003ECA00345, 0x00000003ECC00345, 0x00000003ECE00345, 0x00000003ED000300, 0x00000003ED000301, 0x00000003ED000342, 0x00000003ED000345, 0x00000003ED200300, 0x00000003ED200301, 0x00000003ED200342, 0x00000003ED200345, 0x00000003ED400345, 0x00000003ED600345, 0x00000003ED800345, 0x00000003EDA00345, 0x00000003EDC00345, 0x00000003EDE00345, 0x00000003EE000345, 0x00000003EE800345, 0x00000003EF800345, 0x00000003F6C00345, 0x00000003F7E00300, 0x00000003F7E00301, 0x00000003F7E00342, 0x00000003F8C00345, 0x00000003FEC00345, 0x00000003FFC00300, 0x00000003FFC00301, 0x00000003FFC00342, 0x0000000432000338, 0x0000000432400338, 0x0000000432800338, 0x000000043A000338, 0x000000043A400338, 0x000000043A800338, 0x0000000440600338, 0x0000000441000338, 0x0000000441600338, 0x0000000444600338, 0x0000000444A00338, 0x0000000447800338, 0x0000000448600338, 0x0000000448A00338, 0x0000000449000338, 0x0000000449A00338, 0x000000044C200338, 0x000000044C800338, 0x000000044CA00338, 0x000000044E400338, 0x000000044E600338, 0x000000044EC00338, 0x000000044EE00338, 0x000000044F400338, 0x000000044F600338, 0x000000044F800338, 0x000000044FA00338, 0x0000000450400338, 0x0000000450600338, 0x0000000450C00338, 0x0000000450E00338, 0x0000000452200338, 0x0000000452400338, 0x0000000454400338, 0x0000000455000338, 0x0000000455200338, 0x0000000455600338, 0x0000000456400338, 0x0000000456600338, 0x0000000456800338, 0x0000000456A00338, 0x0000000608C03099, 0x0000000609603099, 0x0000000609A03099, 0x0000000609E03099, 0x000000060A203099, 0x000000060A603099, 0x000000060AA03099, 0x000000060AE03099, 0x000000060B203099, 0x000000060B603099, 0x000000060BA03099, 0x000000060BE03099, 0x000000060C203099, 0x000000060C803099, 0x000000060CC03099, 0x000000060D003099, 0x000000060DE03099, 0x000000060DE0309A, 0x000000060E403099, 0x000000060E40309A, 0x000000060EA03099, 0x000000060EA0309A, 0x000000060F003099, 0x000000060F00309A, 0x000000060F603099, 0x000000060F60309A, 0x0000000613A03099, 0x0000000614C03099, 0x0000000615603099, 0x0000000615A03099, 0x0000000615E03099, 0x0000000616203099, 0x0000000616603099, 0x0000000616A03099, 0x0000000616E03099, 0x0000000617203099, 0x0000000617603099, 0x0000000617A03099, 0x0000000617E03099, 0x0000000618203099, 0x0000000618803099, 0x0000000618C03099, 0x0000000619003099, 0x0000000619E03099, 0x0000000619E0309A, 0x000000061A403099, 0x000000061A40309A, 0x000000061AA03099, 0x000000061AA0309A, 0x000000061B003099, 0x000000061B00309A, 0x000000061B603099, 0x000000061B60309A, 0x000000061DE03099, 0x000000061E003099, 0x000000061E203099, 0x000000061E403099, 0x000000061FA03099, 0x00000020BA400307, 0x00000020BB400307, 0x00000022132110BA, 0x00000022136110BA, 0x0000002214A110BA, 0x0000002226211127, 0x0000002226411127, 0x0000002268E1133E, 0x0000002268E11357, 0x00000022704113C9, 0x00000022708113BB, 0x00000022716113C2, 0x00000022720113C9, 0x00000022784113B8, 0x00000022784113C2, 0x00000022784113C9, 0x00000022972114B0, 0x00000022972114BA, 0x00000022972114BD, 0x00000022B70115AF, 0x00000022B72115AF, 0x0000002326A11930, 0x0000002C23C1611E, 0x0000002C23C1611F, 0x0000002C23C16120, 0x0000002C23C16129, 0x0000002C2421611F, 0x0000002C24216120, 0x0000002C2441611F, 0x0000002C2521611F, 0x0000002DAC616D67, 0x0000002DACE16D67, 0x0000002DAD216D67
+    };
+
+    // 3'844 bytes
+    inline constexpr std::array<std::uint32_t, 961> composition_values{
+        0x226E, 0x2260, 0x226F, 0xC0, 0xC1, 0xC2, 0xC3, 0x0100, 0x0102, 0x0226, 0xC4, 0x1EA2, 0xC5, 0x01CD, 0x0200, 0x0202, 0x1EA0, 0x1E00, 0x0104, 0x1E02, 0x1E04, 0x1E06, 0x0106, 0x0108, 0x010A, 0x010C, 0xC7, 0x1E0A, 0x010E, 0x1E0C, 0x1E10, 0x1E12, 0x1E0E, 0xC8, 0xC9, 0xCA, 0x1EBC, 0x0112, 0x0114, 0x0116, 0xCB, 0x1EBA, 0x011A, 0x0204, 0x0206, 0x1EB8, 0x0228, 0x0118, 0x1E18, 0x1E1A, 0x1E1E, 0x01F4, 0x011C, 0x1E20, 0x011E, 0x0120, 0x01E6, 0x0122, 0x0124, 0x1E22, 0x1E26, 0x021E, 0x1E24, 0x1E28, 0x1E2A, 0xCC, 0xCD, 0xCE, 0x0128, 0x012A, 0x012C, 0x0130, 0xCF, 0x1EC8, 0x01CF, 0x0208, 0x020A, 0x1ECA, 0x012E, 0x1E2C, 0x0134, 0x1E30, 0x01E8, 0x1E32, 0x0136, 0x1E34, 0x0139, 0x013D, 0x1E36, 0x013B, 0x1E3C, 0x1E3A, 0x1E3E, 0x1E40, 0x1E42, 0x01F8, 0x0143, 0xD1, 0x1E44, 0x0147, 0x1E46, 0x0145, 0x1E4A, 0x1E48, 0xD2, 0xD3, 0xD4, 0xD5, 0x014C, 0x014E, 0x022E, 0xD6, 0x1ECE, 0x0150, 0x01D1, 0x020C, 0x020E, 0x01A0, 0x1ECC, 0x01EA, 0x1E54, 0x1E56, 0x0154, 0x1E58, 0x0158, 0x0210, 0x0212, 0x1E5A, 0x0156, 0x1E5E, 0x015A, 0x015C, 0x1E60, 0x0160, 0x1E62, 0x0218, 0x015E, 0x1E6A, 0x0164, 0x1E6C, 0x021A, 0x0162, 0x1E70, 0x1E6E, 0xD9, 0xDA, 0xDB, 0x0168, 0x016A, 0x016C, 0xDC, 0x1EE6, 0x016E, 0x0170, 0x01D3, 0x0214, 0x0216, 0x01AF, 0x1EE4, 0x1E72, 0x0172, 0x1E76, 0x1E74, 0x1E7C, 0x1E7E, 0x1E80, 0x1E82, 0x0174, 0x1E86, 0x1E84, 0x1E88, 0x1E8A, 0x1E8C, 0x1EF2, 0xDD, 0x0176, 0x1EF8, 0x0232, 0x1E8E, 0x0178, 0x1EF6, 0x1EF4, 0x0179, 0x1E90, 0x017B, 0x017D, 0x1E92, 0x1E94, 0xE0, 0xE1, 0xE2, 0xE3, 0x0101, 0x0103, 0x0227, 0xE4, 0x1EA3, 0xE5, 0x01CE, 0x0201, 0x0203, 0x1EA1, 0x1E01, 0x0105, 0x1E03, 0x1E05, 0x1E07, 0x0107, 0x0109, 0x010B, 0x010D, 0xE7, 0x1E0B, 0x010F, 0x1E0D, 0x1E11, 0x1E13, 0x1E0F, 0xE8, 0xE9, 0xEA, 0x1EBD, 0x0113, 0x0115, 0x0117, 0xEB, 0x1EBB, 0x011B, 0x0205, 0x0207, 0x1EB9, 0x0229, 0x0119, 0x1E19, 0x1E1B, 0x1E1F, 0x01F5, 0x011D, 0x1E21, 0x011F, 0x0121, 0x01E7, 0x0123, 0x0125, 0x1E23, 0x1E27, 0x021F, 0x1E25, 0x1E29, 0x1E2B, 0x1E96, 0xEC, 0xED, 0xEE, 0x0129, 0x012B, 0x012D, 0xEF, 0x1EC9, 0x01D0, 0x0209, 0x020B, 0x1ECB, 0x012F, 0x1E2D, 0x0135, 0x01F0, 0x1E31, 0x01E9, 0x1E33, 0x0137, 0x1E35, 0x013A, 0x013E, 0x1E37, 0x013C, 0x1E3D, 0x1E3B, 0x1E3F, 0x1E41, 0x1E43, 0x01F9, 0x0144, 0xF1, 0x1E45, 0x0148, 0x1E47, 0x0146, 0x1E4B, 0x1E49, 0xF2, 0xF3, 0xF4, 0xF5, 0x014D, 0x014F, 0x022F, 0xF6, 0x1ECF, 0x0151, 0x01D2, 0x020D, 0x020F, 0x01A1, 0x1ECD, 0x01EB, 0x1E55, 0x1E57, 0x0155, 0x1E59, 0x0159, 0x0211, 0x0213, 0x1E5B, 0x0157, 0x1E5F, 0x015B, 0x015D, 0x1E61, 0x0161, 0x1E63, 0x0219, 0x015F, 0x1E6B, 0x1E97, 0x0165, 0x1E6D, 0x021B, 0x0163, 0x1E71, 0x1E6F, 0xF9, 0xFA, 0xFB, 0x0169, 0x016B, 0x016D, 0xFC, 0x1EE7, 0x016F, 0x0171, 0x01D4, 0x0215, 0x0217, 0x01B0, 0x1EE5, 0x1E73, 0x0173, 0x1E77, 0x1E75, 0x1E7D, 0x1E7F, 0x1E81, 0x1E83, 0x0175, 0x1E87, 0x1E85, 0x1E98, 0x1E89, 0x1E8B, 0x1E8D, 0x1EF3, 0xFD, 0x0177, 0x1EF9, 0x0233, 0x1E8F, 0xFF, 0x1EF7, 0x1E99, 0x1EF5, 0x017A, 0x1E91, 0x017C, 0x017E, 0x1E93, 0x1E95, 0x1FED, 0x0385, 0x1FC1, 0x1EA6, 0x1EA4, 0x1EAA, 0x1EA8, 0x01DE, 0x01FA, 0x01FC, 0x01E2, 0x1E08, 0x1EC0, 0x1EBE, 0x1EC4, 0x1EC2, 0x1E2E, 0x1ED2, 0x1ED0, 0x1ED6, 0x1ED4, 0x1E4C, 0x022C, 0x1E4E, 0x022A, 0x01FE, 0x01DB, 0x01D7, 0x01D5, 0x01D9, 0x1EA7, 0x1EA5, 0x1EAB, 0x1EA9, 0x01DF, 0x01FB, 0x01FD, 0x01E3, 0x1E09, 0x1EC1, 0x1EBF, 0x1EC5, 0x1EC3, 0x1E2F, 0x1ED3, 0x1ED1, 0x1ED7, 0x1ED5, 0x1E4D, 0x022D, 0x1E4F, 0x022B, 0x01FF, 0x01DC, 0x01D8, 0x01D6, 0x01DA, 0x1EB0, 0x1EAE, 0x1EB4, 0x1EB2, 0x1EB1, 0x1EAF, 0x1EB5, 0x1EB3, 0x1E14, 0x1E16, 0x1E15, 0x1E17, 0x1E50, 0x1E52, 0x1E51, 0x1E53, 0x1E64, 0x1E65, 0x1E66, 0x1E67, 0x1E78, 0x1E79, 0x1E7A, 0x1E7B, 0x1E9B, 0x1EDC, 0x1EDA, 0x1EE0, 0x1EDE, 0x1EE2, 0x1EDD, 0x1EDB, 0x1EE1, 0x1EDF, 0x1EE3, 0x1EEA, 0x1EE8, 0x1EEE, 0x1EEC, 0x1EF0, 0x1EEB, 0x1EE9, 0x1EEF, 0x1EED, 0x1EF1, 0x01EE, 0x01EC, 0x01ED, 0x01E0, 0x01E1, 0x1E1C, 0x1E1D, 0x0230, 0x0231, 0x01EF, 0x1FBA, 0x0386, 0x1FB9, 0x1FB8, 0x1F08, 0x1F09, 0x1FBC, 0x1FC8, 0x0388, 0x1F18, 0x1F19, 0x1FCA, 0x0389, 0x1F28, 0x1F29, 0x1FCC, 0x1FDA, 0x038A, 0x1FD9, 0x1FD8, 0x03AA, 0x1F38, 0x1F39, 0x1FF8, 0x038C, 0x1F48, 0x1F49, 0x1FEC, 0x1FEA, 0x038E, 0x1FE9, 0x1FE8, 0x03AB, 0x1F59, 0x1FFA, 0x038F, 0x1F68, 0x1F69, 0x1FFC, 0x1FB4, 0x1FC4, 0x1F70, 0x03AC, 0x1FB1, 0x1FB0, 0x1F00, 0x1F01, 0x1FB6, 0x1FB3, 0x1F72, 0x03AD, 0x1F10, 0x1F11, 0x1F74, 0x03AE, 0x1F20, 0x1F21, 0x1FC6, 0x1FC3, 0x1F76, 0x03AF, 0x1FD1, 0x1FD0, 0x03CA, 0x1F30, 0x1F31, 0x1FD6, 0x1F78, 0x03CC, 0x1F40, 0x1F41, 0x1FE4, 0x1FE5, 0x1F7A, 0x03CD, 0x1FE1, 0x1FE0, 0x03CB, 0x1F50, 0x1F51, 0x1FE6, 0x1F7C, 0x03CE, 0x1F60, 0x1F61, 0x1FF6, 0x1FF3, 0x1FD2, 0x0390, 0x1FD7, 0x1FE2, 0x03B0, 0x1FE7, 0x1FF4, 0x03D3, 0x03D4, 0x0407, 0x04D0, 0x04D2, 0x0403, 0x0400, 0x04D6, 0x0401, 0x04C1, 0x04DC, 0x04DE, 0x040D, 0x04E2, 0x0419, 0x04E4, 0x040C, 0x04E6, 0x04EE, 0x040E, 0x04F0, 0x04F2, 0x04F4, 0x04F8, 0x04EC, 0x04D1, 0x04D3, 0x0453, 0x0450, 0x04D7, 0x0451, 0x04C2, 0x04DD, 0x04DF, 0x045D, 0x04E3, 0x0439, 0x04E5, 0x045C, 0x04E7, 0x04EF, 0x045E, 0x04F1, 0x04F3, 0x04F5, 0x04F9, 0x04ED, 0x0457, 0x0476, 0x0477, 0x04DA, 0x04DB, 0x04EA, 0x04EB, 0x0622, 0x0623, 0x0625, 0x0624, 0x0626, 0x06C2, 0x06D3, 0x06C0, 0x0929, 0x0931, 0x0934, 0x09CB, 0x09CC, 0x0B4B, 0x0B48, 0x0B4C, 0x0B94, 0x0BCA, 0x0BCC, 0x0BCB, 0x0C48, 0x0CC0, 0x0CCA, 0x0CC7, 0x0CC8, 0x0CCB, 0x0D4A, 0x0D4C, 0x0D4B, 0x0DDA, 0x0DDC, 0x0DDE, 0x0DDD, 0x1026, 0x1B06, 0x1B08, 0x1B0A, 0x1B0C, 0x1B0E, 0x1B12, 0x1B3B, 0x1B3D, 0x1B40, 0x1B41, 0x1B43, 0x1E38, 0x1E39, 0x1E5C, 0x1E5D, 0x1E68, 0x1E69, 0x1EAC, 0x1EB6, 0x1EAD, 0x1EB7, 0x1EC6, 0x1EC7, 0x1ED8, 0x1ED9, 0x1F02, 0x1F04, 0x1F06, 0x1F80, 0x1F03, 0x1F05, 0x1F07, 0x1F81, 0x1F82, 0x1F83, 0x1F84, 0x1F85, 0x1F86, 0x1F87, 0x1F0A, 0x1F0C, 0x1F0E, 0x1F88, 0x1F0B, 0x1F0D, 0x1F0F, 0x1F89, 0x1F8A, 0x1F8B, 0x1F8C, 0x1F8D, 0x1F8E, 0x1F8F, 0x1F12, 0x1F14, 0x1F13, 0x1F15, 0x1F1A, 0x1F1C, 0x1F1B, 0x1F1D, 0x1F22, 0x1F24, 0x1F26, 0x1F90, 0x1F23, 0x1F25, 0x1F27, 0x1F91, 0x1F92, 0x1F93, 0x1F94, 0x1F95, 0x1F96, 0x1F97, 0x1F2A, 0x1F2C, 0x1F2E, 0x1F98, 0x1F2B, 0x1F2D, 0x1F2F, 0x1F99, 0x1F9A, 0x1F9B, 0x1F9C, 0x1F9D, 0x1F9E, 0x1F9F, 0x1F32, 0x1F34, 0x1F36, 0x1F33, 0x1F35, 0x1F37, 0x1F3A, 0x1F3C, 0x1F3E, 0x1F3B, 0x1F3D, 0x1F3F, 0x1F42, 0x1F44, 0x1F43, 0x1F45, 0x1F4A, 0x1F4C, 0x1F4B, 0x1F4D, 0x1F52, 0x1F54, 0x1F56, 0x1F53, 0x1F55, 0x1F57, 0x1F5B, 0x1F5D, 0x1F5F, 0x1F62, 0x1F64, 0x1F66, 0x1FA0, 0x1F63, 0x1F65, 0x1F67, 0x1FA1, 0x1FA2, 0x1FA3, 0x1FA4, 0x1FA5, 0x1FA6, 0x1FA7, 0x1F6A, 0x1F6C, 0x1F6E, 0x1FA8, 0x1F6B, 0x1F6D, 0x1F6F, 0x1FA9, 0x1FAA, 0x1FAB, 0x1FAC, 0x1FAD, 0x1FAE, 0x1FAF, 0x1FB2, 0x1FC2, 0x1FF2, 0x1FB7, 0x1FCD, 0x1FCE, 0x1FCF, 0x1FC7, 0x1FF7, 0x1FDD, 0x1FDE, 0x1FDF, 0x219A, 0x219B, 0x21AE, 0x21CD, 0x21CF, 0x21CE, 0x2204, 0x2209, 0x220C, 0x2224, 0x2226, 0x2241, 0x2244, 0x2247, 0x2249, 0x226D, 0x2262, 0x2270, 0x2271, 0x2274, 0x2275, 0x2278, 0x2279, 0x2280, 0x2281, 0x22E0, 0x22E1, 0x2284, 0x2285, 0x2288, 0x2289, 0x22E2, 0x22E3, 0x22AC, 0x22AD, 0x22AE, 0x22AF, 0x22EA, 0x22EB, 0x22EC, 0x22ED, 0x3094, 0x304C, 0x304E, 0x3050, 0x3052, 0x3054, 0x3056, 0x3058, 0x305A, 0x305C, 0x305E, 0x3060, 0x3062, 0x3065, 0x3067, 0x3069, 0x3070, 0x3071, 0x3073, 0x3074, 0x3076, 0x3077, 0x3079, 0x307A, 0x307C, 0x307D, 0x309E, 0x30F4, 0x30AC, 0x30AE, 0x30B0, 0x30B2, 0x30B4, 0x30B6, 0x30B8, 0x30BA, 0x30BC, 0x30BE, 0x30C0, 0x30C2, 0x30C5, 0x30C7, 0x30C9, 0x30D0, 0x30D1, 0x30D3, 0x30D4, 0x30D6, 0x30D7, 0x30D9, 0x30DA, 0x30DC, 0x30DD, 0x30F7, 0x30F8, 0x30F9, 0x30FA, 0x30FE, 0x000105C9, 0x000105E4, 0x0001109A, 0x0001109C, 0x000110AB, 0x0001112E, 0x0001112F, 0x0001134B, 0x0001134C, 0x00011383, 0x00011385, 0x0001138E, 0x00011391, 0x000113C7, 0x000113C5, 0x000113C8, 0x000114BC, 0x000114BB, 0x000114BE, 0x000115BA, 0x000115BB, 0x00011938, 0x00016121, 0x00016123, 0x00016125, 0x00016122, 0x00016126, 0x00016128, 0x00016127, 0x00016124, 0x00016D69, 0x00016D68, 0x00016D6A
+    };
+
+    // 27'092 bytes
+    inline constexpr std::array<std::uint32_t, 6773> decompositions{
+        0x20, 0x20, 0x0308, 0x61, 0x20, 0x0304, 0x32, 0x33, 0x20, 0x0301, 0x03BC, 0x20, 0x0327, 0x31, 0x6F, 0x31, 0x2044, 0x34, 0x31, 0x2044, 0x32, 0x33, 0x2044, 0x34, 0x41, 0x0300, 0x41, 0x0301, 0x41, 0x0302, 0x41, 0x0303, 0x41, 0x0308, 0x41, 0x030A, 0x43, 0x0327, 0x45, 0x0300, 0x45, 0x0301, 0x45, 0x0302, 0x45, 0x0308, 0x49, 0x0300, 0x49, 0x0301, 0x49, 0x0302, 0x49, 0x0308, 0x4E, 0x0303, 0x4F, 0x0300, 0x4F, 0x0301, 0x4F, 0x0302, 0x4F, 0x0303, 0x4F, 0x0308, 0x55, 0x0300, 0x55, 0x0301, 0x55, 0x0302, 0x55, 0x0308, 0x59, 0x0301, 0x61, 0x0300, 0x61, 0x0301, 0x61, 0x0302, 0x61, 0x0303, 0x61, 0x0308, 0x61, 0x030A, 0x63, 0x0327, 0x65, 0x0300, 0x65, 0x0301, 0x65, 0x0302, 0x65, 0x0308, 0x69, 0x0300, 0x69, 0x0301, 0x69, 0x0302, 0x69, 0x0308, 0x6E, 0x0303, 0x6F, 0x0300, 0x6F, 0x0301, 0x6F, 0x0302, 0x6F, 0x0303, 0x6F, 0x0308, 0x75, 0x0300, 0x75, 0x0301, 0x75, 0x0302, 0x75, 0x0308, 0x79, 0x0301, 0x79, 0x0308, 0x41, 0x0304, 0x61, 0x0304, 0x41, 0x0306, 0x61, 0x0306, 0x41, 0x0328, 0x61, 0x0328, 0x43, 0x0301, 0x63, 0x0301, 0x43, 0x0302, 0x63, 0x0302, 0x43, 0x0307, 0x63, 0x0307, 0x43, 0x030C, 0x63, 0x030C, 0x44, 0x030C, 0x64, 0x030C, 0x45, 0x0304, 0x65, 0x0304, 0x45, 0x0306, 0x65, 0x0306, 0x45, 0x0307, 0x65, 0x0307, 0x45, 0x0328, 0x65, 0x0328, 0x45, 0x030C, 0x65, 0x030C, 0x47, 0x0302, 0x67, 0x0302, 0x47, 0x0306, 0x67, 0x0306, 0x47, 0x0307, 0x67, 0x0307, 0x47, 0x0327, 0x67, 0x0327, 0x48, 0x0302, 0x68, 0x0302, 0x49, 0x0303, 0x69, 0x0303, 0x49, 0x0304, 0x69, 0x0304, 0x49, 0x0306, 0x69, 0x0306, 0x49, 0x0328, 0x69, 0x0328, 0x49, 0x0307, 0x49, 0x4A, 0x69, 0x6A, 0x4A, 0x0302, 0x6A, 0x0302, 0x4B, 0x0327, 0x6B, 0x0327, 0x4C, 0x0301, 0x6C, 0x0301, 0x4C, 0x0327, 0x6C, 0x0327, 0x4C, 0x030C, 0x6C, 0x030C, 0x4C, 0xB7, 0x6C, 0xB7, 0x4E, 0x0301, 0x6E, 0x0301, 0x4E, 0x0327, 0x6E, 0x0327, 0x4E, 0x030C, 0x6E, 0x030C, 0x02BC, 0x6E, 0x4F, 0x0304, 0x6F, 0x0304, 0x4F, 0x0306, 0x6F, 0x0306, 0x4F, 0x030B, 0x6F, 0x030B, 0x52, 0x0301, 0x72, 0x0301, 0x52, 0x0327, 0x72, 0x0327, 0x52, 0x030C, 0x72, 0x030C, 0x53, 0x0301, 0x73, 0x0301, 0x53, 0x0302, 0x73, 0x0302, 0x53, 0x0327, 0x73, 0x0327, 0x53, 0x030C, 0x73, 0x030C, 0x54, 0x0327, 0x74, 0x0327, 0x54, 0x030C, 0x74, 0x030C, 0x55, 0x0303, 0x75, 0x0303, 0x55, 0x0304, 0x75, 0x0304, 0x55, 0x0306, 0x75, 0x0306, 0x55, 0x030A, 0x75, 0x030A, 0x55, 0x030B, 0x75, 0x030B, 0x55, 0x0328, 0x75, 0x0328, 0x57, 0x0302, 0x77, 0x0302, 0x59, 0x0302, 0x79, 0x0302, 0x59, 0x0308, 0x5A, 0x0301, 0x7A, 0x0301, 0x5A, 0x0307, 0x7A, 0x0307, 0x5A, 0x030C, 0x7A, 0x030C, 0x73, 0x4F, 0x031B, 0x6F, 0x031B, 0x55, 0x031B, 0x75, 0x031B, 0x44, 0x5A, 0x030C, 0x44, 0x7A, 0x030C, 0x64, 0x7A, 0x030C, 0x4C, 0x4A, 0x4C, 0x6A, 0x6C, 0x6A, 0x4E, 0x4A, 0x4E, 0x6A, 0x6E, 0x6A, 0x41, 0x030C, 0x61, 0x030C, 0x49, 0x030C, 0x69, 0x030C, 0x4F, 0x030C, 0x6F, 0x030C, 0x55, 0x030C, 0x75, 0x030C, 0x55, 0x0308, 0x0304, 0x75, 0x0308, 0x0304, 0x55, 0x0308, 0x0301, 0x75, 0x0308, 0x0301, 0x55, 0x0308, 0x030C, 0x75, 0x0308, 0x030C, 0x55, 0x0308, 0x0300, 0x75, 0x0308, 0x0300, 0x41, 0x0308, 0x0304, 0x61, 0x0308, 0x0304, 0x41, 0x0307, 0x0304, 0x61, 0x0307, 0x0304, 0xC6, 0x0304, 0xE6, 0x0304, 0x47, 0x030C, 0x67, 0x030C, 0x4B, 0x030C, 0x6B, 0x030C, 0x4F, 0x0328, 0x6F, 0x0328, 0x4F, 0x0328, 0x0304, 0x6F, 0x0328, 0x0304, 0x01B7, 0x030C, 0x0292, 0x030C, 0x6A, 0x030C, 0x44, 0x5A, 0x44, 0x7A, 0x64, 0x7A, 0x47, 0x0301, 0x67, 0x0301, 0x4E, 0x0300, 0x6E, 0x0300, 0x41, 0x030A, 0x0301, 0x61, 0x030A, 0x0301, 0xC6, 0x0301, 0xE6, 0x0301, 0xD8, 0x0301, 0xF8, 0x0301, 0x41, 0x030F, 0x61, 0x030F, 0x41, 0x0311, 0x61, 0x0311, 0x45, 0x030F, 0x65, 0x030F, 0x45, 0x0311, 0x65, 0x0311, 0x49, 0x030F, 0x69, 0x030F, 0x49, 0x0311, 0x69, 0x0311, 0x4F, 0x030F, 0x6F, 0x030F, 0x4F, 0x0311, 0x6F, 0x0311, 0x52, 0x030F, 0x72, 0x030F, 0x52, 0x0311, 0x72, 0x0311, 0x55, 0x030F, 0x75, 0x030F, 0x55, 0x0311, 0x75, 0x0311, 0x53, 0x0326, 0x73, 0x0326, 0x54, 0x0326, 0x74, 0x0326, 0x48, 0x030C, 0x68, 0x030C, 0x41, 0x0307, 0x61, 0x0307, 0x45, 0x0327, 0x65, 0x0327, 0x4F, 0x0308, 0x0304, 0x6F, 0x0308, 0x0304, 0x4F, 0x0303, 0x0304, 0x6F, 0x0303, 0x0304, 0x4F, 0x0307, 0x6F, 0x0307, 0x4F, 0x0307, 0x0304, 0x6F, 0x0307, 0x0304, 0x59, 0x0304, 0x79, 0x0304, 0x68, 0x0266, 0x6A, 0x72, 0x0279, 0x027B, 0x0281, 0x77, 0x79, 0x20, 0x0306, 0x20, 0x0307, 0x20, 0x030A, 0x20, 0x0328, 0x20, 0x0303, 0x20, 0x030B, 0x0263, 0x6C, 0x78, 0x0295, 0x0300, 0x0301, 0x0313, 0x0308, 0x0301, 0x02B9, 0x20, 0x0345, 0x3B, 0xA8, 0x0301, 0x20, 0x0308, 0x0301, 0x0391, 0x0301, 0xB7, 0x0395, 0x0301, 0x0397, 0x0301, 0x0399, 0x0301, 0x039F, 0x0301, 0x03A5, 0x0301, 0x03A9, 0x0301, 0x03B9, 0x0308, 0x0301, 0x0399, 0x0308, 0x03A5, 0x0308, 0x03B1, 0x0301, 0x03B5, 0x0301, 0x03B7, 0x0301, 0x03B9, 0x0301, 0x03C5, 0x0308, 0x0301, 0x03B9, 0x0308, 0x03C5, 0x0308, 0x03BF, 0x0301, 0x03C5, 0x0301, 0x03C9, 0x0301, 0x03B2, 0x03B8, 0x03A5, 0x03D2, 0x0301, 0x03A5, 0x0301, 0x03D2, 0x0308, 0x03A5, 0x0308, 0x03C6, 0x03C0, 0x03BA, 0x03C1, 0x03C2, 0x0398, 0x03B5, 0x03A3, 0x0415, 0x0300, 0x0415, 0x0308, 0x0413, 0x0301, 0x0406, 0x0308, 0x041A, 0x0301, 0x0418, 0x0300, 0x0423, 0x0306, 0x0418, 0x0306, 0x0438, 0x0306, 0x0435, 0x0300, 0x0435, 0x0308, 0x0433, 0x0301, 0x0456, 0x0308, 0x043A, 0x0301, 0x0438, 0x0300, 0x0443, 0x0306, 0x0474, 0x030F, 0x0475, 0x030F, 0x0416, 0x0306, 0x0436, 0x0306, 0x0410, 0x0306, 0x0430, 0x0306, 0x0410, 0x0308, 0x0430, 0x0308, 0x0415, 0x0306, 0x0435, 0x0306, 0x04D8, 0x0308, 0x04D9, 0x0308, 0x0416, 0x0308, 0x0436, 0x0308, 0x0417, 0x0308, 0x0437, 0x0308, 0x0418, 0x0304, 0x0438, 0x0304, 0x0418, 0x0308, 0x0438, 0x0308, 0x041E, 0x0308, 0x043E, 0x0308, 0x04E8, 0x0308, 0x04E9, 0x0308, 0x042D, 0x0308, 0x044D, 0x0308, 0x0423, 0x0304, 0x0443, 0x0304, 0x0423, 0x0308, 0x0443, 0x0308, 0x0423, 0x030B, 0x0443, 0x030B, 0x0427, 0x0308, 0x0447, 0x0308, 0x042B, 0x0308, 0x044B, 0x0308, 0x0565, 0x0582, 0x0627, 0x0653, 0x0627, 0x0654, 0x0648, 0x0654, 0x0627, 0x0655, 0x064A, 0x0654, 0x0627, 0x0674, 0x0648, 0x0674, 0x06C7, 0x0674, 0x064A, 0x0674, 0x06D5, 0x0654, 0x06C1, 0x0654, 0x06D2, 0x0654, 0x0928, 0x093C, 0x0930, 0x093C, 0x0933, 0x093C, 0x0915, 0x093C, 0x0916, 0x093C, 0x0917, 0x093C, 0x091C, 0x093C, 0x0921, 0x093C, 0x0922, 0x093C, 0x092B, 0x093C, 0x092F, 0x093C, 0x09C7, 0x09BE, 0x09C7, 0x09D7, 0x09A1, 0x09BC, 0x09A2, 0x09BC, 0x09AF, 0x09BC, 0x0A32, 0x0A3C, 0x0A38, 0x0A3C, 0x0A16, 0x0A3C, 0x0A17, 0x0A3C, 0x0A1C, 0x0A3C, 0x0A2B, 0x0A3C, 0x0B47, 0x0B56, 0x0B47, 0x0B3E, 0x0B47, 0x0B57, 0x0B21, 0x0B3C, 0x0B22, 0x0B3C, 0x0B92, 0x0BD7, 0x0BC6, 0x0BBE, 0x0BC7, 0x0BBE, 0x0BC6, 0x0BD7, 0x0C46, 0x0C56, 0x0CBF, 0x0CD5, 0x0CC6, 0x0CD5, 0x0CC6, 0x0CD6, 0x0CC6, 0x0CC2, 0x0CC6, 0x0CC2, 0x0CD5, 0x0D46, 0x0D3E, 0x0D47, 0x0D3E, 0x0D46, 0x0D57, 0x0DD9, 0x0DCA, 0x0DD9, 0x0DCF, 0x0DD9, 0x0DCF, 0x0DCA, 0x0DD9, 0x0DDF, 0x0E4D, 0x0E32, 0x0ECD, 0x0EB2, 0x0EAB, 0x0E99, 0x0EAB, 0x0EA1, 0x0F0B, 0x0F42, 0x0FB7, 0x0F4C, 0x0FB7, 0x0F51, 0x0FB7, 0x0F56, 0x0FB7, 0x0F5B, 0x0FB7, 0x0F40, 0x0FB5, 0x0F71, 0x0F72, 0x0F71, 0x0F74, 0x0FB2, 0x0F80, 0x0FB2, 0x0F71, 0x0F80, 0x0FB3, 0x0F80, 0x0FB3, 0x0F71, 0x0F80, 0x0F71, 0x0F80, 0x0F92, 0x0FB7, 0x0F9C, 0x0FB7, 0x0FA1, 0x0FB7, 0x0FA6, 0x0FB7, 0x0FAB, 0x0FB7, 0x0F90, 0x0FB5, 0x1025, 0x102E, 0x10DC, 0x1B05, 0x1B35, 0x1B07, 0x1B35, 0x1B09, 0x1B35, 0x1B0B, 0x1B35, 0x1B0D, 0x1B35, 0x1B11, 0x1B35, 0x1B3A, 0x1B35, 0x1B3C, 0x1B35, 0x1B3E, 0x1B35, 0x1B3F, 0x1B35, 0x1B42, 0x1B35, 0x41, 0xC6, 0x42, 0x44, 0x45, 0x018E, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x0222, 0x50, 0x52, 0x54, 0x55, 0x57, 0x0250, 0x0251, 0x1D02, 0x62, 0x64, 0x65, 0x0259, 0x025B, 0x025C, 0x67, 0x6B, 0x6D, 0x014B, 0x0254, 0x1D16, 0x1D17, 0x70, 0x74, 0x75, 0x1D1D, 0x026F, 0x76, 0x1D25, 0x03B3, 0x03B4, 0x03C7, 0x69, 0x043D, 0x0252, 0x63, 0x0255, 0xF0, 0x66, 0x025F, 0x0261, 0x0265, 0x0268, 0x0269, 0x026A, 0x1D7B, 0x029D, 0x026D, 0x1D85, 0x029F, 0x0271, 0x0270, 0x0272, 0x0273, 0x0274, 0x0275, 0x0278, 0x0282, 0x0283, 0x01AB, 0x0289, 0x028A, 0x1D1C, 0x028B, 0x028C, 0x7A, 0x0290, 0x0291, 0x0292, 0x41, 0x0325, 0x61, 0x0325, 0x42, 0x0307, 0x62, 0x0307, 0x42, 0x0323, 0x62, 0x0323, 0x42, 0x0331, 0x62, 0x0331, 0x43, 0x0327, 0x0301, 0x63, 0x0327, 0x0301, 0x44, 0x0307, 0x64, 0x0307, 0x44, 0x0323, 0x64, 0x0323, 0x44, 0x0331, 0x64, 0x0331, 0x44, 0x0327, 0x64, 0x0327, 0x44, 0x032D, 0x64, 0x032D, 0x45, 0x0304, 0x0300, 0x65, 0x0304, 0x0300, 0x45, 0x0304, 0x0301, 0x65, 0x0304, 0x0301, 0x45, 0x032D, 0x65, 0x032D, 0x45, 0x0330, 0x65, 0x0330, 0x45, 0x0327, 0x0306, 0x65, 0x0327, 0x0306, 0x46, 0x0307, 0x66, 0x0307, 0x47, 0x0304, 0x67, 0x0304, 0x48, 0x0307, 0x68, 0x0307, 0x48, 0x0323, 0x68, 0x0323, 0x48, 0x0308, 0x68, 0x0308, 0x48, 0x0327, 0x68, 0x0327, 0x48, 0x032E, 0x68, 0x032E, 0x49, 0x0330, 0x69, 0x0330, 0x49, 0x0308, 0x0301, 0x69, 0x0308, 0x0301, 0x4B, 0x0301, 0x6B, 0x0301, 0x4B, 0x0323, 0x6B, 0x0323, 0x4B, 0x0331, 0x6B, 0x0331, 0x4C, 0x0323, 0x6C, 0x0323, 0x4C, 0x0323, 0x0304, 0x6C, 0x0323, 0x0304, 0x4C, 0x0331, 0x6C, 0x0331, 0x4C, 0x032D, 0x6C, 0x032D, 0x4D, 0x0301, 0x6D, 0x0301, 0x4D, 0x0307, 0x6D, 0x0307, 0x4D, 0x0323, 0x6D, 0x0323, 0x4E, 0x0307, 0x6E, 0x0307, 0x4E, 0x0323, 0x6E, 0x0323, 0x4E, 0x0331, 0x6E, 0x0331, 0x4E, 0x032D, 0x6E, 0x032D, 0x4F, 0x0303, 0x0301, 0x6F, 0x0303, 0x0301, 0x4F, 0x0303, 0x0308, 0x6F, 0x0303, 0x0308, 0x4F, 0x0304, 0x0300, 0x6F, 0x0304, 0x0300, 0x4F, 0x0304, 0x0301, 0x6F, 0x0304, 0x0301, 0x50, 0x0301, 0x70, 0x0301, 0x50, 0x0307, 0x70, 0x0307, 0x52, 0x0307, 0x72, 0x0307, 0x52, 0x0323, 0x72, 0x0323, 0x52, 0x0323, 0x0304, 0x72, 0x0323, 0x0304, 0x52, 0x0331, 0x72, 0x0331, 0x53, 0x0307, 0x73, 0x0307, 0x53, 0x0323, 0x73, 0x0323, 0x53, 0x0301, 0x0307, 0x73, 0x0301, 0x0307, 0x53, 0x030C, 0x0307, 0x73, 0x030C, 0x0307, 0x53, 0x0323, 0x0307, 0x73, 0x0323, 0x0307, 0x54, 0x0307, 0x74, 0x0307, 0x54, 0x0323, 0x74, 0x0323, 0x54, 0x0331, 0x74, 0x0331, 0x54, 0x032D, 0x74, 0x032D, 0x55, 0x0324, 0x75, 0x0324, 0x55, 0x0330, 0x75, 0x0330, 0x55, 0x032D, 0x75, 0x032D, 0x55, 0x0303, 0x0301, 0x75, 0x0303, 0x0301, 0x55, 0x0304, 0x0308, 0x75, 0x0304, 0x0308, 0x56, 0x0303, 0x76, 0x0303, 0x56, 0x0323, 0x76, 0x0323, 0x57, 0x0300, 0x77, 0x0300, 0x57, 0x0301, 0x77, 0x0301, 0x57, 0x0308, 0x77, 0x0308, 0x57, 0x0307, 0x77, 0x0307, 0x57, 0x0323, 0x77, 0x0323, 0x58, 0x0307, 0x78, 0x0307, 0x58, 0x0308, 0x78, 0x0308, 0x59, 0x0307, 0x79, 0x0307, 0x5A, 0x0302, 0x7A, 0x0302, 0x5A, 0x0323, 0x7A, 0x0323, 0x5A, 0x0331, 0x7A, 0x0331, 0x68, 0x0331, 0x74, 0x0308, 0x77, 0x030A, 0x79, 0x030A, 0x61, 0x02BE, 0x017F, 0x0307, 0x73, 0x0307, 0x41, 0x0323, 0x61, 0x0323, 0x41, 0x0309, 0x61, 0x0309, 0x41, 0x0302, 0x0301, 0x61, 0x0302, 0x0301, 0x41, 0x0302, 0x0300, 0x61, 0x0302, 0x0300, 0x41, 0x0302, 0x0309, 0x61, 0x0302, 0x0309, 0x41, 0x0302, 0x0303, 0x61, 0x0302, 0x0303, 0x41, 0x0323, 0x0302, 0x61, 0x0323, 0x0302, 0x41, 0x0306, 0x0301, 0x61, 0x0306, 0x0301, 0x41, 0x0306, 0x0300, 0x61, 0x0306, 0x0300, 0x41, 0x0306, 0x0309, 0x61, 0x0306, 0x0309, 0x41, 0x0306, 0x0303, 0x61, 0x0306, 0x0303, 0x41, 0x0323, 0x0306, 0x61, 0x0323, 0x0306, 0x45, 0x0323, 0x65, 0x0323, 0x45, 0x0309, 0x65, 0x0309, 0x45, 0x0303, 0x65, 0x0303, 0x45, 0x0302, 0x0301, 0x65, 0x0302, 0x0301, 0x45, 0x0302, 0x0300, 0x65, 0x0302, 0x0300, 0x45, 0x0302, 0x0309, 0x65, 0x0302, 0x0309, 0x45, 0x0302, 0x0303, 0x65, 0x0302, 0x0303, 0x45, 0x0323, 0x0302, 0x65, 0x0323, 0x0302, 0x49, 0x0309, 0x69, 0x0309, 0x49, 0x0323, 0x69, 0x0323, 0x4F, 0x0323, 0x6F, 0x0323, 0x4F, 0x0309, 0x6F, 0x0309, 0x4F, 0x0302, 0x0301, 0x6F, 0x0302, 0x0301, 0x4F, 0x0302, 0x0300, 0x6F, 0x0302, 0x0300, 0x4F, 0x0302, 0x0309, 0x6F, 0x0302, 0x0309, 0x4F, 0x0302, 0x0303, 0x6F, 0x0302, 0x0303, 0x4F, 0x0323, 0x0302, 0x6F, 0x0323, 0x0302, 0x4F, 0x031B, 0x0301, 0x6F, 0x031B, 0x0301, 0x4F, 0x031B, 0x0300, 0x6F, 0x031B, 0x0300, 0x4F, 0x031B, 0x0309, 0x6F, 0x031B, 0x0309, 0x4F, 0x031B, 0x0303, 0x6F, 0x031B, 0x0303, 0x4F, 0x031B, 0x0323, 0x6F, 0x031B, 0x0323, 0x55, 0x0323, 0x75, 0x0323, 0x55, 0x0309, 0x75, 0x0309, 0x55, 0x031B, 0x0301, 0x75, 0x031B, 0x0301, 0x55, 0x031B, 0x0300, 0x75, 0x031B, 0x0300, 0x55, 0x031B, 0x0309, 0x75, 0x031B, 0x0309, 0x55, 0x031B, 0x0303, 0x75, 0x031B, 0x0303, 0x55, 0x031B, 0x0323, 0x75, 0x031B, 0x0323, 0x59, 0x0300, 0x79, 0x0300, 0x59, 0x0323, 0x79, 0x0323, 0x59, 0x0309, 0x79, 0x0309, 0x59, 0x0303, 0x79, 0x0303, 0x03B1, 0x0313, 0x03B1, 0x0314, 0x03B1, 0x0313, 0x0300, 0x03B1, 0x0314, 0x0300, 0x03B1, 0x0313, 0x0301, 0x03B1, 0x0314, 0x0301, 0x03B1, 0x0313, 0x0342, 0x03B1, 0x0314, 0x0342, 0x0391, 0x0313, 0x0391, 0x0314, 0x0391, 0x0313, 0x0300, 0x0391, 0x0314, 0x0300, 0x0391, 0x0313, 0x0301, 0x0391, 0x0314, 0x0301, 0x0391, 0x0313, 0x0342, 0x0391, 0x0314, 0x0342, 0x03B5, 0x0313, 0x03B5, 0x0314, 0x03B5, 0x0313, 0x0300, 0x03B5, 0x0314, 0x0300, 0x03B5, 0x0313, 0x0301, 0x03B5, 0x0314, 0x0301, 0x0395, 0x0313, 0x0395, 0x0314, 0x0395, 0x0313, 0x0300, 0x0395, 0x0314, 0x0300, 0x0395, 0x0313, 0x0301, 0x0395, 0x0314, 0x0301, 0x03B7, 0x0313, 0x03B7, 0x0314, 0x03B7, 0x0313, 0x0300, 0x03B7, 0x0314, 0x0300, 0x03B7, 0x0313, 0x0301, 0x03B7, 0x0314, 0x0301, 0x03B7, 0x0313, 0x0342, 0x03B7, 0x0314, 0x0342, 0x0397, 0x0313, 0x0397, 0x0314, 0x0397, 0x0313, 0x0300, 0x0397, 0x0314, 0x0300, 0x0397, 0x0313, 0x0301, 0x0397, 0x0314, 0x0301, 0x0397, 0x0313, 0x0342, 0x0397, 0x0314, 0x0342, 0x03B9, 0x0313, 0x03B9, 0x0314, 0x03B9, 0x0313, 0x0300, 0x03B9, 0x0314, 0x0300, 0x03B9, 0x0313, 0x0301, 0x03B9, 0x0314, 0x0301, 0x03B9, 0x0313, 0x0342, 0x03B9, 0x0314, 0x0342, 0x0399, 0x0313, 0x0399, 0x0314, 0x0399, 0x0313, 0x0300, 0x0399, 0x0314, 0x0300, 0x0399, 0x0313, 0x0301, 0x0399, 0x0314, 0x0301, 0x0399, 0x0313, 0x0342, 0x0399, 0x0314, 0x0342, 0x03BF, 0x0313, 0x03BF, 0x0314, 0x03BF, 0x0313, 0x0300, 0x03BF, 0x0314, 0x0300, 0x03BF, 0x0313, 0x0301, 0x03BF, 0x0314, 0x0301, 0x039F, 0x0313, 0x039F, 0x0314, 0x039F, 0x0313, 0x0300, 0x039F, 0x0314, 0x0300, 0x039F, 0x0313, 0x0301, 0x039F, 0x0314, 0x0301, 0x03C5, 0x0313, 0x03C5, 0x0314, 0x03C5, 0x0313, 0x0300, 0x03C5, 0x0314, 0x0300, 0x03C5, 0x0313, 0x0301, 0x03C5, 0x0314, 0x0301, 0x03C5, 0x0313, 0x0342, 0x03C5, 0x0314, 0x0342, 0x03A5, 0x0314, 0x03A5, 0x0314, 0x0300, 0x03A5, 0x0314, 0x0301, 0x03A5, 0x0314, 0x0342, 0x03C9, 0x0313, 0x03C9, 0x0314, 0x03C9, 0x0313, 0x0300, 0x03C9, 0x0314, 0x0300, 0x03C9, 0x0313, 0x0301, 0x03C9, 0x0314, 0x0301, 0x03C9, 0x0313, 0x0342, 0x03C9, 0x0314, 0x0342, 0x03A9, 0x0313, 0x03A9, 0x0314, 0x03A9, 0x0313, 0x0300, 0x03A9, 0x0314, 0x0300, 0x03A9, 0x0313, 0x0301, 0x03A9, 0x0314, 0x0301, 0x03A9, 0x0313, 0x0342, 0x03A9, 0x0314, 0x0342, 0x03B1, 0x0300, 0x03B5, 0x0300, 0x03B7, 0x0300, 0x03B9, 0x0300, 0x03BF, 0x0300, 0x03C5, 0x0300, 0x03C9, 0x0300, 0x03B1, 0x0313, 0x0345, 0x03B1, 0x0314, 0x0345, 0x03B1, 0x0313, 0x0300, 0x0345, 0x03B1, 0x0314, 0x0300, 0x0345, 0x03B1, 0x0313, 0x0301, 0x0345, 0x03B1, 0x0314, 0x0301, 0x0345, 0x03B1, 0x0313, 0x0342, 0x0345, 0x03B1, 0x0314, 0x0342, 0x0345, 0x0391, 0x0313, 0x0345, 0x0391, 0x0314, 0x0345, 0x0391, 0x0313, 0x0300, 0x0345, 0x0391, 0x0314, 0x0300, 0x0345, 0x0391, 0x0313, 0x0301, 0x0345, 0x0391, 0x0314, 0x0301, 0x0345, 0x0391, 0x0313, 0x0342, 0x0345, 0x0391, 0x0314, 0x0342, 0x0345, 0x03B7, 0x0313, 0x0345, 0x03B7, 0x0314, 0x0345, 0x03B7, 0x0313, 0x0300, 0x0345, 0x03B7, 0x0314, 0x0300, 0x0345, 0x03B7, 0x0313, 0x0301, 0x0345, 0x03B7, 0x0314, 0x0301, 0x0345, 0x03B7, 0x0313, 0x0342, 0x0345, 0x03B7, 0x0314, 0x0342, 0x0345, 0x0397, 0x0313, 0x0345, 0x0397, 0x0314, 0x0345, 0x0397, 0x0313, 0x0300, 0x0345, 0x0397, 0x0314, 0x0300, 0x0345, 0x0397, 0x0313, 0x0301, 0x0345, 0x0397, 0x0314, 0x0301, 0x0345, 0x0397, 0x0313, 0x0342, 0x0345, 0x0397, 0x0314, 0x0342, 0x0345, 0x03C9, 0x0313, 0x0345, 0x03C9, 0x0314, 0x0345, 0x03C9, 0x0313, 0x0300, 0x0345, 0x03C9, 0x0314, 0x0300, 0x0345, 0x03C9, 0x0313, 0x0301, 0x0345, 0x03C9, 0x0314, 0x0301, 0x0345, 0x03C9, 0x0313, 0x0342, 0x0345, 0x03C9, 0x0314, 0x0342, 0x0345, 0x03A9, 0x0313, 0x0345, 0x03A9, 0x0314, 0x0345, 0x03A9, 0x0313, 0x0300, 0x0345, 0x03A9, 0x0314, 0x0300, 0x0345, 0x03A9, 0x0313, 0x0301, 0x0345, 0x03A9, 0x0314, 0x0301, 0x0345, 0x03A9, 0x0313, 0x0342, 0x0345, 0x03A9, 0x0314, 0x0342, 0x0345, 0x03B1, 0x0306, 0x03B1, 0x0304, 0x03B1, 0x0300, 0x0345, 0x03B1, 0x0345, 0x03B1, 0x0301, 0x0345, 0x03B1, 0x0342, 0x03B1, 0x0342, 0x0345, 0x0391, 0x0306, 0x0391, 0x0304, 0x0391, 0x0300, 0x0391, 0x0345, 0x20, 0x0313, 0x03B9, 0x20, 0x0342, 0xA8, 0x0342, 0x20, 0x0308, 0x0342, 0x03B7, 0x0300, 0x0345, 0x03B7, 0x0345, 0x03B7, 0x0301, 0x0345, 0x03B7, 0x0342, 0x03B7, 0x0342, 0x0345, 0x0395, 0x0300, 0x0397, 0x0300, 0x0397, 0x0345, 0x1FBF, 0x0300, 0x20, 0x0313, 0x0300, 0x1FBF, 0x0301, 0x20, 0x0313, 0x0301, 0x1FBF, 0x0342, 0x20, 0x0313, 0x0342, 0x03B9, 0x0306, 0x03B9, 0x0304, 0x03B9, 0x0308, 0x0300, 0x03B9, 0x0342, 0x03B9, 0x0308, 0x0342, 0x0399, 0x0306, 0x0399, 0x0304, 0x0399, 0x0300, 0x1FFE, 0x0300, 0x20, 0x0314, 0x0300, 0x1FFE, 0x0301, 0x20, 0x0314, 0x0301, 0x1FFE, 0x0342, 0x20, 0x0314, 0x0342, 0x03C5, 0x0306, 0x03C5, 0x0304, 0x03C5, 0x0308, 0x0300, 0x03C1, 0x0313, 0x03C1, 0x0314, 0x03C5, 0x0342, 0x03C5, 0x0308, 0x0342, 0x03A5, 0x0306, 0x03A5, 0x0304, 0x03A5, 0x0300, 0x03A1, 0x0314, 0xA8, 0x0300, 0x20, 0x0308, 0x0300, 0x60, 0x03C9, 0x0300, 0x0345, 0x03C9, 0x0345, 0x03C9, 0x0301, 0x0345, 0x03C9, 0x0342, 0x03C9, 0x0342, 0x0345, 0x039F, 0x0300, 0x03A9, 0x0300, 0x03A9, 0x0345, 0xB4, 0x20, 0x0301, 0x20, 0x0314, 0x2002, 0x20, 0x2003, 0x20, 0x2010, 0x20, 0x0333, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2032, 0x2032, 0x2032, 0x2032, 0x2032, 0x2035, 0x2035, 0x2035, 0x2035, 0x2035, 0x21, 0x21, 0x20, 0x0305, 0x3F, 0x3F, 0x3F, 0x21, 0x21, 0x3F, 0x2032, 0x2032, 0x2032, 0x2032, 0x30, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x2B, 0x2212, 0x3D, 0x28, 0x29, 0x6E, 0x52, 0x73, 0x61, 0x2F, 0x63, 0x61, 0x2F, 0x73, 0x43, 0xB0, 0x43, 0x63, 0x2F, 0x6F, 0x63, 0x2F, 0x75, 0x0190, 0xB0, 0x46, 0x0127, 0x4E, 0x6F, 0x51, 0x53, 0x4D, 0x54, 0x45, 0x4C, 0x54, 0x4D, 0x5A, 0x03A9, 0x46, 0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x46, 0x41, 0x58, 0x0393, 0x03A0, 0x2211, 0x31, 0x2044, 0x37, 0x31, 0x2044, 0x39, 0x31, 0x2044, 0x31, 0x30, 0x31, 0x2044, 0x33, 0x32, 0x2044, 0x33, 0x31, 0x2044, 0x35, 0x32, 0x2044, 0x35, 0x33, 0x2044, 0x35, 0x34, 0x2044, 0x35, 0x31, 0x2044, 0x36, 0x35, 0x2044, 0x36, 0x31, 0x2044, 0x38, 0x33, 0x2044, 0x38, 0x35, 0x2044, 0x38, 0x37, 0x2044, 0x38, 0x31, 0x2044, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x56, 0x56, 0x56, 0x49, 0x56, 0x49, 0x49, 0x56, 0x49, 0x49, 0x49, 0x49, 0x58, 0x58, 0x58, 0x49, 0x58, 0x49, 0x49, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x76, 0x76, 0x69, 0x76, 0x69, 0x69, 0x76, 0x69, 0x69, 0x69, 0x69, 0x78, 0x78, 0x69, 0x78, 0x69, 0x69, 0x30, 0x2044, 0x33, 0x2190, 0x0338, 0x2192, 0x0338, 0x2194, 0x0338, 0x21D0, 0x0338, 0x21D4, 0x0338, 0x21D2, 0x0338, 0x2203, 0x0338, 0x2208, 0x0338, 0x220B, 0x0338, 0x2223, 0x0338, 0x2225, 0x0338, 0x222B, 0x222B, 0x222B, 0x222B, 0x222B, 0x222E, 0x222E, 0x222E, 0x222E, 0x222E, 0x223C, 0x0338, 0x2243, 0x0338, 0x2245, 0x0338, 0x2248, 0x0338, 0x3D, 0x0338, 0x2261, 0x0338, 0x224D, 0x0338, 0x3C, 0x0338, 0x3E, 0x0338, 0x2264, 0x0338, 0x2265, 0x0338, 0x2272, 0x0338, 0x2273, 0x0338, 0x2276, 0x0338, 0x2277, 0x0338, 0x227A, 0x0338, 0x227B, 0x0338, 0x2282, 0x0338, 0x2283, 0x0338, 0x2286, 0x0338, 0x2287, 0x0338, 0x22A2, 0x0338, 0x22A8, 0x0338, 0x22A9, 0x0338, 0x22AB, 0x0338, 0x227C, 0x0338, 0x227D, 0x0338, 0x2291, 0x0338, 0x2292, 0x0338, 0x22B2, 0x0338, 0x22B3, 0x0338, 0x22B4, 0x0338, 0x22B5, 0x0338, 0x3008, 0x3009, 0x31, 0x30, 0x31, 0x31, 0x31, 0x32, 0x31, 0x33, 0x31, 0x34, 0x31, 0x35, 0x31, 0x36, 0x31, 0x37, 0x31, 0x38, 0x31, 0x39, 0x32, 0x30, 0x28, 0x31, 0x29, 0x28, 0x32, 0x29, 0x28, 0x33, 0x29, 0x28, 0x34, 0x29, 0x28, 0x35, 0x29, 0x28, 0x36, 0x29, 0x28, 0x37, 0x29, 0x28, 0x38, 0x29, 0x28, 0x39, 0x29, 0x28, 0x31, 0x30, 0x29, 0x28, 0x31, 0x31, 0x29, 0x28, 0x31, 0x32, 0x29, 0x28, 0x31, 0x33, 0x29, 0x28, 0x31, 0x34, 0x29, 0x28, 0x31, 0x35, 0x29, 0x28, 0x31, 0x36, 0x29, 0x28, 0x31, 0x37, 0x29, 0x28, 0x31, 0x38, 0x29, 0x28, 0x31, 0x39, 0x29, 0x28, 0x32, 0x30, 0x29, 0x31, 0x2E, 0x32, 0x2E, 0x33, 0x2E, 0x34, 0x2E, 0x35, 0x2E, 0x36, 0x2E, 0x37, 0x2E, 0x38, 0x2E, 0x39, 0x2E, 0x31, 0x30, 0x2E, 0x31, 0x31, 0x2E, 0x31, 0x32, 0x2E, 0x31, 0x33, 0x2E, 0x31, 0x34, 0x2E, 0x31, 0x35, 0x2E, 0x31, 0x36, 0x2E, 0x31, 0x37, 0x2E, 0x31, 0x38, 0x2E, 0x31, 0x39, 0x2E, 0x32, 0x30, 0x2E, 0x28, 0x61, 0x29, 0x28, 0x62, 0x29, 0x28, 0x63, 0x29, 0x28, 0x64, 0x29, 0x28, 0x65, 0x29, 0x28, 0x66, 0x29, 0x28, 0x67, 0x29, 0x28, 0x68, 0x29, 0x28, 0x69, 0x29, 0x28, 0x6A, 0x29, 0x28, 0x6B, 0x29, 0x28, 0x6C, 0x29, 0x28, 0x6D, 0x29, 0x28, 0x6E, 0x29, 0x28, 0x6F, 0x29, 0x28, 0x70, 0x29, 0x28, 0x71, 0x29, 0x28, 0x72, 0x29, 0x28, 0x73, 0x29, 0x28, 0x74, 0x29, 0x28, 0x75, 0x29, 0x28, 0x76, 0x29, 0x28, 0x77, 0x29, 0x28, 0x78, 0x29, 0x28, 0x79, 0x29, 0x28, 0x7A, 0x29, 0x53, 0x59, 0x71, 0x222B, 0x222B, 0x222B, 0x222B, 0x3A, 0x3A, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x2ADD, 0x0338, 0x2D61, 0x6BCD, 0x9F9F, 0x4E00, 0x4E28, 0x4E36, 0x4E3F, 0x4E59, 0x4E85, 0x4E8C, 0x4EA0, 0x4EBA, 0x513F, 0x5165, 0x516B, 0x5182, 0x5196, 0x51AB, 0x51E0, 0x51F5, 0x5200, 0x529B, 0x52F9, 0x5315, 0x531A, 0x5338, 0x5341, 0x535C, 0x5369, 0x5382, 0x53B6, 0x53C8, 0x53E3, 0x56D7, 0x571F, 0x58EB, 0x5902, 0x590A, 0x5915, 0x5927, 0x5973, 0x5B50, 0x5B80, 0x5BF8, 0x5C0F, 0x5C22, 0x5C38, 0x5C6E, 0x5C71, 0x5DDB, 0x5DE5, 0x5DF1, 0x5DFE, 0x5E72, 0x5E7A, 0x5E7F, 0x5EF4, 0x5EFE, 0x5F0B, 0x5F13, 0x5F50, 0x5F61, 0x5F73, 0x5FC3, 0x6208, 0x6236, 0x624B, 0x652F, 0x6534, 0x6587, 0x6597, 0x65A4, 0x65B9, 0x65E0, 0x65E5, 0x66F0, 0x6708, 0x6728, 0x6B20, 0x6B62, 0x6B79, 0x6BB3, 0x6BCB, 0x6BD4, 0x6BDB, 0x6C0F, 0x6C14, 0x6C34, 0x706B, 0x722A, 0x7236, 0x723B, 0x723F, 0x7247, 0x7259, 0x725B, 0x72AC, 0x7384, 0x7389, 0x74DC, 0x74E6, 0x7518, 0x751F, 0x7528, 0x7530, 0x758B, 0x7592, 0x7676, 0x767D, 0x76AE, 0x76BF, 0x76EE, 0x77DB, 0x77E2, 0x77F3, 0x793A, 0x79B8, 0x79BE, 0x7A74, 0x7ACB, 0x7AF9, 0x7C73, 0x7CF8, 0x7F36, 0x7F51, 0x7F8A, 0x7FBD, 0x8001, 0x800C, 0x8012, 0x8033, 0x807F, 0x8089, 0x81E3, 0x81EA, 0x81F3, 0x81FC, 0x820C, 0x821B, 0x821F, 0x826E, 0x8272, 0x8278, 0x864D, 0x866B, 0x8840, 0x884C, 0x8863, 0x897E, 0x898B, 0x89D2, 0x8A00, 0x8C37, 0x8C46, 0x8C55, 0x8C78, 0x8C9D, 0x8D64, 0x8D70, 0x8DB3, 0x8EAB, 0x8ECA, 0x8F9B, 0x8FB0, 0x8FB5, 0x9091, 0x9149, 0x91C6, 0x91CC, 0x91D1, 0x9577, 0x9580, 0x961C, 0x96B6, 0x96B9, 0x96E8, 0x9751, 0x975E, 0x9762, 0x9769, 0x97CB, 0x97ED, 0x97F3, 0x9801, 0x98A8, 0x98DB, 0x98DF, 0x9996, 0x9999, 0x99AC, 0x9AA8, 0x9AD8, 0x9ADF, 0x9B25, 0x9B2F, 0x9B32, 0x9B3C, 0x9B5A, 0x9CE5, 0x9E75, 0x9E7F, 0x9EA5, 0x9EBB, 0x9EC3, 0x9ECD, 0x9ED1, 0x9EF9, 0x9EFD, 0x9F0E, 0x9F13, 0x9F20, 0x9F3B, 0x9F4A, 0x9F52, 0x9F8D, 0x9F9C, 0x9FA0, 0x3012, 0x5344, 0x5345, 0x304B, 0x3099, 0x304D, 0x3099, 0x304F, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099, 0x3055, 0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305B, 0x3099, 0x305D, 0x3099, 0x305F, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066, 0x3099, 0x3068, 0x3099, 0x306F, 0x3099, 0x306F, 0x309A, 0x3072, 0x3099, 0x3072, 0x309A, 0x3075, 0x3099, 0x3075, 0x309A, 0x3078, 0x3099, 0x3078, 0x309A, 0x307B, 0x3099, 0x307B, 0x309A, 0x3046, 0x3099, 0x20, 0x3099, 0x20, 0x309A, 0x309D, 0x3099, 0x3088, 0x308A, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30AF, 0x3099, 0x30B1, 0x3099, 0x30B3, 0x3099, 0x30B5, 0x3099, 0x30B7, 0x3099, 0x30B9, 0x3099, 0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF, 0x3099, 0x30C1, 0x3099, 0x30C4, 0x3099, 0x30C6, 0x3099, 0x30C8, 0x3099, 0x30CF, 0x3099, 0x30CF, 0x309A, 0x30D2, 0x3099, 0x30D2, 0x309A, 0x30D5, 0x3099, 0x30D5, 0x309A, 0x30D8, 0x3099, 0x30D8, 0x309A, 0x30DB, 0x3099, 0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF, 0x3099, 0x30F0, 0x3099, 0x30F1, 0x3099, 0x30F2, 0x3099, 0x30FD, 0x3099, 0x30B3, 0x30C8, 0x1100, 0x1101, 0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103, 0x1104, 0x1105, 0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5, 0x111A, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110A, 0x110B, 0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169, 0x116A, 0x116B, 0x116C, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171, 0x1172, 0x1173, 0x1174, 0x1175, 0x1160, 0x1114, 0x1115, 0x11C7, 0x11C8, 0x11CC, 0x11CE, 0x11D3, 0x11D7, 0x11D9, 0x111C, 0x11DD, 0x11DF, 0x111D, 0x111E, 0x1120, 0x1122, 0x1123, 0x1127, 0x1129, 0x112B, 0x112C, 0x112D, 0x112E, 0x112F, 0x1132, 0x1136, 0x1140, 0x1147, 0x114C, 0x11F1, 0x11F2, 0x1157, 0x1158, 0x1159, 0x1184, 0x1185, 0x1188, 0x1191, 0x1192, 0x1194, 0x119E, 0x11A1, 0x4E09, 0x56DB, 0x4E0A, 0x4E2D, 0x4E0B, 0x7532, 0x4E19, 0x4E01, 0x5929, 0x5730, 0x28, 0x1100, 0x29, 0x28, 0x1102, 0x29, 0x28, 0x1103, 0x29, 0x28, 0x1105, 0x29, 0x28, 0x1106, 0x29, 0x28, 0x1107, 0x29, 0x28, 0x1109, 0x29, 0x28, 0x110B, 0x29, 0x28, 0x110C, 0x29, 0x28, 0x110E, 0x29, 0x28, 0x110F, 0x29, 0x28, 0x1110, 0x29, 0x28, 0x1111, 0x29, 0x28, 0x1112, 0x29, 0x28, 0x1100, 0x1161, 0x29, 0x28, 0x1102, 0x1161, 0x29, 0x28, 0x1103, 0x1161, 0x29, 0x28, 0x1105, 0x1161, 0x29, 0x28, 0x1106, 0x1161, 0x29, 0x28, 0x1107, 0x1161, 0x29, 0x28, 0x1109, 0x1161, 0x29, 0x28, 0x110B, 0x1161, 0x29, 0x28, 0x110C, 0x1161, 0x29, 0x28, 0x110E, 0x1161, 0x29, 0x28, 0x110F, 0x1161, 0x29, 0x28, 0x1110, 0x1161, 0x29, 0x28, 0x1111, 0x1161, 0x29, 0x28, 0x1112, 0x1161, 0x29, 0x28, 0x110C, 0x116E, 0x29, 0x28, 0x110B, 0x1169, 0x110C, 0x1165, 0x11AB, 0x29, 0x28, 0x110B, 0x1169, 0x1112, 0x116E, 0x29, 0x28, 0x4E00, 0x29, 0x28, 0x4E8C, 0x29, 0x28, 0x4E09, 0x29, 0x28, 0x56DB, 0x29, 0x28, 0x4E94, 0x29, 0x28, 0x516D, 0x29, 0x28, 0x4E03, 0x29, 0x28, 0x516B, 0x29, 0x28, 0x4E5D, 0x29, 0x28, 0x5341, 0x29, 0x28, 0x6708, 0x29, 0x28, 0x706B, 0x29, 0x28, 0x6C34, 0x29, 0x28, 0x6728, 0x29, 0x28, 0x91D1, 0x29, 0x28, 0x571F, 0x29, 0x28, 0x65E5, 0x29, 0x28, 0x682A, 0x29, 0x28, 0x6709, 0x29, 0x28, 0x793E, 0x29, 0x28, 0x540D, 0x29, 0x28, 0x7279, 0x29, 0x28, 0x8CA1, 0x29, 0x28, 0x795D, 0x29, 0x28, 0x52B4, 0x29, 0x28, 0x4EE3, 0x29, 0x28, 0x547C, 0x29, 0x28, 0x5B66, 0x29, 0x28, 0x76E3, 0x29, 0x28, 0x4F01, 0x29, 0x28, 0x8CC7, 0x29, 0x28, 0x5354, 0x29, 0x28, 0x796D, 0x29, 0x28, 0x4F11, 0x29, 0x28, 0x81EA, 0x29, 0x28, 0x81F3, 0x29, 0x554F, 0x5E7C, 0x7B8F, 0x50, 0x54, 0x45, 0x32, 0x31, 0x32, 0x32, 0x32, 0x33, 0x32, 0x34, 0x32, 0x35, 0x32, 0x36, 0x32, 0x37, 0x32, 0x38, 0x32, 0x39, 0x33, 0x30, 0x33, 0x31, 0x33, 0x32, 0x33, 0x33, 0x33, 0x34, 0x33, 0x35, 0x1100, 0x1161, 0x1102, 0x1161, 0x1103, 0x1161, 0x1105, 0x1161, 0x1106, 0x1161, 0x1107, 0x1161, 0x1109, 0x1161, 0x110B, 0x1161, 0x110C, 0x1161, 0x110E, 0x1161, 0x110F, 0x1161, 0x1110, 0x1161, 0x1111, 0x1161, 0x1112, 0x1161, 0x110E, 0x1161, 0x11B7, 0x1100, 0x1169, 0x110C, 0x116E, 0x110B, 0x1174, 0x110B, 0x116E, 0x4E94, 0x516D, 0x4E03, 0x4E5D, 0x682A, 0x6709, 0x793E, 0x540D, 0x7279, 0x8CA1, 0x795D, 0x52B4, 0x79D8, 0x7537, 0x9069, 0x512A, 0x5370, 0x6CE8, 0x9805, 0x4F11, 0x5199, 0x6B63, 0x5DE6, 0x53F3, 0x533B, 0x5B97, 0x5B66, 0x76E3, 0x4F01, 0x8CC7, 0x5354, 0x591C, 0x33, 0x36, 0x33, 0x37, 0x33, 0x38, 0x33, 0x39, 0x34, 0x30, 0x34, 0x31, 0x34, 0x32, 0x34, 0x33, 0x34, 0x34, 0x34, 0x35, 0x34, 0x36, 0x34, 0x37, 0x34, 0x38, 0x34, 0x39, 0x35, 0x30, 0x31, 0x6708, 0x32, 0x6708, 0x33, 0x6708, 0x34, 0x6708, 0x35, 0x6708, 0x36, 0x6708, 0x37, 0x6708, 0x38, 0x6708, 0x39, 0x6708, 0x31, 0x30, 0x6708, 0x31, 0x31, 0x6708, 0x31, 0x32, 0x6708, 0x48, 0x67, 0x65, 0x72, 0x67, 0x65, 0x56, 0x4C, 0x54, 0x44, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF, 0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F0, 0x30F1, 0x30F2, 0x4EE4, 0x548C, 0x30A2, 0x30CF, 0x309A, 0x30FC, 0x30C8, 0x30A2, 0x30EB, 0x30D5, 0x30A1, 0x30A2, 0x30F3, 0x30D8, 0x309A, 0x30A2, 0x30A2, 0x30FC, 0x30EB, 0x30A4, 0x30CB, 0x30F3, 0x30AF, 0x3099, 0x30A4, 0x30F3, 0x30C1, 0x30A6, 0x30A9, 0x30F3, 0x30A8, 0x30B9, 0x30AF, 0x30FC, 0x30C8, 0x3099, 0x30A8, 0x30FC, 0x30AB, 0x30FC, 0x30AA, 0x30F3, 0x30B9, 0x30AA, 0x30FC, 0x30E0, 0x30AB, 0x30A4, 0x30EA, 0x30AB, 0x30E9, 0x30C3, 0x30C8, 0x30AB, 0x30ED, 0x30EA, 0x30FC, 0x30AB, 0x3099, 0x30ED, 0x30F3, 0x30AB, 0x3099, 0x30F3, 0x30DE, 0x30AD, 0x3099, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30CB, 0x30FC, 0x30AD, 0x30E5, 0x30EA, 0x30FC, 0x30AD, 0x3099, 0x30EB, 0x30BF, 0x3099, 0x30FC, 0x30AD, 0x30ED, 0x30AD, 0x30ED, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30AD, 0x30ED, 0x30EF, 0x30C3, 0x30C8, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x30C8, 0x30F3, 0x30AF, 0x30EB, 0x30BB, 0x3099, 0x30A4, 0x30ED, 0x30AF, 0x30ED, 0x30FC, 0x30CD, 0x30B1, 0x30FC, 0x30B9, 0x30B3, 0x30EB, 0x30CA, 0x30B3, 0x30FC, 0x30DB, 0x309A, 0x30B5, 0x30A4, 0x30AF, 0x30EB, 0x30B5, 0x30F3, 0x30C1, 0x30FC, 0x30E0, 0x30B7, 0x30EA, 0x30F3, 0x30AF, 0x3099, 0x30BB, 0x30F3, 0x30C1, 0x30BB, 0x30F3, 0x30C8, 0x30BF, 0x3099, 0x30FC, 0x30B9, 0x30C6, 0x3099, 0x30B7, 0x30C8, 0x3099, 0x30EB, 0x30C8, 0x30F3, 0x30CA, 0x30CE, 0x30CE, 0x30C3, 0x30C8, 0x30CF, 0x30A4, 0x30C4, 0x30CF, 0x309A, 0x30FC, 0x30BB, 0x30F3, 0x30C8, 0x30CF, 0x309A, 0x30FC, 0x30C4, 0x30CF, 0x3099, 0x30FC, 0x30EC, 0x30EB, 0x30D2, 0x309A, 0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x30D2, 0x309A, 0x30AF, 0x30EB, 0x30D2, 0x309A, 0x30B3, 0x30D2, 0x3099, 0x30EB, 0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C8, 0x3099, 0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x30D5, 0x3099, 0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x30D5, 0x30E9, 0x30F3, 0x30D8, 0x30AF, 0x30BF, 0x30FC, 0x30EB, 0x30D8, 0x309A, 0x30BD, 0x30D8, 0x309A, 0x30CB, 0x30D2, 0x30D8, 0x30EB, 0x30C4, 0x30D8, 0x309A, 0x30F3, 0x30B9, 0x30D8, 0x309A, 0x30FC, 0x30B7, 0x3099, 0x30D8, 0x3099, 0x30FC, 0x30BF, 0x30DB, 0x309A, 0x30A4, 0x30F3, 0x30C8, 0x30DB, 0x3099, 0x30EB, 0x30C8, 0x30DB, 0x30F3, 0x30DB, 0x309A, 0x30F3, 0x30C8, 0x3099, 0x30DB, 0x30FC, 0x30EB, 0x30DB, 0x30FC, 0x30F3, 0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x30DE, 0x30A4, 0x30EB, 0x30DE, 0x30C3, 0x30CF, 0x30DE, 0x30EB, 0x30AF, 0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3, 0x30DF, 0x30AF, 0x30ED, 0x30F3, 0x30DF, 0x30EA, 0x30DF, 0x30EA, 0x30CF, 0x3099, 0x30FC, 0x30EB, 0x30E1, 0x30AB, 0x3099, 0x30E1, 0x30AB, 0x3099, 0x30C8, 0x30F3, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30E4, 0x30FC, 0x30C8, 0x3099, 0x30E4, 0x30FC, 0x30EB, 0x30E6, 0x30A2, 0x30F3, 0x30EA, 0x30C3, 0x30C8, 0x30EB, 0x30EA, 0x30E9, 0x30EB, 0x30D2, 0x309A, 0x30FC, 0x30EB, 0x30FC, 0x30D5, 0x3099, 0x30EB, 0x30EC, 0x30E0, 0x30EC, 0x30F3, 0x30C8, 0x30B1, 0x3099, 0x30F3, 0x30EF, 0x30C3, 0x30C8, 0x30, 0x70B9, 0x31, 0x70B9, 0x32, 0x70B9, 0x33, 0x70B9, 0x34, 0x70B9, 0x35, 0x70B9, 0x36, 0x70B9, 0x37, 0x70B9, 0x38, 0x70B9, 0x39, 0x70B9, 0x31, 0x30, 0x70B9, 0x31, 0x31, 0x70B9, 0x31, 0x32, 0x70B9, 0x31, 0x33, 0x70B9, 0x31, 0x34, 0x70B9, 0x31, 0x35, 0x70B9, 0x31, 0x36, 0x70B9, 0x31, 0x37, 0x70B9, 0x31, 0x38, 0x70B9, 0x31, 0x39, 0x70B9, 0x32, 0x30, 0x70B9, 0x32, 0x31, 0x70B9, 0x32, 0x32, 0x70B9, 0x32, 0x33, 0x70B9, 0x32, 0x34, 0x70B9, 0x68, 0x50, 0x61, 0x64, 0x61, 0x41, 0x55, 0x62, 0x61, 0x72, 0x6F, 0x56, 0x70, 0x63, 0x64, 0x6D, 0x64, 0x6D, 0x32, 0x64, 0x6D, 0x33, 0x49, 0x55, 0x5E73, 0x6210, 0x662D, 0x548C, 0x5927, 0x6B63, 0x660E, 0x6CBB, 0x682A, 0x5F0F, 0x4F1A, 0x793E, 0x70, 0x41, 0x6E, 0x41, 0x03BC, 0x41, 0x6D, 0x41, 0x6B, 0x41, 0x4B, 0x42, 0x4D, 0x42, 0x47, 0x42, 0x63, 0x61, 0x6C, 0x6B, 0x63, 0x61, 0x6C, 0x70, 0x46, 0x6E, 0x46, 0x03BC, 0x46, 0x03BC, 0x67, 0x6D, 0x67, 0x6B, 0x67, 0x48, 0x7A, 0x6B, 0x48, 0x7A, 0x4D, 0x48, 0x7A, 0x47, 0x48, 0x7A, 0x54, 0x48, 0x7A, 0x03BC, 0x6C, 0x6D, 0x6C, 0x64, 0x6C, 0x6B, 0x6C, 0x66, 0x6D, 0x6E, 0x6D, 0x03BC, 0x6D, 0x6D, 0x6D, 0x63, 0x6D, 0x6B, 0x6D, 0x6D, 0x6D, 0x32, 0x63, 0x6D, 0x32, 0x6D, 0x32, 0x6B, 0x6D, 0x32, 0x6D, 0x6D, 0x33, 0x63, 0x6D, 0x33, 0x6D, 0x33, 0x6B, 0x6D, 0x33, 0x6D, 0x2215, 0x73, 0x6D, 0x2215, 0x73, 0x32, 0x50, 0x61, 0x6B, 0x50, 0x61, 0x4D, 0x50, 0x61, 0x47, 0x50, 0x61, 0x72, 0x61, 0x64, 0x72, 0x61, 0x64, 0x2215, 0x73, 0x72, 0x61, 0x64, 0x2215, 0x73, 0x32, 0x70, 0x73, 0x6E, 0x73, 0x03BC, 0x73, 0x6D, 0x73, 0x70, 0x56, 0x6E, 0x56, 0x03BC, 0x56, 0x6D, 0x56, 0x6B, 0x56, 0x4D, 0x56, 0x70, 0x57, 0x6E, 0x57, 0x03BC, 0x57, 0x6D, 0x57, 0x6B, 0x57, 0x4D, 0x57, 0x6B, 0x03A9, 0x4D, 0x03A9, 0x61, 0x2E, 0x6D, 0x2E, 0x42, 0x71, 0x63, 0x63, 0x63, 0x64, 0x43, 0x2215, 0x6B, 0x67, 0x43, 0x6F, 0x2E, 0x64, 0x42, 0x47, 0x79, 0x68, 0x61, 0x48, 0x50, 0x69, 0x6E, 0x4B, 0x4B, 0x4B, 0x4D, 0x6B, 0x74, 0x6C, 0x6D, 0x6C, 0x6E, 0x6C, 0x6F, 0x67, 0x6C, 0x78, 0x6D, 0x62, 0x6D, 0x69, 0x6C, 0x6D, 0x6F, 0x6C, 0x50, 0x48, 0x70, 0x2E, 0x6D, 0x2E, 0x50, 0x50, 0x4D, 0x50, 0x52, 0x73, 0x72, 0x53, 0x76, 0x57, 0x62, 0x56, 0x2215, 0x6D, 0x41, 0x2215, 0x6D, 0x31, 0x65E5, 0x32, 0x65E5, 0x33, 0x65E5, 0x34, 0x65E5, 0x35, 0x65E5, 0x36, 0x65E5, 0x37, 0x65E5, 0x38, 0x65E5, 0x39, 0x65E5, 0x31, 0x30, 0x65E5, 0x31, 0x31, 0x65E5, 0x31, 0x32, 0x65E5, 0x31, 0x33, 0x65E5, 0x31, 0x34, 0x65E5, 0x31, 0x35, 0x65E5, 0x31, 0x36, 0x65E5, 0x31, 0x37, 0x65E5, 0x31, 0x38, 0x65E5, 0x31, 0x39, 0x65E5, 0x32, 0x30, 0x65E5, 0x32, 0x31, 0x65E5, 0x32, 0x32, 0x65E5, 0x32, 0x33, 0x65E5, 0x32, 0x34, 0x65E5, 0x32, 0x35, 0x65E5, 0x32, 0x36, 0x65E5, 0x32, 0x37, 0x65E5, 0x32, 0x38, 0x65E5, 0x32, 0x39, 0x65E5, 0x33, 0x30, 0x65E5, 0x33, 0x31, 0x65E5, 0x67, 0x61, 0x6C, 0x044A, 0x044C, 0xA76F, 0x0126, 0x0153, 0xA727, 0xAB37, 0x026B, 0xAB52, 0x028D, 0x8C48, 0x66F4, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5, 0x5951, 0x5587, 0x5948, 0x61F6, 0x7669, 0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F, 0x6A02, 0x6D1B, 0x70D9, 0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82, 0x5375, 0x6B04, 0x721B, 0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964, 0x62C9, 0x81D8, 0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC, 0x90CE, 0x4F86, 0x51B7, 0x52DE, 0x64C4, 0x6AD3, 0x7210, 0x76E7, 0x8606, 0x865C, 0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F, 0x7DA0, 0x83C9, 0x9304, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E, 0x7262, 0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62, 0x6A13, 0x6DDA, 0x6F0F, 0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C, 0x7DBE, 0x83F1, 0x9675, 0x8B80, 0x62CF, 0x8AFE, 0x4E39, 0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9, 0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449, 0x8AAA, 0x6BBA, 0x6C88, 0x62FE, 0x82E5, 0x63A0, 0x7565, 0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF, 0x52F5, 0x5442, 0x5EEC, 0x65C5, 0x6FFE, 0x792A, 0x95AD, 0x9A6A, 0x9E97, 0x9ECE, 0x66C6, 0x6B77, 0x8F62, 0x5E74, 0x6190, 0x6200, 0x649A, 0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4, 0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD, 0x70C8, 0x88C2, 0x5EC9, 0x5FF5, 0x637B, 0x6BAE, 0x7C3E, 0x7375, 0x4EE4, 0x56F9, 0x5DBA, 0x601C, 0x73B2, 0x7469, 0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748, 0x9818, 0x4F8B, 0x79AE, 0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA, 0x5BEE, 0x5C3F, 0x6599, 0x71CE, 0x7642, 0x84FC, 0x907C, 0x6688, 0x962E, 0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C, 0x7409, 0x7559, 0x786B, 0x7D10, 0x985E, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA, 0x8F2A, 0x5F8B, 0x6144, 0x6817, 0x9686, 0x5229, 0x540F, 0x5C65, 0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2, 0x7F79, 0x88CF, 0x88E1, 0x96E2, 0x533F, 0x6EBA, 0x541D, 0x71D0, 0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F, 0x6797, 0x6DCB, 0x81E8, 0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58, 0x4EC0, 0x8336, 0x523A, 0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4, 0x8F3B, 0x964D, 0x5ED3, 0x5140, 0x55C0, 0x585A, 0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E, 0x7965, 0x798F, 0x9756, 0x7CBE, 0x8612, 0x8AF8, 0x9038, 0x90FD, 0x98EF, 0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7, 0x4FAE, 0x50E7, 0x514D, 0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606, 0x5668, 0x5840, 0x58A8, 0x5C64, 0x6094, 0x6168, 0x618E, 0x61F2, 0x654F, 0x65E2, 0x6691, 0x6885, 0x6D77, 0x6E1A, 0x6F22, 0x716E, 0x722B, 0x7422, 0x7891, 0x7949, 0x7948, 0x7950, 0x7956, 0x798D, 0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7E09, 0x7E41, 0x7F72, 0x8005, 0x81ED, 0x8279, 0x8457, 0x8910, 0x8996, 0x8B01, 0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x96E3, 0x97FF, 0x983B, 0x6075, 0x000242EE, 0x8218, 0x4E26, 0x51B5, 0x5168, 0x4F80, 0x5145, 0x5180, 0x52C7, 0x52FA, 0x5555, 0x5599, 0x55E2, 0x58B3, 0x5944, 0x5954, 0x5A62, 0x5B28, 0x5ED2, 0x5ED9, 0x5F69, 0x5FAD, 0x60D8, 0x614E, 0x6108, 0x6160, 0x6234, 0x63C4, 0x641C, 0x6452, 0x6556, 0x671B, 0x6756, 0x6EDB, 0x6ECB, 0x701E, 0x77A7, 0x7235, 0x72AF, 0x7471, 0x7506, 0x753B, 0x761D, 0x761F, 0x76DB, 0x76F4, 0x774A, 0x7740, 0x78CC, 0x7AB1, 0x7C7B, 0x7D5B, 0x7F3E, 0x8352, 0x83EF, 0x8779, 0x8941, 0x8986, 0x8ABF, 0x8ACB, 0x8AED, 0x8B8A, 0x8F38, 0x9072, 0x9199, 0x9276, 0x967C, 0x97DB, 0x980B, 0x9B12, 0x0002284A, 0x00022844, 0x000233D5, 0x3B9D, 0x4018, 0x4039, 0x00025249, 0x00025CD0, 0x00027ED3, 0x9F43, 0x9F8E, 0x66, 0x66, 0x66, 0x69, 0x66, 0x6C, 0x66, 0x66, 0x69, 0x66, 0x66, 0x6C, 0x73, 0x74, 0x0574, 0x0576, 0x0574, 0x0565, 0x0574, 0x056B, 0x057E, 0x0576, 0x0574, 0x056D, 0x05D9, 0x05B4, 0x05F2, 0x05B7, 0x05E2, 0x05D4, 0x05DB, 0x05DC, 0x05DD, 0x05E8, 0x05EA, 0x05E9, 0x05C1, 0x05E9, 0x05C2, 0x05E9, 0x05BC, 0x05C1, 0x05E9, 0x05BC, 0x05C2, 0x05D0, 0x05B7, 0x05D0, 0x05B8, 0x05D0, 0x05BC, 0x05D1, 0x05BC, 0x05D2, 0x05BC, 0x05D3, 0x05BC, 0x05D4, 0x05BC, 0x05D5, 0x05BC, 0x05D6, 0x05BC, 0x05D8, 0x05BC, 0x05D9, 0x05BC, 0x05DA, 0x05BC, 0x05DB, 0x05BC, 0x05DC, 0x05BC, 0x05DE, 0x05BC, 0x05E0, 0x05BC, 0x05E1, 0x05BC, 0x05E3, 0x05BC, 0x05E4, 0x05BC, 0x05E6, 0x05BC, 0x05E7, 0x05BC, 0x05E8, 0x05BC, 0x05E9, 0x05BC, 0x05EA, 0x05BC, 0x05D5, 0x05B9, 0x05D1, 0x05BF, 0x05DB, 0x05BF, 0x05E4, 0x05BF, 0x05D0, 0x05DC, 0x0671, 0x067B, 0x067E, 0x0680, 0x067A, 0x067F, 0x0679, 0x06A4, 0x06A6, 0x0684, 0x0683, 0x0686, 0x0687, 0x068D, 0x068C, 0x068E, 0x0688, 0x0698, 0x0691, 0x06A9, 0x06AF, 0x06B3, 0x06B1, 0x06BA, 0x06BB, 0x06C1, 0x06BE, 0x06D2, 0x06AD, 0x06C7, 0x06C6, 0x06C8, 0x06CB, 0x06C5, 0x06C9, 0x06D0, 0x0649, 0x064A, 0x0654, 0x0627, 0x064A, 0x0654, 0x06D5, 0x064A, 0x0654, 0x0648, 0x064A, 0x0654, 0x06C7, 0x064A, 0x0654, 0x06C6, 0x064A, 0x0654, 0x06C8, 0x064A, 0x0654, 0x06D0, 0x064A, 0x0654, 0x0649, 0x06CC, 0x064A, 0x0654, 0x062C, 0x064A, 0x0654, 0x062D, 0x064A, 0x0654, 0x0645, 0x064A, 0x0654, 0x064A, 0x0628, 0x062C, 0x0628, 0x062D, 0x0628, 0x062E, 0x0628, 0x0645, 0x0628, 0x0649, 0x0628, 0x064A, 0x062A, 0x062C, 0x062A, 0x062D, 0x062A, 0x062E, 0x062A, 0x0645, 0x062A, 0x0649, 0x062A, 0x064A, 0x062B, 0x062C, 0x062B, 0x0645, 0x062B, 0x0649, 0x062B, 0x064A, 0x062C, 0x062D, 0x062C, 0x0645, 0x062D, 0x062C, 0x062D, 0x0645, 0x062E, 0x062C, 0x062E, 0x062D, 0x062E, 0x0645, 0x0633, 0x062C, 0x0633, 0x062D, 0x0633, 0x062E, 0x0633, 0x0645, 0x0635, 0x062D, 0x0635, 0x0645, 0x0636, 0x062C, 0x0636, 0x062D, 0x0636, 0x062E, 0x0636, 0x0645, 0x0637, 0x062D, 0x0637, 0x0645, 0x0638, 0x0645, 0x0639, 0x062C, 0x0639, 0x0645, 0x063A, 0x062C, 0x063A, 0x0645, 0x0641, 0x062C, 0x0641, 0x062D, 0x0641, 0x062E, 0x0641, 0x0645, 0x0641, 0x0649, 0x0641, 0x064A, 0x0642, 0x062D, 0x0642, 0x0645, 0x0642, 0x0649, 0x0642, 0x064A, 0x0643, 0x0627, 0x0643, 0x062C, 0x0643, 0x062D, 0x0643, 0x062E, 0x0643, 0x0644, 0x0643, 0x0645, 0x0643, 0x0649, 0x0643, 0x064A, 0x0644, 0x062C, 0x0644, 0x062D, 0x0644, 0x062E, 0x0644, 0x0645, 0x0644, 0x0649, 0x0644, 0x064A, 0x0645, 0x062C, 0x0645, 0x062D, 0x0645, 0x062E, 0x0645, 0x0645, 0x0645, 0x0649, 0x0645, 0x064A, 0x0646, 0x062C, 0x0646, 0x062D, 0x0646, 0x062E, 0x0646, 0x0645, 0x0646, 0x0649, 0x0646, 0x064A, 0x0647, 0x062C, 0x0647, 0x0645, 0x0647, 0x0649, 0x0647, 0x064A, 0x064A, 0x062C, 0x064A, 0x062D, 0x064A, 0x062E, 0x064A, 0x0645, 0x064A, 0x0649, 0x064A, 0x064A, 0x0630, 0x0670, 0x0631, 0x0670, 0x0649, 0x0670, 0x20, 0x064C, 0x0651, 0x20, 0x064D, 0x0651, 0x20, 0x064E, 0x0651, 0x20, 0x064F, 0x0651, 0x20, 0x0650, 0x0651, 0x20, 0x0651, 0x0670, 0x064A, 0x0654, 0x0631, 0x064A, 0x0654, 0x0632, 0x064A, 0x0654, 0x0646, 0x0628, 0x0631, 0x0628, 0x0632, 0x0628, 0x0646, 0x062A, 0x0631, 0x062A, 0x0632, 0x062A, 0x0646, 0x062B, 0x0631, 0x062B, 0x0632, 0x062B, 0x0646, 0x0645, 0x0627, 0x0646, 0x0631, 0x0646, 0x0632, 0x0646, 0x0646, 0x064A, 0x0631, 0x064A, 0x0632, 0x064A, 0x0646, 0x064A, 0x0654, 0x062E, 0x064A, 0x0654, 0x0647, 0x0628, 0x0647, 0x062A, 0x0647, 0x0635, 0x062E, 0x0644, 0x0647, 0x0646, 0x0647, 0x0647, 0x0670, 0x064A, 0x0647, 0x062B, 0x0647, 0x0633, 0x0647, 0x0634, 0x0645, 0x0634, 0x0647, 0x0640, 0x064E, 0x0651, 0x0640, 0x064F, 0x0651, 0x0640, 0x0650, 0x0651, 0x0637, 0x0649, 0x0637, 0x064A, 0x0639, 0x0649, 0x0639, 0x064A, 0x063A, 0x0649, 0x063A, 0x064A, 0x0633, 0x0649, 0x0633, 0x064A, 0x0634, 0x0649, 0x0634, 0x064A, 0x062D, 0x0649, 0x062D, 0x064A, 0x062C, 0x0649, 0x062C, 0x064A, 0x062E, 0x0649, 0x062E, 0x064A, 0x0635, 0x0649, 0x0635, 0x064A, 0x0636, 0x0649, 0x0636, 0x064A, 0x0634, 0x062C, 0x0634, 0x062D, 0x0634, 0x062E, 0x0634, 0x0631, 0x0633, 0x0631, 0x0635, 0x0631, 0x0636, 0x0631, 0x0627, 0x064B, 0x062A, 0x062C, 0x0645, 0x062A, 0x062D, 0x062C, 0x062A, 0x062D, 0x0645, 0x062A, 0x062E, 0x0645, 0x062A, 0x0645, 0x062C, 0x062A, 0x0645, 0x062D, 0x062A, 0x0645, 0x062E, 0x062C, 0x0645, 0x062D, 0x062D, 0x0645, 0x064A, 0x062D, 0x0645, 0x0649, 0x0633, 0x062D, 0x062C, 0x0633, 0x062C, 0x062D, 0x0633, 0x062C, 0x0649, 0x0633, 0x0645, 0x062D, 0x0633, 0x0645, 0x062C, 0x0633, 0x0645, 0x0645, 0x0635, 0x062D, 0x062D, 0x0635, 0x0645, 0x0645, 0x0634, 0x062D, 0x0645, 0x0634, 0x062C, 0x064A, 0x0634, 0x0645, 0x062E, 0x0634, 0x0645, 0x0645, 0x0636, 0x062D, 0x0649, 0x0636, 0x062E, 0x0645, 0x0637, 0x0645, 0x062D, 0x0637, 0x0645, 0x0645, 0x0637, 0x0645, 0x064A, 0x0639, 0x062C, 0x0645, 0x0639, 0x0645, 0x0645, 0x0639, 0x0645, 0x0649, 0x063A, 0x0645, 0x0645, 0x063A, 0x0645, 0x064A, 0x063A, 0x0645, 0x0649, 0x0641, 0x062E, 0x0645, 0x0642, 0x0645, 0x062D, 0x0642, 0x0645, 0x0645, 0x0644, 0x062D, 0x0645, 0x0644, 0x062D, 0x064A, 0x0644, 0x062D, 0x0649, 0x0644, 0x062C, 0x062C, 0x0644, 0x062E, 0x0645, 0x0644, 0x0645, 0x062D, 0x0645, 0x062D, 0x062C, 0x0645, 0x062D, 0x0645, 0x0645, 0x062D, 0x064A, 0x0645, 0x062C, 0x062D, 0x0645, 0x062C, 0x0645, 0x0645, 0x062E, 0x062C, 0x0645, 0x062E, 0x0645, 0x0645, 0x062C, 0x062E, 0x0647, 0x0645, 0x062C, 0x0647, 0x0645, 0x0645, 0x0646, 0x062D, 0x0645, 0x0646, 0x062D, 0x0649, 0x0646, 0x062C, 0x0645, 0x0646, 0x062C, 0x0649, 0x0646, 0x0645, 0x064A, 0x0646, 0x0645, 0x0649, 0x064A, 0x0645, 0x0645, 0x0628, 0x062E, 0x064A, 0x062A, 0x062C, 0x064A, 0x062A, 0x062C, 0x0649, 0x062A, 0x062E, 0x064A, 0x062A, 0x062E, 0x0649, 0x062A, 0x0645, 0x064A, 0x062A, 0x0645, 0x0649, 0x062C, 0x0645, 0x064A, 0x062C, 0x062D, 0x0649, 0x062C, 0x0645, 0x0649, 0x0633, 0x062E, 0x0649, 0x0635, 0x062D, 0x064A, 0x0634, 0x062D, 0x064A, 0x0636, 0x062D, 0x064A, 0x0644, 0x062C, 0x064A, 0x0644, 0x0645, 0x064A, 0x064A, 0x062D, 0x064A, 0x064A, 0x062C, 0x064A, 0x064A, 0x0645, 0x064A, 0x0645, 0x0645, 0x064A, 0x0642, 0x0645, 0x064A, 0x0646, 0x062D, 0x064A, 0x0639, 0x0645, 0x064A, 0x0643, 0x0645, 0x064A, 0x0646, 0x062C, 0x062D, 0x0645, 0x062E, 0x064A, 0x0644, 0x062C, 0x0645, 0x0643, 0x0645, 0x0645, 0x062C, 0x062D, 0x064A, 0x062D, 0x062C, 0x064A, 0x0645, 0x062C, 0x064A, 0x0641, 0x0645, 0x064A, 0x0628, 0x062D, 0x064A, 0x0633, 0x062E, 0x064A, 0x0646, 0x062C, 0x064A, 0x0635, 0x0644, 0x06D2, 0x0642, 0x0644, 0x06D2, 0x0627, 0x0644, 0x0644, 0x0647, 0x0627, 0x0643, 0x0628, 0x0631, 0x0645, 0x062D, 0x0645, 0x062F, 0x0635, 0x0644, 0x0639, 0x0645, 0x0631, 0x0633, 0x0648, 0x0644, 0x0639, 0x0644, 0x064A, 0x0647, 0x0648, 0x0633, 0x0644, 0x0645, 0x0635, 0x0644, 0x0649, 0x0635, 0x0644, 0x0649, 0x20, 0x0627, 0x0644, 0x0644, 0x0647, 0x20, 0x0639, 0x0644, 0x064A, 0x0647, 0x20, 0x0648, 0x0633, 0x0644, 0x0645, 0x062C, 0x0644, 0x20, 0x062C, 0x0644, 0x0627, 0x0644, 0x0647, 0x0631, 0x06CC, 0x0627, 0x0644, 0x2C, 0x3001, 0x3002, 0x3A, 0x21, 0x3F, 0x3016, 0x3017, 0x2014, 0x2013, 0x5F, 0x7B, 0x7D, 0x3014, 0x3015, 0x3010, 0x3011, 0x300A, 0x300B, 0x300C, 0x300D, 0x300E, 0x300F, 0x5B, 0x5D, 0x23, 0x26, 0x2A, 0x2D, 0x3C, 0x3E, 0x5C, 0x24, 0x25, 0x40, 0x20, 0x064B, 0x0640, 0x064B, 0x20, 0x064C, 0x20, 0x064D, 0x20, 0x064E, 0x0640, 0x064E, 0x20, 0x064F, 0x0640, 0x064F, 0x20, 0x0650, 0x0640, 0x0650, 0x20, 0x0651, 0x0640, 0x0651, 0x20, 0x0652, 0x0640, 0x0652, 0x0621, 0x0627, 0x0628, 0x0629, 0x062A, 0x062B, 0x062C, 0x062D, 0x062E, 0x062F, 0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x0637, 0x0638, 0x0639, 0x063A, 0x0641, 0x0642, 0x0643, 0x0644, 0x0645, 0x0646, 0x0647, 0x0648, 0x064A, 0x0644, 0x0627, 0x0653, 0x0644, 0x0627, 0x0654, 0x0644, 0x0627, 0x0655, 0x0644, 0x0627, 0x22, 0x27, 0x2F, 0x5E, 0x7C, 0x7E, 0x2985, 0x2986, 0x30FB, 0x30A1, 0x30A3, 0x30A5, 0x30A7, 0x30A9, 0x30E3, 0x30E5, 0x30E7, 0x30C3, 0x30FC, 0x30F3, 0x3099, 0x309A, 0xA2, 0xA3, 0xAC, 0xA6, 0xA5, 0x20A9, 0x2502, 0x2190, 0x2191, 0x2192, 0x2193, 0x25A0, 0x25CB, 0x000105D2, 0x0307, 0x000105DA, 0x0307, 0x02D0, 0x02D1, 0xE6, 0x0299, 0x0253, 0x02A3, 0xAB66, 0x02A5, 0x02A4, 0x0256, 0x0257, 0x1D91, 0x0258, 0x025E, 0x02A9, 0x0264, 0x0262, 0x0260, 0x029B, 0x029C, 0x0267, 0x0284, 0x02AA, 0x02AB, 0x026C, 0x0001DF04, 0xA78E, 0x026E, 0x0001DF05, 0x028E, 0x0001DF06, 0xF8, 0x0276, 0x0277, 0x027A, 0x0001DF08, 0x027D, 0x027E, 0x0280, 0x02A8, 0x02A6, 0xAB67, 0x02A7, 0x0288, 0x2C71, 0x028F, 0x02A1, 0x02A2, 0x0298, 0x01C0, 0x01C1, 0x01C2, 0x0001DF0A, 0x0001DF1E, 0x00011099, 0x000110BA, 0x0001109B, 0x000110BA, 0x000110A5, 0x000110BA, 0x00011131, 0x00011127, 0x00011132, 0x00011127, 0x00011347, 0x0001133E, 0x00011347, 0x00011357, 0x00011382, 0x000113C9, 0x00011384, 0x000113BB, 0x0001138B, 0x000113C2, 0x00011390, 0x000113C9, 0x000113C2, 0x000113C2, 0x000113C2, 0x000113B8, 0x000113C2, 0x000113C9, 0x000114B9, 0x000114BA, 0x000114B9, 0x000114B0, 0x000114B9, 0x000114BD, 0x000115B8, 0x000115AF, 0x000115B9, 0x000115AF, 0x00011935, 0x00011930, 0x0001611E, 0x0001611E, 0x0001611E, 0x00016129, 0x0001611E, 0x0001611F, 0x00016129, 0x0001611F, 0x0001611E, 0x00016120, 0x0001611E, 0x0001611E, 0x0001611F, 0x0001611E, 0x00016129, 0x0001611F, 0x0001611E, 0x0001611E, 0x00016120, 0x00016D67, 0x00016D67, 0x00016D63, 0x00016D67, 0x00016D63, 0x00016D67, 0x00016D67, 0x0001D157, 0x0001D165, 0x0001D158, 0x0001D165, 0x0001D158, 0x0001D165, 0x0001D16E, 0x0001D158, 0x0001D165, 0x0001D16F, 0x0001D158, 0x0001D165, 0x0001D170, 0x0001D158, 0x0001D165, 0x0001D171, 0x0001D158, 0x0001D165, 0x0001D172, 0x0001D1B9, 0x0001D165, 0x0001D1BA, 0x0001D165, 0x0001D1B9, 0x0001D165, 0x0001D16E, 0x0001D1BA, 0x0001D165, 0x0001D16E, 0x0001D1B9, 0x0001D165, 0x0001D16F, 0x0001D1BA, 0x0001D165, 0x0001D16F, 0x0131, 0x0237, 0x0391, 0x0392, 0x0394, 0x0395, 0x0396, 0x0397, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A1, 0x03A4, 0x03A6, 0x03A7, 0x03A8, 0x2207, 0x03B1, 0x03B6, 0x03B7, 0x03BB, 0x03BD, 0x03BE, 0x03BF, 0x03C3, 0x03C4, 0x03C5, 0x03C8, 0x03C9, 0x2202, 0x03DC, 0x03DD, 0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x043A, 0x043B, 0x043C, 0x043E, 0x043F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x044B, 0x044D, 0x044E, 0xA689, 0x04D9, 0x0456, 0x0458, 0x04E9, 0x04AF, 0x04CF, 0x0491, 0x0455, 0x045F, 0x04AB, 0xA651, 0x04B1, 0x066E, 0x06A1, 0x066F, 0x30, 0x2E, 0x30, 0x2C, 0x31, 0x2C, 0x32, 0x2C, 0x33, 0x2C, 0x34, 0x2C, 0x35, 0x2C, 0x36, 0x2C, 0x37, 0x2C, 0x38, 0x2C, 0x39, 0x2C, 0x28, 0x41, 0x29, 0x28, 0x42, 0x29, 0x28, 0x43, 0x29, 0x28, 0x44, 0x29, 0x28, 0x45, 0x29, 0x28, 0x46, 0x29, 0x28, 0x47, 0x29, 0x28, 0x48, 0x29, 0x28, 0x49, 0x29, 0x28, 0x4A, 0x29, 0x28, 0x4B, 0x29, 0x28, 0x4C, 0x29, 0x28, 0x4D, 0x29, 0x28, 0x4E, 0x29, 0x28, 0x4F, 0x29, 0x28, 0x50, 0x29, 0x28, 0x51, 0x29, 0x28, 0x52, 0x29, 0x28, 0x53, 0x29, 0x28, 0x54, 0x29, 0x28, 0x55, 0x29, 0x28, 0x56, 0x29, 0x28, 0x57, 0x29, 0x28, 0x58, 0x29, 0x28, 0x59, 0x29, 0x28, 0x5A, 0x29, 0x3014, 0x53, 0x3015, 0x43, 0x44, 0x57, 0x5A, 0x48, 0x56, 0x53, 0x44, 0x53, 0x53, 0x50, 0x50, 0x56, 0x57, 0x43, 0x4D, 0x43, 0x4D, 0x44, 0x4D, 0x52, 0x44, 0x4A, 0x307B, 0x304B, 0x30B3, 0x30B3, 0x5B57, 0x53CC, 0x591A, 0x89E3, 0x4EA4, 0x6620, 0x7121, 0x524D, 0x5F8C, 0x518D, 0x65B0, 0x521D, 0x7D42, 0x8CA9, 0x58F0, 0x5439, 0x6F14, 0x6295, 0x6355, 0x904A, 0x6307, 0x6253, 0x7981, 0x7A7A, 0x5408, 0x6E80, 0x7533, 0x5272, 0x55B6, 0x914D, 0x3014, 0x672C, 0x3015, 0x3014, 0x4E09, 0x3015, 0x3014, 0x4E8C, 0x3015, 0x3014, 0x5B89, 0x3015, 0x3014, 0x70B9, 0x3015, 0x3014, 0x6253, 0x3015, 0x3014, 0x76D7, 0x3015, 0x3014, 0x52DD, 0x3015, 0x3014, 0x6557, 0x3015, 0x5F97, 0x53EF, 0x4E3D, 0x4E38, 0x4E41, 0x00020122, 0x4F60, 0x4FBB, 0x5002, 0x507A, 0x5099, 0x50CF, 0x349E, 0x0002063A, 0x5154, 0x5164, 0x5177, 0x0002051C, 0x34B9, 0x5167, 0x0002054B, 0x5197, 0x51A4, 0x4ECC, 0x51AC, 0x000291DF, 0x5203, 0x34DF, 0x523B, 0x5246, 0x5277, 0x3515, 0x5305, 0x5306, 0x5349, 0x535A, 0x5373, 0x537D, 0x537F, 0x00020A2C, 0x7070, 0x53CA, 0x53DF, 0x00020B63, 0x53EB, 0x53F1, 0x5406, 0x549E, 0x5438, 0x5448, 0x5468, 0x54A2, 0x54F6, 0x5510, 0x5553, 0x5563, 0x5584, 0x55AB, 0x55B3, 0x55C2, 0x5716, 0x5717, 0x5651, 0x5674, 0x58EE, 0x57CE, 0x57F4, 0x580D, 0x578B, 0x5832, 0x5831, 0x58AC, 0x000214E4, 0x58F2, 0x58F7, 0x5906, 0x5922, 0x5962, 0x000216A8, 0x000216EA, 0x59EC, 0x5A1B, 0x5A27, 0x59D8, 0x5A66, 0x36EE, 0x36FC, 0x5B08, 0x5B3E, 0x000219C8, 0x5BC3, 0x5BD8, 0x5BF3, 0x00021B18, 0x5BFF, 0x5C06, 0x5F53, 0x3781, 0x5C60, 0x5CC0, 0x5C8D, 0x00021DE4, 0x5D43, 0x00021DE6, 0x5D6E, 0x5D6B, 0x5D7C, 0x5DE1, 0x5DE2, 0x382F, 0x5DFD, 0x5E28, 0x5E3D, 0x5E69, 0x3862, 0x00022183, 0x387C, 0x5EB0, 0x5EB3, 0x5EB6, 0x0002A392, 0x00022331, 0x8201, 0x5F22, 0x38C7, 0x000232B8, 0x000261DA, 0x5F62, 0x5F6B, 0x38E3, 0x5F9A, 0x5FCD, 0x5FD7, 0x5FF9, 0x6081, 0x393A, 0x391C, 0x000226D4, 0x60C7, 0x6148, 0x614C, 0x617A, 0x61B2, 0x61A4, 0x61AF, 0x61DE, 0x6210, 0x621B, 0x625D, 0x62B1, 0x62D4, 0x6350, 0x00022B0C, 0x633D, 0x62FC, 0x6368, 0x6383, 0x63E4, 0x00022BF1, 0x6422, 0x63C5, 0x63A9, 0x3A2E, 0x6469, 0x647E, 0x649D, 0x6477, 0x3A6C, 0x656C, 0x0002300A, 0x65E3, 0x66F8, 0x6649, 0x3B19, 0x3B08, 0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C, 0x80AD, 0x43D9, 0x6721, 0x675E, 0x6753, 0x000233C3, 0x3B49, 0x67FA, 0x6785, 0x6852, 0x0002346D, 0x688E, 0x681F, 0x6914, 0x6942, 0x69A3, 0x69EA, 0x6AA8, 0x000236A3, 0x6ADB, 0x3C18, 0x6B21, 0x000238A7, 0x6B54, 0x3C4E, 0x6B72, 0x6B9F, 0x6BBB, 0x00023A8D, 0x00021D0B, 0x00023AFA, 0x6C4E, 0x00023CBC, 0x6CBF, 0x6CCD, 0x6C67, 0x6D16, 0x6D3E, 0x6D69, 0x6D78, 0x6D85, 0x00023D1E, 0x6D34, 0x6E2F, 0x6E6E, 0x3D33, 0x6EC7, 0x00023ED1, 0x6DF9, 0x6F6E, 0x00023F5E, 0x00023F8E, 0x6FC6, 0x7039, 0x701B, 0x3D96, 0x704A, 0x707D, 0x7077, 0x70AD, 0x00020525, 0x7145, 0x00024263, 0x719C, 0x000243AB, 0x7228, 0x7250, 0x00024608, 0x7280, 0x7295, 0x00024735, 0x00024814, 0x737A, 0x738B, 0x3EAC, 0x73A5, 0x3EB8, 0x7447, 0x745C, 0x7485, 0x74CA, 0x3F1B, 0x7524, 0x00024C36, 0x753E, 0x00024C92, 0x0002219F, 0x7610, 0x00024FA1, 0x00024FB8, 0x00025044, 0x3FFC, 0x4008, 0x000250F3, 0x000250F2, 0x00025119, 0x00025133, 0x771E, 0x771F, 0x778B, 0x4046, 0x4096, 0x0002541D, 0x784E, 0x40E3, 0x00025626, 0x0002569A, 0x000256C5, 0x79EB, 0x412F, 0x7A4A, 0x7A4F, 0x0002597C, 0x00025AA7, 0x7AEE, 0x4202, 0x00025BAB, 0x7BC6, 0x7BC9, 0x4227, 0x00025C80, 0x7CD2, 0x42A0, 0x7CE8, 0x7CE3, 0x7D00, 0x00025F86, 0x7D63, 0x4301, 0x7DC7, 0x7E02, 0x7E45, 0x4334, 0x00026228, 0x00026247, 0x4359, 0x000262D9, 0x7F7A, 0x0002633E, 0x7F95, 0x7FFA, 0x000264DA, 0x00026523, 0x8060, 0x000265A8, 0x8070, 0x0002335F, 0x43D5, 0x80B2, 0x8103, 0x440B, 0x813E, 0x5AB5, 0x000267A7, 0x000267B5, 0x00023393, 0x0002339C, 0x8204, 0x8F9E, 0x446B, 0x8291, 0x828B, 0x829D, 0x52B3, 0x82B1, 0x82B3, 0x82BD, 0x82E6, 0x00026B3C, 0x831D, 0x8363, 0x83AD, 0x8323, 0x83BD, 0x83E7, 0x8353, 0x83CA, 0x83CC, 0x83DC, 0x00026C36, 0x00026D6B, 0x00026CD5, 0x452B, 0x84F1, 0x84F3, 0x8516, 0x000273CA, 0x8564, 0x00026F2C, 0x455D, 0x4561, 0x00026FB1, 0x000270D2, 0x456B, 0x8650, 0x8667, 0x8669, 0x86A9, 0x8688, 0x870E, 0x86E2, 0x8728, 0x876B, 0x8786, 0x45D7, 0x87E1, 0x8801, 0x45F9, 0x8860, 0x00027667, 0x88D7, 0x88DE, 0x4635, 0x88FA, 0x34BB, 0x000278AE, 0x00027966, 0x46BE, 0x46C7, 0x8AA0, 0x00027CA8, 0x8CAB, 0x8CC1, 0x8D1B, 0x8D77, 0x00027F2F, 0x00020804, 0x8DCB, 0x8DBC, 0x8DF0, 0x000208DE, 0x8ED4, 0x000285D2, 0x000285ED, 0x9094, 0x90F1, 0x9111, 0x0002872E, 0x911B, 0x9238, 0x92D7, 0x92D8, 0x927C, 0x93F9, 0x9415, 0x00028BFA, 0x958B, 0x4995, 0x95B7, 0x00028D77, 0x49E6, 0x96C3, 0x5DB2, 0x9723, 0x00029145, 0x0002921A, 0x4A6E, 0x4A76, 0x97E0, 0x0002940A, 0x4AB2, 0x00029496, 0x9829, 0x000295B6, 0x98E2, 0x4B33, 0x9929, 0x99A7, 0x99C2, 0x99FE, 0x4BCE, 0x00029B30, 0x9C40, 0x9CFD, 0x4CCE, 0x4CED, 0x9D67, 0x0002A0CE, 0x4CF8, 0x0002A105, 0x0002A20E, 0x0002A291, 0x4D56, 0x9EFE, 0x9F05, 0x9F0F, 0x9F16, 0x0002A600
+    };
+} // namespace upp::impl::unicode_data::normalization::impl
+
+#endif // UNI_CPP_IMPL_UNICODE_DATA_DATA_NORMALIZATION_DATA_INLINE_HPP
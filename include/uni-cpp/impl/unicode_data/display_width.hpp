@@ -0,0 +1,17 @@
+#ifndef UNI_CPP_IMPL_UNICODE_DATA_DISPLAY_WIDTH_HPP
+#define UNI_CPP_IMPL_UNICODE_DATA_DISPLAY_WIDTH_HPP
+
+#include "data/display_width/data.hpp"
+
+namespace upp::impl::unicode_data::display_width
+{
+    // Each lookup value is the width of the code point in columns (0, 1 or 2).
+    // Read `dev/tools/unicode_data_generator/src/unicode_data_generator/datasets/display_width.py` for the rules.
+
+    [[nodiscard]] constexpr std::uint8_t lookup_display_width(const std::uint32_t code_point) noexcept
+    {
+        return impl::lookup(code_point);
+    }
+} // namespace upp::impl::unicode_data::display_width
+
+#endif // UNI_CPP_IMPL_UNICODE_DATA_DISPLAY_WIDTH_HPP
\ No newline at end of file
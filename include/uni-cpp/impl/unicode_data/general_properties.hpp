@@ -0,0 +1,59 @@
+#ifndef UNI_CPP_IMPL_UNICODE_DATA_GENERAL_PROPERTIES_HPP
+#define UNI_CPP_IMPL_UNICODE_DATA_GENERAL_PROPERTIES_HPP
+
+#include "data/general_properties/data.hpp"
+#include <array>
+
+namespace upp::impl::unicode_data::general_properties
+{
+    // Each lookup value stores the binary properties in the lower 4 bits (in the order below)
+    // and the index of the General_Category value in the upper bits.
+    // Read `dev/tools/unicode_data_generator/src/unicode_data_generator/datasets/general_properties.py`.
+
+    inline constexpr std::uint8_t white_space_bit        = 0x01U;
+    inline constexpr std::uint8_t alphabetic_bit         = 0x02U;
+    inline constexpr std::uint8_t xid_start_bit          = 0x04U;
+    inline constexpr std::uint8_t xid_continue_bit       = 0x08U;
+    inline constexpr std::uint8_t binary_properties_mask = 0x0FU;
+
+    inline constexpr std::uint8_t general_category_bit_offset = 4U;
+    /// Index of the `Cn` (unassigned) General_Category value.
+    inline constexpr std::uint8_t unassigned_general_category = 29U;
+
+    namespace impl
+    {
+        [[nodiscard]] consteval std::array<std::uint8_t, 128> make_ascii_properties() noexcept
+        {
+            std::array<std::uint8_t, 128> result{};
+
+            for (std::uint32_t code_point = 0; code_point < 128U; ++code_point)
+                result[code_point] = static_cast<std::uint8_t>(lookup(code_point) & binary_properties_mask);
+
+            return result;
+        }
+    } // namespace impl
+
+    /// Binary properties of every ASCII character, for scanners that never leave the ASCII range.
+    inline constexpr std::array<std::uint8_t, 128> ascii_properties = impl::make_ascii_properties();
+
+    [[nodiscard]] constexpr std::uint8_t lookup_binary_properties(const std::uint32_t code_point) noexcept
+    {
+        if (code_point < 128U)
+            return ascii_properties[code_point];
+
+        if (code_point > 0x10FFFFU)
+            return 0U;
+
+        return static_cast<std::uint8_t>(impl::lookup(code_point) & binary_properties_mask);
+    }
+
+    [[nodiscard]] constexpr std::uint8_t lookup_general_category(const std::uint32_t code_point) noexcept
+    {
+        if (code_point > 0x10FFFFU)
+            return unassigned_general_category;
+
+        return static_cast<std::uint8_t>(impl::lookup(code_point) >> general_category_bit_offset);
+    }
+} // namespace upp::impl::unicode_data::general_properties
+
+#endif // UNI_CPP_IMPL_UNICODE_DATA_GENERAL_PROPERTIES_HPP
\ No newline at end of file
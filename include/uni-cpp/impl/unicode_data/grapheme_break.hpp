@@ -0,0 +1,64 @@
+#ifndef UNI_CPP_IMPL_UNICODE_DATA_GRAPHEME_BREAK_HPP
+#define UNI_CPP_IMPL_UNICODE_DATA_GRAPHEME_BREAK_HPP
+
+#include "data/grapheme_break/data.hpp"
+
+namespace upp::impl::unicode_data::grapheme_break
+{
+    // The order has to match `grapheme_cluster_break_values` in the generator.
+    enum class grapheme_cluster_break : std::uint8_t
+    {
+        other,
+        cr,
+        lf,
+        control,
+        extend,
+        zwj,
+        regional_indicator,
+        prepend,
+        spacing_mark,
+        l,
+        v,
+        t,
+        lv,
+        lvt,
+    };
+
+    // The order has to match `indic_conjunct_break_values` in the generator.
+    enum class indic_conjunct_break : std::uint8_t
+    {
+        none,
+        linker,
+        consonant,
+        extend,
+    };
+
+    /// @brief Grapheme cluster break properties of a single code point, unpacked from the lookup value.
+    ///
+    /// Read `dev/tools/unicode_data_generator/src/unicode_data_generator/datasets/grapheme_break.py` for the layout of the value.
+    ///
+    class code_point_properties
+    {
+    public:
+        constexpr explicit code_point_properties(const std::uint8_t value) noexcept
+            : m_value(value)
+        {
+        }
+
+        [[nodiscard]] constexpr grapheme_cluster_break cluster_break() const noexcept { return static_cast<grapheme_cluster_break>(m_value & 0x0FU); }
+
+        [[nodiscard]] constexpr bool is_extended_pictographic() const noexcept { return (m_value & 0x10U) != 0; }
+
+        [[nodiscard]] constexpr indic_conjunct_break conjunct_break() const noexcept { return static_cast<indic_conjunct_break>(m_value >> 5U); }
+
+    private:
+        std::uint8_t m_value;
+    };
+
+    [[nodiscard]] constexpr code_point_properties lookup_properties(const std::uint32_t code_point) noexcept
+    {
+        return code_point_properties{impl::lookup(code_point)};
+    }
+} // namespace upp::impl::unicode_data::grapheme_break
+
+#endif // UNI_CPP_IMPL_UNICODE_DATA_GRAPHEME_BREAK_HPP
\ No newline at end of file
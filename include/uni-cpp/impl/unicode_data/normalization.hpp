@@ -0,0 +1,119 @@
+#ifndef UNI_CPP_IMPL_UNICODE_DATA_NORMALIZATION_HPP
+#define UNI_CPP_IMPL_UNICODE_DATA_NORMALIZATION_HPP
+
+#include "data/normalization/data.hpp"
+#include <algorithm>
+#include <span>
+
+namespace upp::impl::unicode_data::normalization
+{
+    enum class quick_check_result : std::uint8_t
+    {
+        yes   = 0,
+        maybe = 1,
+        no    = 2,
+    };
+
+    namespace hangul
+    {
+        // See Unicode Standard Chapter 3.12 (Conjoining Jamo Behavior).
+
+        inline constexpr std::uint32_t s_base  = 0xAC00U;
+        inline constexpr std::uint32_t l_base  = 0x1100U;
+        inline constexpr std::uint32_t v_base  = 0x1161U;
+        inline constexpr std::uint32_t t_base  = 0x11A7U;
+        inline constexpr std::uint32_t l_count = 19U;
+        inline constexpr std::uint32_t v_count = 21U;
+        inline constexpr std::uint32_t t_count = 28U;
+        inline constexpr std::uint32_t n_count = v_count * t_count;
+        inline constexpr std::uint32_t s_count = l_count * n_count;
+
+        [[nodiscard]] constexpr bool is_syllable(const std::uint32_t code_point) noexcept
+        {
+            return code_point - s_base < s_count;
+        }
+    } // namespace hangul
+
+    /// @brief Normalization properties of a single code point, unpacked from the lookup value.
+    ///
+    /// Read `dev/tools/unicode_data_generator/src/unicode_data_generator/datasets/normalization.py` for the layout of the value.
+    ///
+    class code_point_properties
+    {
+    public:
+        constexpr explicit code_point_properties(const std::uint64_t value) noexcept
+            : m_value(value)
+        {
+        }
+
+        [[nodiscard]] constexpr std::uint8_t canonical_combining_class() const noexcept { return static_cast<std::uint8_t>(m_value & 0xFFU); }
+
+        [[nodiscard]] constexpr quick_check_result nfc_quick_check() const noexcept { return static_cast<quick_check_result>((m_value >> 8U) & 0x3U); }
+
+        [[nodiscard]] constexpr quick_check_result nfkc_quick_check() const noexcept { return static_cast<quick_check_result>((m_value >> 10U) & 0x3U); }
+
+        /// @return The full canonical decomposition, or an empty span if the code point has none. Hangul syllables are not included.
+        ///
+        [[nodiscard]] constexpr std::span<const std::uint32_t> canonical_decomposition() const noexcept
+        {
+            return std::span<const std::uint32_t>{impl::decompositions}.subspan(offset(), canonical_length());
+        }
+
+        /// @return The full compatibility decomposition, or an empty span if the code point has none. Hangul syllables are not included.
+        ///
+        [[nodiscard]] constexpr std::span<const std::uint32_t> compatibility_decomposition() const noexcept
+        {
+            const std::size_t compatibility_offset = is_decomposition_shared() ? offset() : offset() + canonical_length();
+
+            return std::span<const std::uint32_t>{impl::decompositions}.subspan(compatibility_offset, compatibility_length());
+        }
+
+    private:
+        [[nodiscard]] constexpr std::size_t canonical_length() const noexcept { return static_cast<std::size_t>((m_value >> 12U) & 0x7U); }
+        [[nodiscard]] constexpr std::size_t compatibility_length() const noexcept { return static_cast<std::size_t>((m_value >> 15U) & 0x1FU); }
+        [[nodiscard]] constexpr bool        is_decomposition_shared() const noexcept { return ((m_value >> 20U) & 0x1U) != 0; }
+        [[nodiscard]] constexpr std::size_t offset() const noexcept { return static_cast<std::size_t>(m_value >> 21U); }
+
+    private:
+        std::uint64_t m_value;
+    };
+
+    [[nodiscard]] constexpr code_point_properties lookup_properties(const std::uint32_t code_point) noexcept
+    {
+        if (code_point > impl::greatest_code_point_with_normalization_data)
+            return code_point_properties{0}; // starter without a decomposition, allowed in every normalization form
+
+        return code_point_properties{impl::lookup(code_point)};
+    }
+
+    /// @return The primary composite of `first` and `second`, or `0` if they don't compose.
+    ///
+    [[nodiscard]] constexpr std::uint32_t compose(const std::uint32_t first, const std::uint32_t second) noexcept
+    {
+        // Hangul compositions
+
+        if (first - hangul::l_base < hangul::l_count && second - hangul::v_base < hangul::v_count)
+        {
+            const std::uint32_t l_index = first - hangul::l_base;
+            const std::uint32_t v_index = second - hangul::v_base;
+
+            return hangul::s_base + (l_index * hangul::v_count + v_index) * hangul::t_count;
+        }
+
+        if (hangul::is_syllable(first) && (first - hangul::s_base) % hangul::t_count == 0 && second - hangul::t_base - 1U < hangul::t_count - 1U)
+            return first + (second - hangul::t_base);
+
+        // Other compositions are looked up in a sorted table of `(first << 21) | second` keys.
+
+        const std::uint64_t key = (static_cast<std::uint64_t>(first) << 21U) | second;
+
+        const auto it = std::ranges::lower_bound(impl::composition_keys, key);
+
+        if (it == impl::composition_keys.end() || *it != key)
+            return 0;
+
+        return impl::composition_values[static_cast<std::size_t>(it - impl::composition_keys.begin())];
+    }
+} // namespace upp::impl::unicode_data::normalization
+
+#endif // UNI_CPP_IMPL_UNICODE_DATA_NORMALIZATION_HPP
\ No newline at end of file
@@ -0,0 +1,423 @@
+#ifndef UNI_CPP_INTERN_POOL_HPP
+#define UNI_CPP_INTERN_POOL_HPP
+
+/// @file
+///
+/// @brief Provides `intern_pool`, a concurrent pool that stores every distinct valid string once and identifies it with a 4 byte id.
+///
+
+#include "encoding.hpp"
+#include "ranges.hpp"
+#include "string.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <expected>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <shared_mutex>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace upp
+{
+    namespace impl::intern_pool
+    {
+        /// Code unit ranges that can be interned: contiguous and sized, so that they can be hashed and copied in one pass.
+        template<typename Range, encoding Encoding>
+        concept internable_range =
+            std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range> && ranges::code_unit_range_for<Range, Encoding>;
+
+        /// @brief FNV-1a of the code unit values, so that the same code units hash the same regardless of the code unit type.
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr std::uint64_t hash_code_units(const T* const data, const std::size_t size) noexcept
+        {
+            std::uint64_t hash = 0xCBF2'9CE4'8422'2325ULL;
+
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                hash ^= static_cast<std::uint64_t>(static_cast<std::make_unsigned_t<T>>(data[i]));
+                hash *= 0x0000'0100'0000'01B3ULL;
+            }
+
+            return hash;
+        }
+    } // namespace impl::intern_pool
+
+    /// @brief A concurrent pool of distinct valid strings, each identified by a 4 byte id.
+    ///
+    /// Interning a string that's already in the pool returns the id it got when it was interned first,
+    /// so the strings can be stored, copied and compared as ids. The code units are stored once, packed one after another
+    /// in slabs of `slab_size` code units, which avoids the per-allocation overhead of storing many short strings
+    /// (e.g. tag values) in separate containers. Stored code units never move, so the views returned by `view()`
+    /// stay valid for the lifetime of the pool.
+    ///
+    /// Interning checks that the code units are valid in `Encoding` with `encoding_traits<Encoding>::validate_range`,
+    /// unless they come from a `basic_ustring`. So `view()` returns a `ranges::valid_code_unit_view`, and the decoding
+    /// and transcoding adaptors can be applied to it without checking the code units again.
+    ///
+    /// The pool is split into `ShardCount` shards by the hash of the strings. Each shard has its own hash table and lock:
+    /// lookups of a string take a shared lock of its shard and insertions take an exclusive lock, so threads that intern
+    /// different strings rarely wait for each other. Resolving an id with `view()` doesn't lock at all.
+    /// Ids are only meaningful to the pool that returned them.
+    ///
+    /// @tparam Encoding The encoding of the strings. The code units are stored as `encoding_traits<Encoding>::default_code_unit_type`.
+    /// @tparam ShardCount The number of shards, a power of 2. Default value is 16.
+    ///
+    /// @par Example
+    ///
+    /// @code{.cpp}
+    ///
+    /// using namespace std::string_view_literals;
+    ///
+    /// upp::intern_pool<upp::encoding::utf8> tags;
+    ///
+    /// const auto id   = tags.intern(u8"region=eu-west"sv); // std::expected<id_type, from_utf8_error>
+    /// const auto same = tags.intern(u8"region=eu-west"sv);
+    ///
+    /// // *id == *same, and tags.view(*id) is a valid UTF-8 range of the stored code units
+    ///
+    /// const auto invalid = tags.intern("\xFF"sv); // an error, nothing is stored
+    ///
+    /// @endcode
+    ///
+    /// @headerfile "" <uni-cpp/intern_pool.hpp>
+    ///
+    template<encoding Encoding, std::size_t ShardCount = 16>
+        requires unicode_encoding<Encoding> && (std::has_single_bit(ShardCount) && ShardCount <= 256)
+    class intern_pool
+    {
+    public:
+        using traits_type    = encoding_traits<Encoding>;
+        using code_unit_type = traits_type::default_code_unit_type;
+        using size_type      = std::size_t;
+        using id_type        = std::uint32_t;
+        using view_type      = ranges::valid_code_unit_view<std::span<const code_unit_type>, Encoding>;
+        using error_type     = traits_type::from_error_type;
+
+        /// @brief The number of code units in a slab. Strings longer than a quarter of a slab are allocated separately.
+        ///
+        static constexpr size_type slab_size = 16 * 1024;
+
+    public:
+        /// @brief Constructs an empty pool.
+        ///
+        intern_pool() = default;
+
+        intern_pool(const intern_pool&)            = delete;
+        intern_pool& operator=(const intern_pool&) = delete;
+
+        /// @brief Returns the id of the string `code_units`, interning it if it isn't in the pool yet.
+        ///
+        /// @return The id, or the error from validating `code_units` if they aren't valid in `Encoding`.
+        ///         Code units that are already in the pool aren't validated again.
+        ///
+        /// @throws std::length_error if the shard of the string already holds the maximum number of strings.
+        ///
+        template<typename Range>
+            requires impl::intern_pool::internable_range<Range, Encoding>
+        [[nodiscard]] std::expected<id_type, error_type> intern(Range&& code_units)
+        {
+            const auto* const data = std::ranges::data(code_units);
+            const size_type   size = static_cast<size_type>(std::ranges::size(code_units));
+
+            const std::uint64_t hash = impl::intern_pool::hash_code_units(data, size);
+            shard&              s    = shard_of(hash);
+
+            if (const std::optional<id_type> id = s.find(data, size, hash))
+                return make_id(s, *id);
+
+            if (const auto validated = traits_type::validate_range(std::span{data, size}); !validated)
+                return std::unexpected(validated.error());
+
+            return make_id(s, s.insert(data, size, hash));
+        }
+
+        /// @brief Returns the id of `string`, interning it if it isn't in the pool yet. The code units aren't validated again.
+        ///
+        /// @throws std::length_error if the shard of the string already holds the maximum number of strings.
+        ///
+        template<string_compatible_container<Encoding> Container>
+        [[nodiscard]] id_type intern(const basic_ustring<Encoding, Container>& string)
+        {
+            const auto code_units = string.code_units();
+
+            const std::uint64_t hash = impl::intern_pool::hash_code_units(code_units.data(), code_units.size());
+            shard&              s    = shard_of(hash);
+
+            if (const std::optional<id_type> id = s.find(code_units.data(), code_units.size(), hash))
+                return make_id(s, *id);
+
+            return make_id(s, s.insert(code_units.data(), code_units.size(), hash));
+        }
+
+        /// @brief Returns the id of the string `code_units` if it is in the pool, without interning it.
+        ///
+        template<typename Range>
+            requires impl::intern_pool::internable_range<Range, Encoding>
+        [[nodiscard]] std::optional<id_type> find(Range&& code_units) const
+        {
+            const auto* const data = std::ranges::data(code_units);
+            const size_type   size = static_cast<size_type>(std::ranges::size(code_units));
+
+            const std::uint64_t hash = impl::intern_pool::hash_code_units(data, size);
+            const shard&        s    = shard_of(hash);
+
+            return s.find(data, size, hash).transform([&](const id_type index) { return make_id(s, index); });
+        }
+
+        /// @brief Returns the code units of the string with the id `id`, as a valid code unit range. Doesn't lock.
+        ///
+        /// The view stays valid for the lifetime of the pool.
+        ///
+        /// @pre `id` was returned by this pool.
+        ///
+        [[nodiscard]] view_type view(const id_type id) const noexcept { return view_type{code_units(id)}; }
+
+        /// @brief Returns the code units of the string with the id `id`. Doesn't lock.
+        ///
+        /// @pre `id` was returned by this pool.
+        ///
+        [[nodiscard]] std::span<const code_unit_type> code_units(const id_type id) const noexcept
+        {
+            return m_shards[id & (ShardCount - 1)].entry_at(id >> shard_bits);
+        }
+
+        /// @brief Returns the number of distinct strings in the pool.
+        ///
+        [[nodiscard]] size_type size() const
+        {
+            size_type count = 0;
+
+            for (const shard& s : m_shards)
+                count += s.size();
+
+            return count;
+        }
+
+    private:
+        static constexpr unsigned shard_bits = static_cast<unsigned>(std::countr_zero(ShardCount));
+
+        // The number of strings that a shard can hold, so that the index in the shard fits into an id next to the shard number,
+        // and the index plus one still fits into a table slot, where zero marks an empty slot.
+        static constexpr std::uint64_t max_shard_size = (std::uint64_t{1} << (32U - shard_bits)) - 1;
+
+        /// A shard of the pool: an open addressing hash table of indices into a segmented array of entries,
+        /// whose segments never move, so that entries can be read without the lock.
+        class shard
+        {
+        public:
+            shard() = default;
+
+            shard(const shard&)            = delete;
+            shard& operator=(const shard&) = delete;
+
+            ~shard()
+            {
+                for (std::atomic<entry*>& segment : m_segments)
+                    delete[] segment.load(std::memory_order_relaxed);
+            }
+
+            template<typename T>
+            [[nodiscard]] std::optional<id_type> find(const T* const data, const size_type size, const std::uint64_t hash) const
+            {
+                const std::shared_lock lock{m_mutex};
+
+                return find_locked(data, size, hash);
+            }
+
+            template<typename T>
+            [[nodiscard]] id_type insert(const T* const data, const size_type size, const std::uint64_t hash)
+            {
+                const std::unique_lock lock{m_mutex};
+
+                // Another thread may have inserted the string since it was looked up under the shared lock.
+                if (const std::optional<id_type> index = find_locked(data, size, hash))
+                    return *index;
+
+                if (m_size == max_shard_size)
+                    throw std::length_error("upp::intern_pool::intern: too many strings");
+
+                // Keep the load factor of the table at most 3/4.
+                if ((m_size + 1) * 4 > m_table.size() * 3)
+                    grow_table();
+
+                const id_type index = static_cast<id_type>(m_size);
+
+                store_entry(index, entry{store_code_units(data, size), size});
+                place(slot{index + 1, static_cast<std::uint32_t>(hash >> 32U)});
+                ++m_size;
+
+                return index;
+            }
+
+            [[nodiscard]] std::span<const code_unit_type> entry_at(const id_type index) const noexcept
+            {
+                const auto [segment, offset] = locate(index);
+
+                return m_segments[segment].load(std::memory_order_acquire)[offset];
+            }
+
+            [[nodiscard]] size_type size() const
+            {
+                const std::shared_lock lock{m_mutex};
+
+                return m_size;
+            }
+
+        private:
+            using entry = std::span<const code_unit_type>;
+
+            struct slot
+            {
+                std::uint32_t index_plus_one = 0; // 0 for empty slots
+                std::uint32_t hash           = 0; // the high half of the hash: its low bits select the home slot
+            };
+
+            // Segment `k` holds `first_segment_size << k` entries, so that 25 segments cover all indices that fit into an id.
+            static constexpr unsigned  first_segment_bits = 8;
+            static constexpr size_type segment_count      = 33 - first_segment_bits;
+
+            [[nodiscard]] static std::pair<size_type, size_type> locate(const size_type index) noexcept
+            {
+                const size_type segment = static_cast<size_type>(std::bit_width((index >> first_segment_bits) + 1)) - 1;
+                const size_type offset  = index - (((size_type{1} << segment) - 1) << first_segment_bits);
+
+                return {segment, offset};
+            }
+
+            template<typename T>
+            [[nodiscard]] std::optional<id_type> find_locked(const T* const data, const size_type size, const std::uint64_t hash) const
+            {
+                if (m_table.empty())
+                    return std::nullopt;
+
+                const size_type mask = m_table.size() - 1;
+
+                const std::uint32_t high_hash = static_cast<std::uint32_t>(hash >> 32U);
+
+                for (size_type i = high_hash & mask;; i = (i + 1) & mask)
+                {
+                    const slot& candidate = m_table[i];
+
+                    if (candidate.index_plus_one == 0)
+                        return std::nullopt;
+
+                    if (candidate.hash != high_hash)
+                        continue;
+
+                    const std::span<const code_unit_type> stored = entry_at(candidate.index_plus_one - 1);
+
+                    if (std::ranges::equal(stored, std::span{data, size}, {}, {}, [](const T code_unit) static {
+                            return static_cast<code_unit_type>(code_unit);
+                        }))
+                    {
+                        return candidate.index_plus_one - 1;
+                    }
+                }
+            }
+
+            void place(const slot new_slot) noexcept
+            {
+                const size_type mask = m_table.size() - 1;
+                size_type i = new_slot.hash & mask;
+
+                while (m_table[i].index_plus_one != 0)
+                    i = (i + 1) & mask;
+
+                m_table[i] = new_slot;
+            }
+
+            void grow_table()
+            {
+                std::vector<slot> old_table = std::exchange(m_table, std::vector<slot>(std::max(m_table.size() * 2, 16uz)));
+
+                for (const slot& s : old_table)
+                {
+                    if (s.index_plus_one != 0)
+                        place(s);
+                }
+            }
+
+            void store_entry(const id_type index, const entry e)
+            {
+                const auto [segment, offset] = locate(index);
+
+                entry* segment_entries = m_segments[segment].load(std::memory_order_relaxed);
+
+                if (segment_entries == nullptr)
+                {
+                    segment_entries = new entry[size_type{1} << (segment + first_segment_bits)];
+
+                    // Publishes the segment to threads that resolve ids without the lock.
+                    m_segments[segment].store(segment_entries, std::memory_order_release);
+                }
+
+                segment_entries[offset] = e;
+            }
+
+            template<typename T>
+            [[nodiscard]] const code_unit_type* store_code_units(const T* const data, const size_type size)
+            {
+                if (size == 0)
+                    return nullptr;
+
+                code_unit_type* destination = nullptr;
+
+                if (size > slab_size / 4)
+                {
+                    // Long strings get their own allocation, which leaves the current slab for the short strings.
+                    destination = m_long_strings.emplace_back(std::make_unique_for_overwrite<code_unit_type[]>(size)).get();
+                }
+                else
+                {
+                    if (m_slabs.empty() || slab_size - m_slab_used < size)
+                    {
+                        m_slabs.push_back(std::make_unique_for_overwrite<code_unit_type[]>(slab_size));
+                        m_slab_used = 0;
+                    }
+
+                    destination  = m_slabs.back().get() + m_slab_used;
+                    m_slab_used += size;
+                }
+
+                std::ranges::transform(data, data + size, destination,
+                                       [](const T code_unit) static { return static_cast<code_unit_type>(code_unit); });
+
+                return destination;
+            }
+
+            mutable std::shared_mutex                      m_mutex;
+            std::vector<slot>                              m_table;
+            size_type                                      m_size = 0;
+            std::array<std::atomic<entry*>, segment_count> m_segments{};
+            std::vector<std::unique_ptr<code_unit_type[]>> m_slabs;
+            size_type                                      m_slab_used = 0;
+            std::vector<std::unique_ptr<code_unit_type[]>> m_long_strings;
+        };
+
+        [[nodiscard]] shard& shard_of(const std::uint64_t hash) noexcept { return m_shards[hash & (ShardCount - 1)]; }
+
+        [[nodiscard]] const shard& shard_of(const std::uint64_t hash) const noexcept { return m_shards[hash & (ShardCount - 1)]; }
+
+        [[nodiscard]] id_type make_id(const shard& s, const id_type index) const noexcept
+        {
+            return (index << shard_bits) | static_cast<id_type>(&s - m_shards.data());
+        }
+
+    private:
+        std::array<shard, ShardCount> m_shards;
+    };
+} // namespace upp
+
+#endif // UNI_CPP_INTERN_POOL_HPP
\ No newline at end of file
@@ -0,0 +1,259 @@
+#ifndef UNI_CPP_LINE_INDEX_HPP
+#define UNI_CPP_LINE_INDEX_HPP
+
+/// @file
+///
+/// @brief Provides `line_index`, a side index for converting code unit offsets into a text to line and column numbers.
+///
+
+#include "encoding.hpp"
+#include "string.hpp"
+#include "impl/line_break.hpp"
+#include "impl/text_metadata.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <concepts>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace upp
+{
+    namespace impl::line_index
+    {
+        template<typename Text, encoding Encoding>
+        inline constexpr bool is_ustring_of = false;
+
+        template<encoding Encoding, typename Container>
+        inline constexpr bool is_ustring_of<basic_ustring<Encoding, Container>, Encoding> = true;
+
+        /// Texts that `line_index` can index: strings and contiguous ranges of `Encoding` code units, which don't have to be valid.
+        template<typename Text, encoding Encoding>
+        concept indexable_text = is_ustring_of<std::remove_cvref_t<Text>, Encoding> ||
+                                 (std::ranges::contiguous_range<const Text> && std::ranges::sized_range<const Text> &&
+                                  code_unit_type_for<std::remove_cv_t<std::ranges::range_value_t<const Text>>, Encoding>);
+
+        template<encoding Encoding, typename Text>
+        [[nodiscard]] constexpr auto code_units_of(const Text& text) noexcept
+        {
+            if constexpr (is_ustring_of<Text, Encoding>)
+                return text.code_units();
+            else
+                return std::span{std::ranges::data(text), static_cast<std::size_t>(std::ranges::size(text))};
+        }
+
+        /// @brief The location of a code point boundary in a text: its line and its column in each unit.
+        ///
+        struct location
+        {
+            std::size_t line       = 0; ///< Line number.
+            std::size_t code_unit  = 0; ///< Column in code units of the encoding of the text.
+            std::size_t code_point = 0; ///< Column in code points.
+            std::size_t utf16      = 0; ///< Column in UTF-16 code units.
+
+            [[nodiscard]] friend constexpr bool operator==(const location&, const location&) noexcept = default;
+        };
+
+        /// The decoding errors of `Encoding` text, whose `valid_up_to` is the code unit offset of the error.
+        /// An ASCII error reports a byte offset, which is a UTF-8 code unit offset too.
+        template<typename Error, encoding Encoding>
+        concept decoding_error = std::same_as<Error, typename encoding_traits<Encoding>::from_error_type> ||
+                                 (Encoding == encoding::utf8 && std::same_as<Error, from_ascii_error>);
+    } // namespace impl::line_index
+
+    /// @brief A side index for a UTF-8, UTF-16 or UTF-32 text that converts code unit offsets to line and column numbers.
+    ///
+    /// Decoding errors (`from_utf8_error` etc.) report where the text stopped being valid as a code unit offset,
+    /// while error messages want a line and a column. Converting the offset without an index scans the text from its beginning.
+    /// `line_index` records the code unit offset of the start of every line, so a conversion is a binary search for the line
+    /// followed by counting the code units in front of the offset on that line, a word at a time in UTF-8.
+    ///
+    /// The index is built in one pass that searches for line breaks a word at a time, like `views::lines`.
+    /// Only line breaks are looked at, so the text doesn't have to be valid, e.g. it can be the input that `from_utf8` rejected.
+    /// Optionally, the code point offset of every line is recorded too, which makes code point offsets
+    /// (as reported by other tools) convertible as well.
+    ///
+    /// The index doesn't store or refer to the text. Every member function that reads the text takes it as a parameter,
+    /// which must be the text that the index was built for. The text is either a `basic_ustring` or a contiguous range of code units.
+    ///
+    /// Lines and columns are counted from zero. A line break at the end of the text starts an empty last line,
+    /// so that the offset of the end of the text has a location too.
+    ///
+    /// @tparam Encoding The encoding of the text.
+    /// @tparam Policy Which sequences end a line.
+    ///
+    /// @par Example
+    ///
+    /// @code{.cpp}
+    ///
+    /// using namespace std::string_view_literals;
+    ///
+    /// const auto config = u8"name = \"Zo\u00EB\"\nvalue = \"\xFF\"\n"sv;
+    ///
+    /// if (const auto string = upp::ustring::from_utf8(config); !string.has_value())
+    /// {
+    ///     const upp::line_index<upp::encoding::utf8> index{config};
+    ///
+    ///     const auto location = index.resolve(config, string.error());
+    ///
+    ///     // location.line == 1, location.code_point == 9
+    /// }
+    ///
+    /// @endcode
+    ///
+    /// @headerfile "" <uni-cpp/line_index.hpp>
+    ///
+    template<encoding Encoding, line_break_policy Policy = line_break_policy::unicode>
+        requires unicode_encoding<Encoding>
+    class line_index
+    {
+    public:
+        /// @brief The location of a code point boundary in the text: its line and its column in each unit.
+        ///
+        /// The same type for every `Encoding` and `Policy`.
+        ///
+        using location = impl::line_index::location;
+
+    public:
+        /// @brief Constructs the index of an empty text.
+        ///
+        constexpr line_index() = default;
+
+        /// @brief Builds the index of `text`.
+        ///
+        /// @param with_code_point_offsets Whether to also record the code point offset of every line, for `from_code_point`.
+        ///
+        template<typename Text>
+            requires impl::line_index::indexable_text<Text, Encoding>
+        explicit constexpr line_index(const Text& text, const bool with_code_point_offsets = false)
+        {
+            const auto code_units = impl::line_index::code_units_of<Encoding>(text);
+
+            const auto* const data = code_units.data();
+            const std::size_t size = code_units.size();
+
+            if (with_code_point_offsets)
+                m_code_point_offsets.push_back(0);
+
+            for (std::size_t start = 0;;)
+            {
+                const auto [index, length] = impl::line_break::find_line_break<Encoding, Policy>(data + start, size - start);
+
+                if (length == 0)
+                    break;
+
+                const std::size_t next_line = start + index + length;
+
+                m_line_starts.push_back(next_line);
+
+                if (with_code_point_offsets)
+                {
+                    const std::size_t line_code_points = impl::text_metadata::count_code_points(data + start, next_line - start);
+
+                    m_code_point_offsets.push_back(m_code_point_offsets.back() + line_code_points);
+                }
+
+                start = next_line;
+            }
+        }
+
+        /// @brief Returns the number of lines.
+        ///
+        /// One more than the number of line breaks, so unlike `ranges::count_lines`, this counts the empty line after
+        /// a line break at the end of the text, and an empty text has one line.
+        ///
+        [[nodiscard]] constexpr std::size_t line_count() const noexcept { return m_line_starts.size(); }
+
+        /// @brief Returns the code unit offset of the start of line `line`.
+        ///
+        /// @pre `line < line_count()`
+        ///
+        [[nodiscard]] constexpr std::size_t line_start(const std::size_t line) const noexcept { return m_line_starts[line]; }
+
+        /// @brief Checks whether the index was built with the code point offsets of the lines, so that `from_code_point` can be used.
+        ///
+        [[nodiscard]] constexpr bool has_code_point_offsets() const noexcept { return !m_code_point_offsets.empty(); }
+
+        /// @brief Returns the location of the code unit offset `offset`.
+        ///
+        /// Only the code units of the line in front of `offset` are read, so they have to be valid, but the rest of the text doesn't.
+        ///
+        /// @pre `offset <= text size` and `offset` is a code point boundary.
+        ///
+        template<typename Text>
+            requires impl::line_index::indexable_text<Text, Encoding>
+        [[nodiscard]] constexpr location resolve(const Text& text, const std::size_t offset) const noexcept
+        {
+            const std::size_t line  = static_cast<std::size_t>(std::ranges::upper_bound(m_line_starts, offset) - m_line_starts.begin()) - 1;
+            const std::size_t start = m_line_starts[line];
+
+            const auto* const data = impl::line_index::code_units_of<Encoding>(text).data() + start;
+            const std::size_t size = offset - start;
+
+            const std::size_t code_points = impl::text_metadata::count_code_points(data, size);
+
+            std::size_t utf16 = size;
+
+            if constexpr (Encoding == encoding::utf8)
+                utf16 = code_points + impl::text_metadata::count_supplementary(data, size);
+            else if constexpr (Encoding == encoding::utf32)
+                utf16 = size + impl::text_metadata::count_supplementary(data, size);
+
+            return location{.line = line, .code_unit = size, .code_point = code_points, .utf16 = utf16};
+        }
+
+        /// @brief Returns the location of a decoding error of the text, i.e. of its `valid_up_to` offset.
+        ///
+        /// Only the errors of decoding `Encoding` text are accepted (and `from_ascii_error` for UTF-8),
+        /// because the offsets of other errors count different code units.
+        ///
+        template<typename Text, typename Error>
+            requires impl::line_index::indexable_text<Text, Encoding> && impl::line_index::decoding_error<Error, Encoding>
+        [[nodiscard]] constexpr location resolve(const Text& text, const Error& error) const noexcept
+        {
+            return resolve(text, error.valid_up_to);
+        }
+
+        /// @brief Returns the location of the code point offset `offset`.
+        ///
+        /// @pre `has_code_point_offsets()`, `offset` is at most the number of code points of the text,
+        ///      and the text is valid up to the location of `offset`.
+        ///
+        template<typename Text>
+            requires impl::line_index::indexable_text<Text, Encoding>
+        [[nodiscard]] constexpr location from_code_point(const Text& text, const std::size_t offset) const noexcept
+        {
+            const std::size_t line =
+                static_cast<std::size_t>(std::ranges::upper_bound(m_code_point_offsets, offset) - m_code_point_offsets.begin()) - 1;
+
+            const auto code_units = impl::line_index::code_units_of<Encoding>(text);
+
+            std::size_t code_unit = m_line_starts[line];
+            std::size_t remaining = offset - m_code_point_offsets[line];
+
+            // Skips the code points in front of `offset` on its line, stopping at the leading code unit of the one at `offset`.
+            for (; code_unit < code_units.size(); ++code_unit)
+            {
+                if (impl::text_metadata::is_leading_code_unit(code_units[code_unit]))
+                {
+                    if (remaining == 0)
+                        break;
+
+                    --remaining;
+                }
+            }
+
+            return resolve(text, code_unit);
+        }
+
+    private:
+        std::vector<std::size_t> m_line_starts{0};
+        std::vector<std::size_t> m_code_point_offsets;
+    };
+} // namespace upp
+
+#endif // UNI_CPP_LINE_INDEX_HPP
\ No newline at end of file
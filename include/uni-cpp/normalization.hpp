@@ -0,0 +1,409 @@
+#ifndef UNI_CPP_NORMALIZATION_HPP
+#define UNI_CPP_NORMALIZATION_HPP
+
+/// @file
+///
+/// @brief Unicode normalization forms.
+///
+/// Strings are normalized with `basic_ustring::normalize()`, sequences of `uchar`s lazily with
+/// the @ref upp::views::normalize "views::normalize" range adaptors.
+///
+/// @see https://www.unicode.org/reports/tr15/
+///
+
+#include "uchar.hpp"
+#include "encoding.hpp"
+#include "impl/swar.hpp"
+#include "impl/decode_valid.hpp"
+#include "impl/unicode_data/normalization.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace upp
+{
+    /// @brief Unicode normalization forms.
+    ///
+    /// @see basic_ustring::normalize, views::normalize
+    ///
+    /// @headerfile "" <uni-cpp/normalization.hpp>
+    ///
+    enum class normalization_form : std::uint8_t
+    {
+        nfc,  ///< Canonical decomposition, followed by canonical composition.
+        nfd,  ///< Canonical decomposition.
+        nfkc, ///< Compatibility decomposition, followed by canonical composition.
+        nfkd, ///< Compatibility decomposition.
+    };
+
+    namespace impl::normalization
+    {
+        namespace data = unicode_data::normalization;
+
+        using data::quick_check_result;
+
+        template<normalization_form Form>
+        inline constexpr bool is_composing_form = Form == normalization_form::nfc || Form == normalization_form::nfkc;
+
+        template<normalization_form Form>
+        inline constexpr bool is_compatibility_form = Form == normalization_form::nfkc || Form == normalization_form::nfkd;
+
+        /// @brief Code points below this value are starters that are unchanged by `Form`, so they don't need a table lookup.
+        ///
+        /// Nothing below `U+0300` (the first combining mark) changes in NFC.
+        /// The other forms already decompose characters from the Latin-1 Supplement.
+        ///
+        template<normalization_form Form>
+        inline constexpr std::uint32_t quick_check_yes_limit = Form == normalization_form::nfc ? 0x300U : 0x80U;
+
+        template<normalization_form Form>
+        [[nodiscard]] constexpr data::code_point_properties lookup_properties(const std::uint32_t code_point) noexcept
+        {
+            if (code_point < quick_check_yes_limit<Form>)
+                return data::code_point_properties{0};
+
+            return data::lookup_properties(code_point);
+        }
+
+        template<normalization_form Form>
+        [[nodiscard]] constexpr quick_check_result quick_check(const std::uint32_t code_point, const data::code_point_properties properties) noexcept
+        {
+            if constexpr (Form == normalization_form::nfc)
+            {
+                return properties.nfc_quick_check();
+            }
+            else if constexpr (Form == normalization_form::nfkc)
+            {
+                return properties.nfkc_quick_check();
+            }
+            else
+            {
+                // NFD_QC and NFKD_QC are `No` exactly for the code points that have a decomposition.
+
+                if (data::hangul::is_syllable(code_point))
+                    return quick_check_result::no;
+
+                const bool has_decomposition = is_compatibility_form<Form> ? !properties.compatibility_decomposition().empty()
+                                                                           : !properties.canonical_decomposition().empty();
+
+                return has_decomposition ? quick_check_result::no : quick_check_result::yes;
+            }
+        }
+
+        /// @brief Checks whether a normalization segment starts at `code_point`.
+        ///
+        /// Starters that are unchanged by `Form` neither reorder nor compose with the code points before them,
+        /// so the text on both sides of them can be normalized independently (see UAX #15, section 9).
+        ///
+        template<normalization_form Form>
+        [[nodiscard]] constexpr bool is_segment_start(const std::uint32_t code_point, const data::code_point_properties properties) noexcept
+        {
+            return properties.canonical_combining_class() == 0 && quick_check<Form>(code_point, properties) == quick_check_result::yes;
+        }
+
+        template<normalization_form Form>
+        [[nodiscard]] constexpr bool is_segment_start(const std::uint32_t code_point) noexcept
+        {
+            return code_point < quick_check_yes_limit<Form> || is_segment_start<Form>(code_point, data::lookup_properties(code_point));
+        }
+
+        // The code points of a segment are buffered together with their Canonical_Combining_Class,
+        // so that the canonical ordering and composition don't have to look it up again.
+
+        [[nodiscard]] constexpr std::uint32_t pack(const std::uint32_t code_point, const std::uint8_t canonical_combining_class) noexcept
+        {
+            return (static_cast<std::uint32_t>(canonical_combining_class) << 24U) | code_point;
+        }
+
+        [[nodiscard]] constexpr std::uint32_t code_point_of(const std::uint32_t packed) noexcept
+        {
+            return packed & 0xFF'FFFFU;
+        }
+
+        [[nodiscard]] constexpr std::uint8_t canonical_combining_class_of(const std::uint32_t packed) noexcept
+        {
+            return static_cast<std::uint8_t>(packed >> 24U);
+        }
+
+        /// @brief Appends the full decomposition of `code_point` (or `code_point` itself, if it has none) to `buffer`.
+        ///
+        template<normalization_form Form>
+        constexpr void decompose(const std::uint32_t code_point, std::vector<std::uint32_t>& buffer)
+        {
+            namespace hangul = data::hangul;
+
+            if (hangul::is_syllable(code_point))
+            {
+                const std::uint32_t s_index = code_point - hangul::s_base;
+                const std::uint32_t t_index = s_index % hangul::t_count;
+
+                buffer.push_back(hangul::l_base + s_index / hangul::n_count);
+                buffer.push_back(hangul::v_base + (s_index % hangul::n_count) / hangul::t_count);
+
+                if (t_index != 0)
+                    buffer.push_back(hangul::t_base + t_index);
+
+                return;
+            }
+
+            // Not `lookup_properties<Form>`: code points that are unchanged by `Form` on their own
+            // may still have to be decomposed here, so that they can be reordered or composed differently.
+            const auto properties    = data::lookup_properties(code_point);
+            const auto decomposition = is_compatibility_form<Form> ? properties.compatibility_decomposition() : properties.canonical_decomposition();
+
+            if (decomposition.empty())
+            {
+                buffer.push_back(pack(code_point, properties.canonical_combining_class()));
+                return;
+            }
+
+            for (const std::uint32_t decomposed : decomposition)
+                buffer.push_back(pack(decomposed, data::lookup_properties(decomposed).canonical_combining_class()));
+        }
+
+        /// @brief Canonical Ordering Algorithm: stably sorts every run of non-starters by their Canonical_Combining_Class.
+        ///
+        constexpr void reorder(std::span<std::uint32_t> buffer) noexcept
+        {
+            // The runs of non-starters are short, so insertion sort is the fastest option.
+
+            for (std::size_t i = 1; i < buffer.size(); ++i)
+            {
+                const std::uint32_t current = buffer[i];
+                const std::uint8_t  ccc     = canonical_combining_class_of(current);
+
+                if (ccc == 0)
+                    continue;
+
+                std::size_t j = i;
+
+                for (; j > 0 && canonical_combining_class_of(buffer[j - 1]) > ccc; --j)
+                    buffer[j] = buffer[j - 1];
+
+                buffer[j] = current;
+            }
+        }
+
+        /// @brief Canonical Composition Algorithm: replaces unblocked pairs of a starter and a following code point with their primary composite.
+        ///
+        constexpr void compose(std::vector<std::uint32_t>& buffer) noexcept
+        {
+            std::size_t  size         = 0;
+            std::size_t  starter      = 0;
+            bool         has_starter  = false;
+            std::uint8_t previous_ccc = 0;
+
+            for (const std::uint32_t current : buffer)
+            {
+                const std::uint8_t ccc = canonical_combining_class_of(current);
+
+                // A code point is blocked from the starter if there is a code point between them with a greater or equal combining class,
+                // or if it is a starter itself and doesn't directly follow the starter.
+                const bool is_blocked = size != starter + 1 && (previous_ccc == 0 || previous_ccc >= ccc);
+
+                if (has_starter && !is_blocked)
+                {
+                    if (const std::uint32_t composite = data::compose(code_point_of(buffer[starter]), code_point_of(current)); composite != 0)
+                    {
+                        buffer[starter] = pack(composite, 0);
+                        continue;
+                    }
+                }
+
+                if (ccc == 0)
+                {
+                    starter     = size;
+                    has_starter = true;
+                }
+
+                previous_ccc   = ccc;
+                buffer[size++] = current;
+            }
+
+            buffer.resize(size);
+        }
+
+        /// @brief Reorders and (for the composing forms) composes the decomposed code points of a segment.
+        ///
+        template<normalization_form Form>
+        constexpr void normalize_decomposed(std::vector<std::uint32_t>& buffer)
+        {
+            reorder(buffer);
+
+            if constexpr (is_composing_form<Form>)
+                compose(buffer);
+        }
+
+        /// @brief Normalizes the segment of valid `Encoding` code units `[code_units, code_units + size)` into `buffer`.
+        ///
+        template<normalization_form Form, encoding Encoding, typename T>
+        constexpr void normalize_segment(const T* code_units, std::size_t size, std::vector<std::uint32_t>& buffer)
+        {
+            buffer.clear();
+
+            for (std::size_t index = 0; index < size;)
+            {
+                const auto [code_point, length] = decode_valid_code_point<Encoding>(code_units + index);
+
+                decompose<Form>(code_point, buffer);
+                index += length;
+            }
+
+            normalize_decomposed<Form>(buffer);
+        }
+
+        struct segment
+        {
+            std::size_t begin;
+            std::size_t end;
+            bool        is_normalized;
+        };
+
+        /// @brief Finds the end of the segment starting at `index` and runs the quick check on it.
+        ///
+        /// A segment is normalized if all of its code points are allowed in `Form` and its non-starters are in canonical order.
+        /// Segments with code points that only may be allowed in `Form` (quick check result "maybe") are considered unnormalized.
+        ///
+        template<normalization_form Form, encoding Encoding, typename T>
+        [[nodiscard]] constexpr segment scan_segment(const T* code_units, std::size_t size, std::size_t index) noexcept
+        {
+            const std::size_t begin = index;
+
+            const auto [first, first_length] = decode_valid_code_point<Encoding>(code_units + index);
+            const auto first_properties      = lookup_properties<Form>(first);
+
+            bool         is_normalized = quick_check<Form>(first, first_properties) == quick_check_result::yes;
+            std::uint8_t previous_ccc  = first_properties.canonical_combining_class();
+
+            index += first_length;
+
+            while (index < size)
+            {
+                const auto [code_point, length] = decode_valid_code_point<Encoding>(code_units + index);
+                const auto properties           = lookup_properties<Form>(code_point);
+                const auto result               = quick_check<Form>(code_point, properties);
+                const std::uint8_t ccc          = properties.canonical_combining_class();
+
+                if (ccc == 0 && result == quick_check_result::yes)
+                    break;
+
+                if (result != quick_check_result::yes || (ccc != 0 && previous_ccc > ccc))
+                    is_normalized = false;
+
+                previous_ccc = ccc;
+                index += length;
+            }
+
+            return {begin, index, is_normalized};
+        }
+
+        /// @brief Finds the first segment at or after `index` that fails the quick check.
+        ///
+        /// @return The bounds of the segment, or `{size, size}` if all the remaining segments pass the quick check.
+        ///
+        template<normalization_form Form, encoding Encoding, typename T>
+        [[nodiscard]] constexpr segment find_first_unnormalized_segment(const T* code_units, std::size_t size, std::size_t index) noexcept
+        {
+            while (index < size)
+            {
+                if constexpr (Encoding == encoding::utf8)
+                {
+                    // Most text is ASCII, and every ASCII character is a normalized segment on its own, so skip ASCII a word at a time.
+                    // Only the last ASCII character before a non-ASCII one has to be checked, because it may be followed by combining marks.
+
+                    const std::size_t ascii_length = swar::ascii_prefix_length(code_units + index, size - index);
+
+                    if (ascii_length == size - index)
+                        break;
+
+                    if (ascii_length > 1)
+                        index += ascii_length - 1;
+                }
+
+                const segment current = scan_segment<Form, Encoding>(code_units, size, index);
+
+                if (!current.is_normalized)
+                    return current;
+
+                index = current.end;
+            }
+
+            return {size, size, true};
+        }
+
+        /// @brief Normalizes the valid `Encoding` code units `[code_units, code_units + size)`.
+        ///
+        /// Runs of segments that pass the quick check are passed to `append_code_units` as they are,
+        /// while the code points of the normalized segments are passed to `append_code_point` one by one.
+        ///
+        /// @param index Offset of a segment start, before which the code units are known to pass the quick check.
+        ///
+        template<normalization_form Form, encoding Encoding, typename T, typename AppendCodeUnits, typename AppendCodePoint>
+        constexpr void normalize(const T* code_units, std::size_t size, std::size_t index, AppendCodeUnits&& append_code_units,
+                                 AppendCodePoint&& append_code_point)
+        {
+            std::vector<std::uint32_t> buffer;
+
+            std::size_t copied_up_to = 0;
+
+            while (copied_up_to < size)
+            {
+                const segment unnormalized = find_first_unnormalized_segment<Form, Encoding>(code_units, size, index);
+
+                if (unnormalized.begin != copied_up_to)
+                    append_code_units(std::span<const T>{code_units + copied_up_to, unnormalized.begin - copied_up_to});
+
+                if (unnormalized.begin == size)
+                    break;
+
+                normalize_segment<Form, Encoding>(code_units + unnormalized.begin, unnormalized.end - unnormalized.begin, buffer);
+
+                for (const std::uint32_t packed : buffer)
+                    append_code_point(code_point_of(packed));
+
+                copied_up_to = index = unnormalized.end;
+            }
+        }
+
+        /// @brief Checks whether the valid `Encoding` code units `[code_units, code_units + size)` are in the normalization form `Form`.
+        ///
+        /// Segments that don't pass the quick check are normalized and compared with the original.
+        ///
+        template<normalization_form Form, encoding Encoding, typename T>
+        [[nodiscard]] constexpr bool is_normalized(const T* code_units, std::size_t size)
+        {
+            std::vector<std::uint32_t> buffer;
+
+            std::size_t index = 0;
+
+            while (true)
+            {
+                const segment unnormalized = find_first_unnormalized_segment<Form, Encoding>(code_units, size, index);
+
+                if (unnormalized.begin == size)
+                    return true;
+
+                normalize_segment<Form, Encoding>(code_units + unnormalized.begin, unnormalized.end - unnormalized.begin, buffer);
+
+                std::size_t normalized_index = 0;
+
+                for (index = unnormalized.begin; index < unnormalized.end; ++normalized_index)
+                {
+                    const auto [code_point, length] = decode_valid_code_point<Encoding>(code_units + index);
+
+                    if (normalized_index == buffer.size() || code_point_of(buffer[normalized_index]) != code_point)
+                        return false;
+
+                    index += length;
+                }
+
+                if (normalized_index != buffer.size())
+                    return false;
+            }
+        }
+    } // namespace impl::normalization
+} // namespace upp
+
+#endif // UNI_CPP_NORMALIZATION_HPP
\ No newline at end of file
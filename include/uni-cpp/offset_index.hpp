@@ -0,0 +1,348 @@
+#ifndef UNI_CPP_OFFSET_INDEX_HPP
+#define UNI_CPP_OFFSET_INDEX_HPP
+
+/// @file
+///
+/// @brief Provides `offset_index`, a side index for converting between code unit, code point and UTF-16 offsets into a UTF-8 or UTF-16 text.
+///
+
+#include "encoding.hpp"
+#include "ranges.hpp"
+#include "string.hpp"
+#include "impl/swar.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include <bit>
+
+namespace upp
+{
+    namespace impl::offset_index
+    {
+        template<typename Text, encoding Encoding>
+        inline constexpr bool is_ustring_of = false;
+
+        template<encoding Encoding, typename Container>
+        inline constexpr bool is_ustring_of<basic_ustring<Encoding, Container>, Encoding> = true;
+
+        /// Texts that `offset_index` can index: strings and contiguous valid code unit ranges.
+        template<typename Text, encoding Encoding>
+        concept indexable_text =
+            is_ustring_of<std::remove_cvref_t<Text>, Encoding> ||
+            (std::ranges::contiguous_range<const Text> && std::ranges::sized_range<const Text> && ranges::valid_code_unit_range<Text, Encoding>);
+
+        template<encoding Encoding, typename Text>
+        [[nodiscard]] constexpr auto code_units_of(const Text& text) noexcept
+        {
+            if constexpr (is_ustring_of<Text, Encoding>)
+                return text.code_units();
+            else
+                return std::span{std::ranges::data(text), static_cast<std::size_t>(std::ranges::size(text))};
+        }
+
+        template<typename T>
+        [[nodiscard]] constexpr std::uint32_t code_unit_value(const T code_unit) noexcept
+        {
+            return static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<T>>(code_unit));
+        }
+    } // namespace impl::offset_index
+
+    /// @brief A side index for a UTF-8 or UTF-16 text that converts between code unit offsets, code point offsets and UTF-16 offsets.
+    ///
+    /// Editors and language servers receive positions as UTF-16 offsets (LSP) or code point offsets, while the text is stored as UTF-8.
+    /// Converting such a position without an index scans the text from its beginning. `offset_index` records a checkpoint
+    /// (the three offsets of a code point boundary) every `interval` code points, so a conversion is a binary search
+    /// for the nearest checkpoint followed by a scan of at most `interval` code points: O(log n + interval).
+    ///
+    /// The index doesn't store or refer to the text. Every member function that reads the text takes it as a parameter,
+    /// which must be the text that the index was built for (or updated to).
+    /// The text is either a `basic_ustring` or a contiguous range that models `ranges::valid_code_unit_range`.
+    ///
+    /// The index is built in one pass that counts UTF-8 a word at a time. After an edit of the text, `update()` rescans
+    /// only the surroundings of the edit and shifts the checkpoints that follow it.
+    ///
+    /// @tparam Encoding The encoding of the text, `encoding::utf8` or `encoding::utf16`.
+    ///
+    /// @par Example
+    ///
+    /// @code{.cpp}
+    ///
+    /// using namespace upp::string_literals;
+    ///
+    /// auto text = u8"caf\u00E9 \U0001F600 ..."_us;
+    ///
+    /// const upp::offset_index<upp::encoding::utf8> index{text};
+    ///
+    /// // An LSP position 7 UTF-16 code units into the text (after the emoji, which takes 2 UTF-16 code units)
+    /// const auto position = index.from_utf16(text, 7);
+    ///
+    /// // position.code_unit == 10, position.code_point == 6
+    ///
+    /// @endcode
+    ///
+    /// @headerfile "" <uni-cpp/offset_index.hpp>
+    ///
+    template<encoding Encoding>
+        requires(Encoding == encoding::utf8 || Encoding == encoding::utf16)
+    class offset_index
+    {
+    public:
+        /// @brief A code point boundary in the text, as its offset in each unit.
+        ///
+        struct position
+        {
+            std::size_t code_unit  = 0; ///< Offset in code units of `Encoding`.
+            std::size_t code_point = 0; ///< Offset in code points.
+            std::size_t utf16      = 0; ///< Offset in UTF-16 code units.
+
+            [[nodiscard]] friend constexpr bool operator==(const position&, const position&) noexcept = default;
+        };
+
+        /// @brief The number of code points between checkpoints used by default.
+        ///
+        static constexpr std::size_t default_interval = 128;
+
+    public:
+        /// @brief Constructs the index of an empty text.
+        ///
+        constexpr offset_index() = default;
+
+        /// @brief Builds the index of `text`, with a checkpoint every `interval` code points.
+        ///
+        /// More checkpoints (a smaller `interval`) make conversions faster and take more memory.
+        ///
+        template<typename Text>
+            requires impl::offset_index::indexable_text<Text, Encoding>
+        explicit constexpr offset_index(const Text& text, const std::size_t interval = default_interval)
+            : m_interval(std::max(interval, 1uz))
+        {
+            const auto code_units = impl::offset_index::code_units_of<Encoding>(text);
+
+            m_end = scan(code_units.data(), position{}, code_units.size(), m_checkpoints);
+        }
+
+        /// @brief Returns the number of code points between checkpoints.
+        ///
+        [[nodiscard]] constexpr std::size_t interval() const noexcept { return m_interval; }
+
+        /// @brief Returns the position of the end of the text, i.e. its size in code units, in code points and in UTF-16 code units.
+        ///
+        [[nodiscard]] constexpr position end() const noexcept { return m_end; }
+
+        /// @brief Returns the position at the code unit offset `offset`.
+        ///
+        /// An offset inside of an encoded code point resolves to the beginning of that code point.
+        ///
+        /// @pre `offset <= end().code_unit`
+        ///
+        template<typename Text>
+            requires impl::offset_index::indexable_text<Text, Encoding>
+        [[nodiscard]] constexpr position from_code_unit(const Text& text, const std::size_t offset) const noexcept
+        {
+            return find(impl::offset_index::code_units_of<Encoding>(text), &position::code_unit, offset);
+        }
+
+        /// @brief Returns the position at the code point offset `offset`.
+        ///
+        /// @pre `offset <= end().code_point`
+        ///
+        template<typename Text>
+            requires impl::offset_index::indexable_text<Text, Encoding>
+        [[nodiscard]] constexpr position from_code_point(const Text& text, const std::size_t offset) const noexcept
+        {
+            return find(impl::offset_index::code_units_of<Encoding>(text), &position::code_point, offset);
+        }
+
+        /// @brief Returns the position at the UTF-16 offset `offset`.
+        ///
+        /// An offset between the two code units of a surrogate pair resolves to the beginning of the pair.
+        ///
+        /// @pre `offset <= end().utf16`
+        ///
+        template<typename Text>
+            requires impl::offset_index::indexable_text<Text, Encoding>
+        [[nodiscard]] constexpr position from_utf16(const Text& text, const std::size_t offset) const noexcept
+        {
+            return find(impl::offset_index::code_units_of<Encoding>(text), &position::utf16, offset);
+        }
+
+        /// @brief Updates the index after the code units `[offset, offset + removed_size)` of the text were replaced
+        /// with `inserted_size` code units.
+        ///
+        /// Only the code points between the checkpoints around the edit are scanned, so the cost is O(interval + inserted_size)
+        /// plus shifting the checkpoints after the edit.
+        ///
+        /// @param text The text after the edit.
+        /// @param offset The code unit offset of the edit.
+        /// @param removed_size The number of code units removed at `offset`.
+        /// @param inserted_size The number of code units inserted at `offset`.
+        ///
+        /// @pre `offset` and `offset + removed_size` are code point boundaries of the text before the edit,
+        ///      and `text` is the text before the edit with the code units replaced.
+        ///
+        template<typename Text>
+            requires impl::offset_index::indexable_text<Text, Encoding>
+        constexpr void update(const Text& text, const std::size_t offset, const std::size_t removed_size, const std::size_t inserted_size)
+        {
+            const auto code_units = impl::offset_index::code_units_of<Encoding>(text);
+
+            // Checkpoints up to the edit stay as they are. The first checkpoint after the removed code units
+            // and all checkpoints after it are shifted. The checkpoints in between are recomputed.
+            const auto kept_end = std::ranges::upper_bound(m_checkpoints, offset, {}, &position::code_unit);
+            const auto shifted  = std::ranges::lower_bound(kept_end, m_checkpoints.end(), offset + removed_size, {}, &position::code_unit);
+
+            std::vector<position> rescanned{*std::prev(kept_end)};
+
+            if (shifted == m_checkpoints.end())
+            {
+                m_end = scan(code_units.data(), rescanned.front(), code_units.size(), rescanned);
+            }
+            else
+            {
+                const position old_position = *shifted;
+                const position new_position =
+                    scan(code_units.data(), rescanned.front(), old_position.code_unit - removed_size + inserted_size, rescanned);
+
+                // Unsigned arithmetic wraps around, so the differences work as negative shifts too.
+                const auto shift = [&](position& pos) {
+                    pos.code_unit += new_position.code_unit - old_position.code_unit;
+                    pos.code_point += new_position.code_point - old_position.code_point;
+                    pos.utf16 += new_position.utf16 - old_position.utf16;
+                };
+
+                std::ranges::for_each(shifted, m_checkpoints.end(), shift);
+                shift(m_end);
+            }
+
+            const auto first_replaced = m_checkpoints.erase(kept_end, shifted);
+
+            m_checkpoints.insert(first_replaced, std::next(rescanned.begin()), rescanned.end());
+        }
+
+    private:
+        /// @brief Scans the code units from `pos` to the code unit offset `end`, appending a checkpoint to `checkpoints`
+        /// at every code point boundary that is `interval` code points after the last checkpoint.
+        ///
+        /// @return The position at `end`.
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr position scan(const T* const data, position pos, const std::size_t end, std::vector<position>& checkpoints) const
+        {
+            while (pos.code_unit < end)
+            {
+                if constexpr (Encoding == encoding::utf8)
+                {
+                    // A word can be counted at once if none of its code points can be the next checkpoint.
+                    if (pos.code_unit + word_size <= end && pos.code_point + word_size <= checkpoints.back().code_point + m_interval)
+                    {
+                        // Continuation bytes are the only bytes with the two most significant bits set to 10,
+                        // and leading bytes of 4 byte sequences (2 UTF-16 code units) the only bytes with the four most significant bits set.
+                        const word_type word         = impl::swar::load_word(data + pos.code_unit);
+                        const word_type continuation = word & ~(word << 1U) & impl::swar::high_bits;
+                        const word_type four_byte    = word & (word << 1U) & (word << 2U) & (word << 3U) & impl::swar::high_bits;
+
+                        const auto leading = word_size - static_cast<std::size_t>(std::popcount(continuation));
+
+                        pos.code_unit += word_size;
+                        pos.code_point += leading;
+                        pos.utf16 += leading + static_cast<std::size_t>(std::popcount(four_byte));
+                        continue;
+                    }
+                }
+
+                const std::uint32_t code_unit = impl::offset_index::code_unit_value(data[pos.code_unit]);
+
+                const bool is_leading = Encoding == encoding::utf8 ? (code_unit & 0xC0U) != 0x80U : (code_unit & 0xFC00U) != 0xDC00U;
+
+                if (is_leading)
+                {
+                    if (pos.code_point - checkpoints.back().code_point == m_interval)
+                        checkpoints.push_back(pos);
+
+                    ++pos.code_point;
+                }
+
+                if constexpr (Encoding == encoding::utf8)
+                    pos.utf16 += is_leading ? (code_unit >= 0xF0U ? 2 : 1) : 0;
+                else
+                    ++pos.utf16;
+
+                ++pos.code_unit;
+            }
+
+            return pos;
+        }
+
+        /// @brief Returns the last code point boundary whose `key` offset is at most `target`.
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr position find(const std::span<T> code_units, std::size_t position::* const key,
+                                              const std::size_t target) const noexcept
+        {
+            position pos = *std::prev(std::ranges::upper_bound(m_checkpoints, target, {}, key));
+
+            const T* const    data = code_units.data();
+            const std::size_t size = code_units.size();
+
+            while (pos.code_unit < size)
+            {
+                if constexpr (Encoding == encoding::utf8)
+                {
+                    // ASCII code points advance all of the offsets by one.
+                    if (pos.*key + word_size <= target && pos.code_unit + word_size <= size &&
+                        impl::swar::is_ascii_word(impl::swar::load_word(data + pos.code_unit)))
+                    {
+                        pos.code_unit += word_size;
+                        pos.code_point += word_size;
+                        pos.utf16 += word_size;
+                        continue;
+                    }
+                }
+
+                const std::uint32_t first = impl::offset_index::code_unit_value(data[pos.code_unit]);
+
+                position next = pos;
+
+                if constexpr (Encoding == encoding::utf8)
+                {
+                    const std::size_t length = first < 0x80U ? 1 : first < 0xE0U ? 2 : first < 0xF0U ? 3 : 4;
+
+                    next.code_unit += length;
+                    next.utf16 += length == 4 ? 2 : 1;
+                }
+                else
+                {
+                    const std::size_t length = (first & 0xFC00U) == 0xD800U ? 2 : 1;
+
+                    next.code_unit += length;
+                    next.utf16 += length;
+                }
+
+                ++next.code_point;
+
+                if (next.*key > target)
+                    break;
+
+                pos = next;
+            }
+
+            return pos;
+        }
+
+    private:
+        using word_type = impl::swar::word_type;
+
+        static constexpr std::size_t word_size = impl::swar::word_size;
+
+        std::vector<position> m_checkpoints{position{}};
+        position              m_end;
+        std::size_t           m_interval = default_interval;
+    };
+} // namespace upp
+
+#endif // UNI_CPP_OFFSET_INDEX_HPP
\ No newline at end of file
@@ -0,0 +1,141 @@
+#ifndef UNI_CPP_PROPERTIES_HPP
+#define UNI_CPP_PROPERTIES_HPP
+
+/// @file
+///
+/// @brief Bulk lookup of Unicode character properties.
+///
+/// The per-character properties are available as member functions of `upp::uchar`.
+/// This file provides functions for classifying and scanning whole sequences of code points,
+/// which is what tokenizers and lexers usually need.
+///
+
+#include "uchar.hpp"
+#include "encoding.hpp"
+#include "ranges.hpp"
+#include "string.hpp"
+#include "impl/swar.hpp"
+#include "impl/decode_valid.hpp"
+#include "impl/unicode_data/general_properties.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <ranges>
+#include <utility>
+#include <bit>
+
+namespace upp
+{
+    /// @brief Looks up the binary properties of every code point in `code_points`.
+    ///
+    /// Writes `uchar::binary_properties()` of `code_points[i]` to `out[i]`.
+    /// Values that are not valid Unicode scalar values (surrogates and values above `U+10FFFF`) have no properties.
+    ///
+    /// @pre `out.size() >= code_points.size()`.
+    ///
+    /// @see binary_property, uchar::binary_properties
+    ///
+    /// @headerfile "" <uni-cpp/properties.hpp>
+    ///
+    constexpr void classify(std::span<const char32_t> code_points, std::span<binary_property> out) noexcept
+    {
+        namespace data = impl::unicode_data::general_properties;
+
+        for (std::size_t i = 0; i < code_points.size(); ++i)
+        {
+            const auto code_point = static_cast<std::uint32_t>(code_points[i]);
+
+            // Surrogates are `Cs` and have none of the properties, so the lookup handles them already.
+            out[i] = static_cast<binary_property>(data::lookup_binary_properties(code_point));
+        }
+    }
+
+    namespace impl
+    {
+        template<typename T>
+            requires(sizeof(T) == 1)
+        [[nodiscard]] constexpr std::size_t find_first_not_of_property_impl(const T* code_units, std::size_t size, binary_property properties) noexcept
+        {
+            namespace data = unicode_data::general_properties;
+
+            const std::uint8_t mask = std::to_underlying(properties);
+
+            std::size_t index = 0;
+
+            while (index < size)
+            {
+                // Identifiers and whitespace runs are mostly ASCII, so check a whole word of ASCII using the ASCII table only.
+                if (index + swar::word_size <= size && swar::is_ascii_word(swar::load_word(code_units + index)))
+                {
+                    for (std::size_t end = index + swar::word_size; index < end; ++index)
+                    {
+                        if ((data::ascii_properties[std::bit_cast<std::uint8_t>(code_units[index])] & mask) == 0)
+                            return index;
+                    }
+                    continue;
+                }
+
+                const auto leading_byte = std::bit_cast<char8_t>(code_units[index]);
+
+                if (leading_byte < 0x80U)
+                {
+                    if ((data::ascii_properties[leading_byte] & mask) == 0)
+                        return index;
+
+                    ++index;
+                    continue;
+                }
+
+                const std::uint8_t width = utf8::char_width_from_leading_byte(leading_byte);
+
+                if ((data::lookup_binary_properties(decode_valid_utf8_code_point(code_units + index, width)) & mask) == 0)
+                    return index;
+
+                index += width;
+            }
+
+            return size;
+        }
+    } // namespace impl
+
+    /// @brief Finds the first code point in a valid UTF-8 range that has none of the given `properties`.
+    ///
+    /// For example, `find_first_not_of_property(str, binary_property::xid_continue)` returns the length of the identifier
+    /// run at the beginning of `str`, and `find_first_not_of_property(str, binary_property::white_space)` skips leading whitespace.
+    ///
+    /// ASCII text is scanned a word at a time, using a table of the ASCII characters' properties.
+    ///
+    /// @param range Contiguous range of valid UTF-8 code units.
+    /// @param properties A mask of `binary_property` values. A code point is skipped if it has at least one of them.
+    ///
+    /// @return The offset (in code units) of the first code point without any of the `properties`, or the size of `range` if there isn't one.
+    ///
+    /// @see classify, uchar::binary_properties
+    ///
+    /// @headerfile "" <uni-cpp/properties.hpp>
+    ///
+    template<std::ranges::contiguous_range Range>
+        requires std::ranges::sized_range<Range> && ranges::valid_code_unit_range<Range, encoding::utf8>
+    [[nodiscard]] constexpr std::size_t find_first_not_of_property(Range&& range, binary_property properties) noexcept
+    {
+        return impl::find_first_not_of_property_impl(std::ranges::data(range), static_cast<std::size_t>(std::ranges::size(range)), properties);
+    }
+
+    /// @brief Finds the first code point in a UTF-8 string that has none of the given `properties`.
+    ///
+    /// @copydetails find_first_not_of_property(Range&&, binary_property)
+    ///
+    /// @headerfile "" <uni-cpp/properties.hpp>
+    ///
+    template<string_compatible_container<encoding::utf8> Container>
+    [[nodiscard]] constexpr std::size_t find_first_not_of_property(const basic_ustring<encoding::utf8, Container>& string,
+                                                                   binary_property                                  properties) noexcept
+    {
+        const auto code_units = string.code_units();
+
+        return impl::find_first_not_of_property_impl(code_units.data(), code_units.size(), properties);
+    }
+} // namespace upp
+
+#endif // UNI_CPP_PROPERTIES_HPP
\ No newline at end of file
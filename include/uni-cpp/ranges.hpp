@@ -12,5 +12,10 @@
 #include "impl/ranges/valid_code_unit_range.hpp"
 #include "impl/ranges/cast_code_units_to.hpp"
 #include "impl/ranges/transcode.hpp"
+#include "impl/ranges/normalize.hpp"
+#include "impl/ranges/graphemes.hpp"
+#include "impl/ranges/lines.hpp"
+#include "impl/ranges/split.hpp"
+#include "impl/ranges/trim.hpp"
 
 #endif // UNI_CPP_RANGES_HPP
\ No newline at end of file
@@ -0,0 +1,584 @@
+#ifndef UNI_CPP_ROPE_HPP
+#define UNI_CPP_ROPE_HPP
+
+/// @file
+///
+/// @brief Provides `rope`, a Unicode text type for large documents that is stored as a balanced tree of immutable string chunks.
+///
+
+#include "encoding.hpp"
+#include "ranges.hpp"
+#include "string.hpp"
+#include "impl/text_metadata.hpp"
+
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace upp
+{
+    /// @brief A Unicode text type for large documents, stored as a balanced binary tree of immutable, valid string chunks.
+    ///
+    /// Inserting into or erasing from the middle of a `basic_ustring` moves every code unit after the edit.
+    /// A rope instead splits the text into chunks of at most `max_chunk_size` code units and keeps them in the leaves
+    /// of a height balanced (AVL) concatenation tree, so an edit only rebuilds the O(log n) nodes on the path to it
+    /// and copies at most the two chunks around it: O(log n + max_chunk_size).
+    /// Where an edit leaves a chunk of fewer than `min_chunk_size` code units next to another one, the two are merged,
+    /// or cut again into two chunks of about equal size if they don't fit into one, so edits don't fragment the text.
+    ///
+    /// Every chunk is a valid `basic_ustring<Encoding>` and chunks never split an encoded code point:
+    /// positions passed to `insert()`, `erase()` and `slice()` have to be code point boundaries.
+    /// Every node caches the metrics (the number of code units, code points and line feeds) of its subtree,
+    /// so the metrics of the whole text are O(1) and the metrics of any prefix are O(log n + max_chunk_size).
+    ///
+    /// Nodes are immutable and shared between ropes: copying a rope and `slice()` are O(1) and O(log n) respectively,
+    /// and a copy is not affected by edits of the rope it was copied from. The nodes are reference counted,
+    /// so unlike the other string types of the library, `rope` can't be used in constant expressions.
+    ///
+    /// `code_units()` is a forward range of all the code units that models `ranges::valid_code_unit_range`,
+    /// so it can be passed to the decoding and transcoding range adaptors, for example `views::decode<Encoding>`.
+    /// `flatten()` copies the text into a single string with one allocation.
+    ///
+    /// @tparam Encoding The encoding of the text.
+    /// @tparam MaxChunkBytes The maximum size of a chunk in bytes. Default value is 64 KiB.
+    /// @tparam MinChunkBytes The size in bytes below which a chunk is merged with its neighbor after an edit. Default value is 4 KiB.
+    ///
+    /// @par Example
+    ///
+    /// @code{.cpp}
+    ///
+    /// using namespace upp::string_literals;
+    ///
+    /// upp::rope<upp::encoding::utf8> document{u8"Hello\nworld\n"_us};
+    ///
+    /// document.insert(6, u8"wide "_us);
+    /// document.erase(0, 6);
+    ///
+    /// // document.flatten() holds "wide world\n", document.newline_count() == 1
+    ///
+    /// @endcode
+    ///
+    /// @headerfile "" <uni-cpp/rope.hpp>
+    ///
+    template<encoding Encoding, std::size_t MaxChunkBytes = 64 * 1024, std::size_t MinChunkBytes = 4 * 1024>
+        requires unicode_encoding<Encoding>
+    class rope
+    {
+    public:
+        using string_type    = basic_ustring<Encoding>;
+        using code_unit_type = string_type::code_unit_type;
+        using size_type      = std::size_t;
+
+        /// @brief The cached measurements of a text.
+        ///
+        struct text_metrics
+        {
+            size_type code_units  = 0; ///< The number of code units.
+            size_type code_points = 0; ///< The number of code points.
+            size_type newlines    = 0; ///< The number of line feeds (U+000A).
+
+            [[nodiscard]] friend constexpr text_metrics operator+(const text_metrics& x, const text_metrics& y) noexcept
+            {
+                return {x.code_units + y.code_units, x.code_points + y.code_points, x.newlines + y.newlines};
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(const text_metrics&, const text_metrics&) noexcept = default;
+        };
+
+        /// @brief The maximum number of code units in a chunk.
+        ///
+        /// At least 8, so that a chunk always fits a whole code point.
+        ///
+        static constexpr size_type max_chunk_size = std::max(MaxChunkBytes / sizeof(code_unit_type), 8uz);
+
+        /// @brief The number of code units below which a chunk at the seam of an edit is merged with its neighbor.
+        ///
+        /// At most half of `max_chunk_size`, so that two merged chunks that don't fit into one can be cut into two chunks that are large enough.
+        ///
+        static constexpr size_type min_chunk_size = std::min(MinChunkBytes / sizeof(code_unit_type), max_chunk_size / 2);
+
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+    private:
+        struct node;
+
+        using node_ptr = std::shared_ptr<const node>;
+
+        struct node
+        {
+            text_metrics metrics;
+            int          height = 0; // 0 for leaves
+            node_ptr     left;
+            node_ptr     right;
+            string_type  chunk; // empty for branches
+        };
+
+    public:
+        /// @brief Iterates over the chunks of a rope, in order.
+        ///
+        /// Keeps a stack of the right subtrees that are still to be visited, so it is a forward iterator.
+        ///
+        class chunk_iterator
+        {
+        public:
+            using value_type       = string_type;
+            using difference_type  = std::ptrdiff_t;
+            using iterator_concept = std::forward_iterator_tag;
+
+        public:
+            chunk_iterator() = default;
+
+            [[nodiscard]] const string_type& operator*() const noexcept { return m_leaf->chunk; }
+
+            chunk_iterator& operator++()
+            {
+                if (m_pending.empty())
+                {
+                    m_leaf = nullptr;
+                }
+                else
+                {
+                    const node* next = m_pending.back();
+
+                    m_pending.pop_back();
+                    descend(next);
+                }
+
+                return *this;
+            }
+
+            chunk_iterator operator++(int)
+            {
+                chunk_iterator copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            // A leaf has a single path from the root, so two iterators at the same leaf have the same pending subtrees.
+            [[nodiscard]] friend bool operator==(const chunk_iterator& x, const chunk_iterator& y) noexcept { return x.m_leaf == y.m_leaf; }
+
+            [[nodiscard]] friend bool operator==(const chunk_iterator& it, std::default_sentinel_t) noexcept { return it.m_leaf == nullptr; }
+
+        private:
+            friend class rope;
+
+            explicit chunk_iterator(const node* root)
+            {
+                if (root != nullptr)
+                    descend(root);
+            }
+
+            void descend(const node* subtree)
+            {
+                while (subtree->height > 0)
+                {
+                    m_pending.push_back(subtree->right.get());
+                    subtree = subtree->left.get();
+                }
+
+                m_leaf = subtree;
+            }
+
+            std::vector<const node*> m_pending;
+            const node*              m_leaf = nullptr;
+        };
+
+    public:
+        /// @brief Constructs an empty rope.
+        ///
+        rope() noexcept = default;
+
+        /// @brief Constructs a rope with the contents of `string`.
+        ///
+        template<string_compatible_container<Encoding> Container>
+        explicit rope(const basic_ustring<Encoding, Container>& string)
+            : m_root(build(string.code_units()))
+        {
+        }
+
+        /// @brief Returns the metrics of the whole text. O(1).
+        ///
+        [[nodiscard]] text_metrics metrics() const noexcept { return m_root ? m_root->metrics : text_metrics{}; }
+
+        /// @brief Returns the metrics of the first `pos` code units of the text, e.g. `metrics_before(pos).newlines` is the
+        /// zero-based line number of `pos`. O(log n + max_chunk_size).
+        ///
+        /// @throws std::out_of_range if `pos > size()`.
+        ///
+        [[nodiscard]] text_metrics metrics_before(size_type pos) const
+        {
+            if (pos > size())
+                throw std::out_of_range("upp::rope::metrics_before: pos out of range");
+
+            text_metrics result;
+            const node*  subtree = m_root.get();
+
+            while (subtree != nullptr && subtree->height > 0)
+            {
+                const text_metrics& left = subtree->left->metrics;
+
+                if (pos < left.code_units)
+                {
+                    subtree = subtree->left.get();
+                }
+                else
+                {
+                    result  = result + left;
+                    pos    -= left.code_units;
+                    subtree = subtree->right.get();
+                }
+            }
+
+            if (subtree != nullptr)
+                result = result + measure(subtree->chunk.code_units().first(pos));
+
+            return result;
+        }
+
+        /// @brief Returns the number of code units in the text. O(1).
+        ///
+        [[nodiscard]] size_type size() const noexcept { return metrics().code_units; }
+
+        /// @brief Returns the number of code points in the text. O(1).
+        ///
+        [[nodiscard]] size_type code_point_count() const noexcept { return metrics().code_points; }
+
+        /// @brief Returns the number of line feeds (U+000A) in the text. O(1).
+        ///
+        [[nodiscard]] size_type newline_count() const noexcept { return metrics().newlines; }
+
+        [[nodiscard]] bool empty() const noexcept { return m_root == nullptr; }
+
+        /// @brief Returns a forward range of the chunks of the text, in order, as `const string_type&`.
+        ///
+        /// The range is invalidated by any modification of the rope.
+        ///
+        [[nodiscard]] std::ranges::subrange<chunk_iterator, std::default_sentinel_t> chunks() const
+        {
+            return {chunk_iterator{m_root.get()}, std::default_sentinel};
+        }
+
+        /// @brief Returns a forward range of all the code units of the text, which models `ranges::valid_code_unit_range<Encoding>`.
+        ///
+        /// The range is invalidated by any modification of the rope.
+        ///
+        [[nodiscard]] auto code_units() const
+        {
+            return chunks() | std::views::transform([](const string_type& chunk) static -> const auto& { return chunk.underlying(); }) |
+                   std::views::join | views::mark_as_valid_encoding<Encoding>;
+        }
+
+        /// @brief Inserts `string` before the code unit at `pos`. O(log n + max_chunk_size + string.size()).
+        ///
+        /// @throws std::out_of_range if `pos > size()`.
+        /// @throws std::invalid_argument if `pos` is not a code point boundary.
+        ///
+        template<string_compatible_container<Encoding> Container>
+        void insert(const size_type pos, const basic_ustring<Encoding, Container>& string)
+        {
+            insert_tree(pos, build(string.code_units()));
+        }
+
+        /// @brief Inserts the text of `other` before the code unit at `pos`. Shares the chunks of `other`. O(log n + max_chunk_size).
+        ///
+        /// @throws std::out_of_range if `pos > size()`.
+        /// @throws std::invalid_argument if `pos` is not a code point boundary.
+        ///
+        void insert(const size_type pos, const rope& other) { insert_tree(pos, other.m_root); }
+
+        /// @brief Appends `string` to the end of the text.
+        ///
+        template<string_compatible_container<Encoding> Container>
+        void append(const basic_ustring<Encoding, Container>& string)
+        {
+            m_root = join_merging(std::move(m_root), build(string.code_units()));
+        }
+
+        /// @brief Appends the text of `other` to the end of the text. Shares the chunks of `other`.
+        ///
+        void append(const rope& other) { m_root = join_merging(std::move(m_root), other.m_root); }
+
+        /// @brief Erases `std::min(count, size() - pos)` code units starting at `pos`. O(log n + max_chunk_size).
+        ///
+        /// @throws std::out_of_range if `pos > size()`.
+        /// @throws std::invalid_argument if `pos` or the end of the erased code units is not a code point boundary.
+        ///
+        void erase(const size_type pos, const size_type count = npos)
+        {
+            if (pos > size())
+                throw std::out_of_range("upp::rope::erase: pos out of range");
+
+            const size_type length = std::min(count, size() - pos);
+
+            if (length == 0)
+                return;
+
+            auto [before, rest] = split(m_root, pos);
+            node_ptr after      = split(rest, length).second;
+
+            m_root = join_merging(std::move(before), std::move(after));
+        }
+
+        /// @brief Returns a rope of `std::min(count, size() - pos)` code units starting at `pos`.
+        ///
+        /// The result shares all of its chunks with this rope except for the (at most two) chunks at its ends. O(log n + max_chunk_size).
+        ///
+        /// @throws std::out_of_range if `pos > size()`.
+        /// @throws std::invalid_argument if `pos` or the end of the slice is not a code point boundary.
+        ///
+        [[nodiscard]] rope slice(const size_type pos, const size_type count = npos) const
+        {
+            if (pos > size())
+                throw std::out_of_range("upp::rope::slice: pos out of range");
+
+            rope result;
+
+            result.m_root = split(split(m_root, pos).second, std::min(count, size() - pos)).first;
+
+            return result;
+        }
+
+        /// @brief Copies the text into a single string.
+        ///
+        /// The container is allocated once, for exactly `size()` code units.
+        ///
+        template<string_compatible_container<Encoding> Container = typename string_type::container_type>
+        [[nodiscard]] basic_ustring<Encoding, Container> flatten() const
+        {
+            Container container;
+
+            if constexpr (impl::reserves_for_size_hint<Container>)
+                container.reserve(static_cast<typename Container::size_type>(size()));
+
+            for (const string_type& chunk : chunks())
+            {
+                const std::span<const code_unit_type> chunk_code_units = chunk.code_units();
+
+                container.insert(std::as_const(container).end(), chunk_code_units.begin(), chunk_code_units.end());
+            }
+
+            return impl::basic_ustring_impl::utfx_from_utfx_unchecked<Encoding, Container>(std::move(container));
+        }
+
+        /// @brief Compares the code units of the texts. O(n).
+        ///
+        [[nodiscard]] friend bool operator==(const rope& x, const rope& y)
+        {
+            return x.m_root == y.m_root || (x.size() == y.size() && std::ranges::equal(x.code_units(), y.code_units()));
+        }
+
+    private:
+        [[nodiscard]] static text_metrics measure(const std::span<const code_unit_type> code_units) noexcept
+        {
+            return {
+                code_units.size(),
+                impl::text_metadata::count_code_points(code_units.data(), code_units.size()),
+                impl::text_metadata::count_line_feeds(code_units.data(), code_units.size()),
+            };
+        }
+
+        /// Copies the code units of `first` followed by the code units of `second` into a new chunk.
+        [[nodiscard]] static string_type make_chunk(const std::span<const code_unit_type> first, const std::span<const code_unit_type> second = {})
+        {
+            typename string_type::container_type container;
+
+            container.reserve(first.size() + second.size());
+            container.append(first.begin(), first.end());
+            container.append(second.begin(), second.end());
+
+            return impl::basic_ustring_impl::utfx_from_utfx_unchecked<Encoding, typename string_type::container_type>(std::move(container));
+        }
+
+        [[nodiscard]] static node_ptr make_leaf(string_type chunk)
+        {
+            const text_metrics chunk_metrics = measure(chunk.code_units());
+
+            return std::make_shared<const node>(chunk_metrics, 0, nullptr, nullptr, std::move(chunk));
+        }
+
+        [[nodiscard]] static node_ptr make_branch(node_ptr left, node_ptr right)
+        {
+            const text_metrics sum    = left->metrics + right->metrics;
+            const int          height = std::max(left->height, right->height) + 1;
+
+            return std::make_shared<const node>(sum, height, std::move(left), std::move(right), string_type{});
+        }
+
+        [[nodiscard]] static int height_of(const node_ptr& subtree) noexcept { return subtree ? subtree->height : -1; }
+
+        /// Makes a balanced tree of `left` followed by `right`, whose heights differ by at most 2.
+        [[nodiscard]] static node_ptr balance(node_ptr left, node_ptr right)
+        {
+            if (left->height > right->height + 1)
+            {
+                if (height_of(left->left) >= height_of(left->right))
+                    return make_branch(left->left, make_branch(left->right, std::move(right)));
+
+                return make_branch(make_branch(left->left, left->right->left), make_branch(left->right->right, std::move(right)));
+            }
+
+            if (right->height > left->height + 1)
+            {
+                if (height_of(right->right) >= height_of(right->left))
+                    return make_branch(make_branch(std::move(left), right->left), right->right);
+
+                return make_branch(make_branch(std::move(left), right->left->left), make_branch(right->left->right, right->right));
+            }
+
+            return make_branch(std::move(left), std::move(right));
+        }
+
+        /// Concatenates two balanced trees into a balanced tree. O(|height(left) - height(right)|).
+        [[nodiscard]] static node_ptr join(node_ptr left, node_ptr right)
+        {
+            if (!left || !right)
+                return left ? left : right;
+
+            if (left->height > right->height + 1)
+                return balance(left->left, join(left->right, std::move(right)));
+
+            if (right->height > left->height + 1)
+                return balance(join(std::move(left), right->left), right->right);
+
+            return make_branch(std::move(left), std::move(right));
+        }
+
+        /// Splits a tree into the trees of its first `pos` code units and of the rest. Copies at most one chunk.
+        /// Throws `std::invalid_argument` if `pos` is inside a code point, before anything is copied.
+        [[nodiscard]] static std::pair<node_ptr, node_ptr> split(const node_ptr& subtree, const size_type pos)
+        {
+            if (!subtree || pos == 0)
+                return {nullptr, subtree};
+
+            if (pos >= subtree->metrics.code_units)
+                return {subtree, nullptr};
+
+            if (subtree->height == 0)
+            {
+                const std::span<const code_unit_type> chunk_code_units = subtree->chunk.code_units();
+
+                if (!impl::text_metadata::is_leading_code_unit(chunk_code_units[pos]))
+                    throw std::invalid_argument("upp::rope: position is not a code point boundary");
+
+                return {make_leaf(make_chunk(chunk_code_units.first(pos))), make_leaf(make_chunk(chunk_code_units.subspan(pos)))};
+            }
+
+            const size_type left_size = subtree->left->metrics.code_units;
+
+            if (pos <= left_size)
+            {
+                auto [left, right] = split(subtree->left, pos);
+                return {std::move(left), join(std::move(right), subtree->right)};
+            }
+
+            auto [left, right] = split(subtree->right, pos - left_size);
+            return {join(subtree->left, std::move(left)), std::move(right)};
+        }
+
+        /// Like `join()`, but merges the chunks on both sides of the seam into one if they fit, and cuts them again into two chunks
+        /// of about equal size if they don't but one of them is shorter than `min_chunk_size`,
+        /// so that repeated edits don't leave behind a lot of small chunks.
+        [[nodiscard]] static node_ptr join_merging(node_ptr left, node_ptr right)
+        {
+            if (!left || !right)
+                return left ? left : right;
+
+            const node* last  = left.get();
+            const node* first = right.get();
+
+            while (last->height > 0)
+                last = last->right.get();
+
+            while (first->height > 0)
+                first = first->left.get();
+
+            const bool fits       = last->metrics.code_units + first->metrics.code_units <= max_chunk_size;
+            const bool undersized = std::min(last->metrics.code_units, first->metrics.code_units) < min_chunk_size;
+
+            if (!fits && !undersized)
+                return join(std::move(left), std::move(right));
+
+            // `left` and `right` keep `last` and `first` alive until the merged chunk is made.
+            string_type combined = make_chunk(last->chunk.code_units(), first->chunk.code_units());
+            node_ptr    merged   = fits ? make_leaf(std::move(combined)) : build(combined.code_units());
+
+            node_ptr before = split(left, left->metrics.code_units - last->metrics.code_units).first;
+            node_ptr after  = split(right, first->metrics.code_units).second;
+
+            if (merged->metrics.code_units < min_chunk_size)
+            {
+                // Both pieces were short, so the merged chunk is merged with one of its neighbors too.
+                if (before)
+                    return join_merging(join_merging(std::move(before), std::move(merged)), std::move(after));
+
+                if (after)
+                    return join_merging(std::move(merged), std::move(after));
+            }
+
+            return join(join(std::move(before), std::move(merged)), std::move(after));
+        }
+
+        /// Builds a balanced tree of chunks of `code_units`, which are cut into chunks of about equal size at code point boundaries.
+        [[nodiscard]] static node_ptr build(const std::span<const code_unit_type> code_units)
+        {
+            if (code_units.empty())
+                return nullptr;
+
+            const size_type chunk_count = (code_units.size() + max_chunk_size - 1) / max_chunk_size;
+            const size_type target_size = (code_units.size() + chunk_count - 1) / chunk_count;
+
+            std::vector<node_ptr> leaves;
+            leaves.reserve(chunk_count + 1);
+
+            for (size_type begin = 0; begin < code_units.size();)
+            {
+                size_type end = code_units.size();
+
+                if (end - begin > max_chunk_size)
+                {
+                    // target_size > max_chunk_size / 2 >= 4, so there is a code point boundary in (begin, begin + target_size].
+                    end = begin + target_size;
+
+                    while (!impl::text_metadata::is_leading_code_unit(code_units[end]))
+                        --end;
+                }
+
+                leaves.push_back(make_leaf(make_chunk(code_units.subspan(begin, end - begin))));
+                begin = end;
+            }
+
+            return build_balanced(leaves, 0, leaves.size());
+        }
+
+        [[nodiscard]] static node_ptr build_balanced(const std::vector<node_ptr>& leaves, const size_type first, const size_type last)
+        {
+            if (last - first == 1)
+                return leaves[first];
+
+            const size_type middle = first + (last - first) / 2;
+
+            return make_branch(build_balanced(leaves, first, middle), build_balanced(leaves, middle, last));
+        }
+
+        void insert_tree(const size_type pos, node_ptr inserted)
+        {
+            if (pos > size())
+                throw std::out_of_range("upp::rope::insert: pos out of range");
+
+            auto [before, after] = split(m_root, pos);
+
+            m_root = join_merging(join_merging(std::move(before), std::move(inserted)), std::move(after));
+        }
+
+    private:
+        node_ptr m_root;
+    };
+} // namespace upp
+
+#endif // UNI_CPP_ROPE_HPP
\ No newline at end of file
@@ -0,0 +1,255 @@
+#ifndef UNI_CPP_SHARED_STRING_HPP
+#define UNI_CPP_SHARED_STRING_HPP
+
+/// @file
+///
+/// @brief Provides `shared_ustring`, an immutable, reference counted Unicode string that is cheap to copy across threads.
+///
+
+#include "encoding.hpp"
+#include "string.hpp"
+
+#include <cstddef>
+#include <compare>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <new>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace upp
+{
+    /// @brief An immutable Unicode string whose copies share one reference counted buffer.
+    ///
+    /// Copying a `basic_ustring` allocates and copies all of its code units. A `shared_ustring` keeps the reference count,
+    /// the hash, the size and the code units together in a single allocation, so a copy only increments an atomic counter
+    /// and a string that's copied into many places (e.g. from a configuration into per-request contexts on worker threads)
+    /// is stored once. The code units are never modified, so copies can be used from multiple threads at the same time.
+    ///
+    /// The hash is computed once, when the string is constructed. It is the `std::hash` of the code units as a
+    /// `std::basic_string_view`, so `std::hash<shared_ustring<Encoding>>` can be used for heterogeneous lookup
+    /// together with that `std::hash`.
+    ///
+    /// A `shared_ustring` is constructed from a `basic_ustring` of the same encoding. The code units are always copied once,
+    /// also from an rvalue, because they are stored in the same allocation as the reference count.
+    /// `code_units()` and `to_ustring()` convert back; `code_units() | views::mark_as_valid_encoding<Encoding>` is a valid
+    /// code unit range for the range adaptors.
+    ///
+    /// The empty string doesn't allocate. Reference counting makes `shared_ustring` unusable in constant expressions.
+    ///
+    /// @tparam Encoding The encoding of the string. The code units are stored as `encoding_traits<Encoding>::default_code_unit_type`.
+    ///
+    /// @par Example
+    ///
+    /// @code{.cpp}
+    ///
+    /// using namespace upp::string_literals;
+    ///
+    /// const upp::shared_ustring<upp::encoding::utf8> route{u8"/api/v1/café"_us};
+    ///
+    /// const auto copy = route; // no allocation, route.use_count() == 2
+    ///
+    /// std::unordered_set<upp::shared_ustring<upp::encoding::utf8>> routes{copy}; // uses the cached hash
+    ///
+    /// @endcode
+    ///
+    /// @headerfile "" <uni-cpp/shared_string.hpp>
+    ///
+    template<encoding Encoding>
+        requires unicode_encoding<Encoding>
+    class shared_ustring
+    {
+    public:
+        using code_unit_type = encoding_traits<Encoding>::default_code_unit_type;
+        using size_type      = std::size_t;
+
+    public:
+        /// @brief Constructs an empty string. Doesn't allocate.
+        ///
+        shared_ustring() noexcept = default;
+
+        /// @brief Constructs a string with a copy of the code units of `string`, in a single allocation.
+        ///
+        template<string_compatible_container<Encoding> Container>
+        explicit shared_ustring(const basic_ustring<Encoding, Container>& string)
+            : m_header(make_header(string.code_units()))
+        {
+        }
+
+        /// @brief Copy constructor. Shares the buffer of `other`, which costs one atomic increment.
+        ///
+        shared_ustring(const shared_ustring& other) noexcept
+            : m_header(other.m_header)
+        {
+            if (m_header != nullptr)
+                m_header->reference_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /// @brief Move constructor.
+        ///
+        /// After the move, `other` is **guaranteed** to be empty.
+        ///
+        shared_ustring(shared_ustring&& other) noexcept
+            : m_header(std::exchange(other.m_header, nullptr))
+        {
+        }
+
+        shared_ustring& operator=(const shared_ustring& other) noexcept
+        {
+            shared_ustring{other}.swap(*this);
+            return *this;
+        }
+
+        /// @brief Move assignment operator.
+        ///
+        /// After the move, `other` is **guaranteed** to be empty.
+        ///
+        shared_ustring& operator=(shared_ustring&& other) noexcept
+        {
+            shared_ustring{std::move(other)}.swap(*this);
+            return *this;
+        }
+
+        ~shared_ustring() { release(m_header); }
+
+        void swap(shared_ustring& other) noexcept { std::swap(m_header, other.m_header); }
+
+        friend void swap(shared_ustring& x, shared_ustring& y) noexcept { x.swap(y); }
+
+        /// @brief Returns the number of code units.
+        ///
+        [[nodiscard]] size_type size() const noexcept { return m_header ? m_header->size : 0; }
+
+        [[nodiscard]] bool empty() const noexcept { return m_header == nullptr; }
+
+        /// @brief Returns the code units of the string.
+        ///
+        [[nodiscard]] std::span<const code_unit_type> code_units() const noexcept
+        {
+            if (m_header == nullptr)
+                return {};
+
+            return {code_units_of(m_header), m_header->size};
+        }
+
+        /// @brief Returns the hash of the string, which was computed when the string was constructed.
+        ///
+        /// Equals `std::hash<std::basic_string_view<code_unit_type>>` of the code units.
+        ///
+        [[nodiscard]] std::size_t hash() const noexcept { return m_header ? m_header->hash : hash_of({}); }
+
+        /// @brief Returns the number of `shared_ustring` objects that share this string's buffer, or 0 for an empty string.
+        ///
+        /// The result is only approximate if the string is being copied by other threads at the same time.
+        ///
+        [[nodiscard]] long use_count() const noexcept
+        {
+            return m_header ? static_cast<long>(m_header->reference_count.load(std::memory_order_relaxed)) : 0;
+        }
+
+        /// @brief Copies the string into a `basic_ustring`, allocated once with its exact size.
+        ///
+        /// @tparam Container The underlying container of the result.
+        ///         Default value is `std::basic_string<typename encoding_traits<Encoding>::default_code_unit_type>`.
+        ///
+        template<string_compatible_container<Encoding> Container = std::basic_string<code_unit_type>>
+        [[nodiscard]] basic_ustring<Encoding, Container> to_ustring() const
+        {
+            const std::span<const code_unit_type> units = code_units();
+
+            Container container;
+
+            if constexpr (impl::reserves_for_size_hint<Container>)
+                container.reserve(static_cast<typename Container::size_type>(units.size()));
+
+            container.insert(std::as_const(container).end(), units.begin(), units.end());
+
+            return impl::basic_ustring_impl::utfx_from_utfx_unchecked<Encoding, Container>(std::move(container));
+        }
+
+        [[nodiscard]] friend bool operator==(const shared_ustring& x, const shared_ustring& y) noexcept
+        {
+            if (x.m_header == y.m_header)
+                return true;
+
+            // The cached hashes reject most unequal strings without comparing their code units.
+            return x.size() == y.size() && x.hash() == y.hash() && std::ranges::equal(x.code_units(), y.code_units());
+        }
+
+        template<string_compatible_container<Encoding> Container>
+        [[nodiscard]] friend bool operator==(const shared_ustring& x, const basic_ustring<Encoding, Container>& y) noexcept
+        {
+            return std::ranges::equal(x.code_units(), y.code_units());
+        }
+
+        /// @brief Compares the strings lexicographically by their code units.
+        ///
+        [[nodiscard]] friend std::strong_ordering operator<=>(const shared_ustring& x, const shared_ustring& y) noexcept
+        {
+            return std::lexicographical_compare_three_way(x.code_units().begin(), x.code_units().end(), y.code_units().begin(),
+                                                          y.code_units().end());
+        }
+
+    private:
+        /// The beginning of the allocation. The code units follow it in the same allocation.
+        struct header
+        {
+            std::atomic<std::size_t> reference_count;
+            std::size_t              hash;
+            std::size_t              size;
+        };
+
+        static_assert(sizeof(header) % alignof(code_unit_type) == 0);
+
+        [[nodiscard]] static code_unit_type* code_units_of(header* const h) noexcept { return reinterpret_cast<code_unit_type*>(h + 1); }
+
+        [[nodiscard]] static std::size_t hash_of(const std::basic_string_view<code_unit_type> code_units) noexcept
+        {
+            return std::hash<std::basic_string_view<code_unit_type>>{}(code_units);
+        }
+
+        template<typename CodeUnit>
+        [[nodiscard]] static header* make_header(const std::span<const CodeUnit> code_units)
+        {
+            if (code_units.empty())
+                return nullptr;
+
+            void* const   storage = ::operator new(sizeof(header) + code_units.size() * sizeof(code_unit_type));
+            header* const h       = ::new (storage) header{1, 0, code_units.size()};
+
+            code_unit_type* const data = code_units_of(h);
+
+            std::ranges::transform(code_units, data, [](const CodeUnit code_unit) static { return static_cast<code_unit_type>(code_unit); });
+
+            h->hash = hash_of({data, code_units.size()});
+
+            return h;
+        }
+
+        static void release(header* const h) noexcept
+        {
+            // The last owner must see all writes of the other owners before destroying the buffer.
+            if (h != nullptr && h->reference_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                h->~header();
+                ::operator delete(h);
+            }
+        }
+
+    private:
+        header* m_header = nullptr;
+    };
+} // namespace upp
+
+/// @brief Returns the hash that `upp::shared_ustring` computed when it was constructed.
+///
+template<upp::encoding Encoding>
+struct std::hash<upp::shared_ustring<Encoding>>
+{
+    [[nodiscard]] std::size_t operator()(const upp::shared_ustring<Encoding>& string) const noexcept { return string.hash(); }
+};
+
+#endif // UNI_CPP_SHARED_STRING_HPP
\ No newline at end of file
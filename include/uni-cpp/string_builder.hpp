@@ -0,0 +1,252 @@
+#ifndef UNI_CPP_STRING_BUILDER_HPP
+#define UNI_CPP_STRING_BUILDER_HPP
+
+/// @file
+///
+/// @brief Provides `ustring_builder`, for building a Unicode string out of many small pieces.
+///
+
+#include "uchar.hpp"
+#include "encoding.hpp"
+#include "string.hpp"
+#include "impl/decode_valid.hpp"
+#include "impl/encode_valid.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <string>
+#include <utility>
+
+namespace upp
+{
+    /// @brief Builds a `basic_ustring` out of many small pieces, like code points, strings in any encoding, ASCII text and integers.
+    ///
+    /// The code units are written through a raw pointer into a buffer that grows geometrically. Every piece is measured
+    /// first, so each `append` checks for room once and then encodes the piece straight into the buffer, without going
+    /// through a range adaptor per code point.
+    ///
+    /// `std::move(builder).build()` hands the buffer over to the resulting string, so the text isn't copied.
+    /// `reset()` empties the builder but keeps its buffer. A builder whose text is consumed through `code_units()` and which is
+    /// then reset (e.g. a `thread_local` one in a response serializer) stops allocating once its buffer is large enough.
+    ///
+    /// @tparam Encoding The encoding of the built string.
+    /// @tparam Container The underlying container of the built string, which also serves as the buffer.
+    ///         Default value is `std::basic_string<typename encoding_traits<Encoding>::default_code_unit_type>`.
+    ///
+    /// @par Example
+    ///
+    /// @code{.cpp}
+    ///
+    /// using namespace std::string_view_literals;
+    /// using namespace upp::char_literals;
+    ///
+    /// upp::ustring_builder<upp::encoding::utf8> builder;
+    ///
+    /// builder.append_ascii("{\"id\":"sv).append_integer(42).append_ascii(",\"name\":\""sv);
+    /// builder.append(upp::utf16_string::from_utf16_unchecked(u"Zo\u00EB"sv)).append(U'"'_uc).append(U'}'_uc);
+    ///
+    /// const upp::ustring json = std::move(builder).build(); // {"id":42,"name":"Zo\u00EB"}
+    ///
+    /// @endcode
+    ///
+    /// @headerfile "" <uni-cpp/string_builder.hpp>
+    ///
+    template<encoding Encoding,
+             string_compatible_container<Encoding> Container = std::basic_string<typename encoding_traits<Encoding>::default_code_unit_type>>
+        requires unicode_encoding<Encoding> && requires(Container& c, typename Container::size_type n) { c.resize(n); }
+    class ustring_builder
+    {
+    public:
+        using string_type    = basic_ustring<Encoding, Container>;
+        using code_unit_type = string_type::code_unit_type;
+        using size_type      = string_type::size_type;
+
+    public:
+        /// @brief Constructs an empty builder. Doesn't allocate.
+        ///
+        constexpr ustring_builder() = default;
+
+        /// @brief Constructs an empty builder with room for `capacity` code units.
+        ///
+        constexpr explicit ustring_builder(const size_type capacity) { m_buffer.resize(capacity); }
+
+        /// @brief Returns the number of code units written so far.
+        ///
+        [[nodiscard]] constexpr size_type size() const noexcept { return m_size; }
+
+        [[nodiscard]] constexpr bool empty() const noexcept { return m_size == 0; }
+
+        /// @brief Returns the number of code units that can be written without growing the buffer.
+        ///
+        [[nodiscard]] constexpr size_type capacity() const noexcept { return static_cast<size_type>(std::ranges::size(m_buffer)); }
+
+        /// @brief Returns the code units written so far.
+        ///
+        [[nodiscard]] constexpr std::span<const code_unit_type> code_units() const noexcept
+        {
+            return std::span<const code_unit_type>{std::ranges::data(m_buffer), m_size};
+        }
+
+        /// @brief Makes sure that at least `new_capacity` code units can be written without growing the buffer.
+        ///
+        constexpr void reserve(const size_type new_capacity)
+        {
+            if (new_capacity > capacity())
+                m_buffer.resize(new_capacity);
+        }
+
+        /// @brief Empties the builder, but keeps the buffer, so that building the next string doesn't allocate.
+        ///
+        constexpr void reset() noexcept { m_size = 0; }
+
+        /// @brief Encodes `code_point` and appends it.
+        ///
+        constexpr ustring_builder& append(const uchar code_point)
+        {
+            code_unit_type* const cursor = make_room(impl::basic_ustring_impl::code_point_length<Encoding>(code_point));
+
+            m_size += impl::encode_valid_code_point<Encoding>(code_point.value(), cursor);
+
+            return *this;
+        }
+
+        /// @brief Appends `piece`, transcoded to `Encoding`.
+        ///
+        /// `piece` is anything that `basic_ustring::append` accepts: a `basic_ustring` in any encoding, a `basic_ascii_string`,
+        /// or a forward range marked as valid (e.g. with `views::mark_as_valid_utf16`). Its exact size in `Encoding` is counted
+        /// first; pieces in the same encoding and ASCII pieces are then copied as a whole, and others are encoded code point by code point.
+        ///
+        /// @pre `piece` must not refer to the code units of this builder.
+        ///
+        template<impl::string_piece Piece>
+            requires(!std::same_as<Piece, uchar>)
+        constexpr ustring_builder& append(const Piece& piece)
+        {
+            constexpr encoding piece_encoding = impl::string_piece_encoding<Piece>::value;
+
+            const std::size_t added  = impl::basic_ustring_impl::transcoded_size<Encoding>(piece);
+            code_unit_type*   cursor = make_room(added);
+
+            const auto code_units = impl::basic_ustring_impl::piece_code_units(piece);
+
+            if constexpr (piece_encoding == Encoding || piece_encoding == encoding::ascii)
+            {
+                copy_code_units(code_units, cursor);
+            }
+            else
+            {
+                for (auto it = std::ranges::begin(code_units); it != std::ranges::end(code_units);)
+                {
+                    const std::uint32_t code_point = impl::decode_valid_code_point_and_advance<piece_encoding>(it);
+
+                    cursor += impl::encode_valid_code_point<Encoding>(code_point, cursor);
+                }
+            }
+
+            m_size += added;
+
+            return *this;
+        }
+
+        /// @brief Appends ASCII text, e.g. a `std::string_view`, copying it as a whole.
+        ///
+        /// @pre Every code unit of `ascii` must be ASCII.
+        ///
+        constexpr ustring_builder& append_ascii(const std::span<const char> ascii)
+        {
+            copy_code_units(ascii, make_room(ascii.size()));
+
+            m_size += ascii.size();
+
+            return *this;
+        }
+
+        /// @brief Appends `value` formatted in base `base` (2 to 36), like `std::to_chars`.
+        ///
+        template<std::integral T>
+            requires(!std::same_as<T, bool>)
+        constexpr ustring_builder& append_integer(const T value, const int base = 10)
+        {
+            // Enough for every digit in base 2, and the sign.
+            std::array<char, std::numeric_limits<T>::digits + 1> digits{};
+
+            const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), value, base);
+
+            return append_ascii(std::span<const char>{digits.data(), result.ptr});
+        }
+
+        /// @brief Returns the built string, which takes over the buffer of the builder without copying it.
+        ///
+        /// The builder is empty afterwards.
+        ///
+        [[nodiscard]] constexpr string_type build() &&
+        {
+            m_buffer.resize(m_size);
+            m_size = 0;
+
+            string_type result = impl::basic_ustring_impl::utfx_from_utfx_unchecked<Encoding, Container>(std::move(m_buffer));
+
+            m_buffer.clear();
+
+            return result;
+        }
+
+    private:
+        /// @brief Grows the buffer, if necessary, so that `count` more code units fit, and returns a pointer to where they go.
+        ///
+        constexpr code_unit_type* make_room(const std::size_t count)
+        {
+            const std::size_t required = m_size + count;
+            const std::size_t capacity = std::ranges::size(m_buffer);
+
+            if (required > capacity)
+            {
+                std::size_t new_capacity = std::max({required, 2 * capacity, min_capacity});
+
+                // Growing a fixed-capacity container past its capacity throws, so don't grow it further than needed.
+                if constexpr (fixed_capacity_container<Container>)
+                    new_capacity = std::max(required, std::min(new_capacity, static_cast<std::size_t>(Container::capacity())));
+
+                m_buffer.resize(static_cast<size_type>(new_capacity));
+            }
+
+            return std::ranges::data(m_buffer) + m_size;
+        }
+
+        template<typename Range>
+        static constexpr void copy_code_units(const Range& code_units, code_unit_type* const out)
+        {
+            using source_code_unit_type = std::ranges::range_value_t<Range>;
+
+            if constexpr (std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range> &&
+                          sizeof(source_code_unit_type) == sizeof(code_unit_type))
+            {
+                if !consteval
+                {
+                    std::memcpy(out, std::ranges::data(code_units), std::ranges::size(code_units) * sizeof(code_unit_type));
+                    return;
+                }
+            }
+
+            std::ranges::transform(code_units, out, [](const source_code_unit_type code_unit) static {
+                return static_cast<code_unit_type>(code_unit);
+            });
+        }
+
+    private:
+        static constexpr std::size_t min_capacity = 64;
+
+        Container m_buffer;
+        size_type m_size = 0;
+    };
+} // namespace upp
+
+#endif // UNI_CPP_STRING_BUILDER_HPP
\ No newline at end of file
@@ -13,7 +13,7 @@
 /// - Safe conversion between ASCII and Unicode characters
 /// - UTF-8 and UTF-16 encoding of characters
 /// - Case conversion for characters
-/// - Checking character properties
+/// - Checking character properties (General_Category, White_Space, Alphabetic, XID_Start and XID_Continue)
 ///
 
 #include <cstddef>
@@ -22,6 +22,8 @@
 #include <expected>
 
 #include "impl/unicode_data/case_mapping.hpp"
+#include "impl/unicode_data/general_properties.hpp"
+#include "impl/unicode_data/display_width.hpp"
 #include "impl/encoding/ascii.hpp"
 #include "impl/encoding/utf32.hpp"
 
@@ -287,6 +289,77 @@ namespace upp
         inline constexpr std::uint32_t max_usv = 0x10FFFFU;
     }
 
+    /// @brief The [General_Category](https://www.unicode.org/reports/tr44/#General_Category_Values) property of a character.
+    ///
+    /// @see uchar::general_category
+    ///
+    /// @headerfile "" <uni-cpp/uchar.hpp>
+    ///
+    enum class general_category : std::uint8_t
+    {
+        uppercase_letter,      ///< `Lu`
+        lowercase_letter,      ///< `Ll`
+        titlecase_letter,      ///< `Lt`
+        modifier_letter,       ///< `Lm`
+        other_letter,          ///< `Lo`
+        nonspacing_mark,       ///< `Mn`
+        spacing_mark,          ///< `Mc`
+        enclosing_mark,        ///< `Me`
+        decimal_number,        ///< `Nd`
+        letter_number,         ///< `Nl`
+        other_number,          ///< `No`
+        connector_punctuation, ///< `Pc`
+        dash_punctuation,      ///< `Pd`
+        open_punctuation,      ///< `Ps`
+        close_punctuation,     ///< `Pe`
+        initial_punctuation,   ///< `Pi`
+        final_punctuation,     ///< `Pf`
+        other_punctuation,     ///< `Po`
+        math_symbol,           ///< `Sm`
+        currency_symbol,       ///< `Sc`
+        modifier_symbol,       ///< `Sk`
+        other_symbol,          ///< `So`
+        space_separator,       ///< `Zs`
+        line_separator,        ///< `Zl`
+        paragraph_separator,   ///< `Zp`
+        control,               ///< `Cc`
+        format,                ///< `Cf`
+        surrogate,             ///< `Cs`
+        private_use,           ///< `Co`
+        unassigned,            ///< `Cn`
+    };
+
+    /// @brief Bitmask of the binary character properties exposed by uni-cpp.
+    ///
+    /// Values can be combined with `operator|` and tested with `operator&`.
+    ///
+    /// @see uchar::is_whitespace, uchar::is_alphabetic, uchar::is_xid_start, uchar::is_xid_continue, classify
+    ///
+    /// @headerfile "" <uni-cpp/uchar.hpp>
+    ///
+    enum class binary_property : std::uint8_t
+    {
+        none         = 0,
+        white_space  = impl::unicode_data::general_properties::white_space_bit,  ///< `White_Space`
+        alphabetic   = impl::unicode_data::general_properties::alphabetic_bit,   ///< `Alphabetic`
+        xid_start    = impl::unicode_data::general_properties::xid_start_bit,    ///< `XID_Start`
+        xid_continue = impl::unicode_data::general_properties::xid_continue_bit, ///< `XID_Continue`
+    };
+
+    /// @brief Combines two `binary_property` masks.
+    ///
+    [[nodiscard]] constexpr binary_property operator|(binary_property lhs, binary_property rhs) noexcept
+    {
+        return static_cast<binary_property>(std::to_underlying(lhs) | std::to_underlying(rhs));
+    }
+
+    /// @brief Intersects two `binary_property` masks.
+    ///
+    [[nodiscard]] constexpr binary_property operator&(binary_property lhs, binary_property rhs) noexcept
+    {
+        return static_cast<binary_property>(std::to_underlying(lhs) & std::to_underlying(rhs));
+    }
+
     /// @brief A Unicode character type representing a single [Unicode scalar value](https://www.unicode.org/glossary/#unicode_scalar_value).
     ///
     /// @headerfile "" <uni-cpp/uchar.hpp>
@@ -616,12 +689,73 @@ namespace upp
             return to_case_impl<to_titlecase_t, impl::unicode_data::case_mapping::case_mapping_type::titlecase>();
         }
 
+        /// @brief Returns the [General_Category](https://www.unicode.org/reports/tr44/#General_Category_Values) of this `uchar`.
+        ///
+        /// Code points that are not assigned in the supported Unicode version are `general_category::unassigned`.
+        ///
+        [[nodiscard]] constexpr upp::general_category general_category() const noexcept
+        {
+            return static_cast<upp::general_category>(impl::unicode_data::general_properties::lookup_general_category(m_value));
+        }
+
+        /// @brief Returns all of the `binary_property` values this `uchar` has, as a bitmask.
+        ///
+        /// @see is_whitespace, is_alphabetic, is_xid_start, is_xid_continue
+        ///
+        [[nodiscard]] constexpr binary_property binary_properties() const noexcept
+        {
+            return static_cast<binary_property>(impl::unicode_data::general_properties::lookup_binary_properties(m_value));
+        }
+
+        /// @brief Checks whether this `uchar` has the `White_Space` property.
+        ///
+        [[nodiscard]] constexpr bool is_whitespace() const noexcept { return has_binary_property(binary_property::white_space); }
+
+        /// @brief Checks whether this `uchar` has the `Alphabetic` property.
+        ///
+        [[nodiscard]] constexpr bool is_alphabetic() const noexcept { return has_binary_property(binary_property::alphabetic); }
+
+        /// @brief Checks whether this `uchar` has the `XID_Start` property.
+        ///
+        /// See [UAX #31 (Unicode Identifiers and Syntax)](https://www.unicode.org/reports/tr31/).
+        ///
+        [[nodiscard]] constexpr bool is_xid_start() const noexcept { return has_binary_property(binary_property::xid_start); }
+
+        /// @brief Checks whether this `uchar` has the `XID_Continue` property.
+        ///
+        /// See [UAX #31 (Unicode Identifiers and Syntax)](https://www.unicode.org/reports/tr31/).
+        ///
+        [[nodiscard]] constexpr bool is_xid_continue() const noexcept { return has_binary_property(binary_property::xid_continue); }
+
+        /// @brief Returns the number of columns this `uchar` occupies when displayed in a terminal (0, 1 or 2).
+        ///
+        /// Equivalent to POSIX `wcwidth()` for the supported Unicode version, with the following rules:
+        ///
+        /// - Nonspacing and enclosing marks (`Mn`, `Me`), `Default_Ignorable_Code_Point`s and Hangul Jamo
+        ///   vowels and trailing consonants are 0 columns wide, because they are combined with the preceding character.
+        /// - Control characters (`Cc`) are 0 columns wide. Unlike `wcwidth()`, this function never returns -1.
+        /// - Characters with the [East_Asian_Width](https://www.unicode.org/reports/tr11/) `W` (wide) or `F` (fullwidth),
+        ///   which includes emoji with the default emoji presentation, are 2 columns wide.
+        /// - All other characters, including unassigned code points, are 1 column wide.
+        ///
+        /// @see upp::display_width, upp::truncate_to_width
+        ///
+        [[nodiscard]] constexpr std::uint8_t display_width() const noexcept
+        {
+            return impl::unicode_data::display_width::lookup_display_width(m_value);
+        }
+
     private:
         explicit constexpr uchar(std::uint32_t value) noexcept
             : m_value(value)
         {
         }
 
+        [[nodiscard]] constexpr bool has_binary_property(binary_property property) const noexcept
+        {
+            return (binary_properties() & property) != binary_property::none;
+        }
+
         template<typename ResultType, impl::unicode_data::case_mapping::case_mapping_type MappingType>
         [[nodiscard]] constexpr ResultType to_case_impl() const noexcept
         {
@@ -0,0 +1,71 @@
+#include "bugspray.hpp"
+
+#include <uni-cpp/compare.hpp>
+#include <uni-cpp/string.hpp>
+
+#include <compare>
+#include <string_view>
+
+TEST_CASE("upp::equal", "[compare]")
+{
+    using namespace std::string_view_literals;
+
+    constexpr auto utf8  = u8"Long enough ASCII prefix, then Gr\u00FC\u00DFe \U0001F600"sv;
+    constexpr auto utf16 = u"Long enough ASCII prefix, then Gr\u00FC\u00DFe \U0001F600"sv;
+    constexpr auto utf32 = U"Long enough ASCII prefix, then Gr\u00FC\u00DFe \U0001F600"sv;
+
+    CHECK(upp::equal<upp::encoding::utf8, upp::encoding::utf16>(utf8 | upp::views::mark_as_valid_utf8, utf16 | upp::views::mark_as_valid_utf16));
+    CHECK(upp::equal<upp::encoding::utf32, upp::encoding::utf8>(utf32 | upp::views::mark_as_valid_utf32, utf8 | upp::views::mark_as_valid_utf8));
+    CHECK(upp::equal<upp::encoding::utf16, upp::encoding::utf16>(utf16 | upp::views::mark_as_valid_utf16, utf16 | upp::views::mark_as_valid_utf16));
+
+    CHECK(!upp::equal<upp::encoding::utf8, upp::encoding::utf16>(utf8 | upp::views::mark_as_valid_utf8,
+                                                                 utf16.substr(1) | upp::views::mark_as_valid_utf16));
+    CHECK(!upp::equal<upp::encoding::utf8, upp::encoding::utf32>(utf8.substr(0, utf8.size() - 4) | upp::views::mark_as_valid_utf8,
+                                                                 utf32 | upp::views::mark_as_valid_utf32));
+
+    // ASCII is compared as a subset of UTF-8.
+    CHECK(upp::equal<upp::encoding::ascii, upp::encoding::utf16>("ASCII"sv | upp::views::mark_as_valid_ascii,
+                                                                  u"ASCII"sv | upp::views::mark_as_valid_utf16));
+
+    const auto string8  = upp::utf8_string::from_utf8_unchecked(utf8);
+    const auto string16 = upp::utf16_string::from_utf16_unchecked(utf16);
+
+    CHECK(upp::equal(string8, string16));
+    CHECK(!upp::equal(string8, upp::utf16_string{}));
+}
+EVAL_TEST_CASE("upp::equal");
+
+TEST_CASE("upp::compare", "[compare]")
+{
+    using namespace std::string_view_literals;
+
+    const auto compare16 = [](const std::u16string_view x, const std::u16string_view y) {
+        return upp::compare<upp::encoding::utf16, upp::encoding::utf16>(x | upp::views::mark_as_valid_utf16, y | upp::views::mark_as_valid_utf16);
+    };
+
+    const auto compare8_16 = [](const std::u8string_view x, const std::u16string_view y) {
+        return upp::compare<upp::encoding::utf8, upp::encoding::utf16>(x | upp::views::mark_as_valid_utf8, y | upp::views::mark_as_valid_utf16);
+    };
+
+    CHECK(compare16(u"abc"sv, u"abd"sv) == std::strong_ordering::less);
+    CHECK(compare16(u"abc"sv, u"ab"sv) == std::strong_ordering::greater);
+    CHECK(compare16(u"abc"sv, u"abc"sv) == std::strong_ordering::equal);
+
+    // U+FF61 is ordered before U+1F600, although its code unit is greater than the high surrogate 0xD83D.
+    CHECK(compare16(u"x\uFF61"sv, u"x\U0001F600"sv) == std::strong_ordering::less);
+    CHECK(compare16(u"x\U0001F600"sv, u"x\uFF61"sv) == std::strong_ordering::greater);
+    CHECK(compare16(u"x\uD7FF"sv, u"x\U0001F600"sv) == std::strong_ordering::less);
+    CHECK(compare16(u"x\U0001F600"sv, u"x\U0001F601"sv) == std::strong_ordering::less);
+
+    CHECK(compare8_16(u8"same ASCII prefix: \uFF61"sv, u"same ASCII prefix: \U0001F600"sv) == std::strong_ordering::less);
+    CHECK(compare8_16(u8"same ASCII prefix: b"sv, u"same ASCII prefix: a"sv) == std::strong_ordering::greater);
+    CHECK(compare8_16(u8"same ASCII prefix"sv, u"same ASCII prefix: a"sv) == std::strong_ordering::less);
+    CHECK(compare8_16(u8"Gr\u00FC\u00DFe"sv, u"Gr\u00FC\u00DFe"sv) == std::strong_ordering::equal);
+
+    const auto x = upp::utf8_string::from_utf8_unchecked(u8"\uFF61"sv);
+    const auto y = upp::utf32_string::from_utf32_unchecked(U"\U0001F600"sv);
+
+    CHECK(upp::compare(x, y) == std::strong_ordering::less);
+    CHECK(upp::compare(y, x) == std::strong_ordering::greater);
+}
+EVAL_TEST_CASE("upp::compare");
\ No newline at end of file
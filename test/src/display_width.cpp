@@ -0,0 +1,118 @@
+#include "bugspray.hpp"
+
+#include <uni-cpp/uchar.hpp>
+#include <uni-cpp/display_width.hpp>
+#include <uni-cpp/string.hpp>
+
+#include "test_data.hpp"
+
+#include <string_view>
+#include <ranges>
+
+namespace
+{
+    [[nodiscard]] constexpr std::size_t width(std::u8string_view str)
+    {
+        return upp::display_width<upp::encoding::utf8>(str | upp::views::mark_as_valid_utf8);
+    }
+
+    [[nodiscard]] constexpr std::size_t truncate(std::u8string_view str, std::size_t max_width)
+    {
+        return upp::truncate_to_width<upp::encoding::utf8>(str | upp::views::mark_as_valid_utf8, max_width);
+    }
+} // namespace
+
+TEST_CASE("Display width", "[display width][upp::uchar]", runtime)
+{
+    const auto test_data = upp_test::load_test_data<std::uint32_t>("display_width.txt");
+
+    for (const auto& [code_point, data] : test_data)
+    {
+        REQUIRE(data.size() == 1);
+
+        if (!upp::is_valid_usv(code_point))
+            continue;
+
+        const auto ch = upp::uchar::from_unchecked(code_point);
+
+        CHECK(ch.display_width() == data[0]);
+
+        const char32_t code_points[] = {static_cast<char32_t>(code_point)};
+
+        CHECK(upp::display_width<upp::encoding::utf32>(code_points | upp::views::mark_as_valid_utf32) == data[0]);
+    }
+}
+
+TEST_CASE("upp::uchar::display_width", "[display width][upp::uchar]")
+{
+    using namespace upp::char_literals;
+
+    CHECK(U'a'_uc.display_width() == 1);
+    CHECK(U'\t'_uc.display_width() == 0);
+    CHECK(U'\x7F'_uc.display_width() == 0);
+    CHECK(U'\u00E9'_uc.display_width() == 1);
+    CHECK(U'\u0301'_uc.display_width() == 0);
+    CHECK(U'\u200B'_uc.display_width() == 0);
+    CHECK(U'\u1161'_uc.display_width() == 0);
+    CHECK(U'\u4E16'_uc.display_width() == 2);
+    CHECK(U'\uFF21'_uc.display_width() == 2);
+    CHECK(U'\uFF71'_uc.display_width() == 1);
+    CHECK(U'\U0001F600'_uc.display_width() == 2);
+    CHECK(U'\U0010FFFF'_uc.display_width() == 1);
+}
+EVAL_TEST_CASE("upp::uchar::display_width");
+
+TEST_CASE("upp::display_width", "[display width]")
+{
+    using namespace std::string_view_literals;
+
+    CHECK(width(u8"") == 0);
+    CHECK(width(u8"hello") == 5);
+    CHECK(width(u8"\t\r\n") == 0);
+    CHECK(width(u8"abcdefgh\x7Fijklmn\n") == 14);
+    CHECK(width(u8"ab\u4E16\u754Ce\u0301") == 7);
+    CHECK(width(u8"| \u65E5\u672C\u8A9E | \U0001F600 | caf\u00E9 |") == 22);
+
+    // Emoji ZWJ sequences are measured code point by code point, like `wcswidth()` does
+    CHECK(width(u8"\U0001F468\u200D\U0001F469\u200D\U0001F467") == 6);
+
+    CHECK(upp::display_width<upp::encoding::utf16>(u"ab\u4E16\u754Ce\u0301\U0001F600"sv | upp::views::mark_as_valid_utf16) == 9);
+    CHECK(upp::display_width<upp::encoding::ascii>("abc\tdef"sv | upp::views::mark_as_valid_ascii) == 6);
+
+    // A range that is not contiguous
+    auto filtered = u8"ab\u4E16\u754Ce\u0301"sv | std::views::filter([](char8_t) { return true; }) | upp::views::mark_as_valid_utf8;
+    CHECK(upp::display_width<upp::encoding::utf8>(filtered) == 7);
+
+    const auto str = upp::ustring::from_utf8_unchecked(u8"\uFF21\uFF22\uFF23 abc"sv);
+    CHECK(upp::display_width(str) == 10);
+}
+EVAL_TEST_CASE("upp::display_width");
+
+TEST_CASE("upp::truncate_to_width", "[display width]")
+{
+    using namespace std::string_view_literals;
+
+    CHECK(truncate(u8"", 10) == 0);
+    CHECK(truncate(u8"hello world", 5) == 5);
+    CHECK(truncate(u8"hello world", 100) == 11);
+    CHECK(truncate(u8"abcdefghijklmnop", 10) == 10);
+    CHECK(truncate(u8"abcdefghijklmnop", 0) == 0);
+
+    // Wide characters are never split between the columns
+    CHECK(truncate(u8"ab\u4E16\u754C", 3) == 2);
+    CHECK(truncate(u8"ab\u4E16\u754C", 4) == 5);
+    CHECK(truncate(u8"abcdefghijkl\u4E16", 13) == 12);
+    CHECK(truncate(u8"abcdefghijkl\u4E16", 14) == 15);
+
+    // Zero width code points after the last code point that fits are included
+    CHECK(truncate(u8"e\u0301xyz", 1) == 3);
+    CHECK(truncate(u8"\u0301abc", 0) == 2);
+    CHECK(truncate(u8"abcdefgh\n\n\nij", 8) == 11);
+
+    CHECK(upp::truncate_to_width<upp::encoding::utf16>(u"\U0001F600\U0001F600\U0001F600"sv | upp::views::mark_as_valid_utf16, 5) == 4);
+    CHECK(upp::truncate_to_width<upp::encoding::utf32>(U"a\u4E16b"sv | upp::views::mark_as_valid_utf32, 3) == 2);
+
+    const auto str = upp::ustring::from_utf8_unchecked(u8"\uFF21\uFF22\uFF23 abc"sv);
+    CHECK(upp::truncate_to_width(str, 5) == 6);
+}
+EVAL_TEST_CASE("upp::truncate_to_width");
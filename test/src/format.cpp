@@ -0,0 +1,47 @@
+#include "bugspray.hpp"
+
+#include <uni-cpp/format.hpp>
+#include <uni-cpp/string.hpp>
+
+#include <format>
+#include <string>
+#include <string_view>
+
+TEST_CASE("std::formatter for uni-cpp strings", "[format]", runtime)
+{
+    using namespace std::string_view_literals;
+
+    const auto utf8  = upp::ustring::from_utf8_unchecked(u8"Zo\u00EB"sv);
+    const auto utf16 = upp::utf16_string::from_utf16_unchecked(u"Zo\u00EB \U0001F600"sv);
+    const auto utf32 = upp::utf32_string::from_utf32_unchecked(U"\u00DF"sv);
+    const auto ascii = upp::ascii_string::from_ascii_unchecked("ascii"sv);
+
+    CHECK(std::format("{}|{}|{}|{}", utf8, utf16, utf32, ascii) == "Zo\xC3\xAB|Zo\xC3\xAB \xF0\x9F\x98\x80|\xC3\x9F|ascii");
+
+    // Width and precision are counted in code points.
+    CHECK(std::format("[{:6}]", utf8) == "[Zo\xC3\xAB   ]");
+    CHECK(std::format("[{:*>5}]", utf16) == "[Zo\xC3\xAB \xF0\x9F\x98\x80]");
+    CHECK(std::format("[{:*^7}]", utf16) == "[*Zo\xC3\xAB \xF0\x9F\x98\x80*]");
+    CHECK(std::format("[{:.3}]", utf16) == "[Zo\xC3\xAB]");
+    CHECK(std::format("[{:.0}]", utf8) == "[]");
+    CHECK(std::format("[{:\xE2\x80\xA2<4.1s}]", utf32) == "[\xC3\x9F\xE2\x80\xA2\xE2\x80\xA2\xE2\x80\xA2]");
+    CHECK(std::format("[{:>{}.{}}]", ascii, 4, 2) == "[  as]");
+
+    // Longer than the buffer that other encodings are transcoded into.
+    const std::u16string long_text(1000, u'\u00E9');
+    std::string          expected;
+
+    for (int i = 0; i < 1000; ++i)
+        expected += "\xC3\xA9";
+
+    CHECK(std::format("{}", upp::utf16_string::from_utf16_unchecked(long_text)) == expected);
+}
+
+TEST_CASE("std::formatter for uni-cpp characters", "[format]", runtime)
+{
+    using namespace upp::char_literals;
+
+    CHECK(std::format("{}{:c}", U'\u00E9'_uc, U'\U0001F600'_uc) == "\xC3\xA9\xF0\x9F\x98\x80");
+    CHECK(std::format("[{:-^3}]", U'\u00E9'_uc) == "[-\xC3\xA9-]");
+    CHECK(std::format("[{:>2}]", u8'a'_ac) == "[ a]");
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include "bugspray.hpp"
+
+#include <uni-cpp/uchar.hpp>
+#include <uni-cpp/properties.hpp>
+#include <uni-cpp/string.hpp>
+
+#include "test_data.hpp"
+
+#include <array>
+#include <string_view>
+#include <utility>
+
+TEST_CASE("General_Category & binary properties", "[general properties][upp::uchar]", runtime)
+{
+    const auto test_data = upp_test::load_test_data<std::uint32_t>("general_properties.txt");
+
+    for (const auto& [code_point, data] : test_data)
+    {
+        REQUIRE(data.size() == 2);
+
+        const auto general_category = static_cast<upp::general_category>(data[0]);
+        const auto properties       = static_cast<upp::binary_property>(data[1]);
+
+        if (!upp::is_valid_usv(code_point))
+        {
+            CHECK(general_category == upp::general_category::surrogate);
+            continue;
+        }
+
+        const auto ch = upp::uchar::from_unchecked(code_point);
+
+        CHECK(ch.general_category() == general_category);
+        CHECK(ch.binary_properties() == properties);
+
+        CHECK(ch.is_whitespace() == ((properties & upp::binary_property::white_space) != upp::binary_property::none));
+        CHECK(ch.is_alphabetic() == ((properties & upp::binary_property::alphabetic) != upp::binary_property::none));
+        CHECK(ch.is_xid_start() == ((properties & upp::binary_property::xid_start) != upp::binary_property::none));
+        CHECK(ch.is_xid_continue() == ((properties & upp::binary_property::xid_continue) != upp::binary_property::none));
+    }
+}
+
+TEST_CASE("upp::uchar property queries", "[general properties][upp::uchar]")
+{
+    using namespace upp::char_literals;
+
+    CHECK(U'A'_uc.general_category() == upp::general_category::uppercase_letter);
+    CHECK(U'\u01C5'_uc.general_category() == upp::general_category::titlecase_letter);
+    CHECK(U'7'_uc.general_category() == upp::general_category::decimal_number);
+    CHECK(U'\u0301'_uc.general_category() == upp::general_category::nonspacing_mark);
+    CHECK(U'\u2029'_uc.general_category() == upp::general_category::paragraph_separator);
+    CHECK(U'\uE000'_uc.general_category() == upp::general_category::private_use);
+    CHECK(U'\U0010FFFF'_uc.general_category() == upp::general_category::unassigned);
+
+    CHECK(U' '_uc.is_whitespace());
+    CHECK(U'\u3000'_uc.is_whitespace());
+    CHECK_FALSE(U'\u200B'_uc.is_whitespace());
+
+    CHECK(U'\u00E9'_uc.is_alphabetic());
+    CHECK_FALSE(U'1'_uc.is_alphabetic());
+
+    CHECK(U'_'_uc.is_xid_continue());
+    CHECK_FALSE(U'_'_uc.is_xid_start());
+    CHECK(U'\u0416'_uc.is_xid_start());
+    CHECK(U'\u0301'_uc.is_xid_continue());
+    CHECK_FALSE(U'$'_uc.is_xid_continue());
+}
+EVAL_TEST_CASE("upp::uchar property queries");
+
+TEST_CASE("upp::classify", "[general properties]")
+{
+    constexpr std::array<char32_t, 6> code_points{U'a', U' ', U'9', U'\u0301', 0xD800, 0x110000};
+
+    std::array<upp::binary_property, 6> out{};
+    upp::classify(code_points, out);
+
+    using enum upp::binary_property;
+
+    CHECK(out[0] == (alphabetic | xid_start | xid_continue));
+    CHECK(out[1] == white_space);
+    CHECK(out[2] == xid_continue);
+    CHECK(out[3] == xid_continue);
+    CHECK(out[4] == none);
+    CHECK(out[5] == none);
+}
+EVAL_TEST_CASE("upp::classify");
+
+TEST_CASE("upp::find_first_not_of_property", "[general properties]")
+{
+    using upp::binary_property;
+
+    const auto find = [](std::u8string_view str, binary_property properties) {
+        return upp::find_first_not_of_property(str | upp::views::mark_as_valid_encoding<upp::encoding::utf8>, properties);
+    };
+
+    CHECK(find(u8"", binary_property::xid_continue) == 0);
+    CHECK(find(u8"identifier", binary_property::xid_continue) == 10);
+    CHECK(find(u8"long_identifier_name = 1", binary_property::xid_continue) == 20);
+    CHECK(find(u8"x+y", binary_property::xid_continue) == 1);
+    CHECK(find(u8"caf\u00E9_\u0416\u0301 ", binary_property::xid_continue) == 10);
+    CHECK(find(u8"\U00010400\U00010401!", binary_property::xid_continue) == 8);
+    CHECK(find(u8"abcdefgh\u00E9jklmnop ", binary_property::xid_continue) == 17);
+
+    CHECK(find(u8" \t\r\n\u3000\u2029token", binary_property::white_space) == 10);
+    CHECK(find(u8"        ", binary_property::white_space) == 8);
+    CHECK(find(u8"a b", binary_property::white_space | binary_property::alphabetic) == 3);
+
+    const auto str = upp::ustring::from_utf8_unchecked(std::u8string_view{u8"snake_case_\u00FCber(x)"});
+    CHECK(upp::find_first_not_of_property(str, binary_property::xid_continue) == 16);
+}
+EVAL_TEST_CASE("upp::find_first_not_of_property");
\ No newline at end of file
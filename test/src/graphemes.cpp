@@ -0,0 +1,265 @@
+#include "bugspray.hpp"
+
+#include <uni-cpp/ranges.hpp>
+#include <uni-cpp/string.hpp>
+
+#include "test_data.hpp"
+
+#include <string>
+#include <string_view>
+#include <ranges>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    [[nodiscard]] std::size_t count_code_point_graphemes(const std::u32string& code_points)
+    {
+        return upp::ranges::count_graphemes<upp::encoding::utf32>(code_points | upp::views::mark_as_valid_utf32);
+    }
+
+    [[nodiscard]] constexpr std::vector<std::u8string> split(std::u8string_view str)
+    {
+        std::vector<std::u8string> result;
+
+        for (const auto cluster : str | upp::views::mark_as_valid_utf8 | upp::views::graphemes_utf8)
+            result.emplace_back(cluster.begin(), cluster.end());
+
+        return result;
+    }
+
+    using clusters = std::vector<std::u8string>;
+
+    /// A line of GraphemeBreakTest.txt, e.g. "\xC3\xB7 0020 \xC3\x97 0308 \xC3\xB7": code points separated by U+00F7 DIVISION SIGN
+    /// where there is a boundary, and by U+00D7 MULTIPLICATION SIGN where there isn't.
+    struct grapheme_break_test
+    {
+        std::u32string              code_points;
+        std::vector<std::u32string> clusters;
+    };
+
+    [[nodiscard]] grapheme_break_test parse_grapheme_break_test(std::string_view line)
+    {
+        grapheme_break_test test;
+        std::u32string      cluster;
+
+        for (const auto token_chars : std::views::split(line, ' '))
+        {
+            std::string_view token{token_chars};
+
+            token = token.substr(0, token.find('\t'));
+
+            if (token.empty() || token == "\xC3\x97")
+                continue;
+
+            if (token == "\xC3\xB7")
+            {
+                if (!cluster.empty())
+                    test.clusters.push_back(std::move(cluster));
+
+                cluster.clear();
+                continue;
+            }
+
+            const std::u32string code_point = upp_test::parse_code_points(token);
+
+            test.code_points += code_point;
+            cluster += code_point;
+        }
+
+        if (!cluster.empty())
+            test.clusters.push_back(std::move(cluster));
+
+        return test;
+    }
+
+    /// Splits `code_points` into grapheme clusters in the encoding of `String`, and returns the clusters as code points.
+    template<typename String>
+    [[nodiscard]] std::vector<std::u32string> grapheme_clusters(const std::u32string& code_points)
+    {
+        constexpr upp::encoding encoding = String::encoding_value;
+
+        const auto string = String::from_utf32_unchecked(code_points);
+
+        std::vector<std::u32string> result;
+
+        for (const auto cluster : string.code_units() | upp::views::mark_as_valid_encoding<encoding> | upp::views::graphemes<encoding>)
+        {
+            if constexpr (encoding == upp::encoding::utf8)
+                result.push_back(upp::utf32_string::from_utf8_unchecked(cluster).underlying());
+            else if constexpr (encoding == upp::encoding::utf16)
+                result.push_back(upp::utf32_string::from_utf16_unchecked(cluster).underlying());
+            else
+                result.emplace_back(cluster.begin(), cluster.end());
+        }
+
+        return result;
+    }
+
+    template<typename String>
+    [[nodiscard]] std::size_t count_grapheme_clusters(const std::u32string& code_points)
+    {
+        constexpr upp::encoding encoding = String::encoding_value;
+
+        const auto string = String::from_utf32_unchecked(code_points);
+
+        return upp::ranges::count_graphemes<encoding>(string.code_units() | upp::views::mark_as_valid_encoding<encoding>);
+    }
+} // namespace
+
+TEST_CASE("Grapheme_Cluster_Break, Extended_Pictographic & Indic_Conjunct_Break properties", "[graphemes]", runtime)
+{
+    const auto test_data = upp_test::load_test_data<std::uint32_t>("grapheme_break_properties.txt");
+
+    // The order of the values in the test data
+    enum : std::uint32_t
+    {
+        other,
+        cr,
+        lf,
+        control,
+        extend,
+        zwj,
+        regional_indicator,
+        prepend,
+        spacing_mark,
+        l,
+        v,
+        t,
+        lv,
+        lvt,
+    };
+
+    enum : std::uint32_t
+    {
+        incb_none,
+        incb_linker,
+        incb_consonant,
+        incb_extend,
+    };
+
+    for (const auto& [code_point, data] : test_data)
+    {
+        REQUIRE(data.size() == 3);
+
+        const auto c = static_cast<char32_t>(code_point);
+
+        const std::uint32_t gcb = data[0];
+
+        const bool is_extended_pictographic = data[1] != 0;
+        const bool is_extender              = gcb == extend || gcb == zwj || gcb == spacing_mark;
+
+        // GB9, GB9a, GB9b
+        CHECK((count_code_point_graphemes({U'a', c}) == 1) == is_extender);
+        CHECK((count_code_point_graphemes({c, U'a'}) == 1) == (gcb == prepend));
+
+        // GB6, GB7, GB8 (U+1100 is L, U+1161 is V, U+11A8 is T)
+        CHECK((count_code_point_graphemes({U'\u1100', c}) == 1) == (is_extender || gcb == l || gcb == v || gcb == lv || gcb == lvt));
+        CHECK((count_code_point_graphemes({c, U'\u1161'}) == 1) == (gcb == prepend || gcb == l || gcb == v || gcb == lv));
+        CHECK((count_code_point_graphemes({c, U'\u11A8'}) == 1) == (gcb == prepend || gcb == v || gcb == t || gcb == lv || gcb == lvt));
+
+        // GB11
+        CHECK((count_code_point_graphemes({U'\U0001F600', U'\u200D', c}) == 1) == (is_extender || is_extended_pictographic));
+
+        // GB12, GB13
+        CHECK((count_code_point_graphemes({U'\U0001F1E6', c}) == 1) == (is_extender || gcb == regional_indicator));
+
+        // GB9c (U+0915 is a consonant, U+094D is a linker)
+        CHECK((count_code_point_graphemes({U'\u0915', U'\u094D', c}) == 1) == (is_extender || data[2] == incb_consonant));
+        CHECK((count_code_point_graphemes({U'\u0915', c, U'\u0915'}) == 1) == (data[2] == incb_linker));
+        CHECK((count_code_point_graphemes({U'\u0915', c, U'\u094D', U'\u0915'}) == 1) == (data[2] == incb_linker || data[2] == incb_extend));
+    }
+}
+
+// The conformance test of UAX #29, run in all three encodings.
+TEST_CASE("GraphemeBreakTest.txt", "[graphemes][ranges]", runtime)
+{
+    const auto lines = upp_test::load_ucd_test_file("GraphemeBreakTest.txt");
+
+    REQUIRE(!lines.empty());
+
+    for (const std::string& line : lines)
+    {
+        const auto [code_points, clusters] = parse_grapheme_break_test(line);
+
+        CHECK(grapheme_clusters<upp::ustring>(code_points) == clusters);
+        CHECK(grapheme_clusters<upp::utf16_string>(code_points) == clusters);
+        CHECK(grapheme_clusters<upp::utf32_string>(code_points) == clusters);
+
+        CHECK(count_grapheme_clusters<upp::ustring>(code_points) == clusters.size());
+        CHECK(count_grapheme_clusters<upp::utf16_string>(code_points) == clusters.size());
+        CHECK(count_grapheme_clusters<upp::utf32_string>(code_points) == clusters.size());
+    }
+}
+
+TEST_CASE("upp::views::graphemes", "[graphemes][ranges]")
+{
+    CHECK(split(u8"") == clusters{});
+    CHECK(split(u8"abc") == clusters{u8"a", u8"b", u8"c"});
+
+    // CR LF (GB3) and controls (GB4, GB5)
+    CHECK(split(u8"a\r\nb\n\r\t\u0301") == clusters{u8"a", u8"\r\n", u8"b", u8"\n", u8"\r", u8"\t", u8"\u0301"});
+
+    // Combining marks (GB9), also at the start of the text and after the ASCII fast path
+    CHECK(split(u8"xe\u0301\u0323y") == clusters{u8"x", u8"e\u0301\u0323", u8"y"});
+    CHECK(split(u8"\u0301a") == clusters{u8"\u0301", u8"a"});
+
+    // Hangul syllable sequences (GB6, GB7, GB8)
+    CHECK(split(u8"\u1100\u1161\u11A8\uAC00\u11A8\uAC01\u1161") == clusters{u8"\u1100\u1161\u11A8", u8"\uAC00\u11A8", u8"\uAC01", u8"\u1161"});
+
+    // Spacing marks (GB9a) and prepended concatenation marks (GB9b)
+    CHECK(split(u8"\u0915\u093F\u0600\u0661x") == clusters{u8"\u0915\u093F", u8"\u0600\u0661", u8"x"});
+
+    // Indic conjuncts (GB9c)
+    CHECK(split(u8"\u0915\u094D\u0937\u093F") == clusters{u8"\u0915\u094D\u0937\u093F"});
+    CHECK(split(u8"\u0915\u093C\u094D\u200D\u0924") == clusters{u8"\u0915\u093C\u094D\u200D\u0924"});
+    CHECK(split(u8"a\u094D\u0924") == clusters{u8"a\u094D", u8"\u0924"});
+
+    // Emoji modifier and ZWJ sequences (GB11)
+    CHECK(split(u8"\U0001F468\u200D\U0001F469\u200D\U0001F467!") == clusters{u8"\U0001F468\u200D\U0001F469\u200D\U0001F467", u8"!"});
+    CHECK(split(u8"\U0001F44D\U0001F3FD\u2764\uFE0F") == clusters{u8"\U0001F44D\U0001F3FD", u8"\u2764\uFE0F"});
+    CHECK(split(u8"a\u200D\U0001F469") == clusters{u8"a\u200D", u8"\U0001F469"});
+
+    // Flags (GB12, GB13)
+    CHECK(split(u8"\U0001F1EF\U0001F1F5\U0001F1FA\U0001F1F8\U0001F1E6") ==
+          clusters{u8"\U0001F1EF\U0001F1F5", u8"\U0001F1FA\U0001F1F8", u8"\U0001F1E6"});
+}
+EVAL_TEST_CASE("upp::views::graphemes");
+
+TEST_CASE("upp::views::graphemes with UTF-16 and UTF-32", "[graphemes][ranges]")
+{
+    using namespace std::string_view_literals;
+
+    const auto utf16 = u"e\u0301\U0001F1EF\U0001F1F5!"sv | upp::views::mark_as_valid_utf16 | upp::views::graphemes_utf16;
+
+    CHECK(std::ranges::distance(utf16) == 3);
+    CHECK(std::ranges::equal(*utf16.begin(), u"e\u0301"sv));
+    CHECK(std::ranges::equal(*std::ranges::next(utf16.begin()), u"\U0001F1EF\U0001F1F5"sv));
+
+    const auto utf32 = U"e\u0301\U0001F1EF\U0001F1F5!"sv | upp::views::mark_as_valid_utf32 | upp::views::graphemes<upp::encoding::utf32>;
+
+    CHECK(std::ranges::distance(utf32) == 3);
+    CHECK(std::ranges::equal(*std::ranges::next(utf32.begin(), 2), U"!"sv));
+}
+EVAL_TEST_CASE("upp::views::graphemes with UTF-16 and UTF-32");
+
+TEST_CASE("upp::ranges::count_graphemes", "[graphemes][ranges]")
+{
+    using namespace std::string_view_literals;
+
+    constexpr auto text  = u8"cafe\u0301 \U0001F468\u200D\U0001F469\u200D\U0001F467"sv;
+    constexpr auto utf16 = u"cafe\u0301 \U0001F468\u200D\U0001F469\u200D\U0001F467"sv;
+
+    CHECK(upp::ranges::count_graphemes<upp::encoding::utf8>(u8""sv | upp::views::mark_as_valid_utf8) == 0);
+    CHECK(upp::ranges::count_graphemes<upp::encoding::utf8>(u8"hello, world\r\n"sv | upp::views::mark_as_valid_utf8) == 13);
+    CHECK(upp::ranges::count_graphemes<upp::encoding::utf8>(text | upp::views::mark_as_valid_utf8) == 6);
+    CHECK(upp::ranges::count_graphemes<upp::encoding::utf16>(utf16 | upp::views::mark_as_valid_utf16) == 6);
+
+    // A range that is not contiguous
+    auto filtered = text | std::views::filter([](char8_t) { return true; }) | upp::views::mark_as_valid_utf8;
+
+    CHECK(upp::ranges::count_graphemes<upp::encoding::utf8>(filtered) == 6);
+    CHECK(std::ranges::distance(filtered | upp::views::graphemes_utf8) == 6);
+}
+EVAL_TEST_CASE("upp::ranges::count_graphemes");
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include "bugspray.hpp"
+
+#include <uni-cpp/hash.hpp>
+#include <uni-cpp/string.hpp>
+
+#include <string_view>
+#include <unordered_set>
+
+TEST_CASE("upp::hash", "[hash]")
+{
+    using namespace std::string_view_literals;
+
+    constexpr auto utf8  = u8"Long enough ASCII prefix, then Gr\u00FC\u00DFe \U0001F600 and more text after it"sv;
+    constexpr auto utf16 = u"Long enough ASCII prefix, then Gr\u00FC\u00DFe \U0001F600 and more text after it"sv;
+    constexpr auto utf32 = U"Long enough ASCII prefix, then Gr\u00FC\u00DFe \U0001F600 and more text after it"sv;
+
+    constexpr upp::hash hash;
+
+    const auto string8  = upp::utf8_string::from_utf8_unchecked(utf8);
+    const auto string16 = upp::utf16_string::from_utf16_unchecked(utf16);
+    const auto string32 = upp::utf32_string::from_utf32_unchecked(utf32);
+
+    CHECK(hash(string8) == hash(string16));
+    CHECK(hash(string8) == hash(string32));
+
+    CHECK(hash(utf8) == hash(string8));
+    CHECK(hash(utf16) == hash(string8));
+    CHECK(hash(utf32) == hash(string8));
+
+    CHECK(hash(utf16 | upp::views::mark_as_valid_utf16) == hash(string8));
+    CHECK(hash(utf32 | upp::views::mark_as_valid_utf32) == hash(string8));
+
+    CHECK(hash(upp::ascii_string::from_ascii_unchecked("ASCII"sv)) == hash(u"ASCII"sv));
+    CHECK(hash("ASCII"sv | upp::views::mark_as_valid_ascii) == hash(U"ASCII"sv));
+
+    CHECK(hash(string8) != hash(upp::utf8_string::from_utf8_unchecked(utf8.substr(1))));
+    CHECK(hash(u8""sv) == hash(U""sv));
+
+    // An unpaired surrogate isn't valid, so the code units are hashed as they are.
+    CHECK(hash(u"\xD800"sv) != hash(u"\xDC00"sv));
+}
+EVAL_TEST_CASE("upp::hash");
+
+TEST_CASE("upp::equal_to", "[hash]")
+{
+    using namespace std::string_view_literals;
+
+    constexpr upp::equal_to equal_to;
+
+    const auto string8 = upp::utf8_string::from_utf8_unchecked(u8"Gr\u00FC\u00DFe"sv);
+
+    CHECK(equal_to(string8, u"Gr\u00FC\u00DFe"sv));
+    CHECK(equal_to(U"Gr\u00FC\u00DFe"sv, string8));
+    CHECK(equal_to(string8, u"Gr\u00FC\u00DFe"sv | upp::views::mark_as_valid_utf16));
+    CHECK(!equal_to(string8, u"Gruesse"sv));
+
+    // Invalid string views are compared by their code units, like they are hashed.
+    CHECK(equal_to(u"\xD800"sv, u"\xD800"sv));
+    CHECK(equal_to(u8"a\xFF"sv, u8"a\xFF"sv));
+    CHECK(!equal_to(u"\xD800"sv, u"\xDC00"sv));
+    CHECK(!equal_to(u"\xD800"sv, U"\xD800"sv));
+    CHECK(!equal_to(u"\xD800"sv, u"\xD800a"sv));
+}
+EVAL_TEST_CASE("upp::equal_to");
+
+TEST_CASE("upp::hash heterogeneous lookup", "[hash]", runtime)
+{
+    using namespace std::string_view_literals;
+
+    const std::unordered_set<upp::ustring, upp::hash, upp::equal_to> set{
+        upp::ustring::from_utf8_unchecked(u8"caf\u00E9"sv),
+        upp::ustring::from_utf8_unchecked(u8"\U0001F600"sv),
+    };
+
+    CHECK(set.contains(u"caf\u00E9"sv));
+    CHECK(set.contains(U"\U0001F600"sv));
+    CHECK(set.contains(upp::utf16_string::from_utf16_unchecked(u"caf\u00E9"sv)));
+    CHECK(set.find(u8"cafe"sv) == set.end());
+}
\ No newline at end of file
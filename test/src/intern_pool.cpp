@@ -0,0 +1,60 @@
+#include "bugspray.hpp"
+
+#include <uni-cpp/intern_pool.hpp>
+#include <uni-cpp/string.hpp>
+#include <uni-cpp/ranges.hpp>
+
+#include <string>
+#include <string_view>
+#include <ranges>
+#include <algorithm>
+
+static_assert(upp::ranges::valid_code_unit_range<upp::intern_pool<upp::encoding::utf8>::view_type, upp::encoding::utf8>);
+
+TEST_CASE("upp::intern_pool", "[intern pool]", runtime)
+{
+    using namespace std::string_view_literals;
+
+    upp::intern_pool<upp::encoding::utf8, 4> pool;
+
+    const auto tag = pool.intern(u8"region=eu-west"sv);
+
+    REQUIRE(tag.has_value());
+    CHECK(std::ranges::equal(pool.view(*tag), u8"region=eu-west"sv));
+
+    // The same code units get the same id, whatever their code unit type
+    const auto same = pool.intern("region=eu-west"sv);
+
+    REQUIRE(same.has_value());
+    CHECK(*same == *tag);
+    CHECK(pool.intern(upp::ustring::from_utf8_unchecked(u8"region=eu-west"sv)) == *tag);
+    CHECK(pool.size() == 1);
+
+    // Invalid code units aren't interned
+    const auto invalid = pool.intern("caf\xC3"sv);
+
+    REQUIRE(!invalid.has_value());
+    CHECK(invalid.error().valid_up_to == 3);
+    CHECK(pool.size() == 1);
+
+    const auto accented = pool.intern(u8"caf\u00E9"sv);
+
+    REQUIRE(accented.has_value());
+    CHECK(*accented != *tag);
+    CHECK(pool.find(u8"caf\u00E9"sv) == *accented);
+    CHECK(!pool.find(u8"cafe"sv).has_value());
+
+    // Views are valid code unit ranges, so they can be decoded without validation
+    CHECK(std::ranges::distance(pool.view(*accented) | upp::views::decode<upp::encoding::utf8>) == 4);
+
+    // Ids and views stay stable while the pool grows
+    const auto view = pool.view(*tag);
+
+    for (int i = 0; i < 5000; ++i)
+        REQUIRE(pool.intern(std::to_string(i)).has_value());
+
+    CHECK(pool.size() == 5002);
+    CHECK(pool.view(*tag).begin() == view.begin());
+    CHECK(pool.find("4999"sv).has_value());
+    CHECK(std::ranges::equal(pool.view(*pool.find("1234"sv)), u8"1234"sv));
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include "bugspray.hpp"
+
+#include <uni-cpp/line_index.hpp>
+#include <uni-cpp/string.hpp>
+
+#include <string>
+#include <string_view>
+
+TEST_CASE("upp::line_index", "[line index]")
+{
+    using namespace std::string_view_literals;
+
+    // 'a', U+00E9, U+4E16 and U+1F600 take 1, 2, 3 and 4 UTF-8 code units, and 1, 1, 1 and 2 UTF-16 code units
+    const auto text = upp::ustring::from_utf8_unchecked(u8"a\u00E9\u4E16\U0001F600\r\nb\u2028\u00E9\nlast line\n"sv);
+
+    const upp::line_index<upp::encoding::utf8> index{text};
+
+    using location = upp::line_index<upp::encoding::utf8>::location;
+
+    CHECK(index.line_count() == 5);
+    CHECK(index.line_start(1) == 12);
+    CHECK(index.line_start(2) == 16);
+    CHECK(index.line_start(4) == text.size());
+
+    CHECK(index.resolve(text, 0) == location{});
+    CHECK(index.resolve(text, 10) == location{.line = 0, .code_unit = 10, .code_point = 4, .utf16 = 5});
+    CHECK(index.resolve(text, 13) == location{.line = 1, .code_unit = 1, .code_point = 1, .utf16 = 1});
+    CHECK(index.resolve(text, 18) == location{.line = 2, .code_unit = 2, .code_point = 1, .utf16 = 1});
+    CHECK(index.resolve(text, text.size()) == location{.line = 4});
+
+    // Policies
+    const upp::line_index<upp::encoding::utf8, upp::line_break_policy::lf> lf_index{text};
+
+    CHECK(lf_index.line_count() == 4);
+    CHECK(lf_index.resolve(text, 18) == location{.line = 1, .code_unit = 6, .code_point = 3, .utf16 = 3});
+
+    const upp::line_index<upp::encoding::utf16> empty_index{u""sv};
+
+    CHECK(empty_index.line_count() == 1);
+    CHECK(empty_index.resolve(u""sv, 0).line == 0);
+}
+EVAL_TEST_CASE("upp::line_index");
+
+TEST_CASE("upp::line_index of decoding errors", "[line index]")
+{
+    using namespace std::string_view_literals;
+
+    // The text doesn't have to be valid after the error
+    constexpr auto config = u8"name = \"Zo\u00EB\"\nvalue = \"\xFF\"\n\xC2\n"sv;
+
+    const auto string = upp::ustring::from_utf8(config);
+
+    CHECK(!string.has_value());
+
+    const upp::line_index<upp::encoding::utf8> index{config};
+
+    CHECK(index.line_count() == 4);
+    CHECK(index.resolve(config, string.error()).line == 1);
+    CHECK(index.resolve(config, string.error()).code_point == 9);
+
+    constexpr auto utf16_config = u"k = \U0001F600 \xD800"sv;
+
+    const auto utf16_string = upp::utf16_string::from_utf16(utf16_config);
+
+    CHECK(!utf16_string.has_value());
+
+    const upp::line_index<upp::encoding::utf16> utf16_index{utf16_config};
+
+    CHECK(utf16_index.resolve(utf16_config, utf16_string.error()) ==
+          upp::line_index<upp::encoding::utf16>::location{.line = 0, .code_unit = 7, .code_point = 6, .utf16 = 7});
+
+    // The offsets of errors of other encodings count other code units
+    constexpr auto resolves = []<typename Index, typename Text, typename Error>(const Index& i, const Text& t, const Error& e) {
+        return requires { i.resolve(t, e); };
+    };
+
+    CHECK(resolves(index, config, upp::from_ascii_error{}));
+    CHECK(!resolves(index, config, upp::from_utf16_error{}));
+    CHECK(!resolves(utf16_index, utf16_config, upp::from_utf8_error{}));
+    CHECK(!resolves(utf16_index, utf16_config, upp::from_ascii_error{}));
+}
+EVAL_TEST_CASE("upp::line_index of decoding errors");
+
+TEST_CASE("upp::line_index from_code_point()", "[line index]")
+{
+    using namespace std::string_view_literals;
+
+    const auto text = u"a\U0001F600b\r\nxy\u2028\u00E9\U0001F600z"sv;
+
+    const upp::line_index<upp::encoding::utf16> index{text, true};
+
+    CHECK(index.has_code_point_offsets());
+    CHECK(!upp::line_index<upp::encoding::utf16>{text}.has_code_point_offsets());
+
+    using location = upp::line_index<upp::encoding::utf16>::location;
+
+    CHECK(index.from_code_point(text, 0) == location{});
+    CHECK(index.from_code_point(text, 2) == location{.line = 0, .code_unit = 3, .code_point = 2, .utf16 = 3});
+    CHECK(index.from_code_point(text, 6) == location{.line = 1, .code_unit = 1, .code_point = 1, .utf16 = 1});
+    CHECK(index.from_code_point(text, 10) == location{.line = 2, .code_unit = 3, .code_point = 2, .utf16 = 3});
+    CHECK(index.from_code_point(text, 11) == location{.line = 2, .code_unit = 4, .code_point = 3, .utf16 = 4});
+}
+EVAL_TEST_CASE("upp::line_index from_code_point()");
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include "bugspray.hpp"
+
+#include <uni-cpp/ranges.hpp>
+
+#include <string>
+#include <string_view>
+#include <ranges>
+#include <vector>
+
+namespace
+{
+    template<upp::line_break_policy Policy = upp::line_break_policy::unicode>
+    [[nodiscard]] constexpr std::vector<std::u8string> split(std::u8string_view str)
+    {
+        std::vector<std::u8string> result;
+
+        for (const auto line : str | upp::views::mark_as_valid_utf8 | upp::views::lines<upp::encoding::utf8, Policy>)
+            result.emplace_back(line.begin(), line.end());
+
+        return result;
+    }
+
+    using lines = std::vector<std::u8string>;
+} // namespace
+
+TEST_CASE("upp::views::lines", "[lines][ranges]")
+{
+    CHECK(split(u8"").empty());
+    CHECK(split(u8"abc") == lines{u8"abc"});
+    CHECK(split(u8"\n") == lines{u8""});
+
+    // A line break at the end doesn't start another line
+    CHECK(split(u8"a\nb\n") == lines{u8"a", u8"b"});
+    CHECK(split(u8"a\n\nb") == lines{u8"a", u8"", u8"b"});
+
+    // CR LF is a single line break, a lone CR is one too
+    CHECK(split(u8"a\r\nb\rc\n\rd") == lines{u8"a", u8"b", u8"c", u8"", u8"d"});
+
+    // NEL, LS and PS, also within long lines that are scanned a word at a time
+    CHECK(split(u8"first line\u0085second\u2028third line of text\u2029\u00E9\u2027\U0001F600") ==
+          lines{u8"first line", u8"second", u8"third line of text", u8"\u00E9\u2027\U0001F600"});
+
+    // Other characters that share code units with NEL, LS and PS
+    CHECK(split(u8"\u00C2\u0105\u20AC\u2030") == lines{u8"\u00C2\u0105\u20AC\u2030"});
+
+    // Policies
+    CHECK(split<upp::line_break_policy::lf>(u8"a\r\nb\rc\u2028d") == lines{u8"a\r", u8"b\rc\u2028d"});
+    CHECK(split<upp::line_break_policy::ascii>(u8"a\r\nb\rc\u2028d\u0085") == lines{u8"a", u8"b", u8"c\u2028d\u0085"});
+}
+EVAL_TEST_CASE("upp::views::lines");
+
+TEST_CASE("upp::views::lines with UTF-16 and UTF-32", "[lines][ranges]")
+{
+    using namespace std::string_view_literals;
+
+    const auto utf16 = u"abcdefgh\r\nijk\u2029\u0085\u2028l"sv | upp::views::mark_as_valid_utf16 | upp::views::lines_utf16;
+
+    CHECK(std::ranges::distance(utf16) == 5);
+    CHECK(std::ranges::equal(*utf16.begin(), u"abcdefgh"sv));
+    CHECK(std::ranges::equal(*std::ranges::next(utf16.begin()), u"ijk"sv));
+    CHECK(std::ranges::equal(*std::ranges::next(utf16.begin(), 4), u"l"sv));
+
+    const auto utf32 = U"a\U0001F600\nb\u2028"sv | upp::views::mark_as_valid_utf32 | upp::views::lines<upp::encoding::utf32>;
+
+    CHECK(std::ranges::distance(utf32) == 2);
+    CHECK(std::ranges::equal(*utf32.begin(), U"a\U0001F600"sv));
+}
+EVAL_TEST_CASE("upp::views::lines with UTF-16 and UTF-32");
+
+TEST_CASE("upp::ranges::count_lines", "[lines][ranges]")
+{
+    using namespace std::string_view_literals;
+
+    constexpr auto text = u8"GET / HTTP/1.1\r\nHost: example.com\r\n\r\nbody\u2028text"sv;
+
+    CHECK(upp::ranges::count_lines<upp::encoding::utf8>(u8""sv | upp::views::mark_as_valid_utf8) == 0);
+    CHECK(upp::ranges::count_lines<upp::encoding::utf8>(text | upp::views::mark_as_valid_utf8) == 5);
+    CHECK(upp::ranges::count_lines<upp::encoding::utf16>(u"a\u0085b\r"sv | upp::views::mark_as_valid_utf16) == 2);
+
+    // Line feeds only, counted a word at a time
+    CHECK(upp::ranges::count_lines<upp::encoding::utf8, upp::line_break_policy::lf>(text | upp::views::mark_as_valid_utf8) == 4);
+    CHECK(upp::ranges::count_lines<upp::encoding::utf8, upp::line_break_policy::lf>(u8"a\nb\n"sv | upp::views::mark_as_valid_utf8) == 2);
+
+    // A range that is not contiguous
+    auto filtered = text | std::views::filter([](char8_t) { return true; }) | upp::views::mark_as_valid_utf8;
+
+    CHECK(upp::ranges::count_lines<upp::encoding::utf8>(filtered) == 5);
+    CHECK(upp::ranges::count_lines<upp::encoding::utf8, upp::line_break_policy::lf>(filtered) == 4);
+    CHECK(std::ranges::distance(filtered | upp::views::lines_utf8) == 5);
+}
+EVAL_TEST_CASE("upp::ranges::count_lines");
\ No newline at end of file
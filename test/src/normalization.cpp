@@ -0,0 +1,312 @@
+#include "bugspray.hpp"
+
+#include <uni-cpp/normalization.hpp>
+#include <uni-cpp/string.hpp>
+#include <uni-cpp/ranges.hpp>
+
+#include "test_data.hpp"
+
+#include <string>
+#include <string_view>
+#include <ranges>
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using upp::normalization_form;
+
+    template<normalization_form Form>
+    [[nodiscard]] std::u32string normalize_code_points(std::u32string_view code_points)
+    {
+        return upp::utf32_string::from_utf32_unchecked(code_points).normalize<Form>().underlying();
+    }
+
+    template<normalization_form Form>
+    [[nodiscard]] std::u32string normalize_utf8(std::u32string_view code_points)
+    {
+        const auto normalized = upp::ustring::from_utf32_unchecked(code_points).normalize<Form>();
+
+        return normalized.transcode<upp::encoding::utf32>().underlying();
+    }
+
+    template<normalization_form Form>
+    [[nodiscard]] std::u32string normalize_view(std::u32string_view code_points)
+    {
+        return code_points | upp::views::mark_as_valid_utf32 | upp::views::decode_valid_utf32 | upp::views::normalize<Form> |
+               upp::views::encode_as_utf32 | std::ranges::to<std::u32string>();
+    }
+
+    [[nodiscard]] std::u32string to_u32string(const std::vector<std::uint32_t>& code_points)
+    {
+        std::u32string result;
+
+        for (const std::uint32_t code_point : code_points)
+            result.push_back(static_cast<char32_t>(code_point));
+
+        return result;
+    }
+} // namespace
+
+TEST_CASE("Canonical decompositions", "[normalization]", runtime)
+{
+    const auto test_data = upp_test::load_test_data<std::uint32_t>("canonical_decompositions.txt");
+
+    for (const auto& [code_point, decomposition] : test_data)
+    {
+        const std::u32string input{static_cast<char32_t>(code_point)};
+
+        CHECK(normalize_code_points<normalization_form::nfd>(input) == to_u32string(decomposition));
+        CHECK_FALSE(upp::utf32_string::from_utf32_unchecked(input).is_normalized<normalization_form::nfd>());
+    }
+}
+
+TEST_CASE("Compatibility decompositions", "[normalization]", runtime)
+{
+    const auto test_data = upp_test::load_test_data<std::uint32_t>("compatibility_decompositions.txt");
+
+    for (const auto& [code_point, decomposition] : test_data)
+    {
+        const std::u32string input{static_cast<char32_t>(code_point)};
+
+        CHECK(normalize_code_points<normalization_form::nfkd>(input) == to_u32string(decomposition));
+        CHECK_FALSE(upp::utf32_string::from_utf32_unchecked(input).is_normalized<normalization_form::nfkd>());
+    }
+}
+
+TEST_CASE("Primary compositions", "[normalization]", runtime)
+{
+    const auto test_data = upp_test::load_test_data<std::uint32_t>("compositions.txt");
+
+    for (const auto& [composite, pair] : test_data)
+    {
+        REQUIRE(pair.size() == 2);
+
+        const std::u32string expected{static_cast<char32_t>(composite)};
+
+        CHECK(normalize_code_points<normalization_form::nfc>(to_u32string(pair)) == expected);
+        CHECK(normalize_code_points<normalization_form::nfc>(expected) == expected);
+        CHECK(upp::utf32_string::from_utf32_unchecked(expected).is_normalized<normalization_form::nfc>());
+    }
+}
+
+TEST_CASE("Canonical_Combining_Class & quick check properties", "[normalization]", runtime)
+{
+    const auto test_data = upp_test::load_test_data<std::uint32_t>("normalization_properties.txt");
+
+    constexpr std::uint32_t no = 2;
+
+    for (const auto& [code_point, data] : test_data)
+    {
+        REQUIRE(data.size() == 3);
+
+        if (!upp::is_valid_usv(code_point))
+            continue;
+
+        const auto string = upp::utf32_string::from_utf32_unchecked(std::u32string{static_cast<char32_t>(code_point)});
+
+        // A single code point is in NFC or NFKC unless its quick check property is `No`.
+        CHECK(string.is_normalized<normalization_form::nfc>() == (data[1] != no));
+        CHECK(string.is_normalized<normalization_form::nfkc>() == (data[2] != no));
+
+        if (!string.is_normalized<normalization_form::nfd>())
+            continue;
+
+        // U+0334 COMBINING TILDE OVERLAY has the lowest non-zero combining class (1).
+        const std::u32string input{static_cast<char32_t>(code_point), U'\u0334'};
+        const std::u32string reordered{U'\u0334', static_cast<char32_t>(code_point)};
+
+        CHECK(normalize_code_points<normalization_form::nfd>(input) == (data[0] > 1 ? reordered : input));
+    }
+}
+
+// The conformance test of UAX #15. Every line has five columns c1 to c5, and:
+// - NFC:  c2 == toNFC(c1) == toNFC(c2) == toNFC(c3),  c4 == toNFC(c4) == toNFC(c5)
+// - NFD:  c3 == toNFD(c1) == toNFD(c2) == toNFD(c3),  c5 == toNFD(c4) == toNFD(c5)
+// - NFKC: c4 == toNFKC(c1) == toNFKC(c2) == toNFKC(c3) == toNFKC(c4) == toNFKC(c5)
+// - NFKD: c5 == toNFKD(c1) == toNFKD(c2) == toNFKD(c3) == toNFKD(c4) == toNFKD(c5)
+// Code points that aren't listed in part 1 are unchanged by all forms.
+TEST_CASE("NormalizationTest.txt", "[normalization][string types][ranges]", runtime)
+{
+    const auto lines = upp_test::load_ucd_test_file("NormalizationTest.txt");
+
+    REQUIRE(!lines.empty());
+
+    constexpr std::array<std::size_t, 5> nfc_expected{1, 1, 1, 3, 3};
+    constexpr std::array<std::size_t, 5> nfd_expected{2, 2, 2, 4, 4};
+
+    std::vector<bool> listed_in_part_1(0x10FFFF + 1);
+
+    bool in_part_1 = false;
+
+    for (const std::string& line : lines)
+    {
+        if (line.starts_with('@'))
+        {
+            in_part_1 = line.starts_with("@Part1");
+            continue;
+        }
+
+        std::array<std::u32string, 5> columns;
+
+        for (std::size_t i = 0; const auto field : std::views::split(line, ';') | std::views::take(5))
+            columns[i++] = upp_test::parse_code_points(std::string_view{field});
+
+        if (in_part_1)
+            listed_in_part_1[columns[0][0]] = true;
+
+        for (std::size_t i = 0; i < columns.size(); ++i)
+        {
+            CHECK(normalize_utf8<normalization_form::nfc>(columns[i]) == columns[nfc_expected[i]]);
+            CHECK(normalize_utf8<normalization_form::nfd>(columns[i]) == columns[nfd_expected[i]]);
+            CHECK(normalize_utf8<normalization_form::nfkc>(columns[i]) == columns[3]);
+            CHECK(normalize_utf8<normalization_form::nfkd>(columns[i]) == columns[4]);
+
+            CHECK(normalize_view<normalization_form::nfc>(columns[i]) == columns[nfc_expected[i]]);
+            CHECK(normalize_view<normalization_form::nfd>(columns[i]) == columns[nfd_expected[i]]);
+            CHECK(normalize_view<normalization_form::nfkc>(columns[i]) == columns[3]);
+            CHECK(normalize_view<normalization_form::nfkd>(columns[i]) == columns[4]);
+        }
+    }
+
+    for (std::uint32_t code_point = 0; code_point <= 0x10FFFF; ++code_point)
+    {
+        if (listed_in_part_1[code_point] || (code_point >= 0xD800 && code_point <= 0xDFFF))
+            continue;
+
+        const std::u32string unchanged(1, static_cast<char32_t>(code_point));
+
+        CHECK(normalize_utf8<normalization_form::nfc>(unchanged) == unchanged);
+        CHECK(normalize_utf8<normalization_form::nfd>(unchanged) == unchanged);
+        CHECK(normalize_utf8<normalization_form::nfkc>(unchanged) == unchanged);
+        CHECK(normalize_utf8<normalization_form::nfkd>(unchanged) == unchanged);
+    }
+}
+
+TEST_CASE("upp::basic_ustring::normalize()", "[normalization][string types]")
+{
+    const auto normalize = []<normalization_form Form>(std::u8string_view str, upp::nontype_t<Form>) {
+        return upp::ustring::from_utf8_unchecked(str).normalize<Form>().underlying();
+    };
+
+    constexpr auto nfc  = upp::nontype<normalization_form::nfc>;
+    constexpr auto nfd  = upp::nontype<normalization_form::nfd>;
+    constexpr auto nfkc = upp::nontype<normalization_form::nfkc>;
+    constexpr auto nfkd = upp::nontype<normalization_form::nfkd>;
+
+    // Already normalized
+    CHECK(normalize(u8"", nfc) == u8"");
+    CHECK(normalize(u8"plain ASCII text", nfkd) == u8"plain ASCII text");
+    CHECK(normalize(u8"caf\u00E9", nfc) == u8"caf\u00E9");
+
+    // Composition and decomposition
+    CHECK(normalize(u8"cafe\u0301", nfc) == u8"caf\u00E9");
+    CHECK(normalize(u8"caf\u00E9", nfd) == u8"cafe\u0301");
+
+    // Canonical ordering: U+0323 COMBINING DOT BELOW (220) goes before U+0302 COMBINING CIRCUMFLEX ACCENT (230)
+    CHECK(normalize(u8"a\u0302\u0323", nfd) == u8"a\u0323\u0302");
+    CHECK(normalize(u8"e\u0302\u0323 e\u0323\u0302 \u00EA\u0323 \u1EB9\u0302", nfc) == u8"\u1EC7 \u1EC7 \u1EC7 \u1EC7");
+
+    // A starter that is unchanged by NFC on its own still has to be decomposed when it is followed by combining marks
+    CHECK(normalize(u8"\u00E9\u0323", nfc) == u8"\u1EB9\u0301");
+
+    // U+0301 is blocked from "a" by U+0305 COMBINING OVERLINE, which has the same combining class (230)
+    CHECK(normalize(u8"a\u0305\u0301", nfc) == u8"a\u0305\u0301");
+    CHECK(normalize(u8"a\u0323\u0301", nfc) == u8"\u1EA1\u0301");
+
+    // Composition exclusions and singletons
+    CHECK(normalize(u8"\u0958", nfc) == u8"\u0915\u093C");
+    CHECK(normalize(u8"\u212B", nfc) == u8"\u00C5");
+
+    // Hangul
+    CHECK(normalize(u8"\uD55C", nfd) == u8"\u1112\u1161\u11AB");
+    CHECK(normalize(u8"\u1112\u1161\u11AB", nfc) == u8"\uD55C");
+    CHECK(normalize(u8"\u1112\u1161", nfc) == u8"\uD558");
+    CHECK(normalize(u8"\uD558\u11AB", nfc) == u8"\uD55C");
+
+    // Compatibility forms (examples from UAX #15)
+    CHECK(normalize(u8"\uFB01 \u2460 x\u00B2", nfkc) == u8"fi 1 x2");
+    CHECK(normalize(u8"\u1E9B\u0323", nfc) == u8"\u1E9B\u0323");
+    CHECK(normalize(u8"\u1E9B\u0323", nfd) == u8"\u017F\u0323\u0307");
+    CHECK(normalize(u8"\u1E9B\u0323", nfkc) == u8"\u1E69");
+    CHECK(normalize(u8"\u1E9B\u0323", nfkd) == u8"s\u0323\u0307");
+
+    // Leading combining mark
+    CHECK(normalize(u8"\u0301e\u0301", nfc) == u8"\u0301\u00E9");
+
+    // Other encodings
+    CHECK(upp::utf16_string::from_utf16_unchecked(std::u16string_view{u"cafe\u0301 \U0001D15E"}).normalize<normalization_form::nfc>().underlying() ==
+          u"caf\u00E9 \U0001D157\U0001D165");
+    CHECK(upp::utf32_string::from_utf32_unchecked(std::u32string_view{U"cafe\u0301"}).normalize<normalization_form::nfc>().underlying() ==
+          U"caf\u00E9");
+}
+EVAL_TEST_CASE("upp::basic_ustring::normalize()");
+
+TEST_CASE("upp::basic_ustring::normalize() moves normalized rvalues", "[normalization][string types]")
+{
+    auto string = upp::ustring::from_utf8_unchecked(std::u8string_view{u8"a long enough string that is already in NFC: \u00E9"});
+
+    const auto* data = string.underlying().data();
+
+    const auto result = std::move(string).normalize<normalization_form::nfc>();
+
+    CHECK(result.underlying().data() == data);
+}
+EVAL_TEST_CASE("upp::basic_ustring::normalize() moves normalized rvalues");
+
+TEST_CASE("upp::basic_ustring::is_normalized()", "[normalization][string types]")
+{
+    const auto is_normalized = []<normalization_form Form>(std::u8string_view str, upp::nontype_t<Form>) {
+        return upp::ustring::from_utf8_unchecked(str).is_normalized<Form>();
+    };
+
+    constexpr auto nfc  = upp::nontype<normalization_form::nfc>;
+    constexpr auto nfd  = upp::nontype<normalization_form::nfd>;
+    constexpr auto nfkc = upp::nontype<normalization_form::nfkc>;
+
+    CHECK(is_normalized(u8"", nfc));
+    CHECK(is_normalized(u8"caf\u00E9", nfc));
+    CHECK_FALSE(is_normalized(u8"caf\u00E9", nfd));
+    CHECK_FALSE(is_normalized(u8"cafe\u0301", nfc));
+    CHECK(is_normalized(u8"cafe\u0301", nfd));
+
+    // The quick check is inconclusive ("maybe") for U+0301, but it doesn't compose with "x".
+    CHECK(is_normalized(u8"x\u0301", nfc));
+
+    CHECK_FALSE(is_normalized(u8"a\u0302\u0323", nfd));
+    CHECK_FALSE(is_normalized(u8"\uFB01", nfkc));
+    CHECK(is_normalized(u8"\uFB01", nfc));
+}
+EVAL_TEST_CASE("upp::basic_ustring::is_normalized()");
+
+TEST_CASE("upp::views::normalize", "[normalization][ranges]")
+{
+    using namespace std::string_view_literals;
+
+    const auto normalize = []<normalization_form Form>(std::u32string_view str, upp::nontype_t<Form>) {
+        return str | upp::views::mark_as_valid_utf32 | upp::views::decode_valid_utf32 | upp::views::normalize<Form> | upp::views::encode_as_utf32 |
+               std::ranges::to<std::u32string>();
+    };
+
+    constexpr auto nfc  = upp::nontype<normalization_form::nfc>;
+    constexpr auto nfd  = upp::nontype<normalization_form::nfd>;
+    constexpr auto nfkc = upp::nontype<normalization_form::nfkc>;
+    constexpr auto nfkd = upp::nontype<normalization_form::nfkd>;
+
+    CHECK(normalize(U""sv, nfc) == U"");
+    CHECK(normalize(U"abc"sv, nfc) == U"abc");
+    CHECK(normalize(U"cafe\u0301!"sv, nfc) == U"caf\u00E9!");
+    CHECK(normalize(U"caf\u00E9!"sv, nfd) == U"cafe\u0301!");
+    CHECK(normalize(U"e\u0302\u0323x"sv, nfc) == U"\u1EC7x");
+    CHECK(normalize(U"\uD55C\uAE00"sv, nfd) == U"\u1112\u1161\u11AB\u1100\u1173\u11AF");
+    CHECK(normalize(U"\uFB01"sv, nfkc) == U"fi");
+    CHECK(normalize(U"\u0301\u0334"sv, nfkd) == U"\u0334\u0301");
+
+    const auto utf8 = u8"A\u030A"sv | upp::views::mark_as_valid_utf8 | upp::views::decode_valid_utf8;
+
+    CHECK(std::ranges::equal(utf8 | upp::views::normalize_nfc, U"\u00C5"sv, {}, &upp::uchar::value));
+    CHECK(std::ranges::equal(utf8 | upp::views::normalize_nfd, U"A\u030A"sv, {}, &upp::uchar::value));
+}
+EVAL_TEST_CASE("upp::views::normalize");
\ No newline at end of file
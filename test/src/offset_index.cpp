@@ -0,0 +1,77 @@
+#include "bugspray.hpp"
+
+#include <uni-cpp/offset_index.hpp>
+#include <uni-cpp/string.hpp>
+#include <uni-cpp/ranges.hpp>
+
+#include <string>
+#include <string_view>
+
+TEST_CASE("upp::offset_index", "[offset index]")
+{
+    using namespace std::string_view_literals;
+
+    // 'a', U+00E9, U+4E16 and U+1F600 take 1, 2, 3 and 4 UTF-8 code units, and 1, 1, 1 and 2 UTF-16 code units
+    auto text = upp::ustring::from_utf8_unchecked(u8"a\u00E9\u4E16\U0001F600 a\u00E9\u4E16\U0001F600 a\u00E9\u4E16\U0001F600"sv);
+
+    const upp::offset_index<upp::encoding::utf8> index{text, 3};
+
+    using position = upp::offset_index<upp::encoding::utf8>::position;
+
+    CHECK(index.end() == position{.code_unit = 32, .code_point = 14, .utf16 = 17});
+
+    CHECK(index.from_code_unit(text, 0) == position{});
+    CHECK(index.from_code_unit(text, 11) == position{.code_unit = 11, .code_point = 5, .utf16 = 6});
+    CHECK(index.from_code_point(text, 9) == position{.code_unit = 21, .code_point = 9, .utf16 = 11});
+    CHECK(index.from_utf16(text, 16) == position{.code_unit = 28, .code_point = 13, .utf16 = 15});
+    CHECK(index.from_utf16(text, 17) == index.end());
+
+    // Offsets inside of a code point resolve to its beginning
+    CHECK(index.from_code_unit(text, 8) == position{.code_unit = 6, .code_point = 3, .utf16 = 3});
+    CHECK(index.from_utf16(text, 4) == position{.code_unit = 6, .code_point = 3, .utf16 = 3});
+
+    const auto view = u8"a\u00E9\u4E16\U0001F600"sv | upp::views::mark_as_valid_utf8;
+
+    const upp::offset_index<upp::encoding::utf8> view_index{view};
+
+    CHECK(view_index.from_code_point(view, 3) == position{.code_unit = 6, .code_point = 3, .utf16 = 3});
+}
+EVAL_TEST_CASE("upp::offset_index");
+
+TEST_CASE("upp::offset_index update()", "[offset index]")
+{
+    using namespace std::string_view_literals;
+
+    std::u8string code_units = u8"0123456789 \u00E9\u00E9\u00E9 0123456789 \U0001F600\U0001F600 0123456789";
+
+    upp::offset_index<upp::encoding::utf8> index{code_units | upp::views::mark_as_valid_utf8, 4};
+
+    // Replace the second group of digits with a single U+4E16
+    code_units.replace(18, 10, u8"\u4E16");
+    index.update(code_units | upp::views::mark_as_valid_utf8, 18, 10, 3);
+
+    const upp::offset_index<upp::encoding::utf8> rebuilt{code_units | upp::views::mark_as_valid_utf8, 4};
+
+    CHECK(index.end() == rebuilt.end());
+
+    for (std::size_t offset = 0; offset <= rebuilt.end().utf16; ++offset)
+    {
+        CHECK(index.from_utf16(code_units | upp::views::mark_as_valid_utf8, offset) ==
+              rebuilt.from_utf16(code_units | upp::views::mark_as_valid_utf8, offset));
+    }
+
+    // Insert at the end
+    code_units += u8"\u00E9!";
+    index.update(code_units | upp::views::mark_as_valid_utf8, code_units.size() - 3, 0, 3);
+
+    CHECK(index.end().code_point == rebuilt.end().code_point + 2);
+    CHECK(index.from_code_point(code_units | upp::views::mark_as_valid_utf8, index.end().code_point - 1).code_unit == code_units.size() - 1);
+
+    const auto utf16 = upp::utf16_string::from_utf8_unchecked(u8"\U0001F600a\U0001F600b"sv);
+
+    const upp::offset_index<upp::encoding::utf16> utf16_index{utf16, 1};
+
+    CHECK(utf16_index.from_code_point(utf16, 2).code_unit == 3);
+    CHECK(utf16_index.from_code_unit(utf16, 4).code_point == 2);
+}
+EVAL_TEST_CASE("upp::offset_index update()");
\ No newline at end of file
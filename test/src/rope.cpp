@@ -0,0 +1,131 @@
+#include "bugspray.hpp"
+
+#include <uni-cpp/rope.hpp>
+#include <uni-cpp/string.hpp>
+#include <uni-cpp/ranges.hpp>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <ranges>
+#include <stdexcept>
+
+TEST_CASE("upp::rope", "[rope]", runtime)
+{
+    using namespace std::string_view_literals;
+
+    // Chunks of at most 8 code units, so that even short texts are split into several chunks
+    using rope = upp::rope<upp::encoding::utf8, 8>;
+
+    const auto text = upp::ustring::from_utf8_unchecked(u8"first line\nsecond \u00E9\u00E9 line\nthird \U0001F600 line"sv);
+
+    rope r{text};
+
+    CHECK(r.size() == text.code_units().size());
+    CHECK(r.code_point_count() == text.code_point_count());
+    CHECK(r.newline_count() == 2);
+    CHECK(std::ranges::distance(r.chunks()) > 1);
+    CHECK(std::ranges::all_of(r.chunks(), [](const auto& chunk) {
+        return !chunk.code_units().empty() && chunk.code_units().size() <= rope::max_chunk_size;
+    }));
+    CHECK(std::ranges::equal(r.flatten().code_units(), text.code_units()));
+
+    // The code units are a valid UTF-8 range, so they can be decoded
+    CHECK(std::ranges::equal(r.code_units(), text.code_units()));
+    CHECK(std::ranges::distance(r.code_units() | upp::views::decode<upp::encoding::utf8>) == static_cast<std::ptrdiff_t>(text.code_point_count()));
+
+    // The metrics of a prefix give the line number of an offset
+    CHECK(r.metrics_before(0) == rope::text_metrics{});
+    CHECK(r.metrics_before(11).newlines == 1);
+    CHECK(r.metrics_before(r.size()) == r.metrics());
+
+    const rope before_edits = r;
+
+    r.insert(6, upp::ustring::from_utf8_unchecked(u8"\u4E16\u754C "sv));
+    r.erase(0, 6);
+    r.append(upp::ustring::from_utf8_unchecked(u8"\n"sv));
+
+    const auto expected = upp::ustring::from_utf8_unchecked(u8"\u4E16\u754C line\nsecond \u00E9\u00E9 line\nthird \U0001F600 line\n"sv);
+
+    CHECK(std::ranges::equal(r.flatten().code_units(), expected.code_units()));
+    CHECK(r.code_point_count() == expected.code_point_count());
+    CHECK(r.newline_count() == 3);
+
+    // Copies share the chunks but aren't affected by edits
+    CHECK(std::ranges::equal(before_edits.flatten().code_units(), text.code_units()));
+
+    const rope line = r.slice(12, 17);
+
+    CHECK(std::ranges::equal(line.flatten().code_units(), u8"second \u00E9\u00E9 line\n"sv));
+    CHECK(line.newline_count() == 1);
+
+    r.insert(0, line);
+
+    CHECK(r.slice(0, 17) == line);
+    CHECK(r.size() == expected.code_units().size() + line.size());
+
+    // Positions inside a code point are rejected, and the rope is left unchanged
+    rope edited = before_edits;
+
+    CHECK_THROWS_AS(edited.insert(19, upp::ustring::from_utf8_unchecked(u8"x"sv)), std::invalid_argument);
+    CHECK_THROWS_AS(edited.erase(19), std::invalid_argument);
+    CHECK_THROWS_AS(edited.erase(18, 1), std::invalid_argument);
+    CHECK_THROWS_AS(static_cast<void>(edited.slice(0, 19)), std::invalid_argument);
+    CHECK(edited == before_edits);
+
+    r.erase(0);
+
+    CHECK(r.empty());
+    CHECK(r.metrics() == rope::text_metrics{});
+    CHECK(r.flatten().code_units().empty());
+}
+
+TEST_CASE("upp::rope merges short chunks", "[rope]", runtime)
+{
+    using namespace std::string_view_literals;
+
+    // Chunks of 8 to 16 code units
+    using rope = upp::rope<upp::encoding::utf8, 16, 8>;
+
+    std::u8string expected(200, u8'x');
+
+    rope r{upp::ustring::from_utf8_unchecked(expected)};
+
+    const auto is_boundary = [&](const std::size_t pos) { return pos == expected.size() || (expected[pos] & 0xC0) != 0x80; };
+
+    // Small edits all over the text, which would otherwise leave short chunks behind
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        std::size_t pos = (i * 37) % (expected.size() + 1);
+
+        while (!is_boundary(pos))
+            ++pos;
+
+        if (i % 3 == 0)
+        {
+            std::size_t end = std::min(pos + 1 + i % 5, expected.size());
+
+            while (!is_boundary(end))
+                ++end;
+
+            r.erase(pos, end - pos);
+            expected.erase(pos, end - pos);
+        }
+        else
+        {
+            r.insert(pos, upp::ustring::from_utf8_unchecked(u8"\u00E9y"sv));
+            expected.insert(pos, u8"\u00E9y"sv);
+        }
+    }
+
+    CHECK(std::ranges::equal(r.flatten().code_units(), expected));
+
+    // Every chunk but the first and the last one is at least min_chunk_size code units long
+    const auto chunks = r.chunks();
+    const auto count  = std::ranges::distance(chunks);
+
+    CHECK(std::ranges::all_of(chunks | std::views::drop(1) | std::views::take(count - 2),
+                              [](const auto& chunk) { return chunk.size() >= rope::min_chunk_size; }));
+    CHECK(std::ranges::all_of(chunks, [](const auto& chunk) { return !chunk.empty() && chunk.size() <= rope::max_chunk_size; }));
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+#include "bugspray.hpp"
+
+#include <uni-cpp/ranges.hpp>
+#include <uni-cpp/uchar.hpp>
+
+#include <string>
+#include <string_view>
+#include <ranges>
+#include <vector>
+
+namespace
+{
+    template<typename Range>
+    [[nodiscard]] constexpr std::vector<std::u8string> to_strings(Range&& fields)
+    {
+        std::vector<std::u8string> result;
+
+        for (const auto field : fields)
+            result.emplace_back(field.begin(), field.end());
+
+        return result;
+    }
+
+    using fields = std::vector<std::u8string>;
+} // namespace
+
+TEST_CASE("upp::views::split_on", "[split][ranges]")
+{
+    using namespace std::string_view_literals;
+    using namespace upp::char_literals;
+
+    constexpr auto split_on_comma = upp::views::split_on<upp::encoding::utf8>(U'\u3001'_uc);
+
+    CHECK(to_strings(u8""sv | upp::views::mark_as_valid_utf8 | split_on_comma).empty());
+    CHECK(to_strings(u8"abc"sv | upp::views::mark_as_valid_utf8 | split_on_comma) == fields{u8"abc"});
+
+    // Adjacent delimiters and delimiters at either end produce empty fields
+    CHECK(to_strings(u8"\u6771\u4EAC\u3001\u5927\u962A\u3001\u3001\u4EAC\u90FD"sv | upp::views::mark_as_valid_utf8 | split_on_comma) ==
+          fields{u8"\u6771\u4EAC", u8"\u5927\u962A", u8"", u8"\u4EAC\u90FD"});
+    CHECK(to_strings(u8"\u3001a\u3001"sv | upp::views::mark_as_valid_utf8 | split_on_comma) == fields{u8"", u8"a", u8""});
+
+    // Code points that share code units with the delimiter
+    CHECK(to_strings(u8"\u3002\u3001\u4001\u3001\u3000"sv | upp::views::mark_as_valid_utf8 | split_on_comma) ==
+          fields{u8"\u3002", u8"\u4001", u8"\u3000"});
+
+    CHECK(to_strings(upp::views::split_on<upp::encoding::utf8>(u8"a,b,c"sv | upp::views::mark_as_valid_utf8, U','_uc)) ==
+          fields{u8"a", u8"b", u8"c"});
+}
+EVAL_TEST_CASE("upp::views::split_on");
+
+TEST_CASE("upp::views::split_on_any", "[split][ranges]")
+{
+    using namespace std::string_view_literals;
+    using namespace upp::char_literals;
+
+    const auto text = u8"a,b\u00A6c;\U0001F600,,d\u00A7"sv | upp::views::mark_as_valid_utf8;
+
+    CHECK(to_strings(text | upp::views::split_on_any<upp::encoding::utf8>({U','_uc, U'\u00A6'_uc, U';'_uc})) ==
+          fields{u8"a", u8"b", u8"c", u8"\U0001F600", u8"", u8"d\u00A7"});
+
+    CHECK(to_strings(text | upp::views::split_on_any<upp::encoding::utf8>({U'\U0001F600'_uc, U'\u00A7'_uc})) ==
+          fields{u8"a,b\u00A6c;", u8",,d", u8""});
+}
+EVAL_TEST_CASE("upp::views::split_on_any");
+
+TEST_CASE("upp::views::split_whitespace", "[split][ranges]")
+{
+    using namespace std::string_view_literals;
+
+    constexpr auto words = [](std::u8string_view str) {
+        return to_strings(str | upp::views::mark_as_valid_utf8 | upp::views::split_whitespace<upp::encoding::utf8>);
+    };
+
+    CHECK(words(u8"").empty());
+    CHECK(words(u8" \t\n ").empty());
+    CHECK(words(u8"one") == fields{u8"one"});
+
+    // Runs of whitespace, including non-ASCII whitespace, separate words and are skipped at either end
+    CHECK(words(u8"  one\u3000two \t three\u2028\u00A0four\u205F\u1680five\u2009\u0085") ==
+          fields{u8"one", u8"two", u8"three", u8"four", u8"five"});
+
+    // Code points that share code units with whitespace
+    CHECK(words(u8"\u00A1\u00A0\u2010\u1681 \u3001") == fields{u8"\u00A1", u8"\u2010\u1681", u8"\u3001"});
+}
+EVAL_TEST_CASE("upp::views::split_whitespace");
+
+TEST_CASE("upp::views::split_on and split_whitespace with UTF-16, UTF-32 and ranges that are not contiguous", "[split][ranges]")
+{
+    using namespace std::string_view_literals;
+    using namespace upp::char_literals;
+
+    const auto utf16 = u"a\u3001\U0001F600\u3001"sv | upp::views::mark_as_valid_utf16 | upp::views::split_on<upp::encoding::utf16>(U'\u3001'_uc);
+
+    CHECK(std::ranges::distance(utf16) == 3);
+    CHECK(std::ranges::equal(*std::ranges::next(utf16.begin()), u"\U0001F600"sv));
+
+    const auto utf32 = U" a\u2029b\u3000"sv | upp::views::mark_as_valid_utf32 | upp::views::split_whitespace<upp::encoding::utf32>;
+
+    CHECK(std::ranges::distance(utf32) == 2);
+    CHECK(std::ranges::equal(*utf32.begin(), U"a"sv));
+
+    // The shorthands for each encoding
+    CHECK(std::ranges::distance(u"a\u3001b"sv | upp::views::mark_as_valid_utf16 | upp::views::split_on_utf16(U'\u3001'_uc)) == 2);
+    CHECK(std::ranges::distance(U"a,b;c"sv | upp::views::mark_as_valid_utf32 | upp::views::split_on_any_utf32({U','_uc, U';'_uc})) == 3);
+    CHECK(std::ranges::distance(u8" a b "sv | upp::views::mark_as_valid_utf8 | upp::views::split_whitespace_utf8) == 2);
+
+    // A range that is not contiguous
+    constexpr auto text = u8" a,\u00E9 \u00A6b "sv;
+
+    auto filtered = text | std::views::filter([](char8_t) { return true; }) | upp::views::mark_as_valid_utf8;
+
+    CHECK(std::ranges::distance(filtered | upp::views::split_on<upp::encoding::utf8>(U','_uc)) == 2);
+    CHECK(std::ranges::distance(filtered | upp::views::split_on_any<upp::encoding::utf8>({U','_uc, U'\u00A6'_uc})) == 3);
+    CHECK(std::ranges::distance(filtered | upp::views::split_whitespace<upp::encoding::utf8>) == 2);
+}
+EVAL_TEST_CASE("upp::views::split_on and split_whitespace with UTF-16, UTF-32 and ranges that are not contiguous");
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "../bugspray.hpp"
+
+#include <uni-cpp/string.hpp>
+#include <uni-cpp/ranges.hpp>
+
+#include <new>
+#include <ranges>
+#include <string_view>
+
+TEST_CASE("upp::basic_ustring append()", "[string types][Unicode string types]")
+{
+    using namespace std::string_view_literals;
+    using namespace upp::char_literals;
+
+    auto line = upp::ustring::from_utf8_unchecked(u8"[worker 3] "sv);
+
+    line.append(upp::utf16_string::from_utf16_unchecked(u"r\u00E9sum\u00E9 "sv))
+        .append(upp::utf32_string::from_utf32_unchecked(U"\U0001F600 "sv))
+        .append(upp::ascii_string::from_ascii_unchecked("ok"sv))
+        .append(U'\u2713'_uc);
+
+    CHECK(line.underlying() == u8"[worker 3] r\u00E9sum\u00E9 \U0001F600 ok\u2713"sv);
+
+    // Valid code unit views, also ones that aren't contiguous.
+    auto utf16 = upp::utf16_string::from_utf16_unchecked(u"a"sv);
+
+    utf16.append(u8"\u00DF\U0001F600"sv | upp::views::mark_as_valid_utf8);
+    utf16.append(U"x\u00FF"sv | std::views::filter([](char32_t) { return true; }) | upp::views::mark_as_valid_utf32);
+
+    CHECK(utf16.underlying() == u"a\u00DF\U0001F600x\u00FF"sv);
+
+    // The string can be appended to itself.
+    auto twice = upp::utf32_string::from_utf32_unchecked(U"ab\u00E9"sv);
+
+    twice.append(twice);
+
+    CHECK(twice.underlying() == U"ab\u00E9ab\u00E9"sv);
+
+    // So can views of its own code units, although appending moves them.
+    auto echo = upp::ustring::from_utf8_unchecked(u8"caf\u00E9 "sv);
+
+    echo.append(echo.code_units() | upp::views::mark_as_valid_utf8);
+    echo.append(echo.code_units().subspan(6) | upp::views::mark_as_valid_utf8);
+
+    CHECK(echo.underlying() == u8"caf\u00E9 caf\u00E9 caf\u00E9 "sv);
+}
+EVAL_TEST_CASE("upp::basic_ustring append()");
+
+TEST_CASE("upp::basic_ustring append() to an inplace string", "[string types][Unicode string types]")
+{
+    using namespace std::string_view_literals;
+
+    auto tag = upp::inplace_utf8_string<8>::from_utf8_unchecked(u8"ab"sv);
+
+    tag.append(upp::utf16_string::from_utf16_unchecked(u"\u00E9\u00E9"sv));
+
+    CHECK(tag.underlying().size() == 6);
+
+    // A piece that doesn't fit leaves the string unchanged.
+    RUNTIME_CHECK_THROWS_AS(tag.append(upp::utf32_string::from_utf32_unchecked(U"\U0001F600"sv)), std::bad_alloc);
+
+    CHECK(tag.underlying().size() == 6);
+}
+EVAL_TEST_CASE("upp::basic_ustring append() to an inplace string");
+
+TEST_CASE("upp::concat", "[string types][Unicode string types]")
+{
+    using namespace std::string_view_literals;
+    using namespace upp::char_literals;
+
+    const auto user = upp::utf16_string::from_utf16_unchecked(u"Zo\u00EB"sv);
+    const auto tail = upp::utf32_string::from_utf32_unchecked(U" \U0001F600"sv);
+
+    const auto utf8 = upp::concat<upp::encoding::utf8>(upp::ascii_string::from_ascii_unchecked("login: "sv), user, tail, U'!'_uc);
+
+    CHECK(utf8.underlying() == u8"login: Zo\u00EB \U0001F600!"sv);
+
+    const auto utf16 = upp::concat<upp::encoding::utf16>(utf8, u8" and "sv | upp::views::mark_as_valid_utf8, user);
+
+    CHECK(utf16.underlying() == u"login: Zo\u00EB \U0001F600! and Zo\u00EB"sv);
+
+    CHECK(upp::concat<upp::encoding::utf32>().underlying().empty());
+}
+EVAL_TEST_CASE("upp::concat");
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "../bugspray.hpp"
+
+#include <uni-cpp/compact_string.hpp>
+#include <uni-cpp/string.hpp>
+
+#include <string_view>
+#include <ranges>
+#include <array>
+#include <utility>
+#include <algorithm>
+#include <vector>
+
+static_assert(std::ranges::random_access_range<upp::compact_ustring>);
+static_assert(std::ranges::sized_range<upp::compact_ustring>);
+static_assert(std::ranges::random_access_range<decltype(std::declval<const upp::compact_ustring&>().chars())>);
+
+TEST_CASE("upp::compact_ustring width", "[string types][compact string]")
+{
+    using namespace std::string_view_literals;
+
+    const upp::compact_ustring empty;
+
+    CHECK(empty.empty());
+    CHECK(empty.width() == 1);
+
+    const upp::compact_ustring latin1{upp::ustring::from_utf8_unchecked(u8"na\u00EFve caf\u00E9"sv)};
+
+    CHECK(latin1.width() == 1);
+    CHECK(latin1.size() == 10);
+    CHECK(latin1[2] == upp::uchar::from_unchecked(0xEF));
+    CHECK(latin1.back() == upp::uchar::from_unchecked(0xE9));
+
+    const upp::compact_ustring bmp{upp::utf16_string::from_utf8_unchecked(u8"\u0394\u03B5\u03BB\u03C4\u03B1 \u4E16\u754C"sv)};
+
+    CHECK(bmp.width() == 2);
+    CHECK(bmp.size() == 8);
+    CHECK(bmp[6] == upp::uchar::from_unchecked(0x4E16));
+
+    const upp::compact_ustring supplementary{upp::utf32_string::from_utf8_unchecked(u8"a\U0001F600b"sv)};
+
+    CHECK(supplementary.width() == 4);
+    CHECK(supplementary.size() == 3);
+    CHECK(supplementary[1] == upp::uchar::from_unchecked(0x1F600));
+    CHECK(supplementary.front() == upp::uchar::from_unchecked('a'));
+}
+EVAL_TEST_CASE("upp::compact_ustring width");
+
+TEST_CASE("upp::compact_ustring from_utf8(), from_utf16() and from_utf32()", "[string types][compact string]")
+{
+    using namespace std::string_view_literals;
+
+    const auto utf8 = upp::compact_ustring::from_utf8(u8"caf\u00E9 \U0001F600"sv);
+
+    REQUIRE(utf8.has_value());
+    CHECK(utf8->width() == 4);
+    CHECK(utf8->size() == 6);
+
+    const auto utf16 = upp::compact_ustring::from_utf16(u"caf\u00E9 \U0001F600"sv);
+
+    REQUIRE(utf16.has_value());
+    CHECK(*utf16 == *utf8);
+
+    const auto utf32 = upp::compact_ustring::from_utf32(U"caf\u00E9"sv);
+
+    REQUIRE(utf32.has_value());
+    CHECK(utf32->width() == 1);
+    CHECK(*utf32 < *utf8);
+
+    const auto invalid = upp::compact_ustring::from_utf8("ab\xFF"sv);
+
+    REQUIRE(!invalid.has_value());
+    CHECK(invalid.error().valid_up_to == 2);
+}
+EVAL_TEST_CASE("upp::compact_ustring from_utf8(), from_utf16() and from_utf32()");
+
+TEST_CASE("upp::compact_ustring to_ustring() and substr()", "[string types][compact string]")
+{
+    using namespace std::string_view_literals;
+
+    const upp::compact_ustring string{upp::ustring::from_utf8_unchecked(u8"Gr\u00FC\u00DFe, \u4E16\u754C \U0001F600!"sv)};
+
+    CHECK(std::ranges::equal(string.to_ustring().code_units(), u8"Gr\u00FC\u00DFe, \u4E16\u754C \U0001F600!"sv));
+    CHECK(std::ranges::equal(string.to_ustring<upp::encoding::utf16>().code_units(), u"Gr\u00FC\u00DFe, \u4E16\u754C \U0001F600!"sv));
+    CHECK(std::ranges::equal(string.to_ustring<upp::encoding::utf32>().code_units(), U"Gr\u00FC\u00DFe, \u4E16\u754C \U0001F600!"sv));
+
+    // Runs of ASCII longer than a word, and containers without resize_and_overwrite() or with cached metadata
+    const upp::compact_ustring latin1{upp::ustring::from_utf8_unchecked(u8"caf\u00E9 au lait, cr\u00E8me br\u00FBl\u00E9e"sv)};
+
+    CHECK(std::ranges::equal(latin1.to_ustring().code_units(), u8"caf\u00E9 au lait, cr\u00E8me br\u00FBl\u00E9e"sv));
+    CHECK(std::ranges::equal(latin1.to_ustring<upp::encoding::utf16>().code_units(), u"caf\u00E9 au lait, cr\u00E8me br\u00FBl\u00E9e"sv));
+    CHECK(std::ranges::equal(latin1.to_ustring<upp::encoding::utf8, std::vector<char8_t>>().code_units(),
+                             u8"caf\u00E9 au lait, cr\u00E8me br\u00FBl\u00E9e"sv));
+    CHECK(std::ranges::equal(string.to_ustring<upp::encoding::utf16, std::vector<char16_t>>().code_units(),
+                             u"Gr\u00FC\u00DFe, \u4E16\u754C \U0001F600!"sv));
+
+    const auto small = latin1.to_ustring<upp::encoding::utf8, upp::small_text_buffer<char8_t>>();
+
+    CHECK(std::ranges::equal(small.code_units(), u8"caf\u00E9 au lait, cr\u00E8me br\u00FBl\u00E9e"sv));
+    CHECK(small.code_point_count() == latin1.size());
+
+    const auto greeting = string.substr(0, 5);
+
+    CHECK(greeting.size() == 5);
+    CHECK(greeting.width() == string.width());
+    CHECK(std::ranges::equal(greeting.to_ustring().code_units(), u8"Gr\u00FC\u00DFe"sv));
+    CHECK(string.substr(10).size() == 2);
+    CHECK(string.substr(12).empty());
+
+    const auto reversed = string.chars() | std::views::reverse | std::views::take(2);
+
+    CHECK(std::ranges::equal(reversed, std::array{upp::uchar::from_unchecked('!'), upp::uchar::from_unchecked(0x1F600)}));
+}
+EVAL_TEST_CASE("upp::compact_ustring to_ustring() and substr()");
\ No newline at end of file
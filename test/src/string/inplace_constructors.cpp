@@ -0,0 +1,99 @@
+#include "../bugspray.hpp"
+
+#include <uni-cpp/string.hpp>
+
+#include <string_view>
+#include <algorithm>
+
+static_assert(upp::fixed_capacity_container<upp::impl::inplace_vector<char8_t, 8>>);
+static_assert(!upp::fixed_capacity_container<std::u8string>);
+static_assert(upp::string_compatible_container<upp::impl::inplace_vector<char, 8>, upp::encoding::ascii>);
+static_assert(upp::string_compatible_container<upp::impl::inplace_vector<char8_t, 8>, upp::encoding::utf8>);
+static_assert(upp::string_compatible_container<upp::impl::inplace_vector<char16_t, 8>, upp::encoding::utf16>);
+static_assert(upp::string_compatible_container<upp::impl::inplace_vector<char32_t, 8>, upp::encoding::utf32>);
+
+TEST_CASE("upp::inplace_ascii_string from_ascii()", "[string types]")
+{
+    using namespace std::string_view_literals;
+
+    const auto fits = upp::inplace_ascii_string<4>::from_ascii("abcd"sv);
+
+    REQUIRE(fits.has_value());
+    CHECK(std::ranges::equal(fits->underlying(), "abcd"sv));
+
+    const auto too_long = upp::inplace_ascii_string<4>::from_ascii("abcde"sv);
+
+    REQUIRE(!too_long.has_value());
+    CHECK(too_long.error() == upp::from_ascii_error{.valid_up_to = 4, .error = upp::ascii_error{.code = upp::ascii_error_code::capacity_exceeded}});
+
+    // An invalid code unit that fits is reported as such
+    const auto invalid = upp::inplace_ascii_string<4>::from_ascii("ab\x80"sv);
+
+    REQUIRE(!invalid.has_value());
+    CHECK(invalid.error() == upp::from_ascii_error{.valid_up_to = 2, .error = upp::ascii_error{}});
+}
+EVAL_TEST_CASE("upp::inplace_ascii_string from_ascii()");
+
+TEST_CASE("upp::basic_inplace_ustring from_utf()", "[UTF encoding][string types][Unicode string types]")
+{
+    using namespace std::string_view_literals;
+
+    constexpr auto capacity_exceeded = [](const std::size_t valid_up_to) {
+        return upp::from_utf8_error{.valid_up_to = valid_up_to,
+                                    .error       = upp::utf8_error{.length = {std::nullopt}, .code = upp::utf8_error_code::capacity_exceeded}};
+    };
+
+    SECTION("Input that fits")
+    {
+        const auto result = upp::inplace_ustring<8>::from_utf8(u8"ab\u00E9\u4E16"sv);
+
+        REQUIRE(result.has_value());
+        CHECK(std::ranges::equal(result->underlying(), u8"ab\u00E9\u4E16"sv));
+        CHECK(result->underlying().size() == 7);
+    }
+
+    SECTION("Input that doesn't fit is cut at a code point boundary")
+    {
+        // U+00E9 takes two code units, only one is left after "abcdef"
+        const auto result = upp::inplace_ustring<7>::from_utf8(u8"abcdef\u00E9\u00E9"sv);
+
+        REQUIRE(!result.has_value());
+        CHECK(result.error() == capacity_exceeded(6));
+    }
+
+    SECTION("Transcoding input that doesn't fit")
+    {
+        // "abc" and U+00E9 take 5 UTF-8 code units, U+4E16 would need 3 more. `valid_up_to` counts UTF-16 code units.
+        const auto from_utf16 = upp::inplace_ustring<6>::from_utf16(u"abc\u00E9\u4E16"sv);
+
+        REQUIRE(!from_utf16.has_value());
+        CHECK(from_utf16.error() == upp::from_utf16_error{.valid_up_to = 4,
+                                                          .error       = upp::utf16_error{.length = {std::nullopt},
+                                                                                          .code   = upp::utf16_error_code::capacity_exceeded}});
+
+        const auto to_utf16 = upp::inplace_utf16_string<2>::from_utf8(u8"a\U0001F600"sv);
+
+        REQUIRE(!to_utf16.has_value());
+        CHECK(to_utf16.error() == capacity_exceeded(1));
+
+        const auto to_utf32 = upp::inplace_utf32_string<2>::from_utf8(u8"a\U0001F600"sv);
+
+        REQUIRE(to_utf32.has_value());
+        CHECK(std::ranges::equal(to_utf32->underlying(), U"a\U0001F600"sv));
+    }
+
+    SECTION("Encoding errors that come first are reported")
+    {
+        const auto invalid = upp::inplace_ustring<4>::from_utf8(u8"ab\xFF" "cdefgh"sv);
+
+        REQUIRE(!invalid.has_value());
+        CHECK(invalid.error().valid_up_to == 2);
+        CHECK(invalid.error().error.code == upp::utf8_error_code::invalid_leading_byte);
+
+        const auto too_long = upp::inplace_ustring<4>::from_utf8(u8"abcdef\xFF"sv);
+
+        REQUIRE(!too_long.has_value());
+        CHECK(too_long.error() == capacity_exceeded(4));
+    }
+}
+EVAL_TEST_CASE("upp::basic_inplace_ustring from_utf()");
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "../bugspray.hpp"
+
+#include <uni-cpp/string.hpp>
+#include <uni-cpp/ranges.hpp>
+
+#include <algorithm>
+#include <list>
+#include <ranges>
+#include <string_view>
+#include <utility>
+
+TEST_CASE("upp::basic_ustring replace_all()", "[string types][Unicode string types]")
+{
+    using namespace std::string_view_literals;
+    using namespace upp::char_literals;
+
+    const auto text = upp::ustring::from_utf8_unchecked(u8"caf\u00E9\u00A0au\u00A0lait\u00A0"sv);
+
+    // Code points and substrings of the same length and of different lengths
+    CHECK(std::ranges::equal(text.replace_all(U'\u00A0'_uc, U' '_uc).code_units(), u8"caf\u00E9 au lait "sv));
+    CHECK(std::ranges::equal(text.replace_all(U'\u00A0'_uc, U'\u3000'_uc).code_units(), u8"caf\u00E9\u3000au\u3000lait\u3000"sv));
+    CHECK(std::ranges::equal(text.replace_all(U'\u00E9'_uc, u8"e\u0301"sv | upp::views::mark_as_valid_utf8).code_units(),
+                             u8"cafe\u0301\u00A0au\u00A0lait\u00A0"sv));
+    CHECK(std::ranges::equal(text.replace_all(u8"\u00A0au\u00A0"sv | upp::views::mark_as_valid_utf8, U' '_uc).code_units(),
+                             u8"caf\u00E9 lait\u00A0"sv));
+    CHECK(std::ranges::equal(text.replace_all(U'\u00A0'_uc, upp::ustring{}).code_units(), u8"caf\u00E9aulait"sv));
+
+    // Nothing to replace
+    CHECK(std::ranges::equal(text.replace_all(U'x'_uc, U'y'_uc).code_units(), text.code_units()));
+    CHECK(std::ranges::equal(text.replace_all(upp::ustring{}, U'y'_uc).code_units(), text.code_units()));
+
+    // Occurrences don't overlap
+    const auto repeated = upp::utf16_string::from_utf16_unchecked(u"aaaaa"sv);
+
+    CHECK(std::ranges::equal(repeated.replace_all(u"aa"sv | upp::views::mark_as_valid_utf16, U'b'_uc).code_units(), u"bba"sv));
+
+    // In place, and with the replacement stored in the string itself
+    auto moved = text;
+
+    moved = std::move(moved).replace_all(U'\u00A0'_uc, U'\u00E9'_uc);
+
+    CHECK(std::ranges::equal(moved.code_units(), u8"caf\u00E9\u00E9au\u00E9lait\u00E9"sv));
+    CHECK(moved.code_point_count() == 13);
+
+    auto aliased = upp::utf32_string::from_utf32_unchecked(U"ab\U0001F600ab"sv);
+
+    aliased = std::move(aliased).replace_all(U'a'_uc, aliased.code_units().subspan(2, 1) | upp::views::mark_as_valid_utf32);
+
+    CHECK(std::ranges::equal(aliased.code_units(), U"\U0001F600b\U0001F600\U0001F600b"sv));
+}
+EVAL_TEST_CASE("upp::basic_ustring replace_all()");
+
+TEST_CASE("upp::basic_ustring trim()", "[string types][Unicode string types]")
+{
+    using namespace std::string_view_literals;
+
+    const auto text = upp::ustring::from_utf8_unchecked(u8"\u3000 \t\u00E9t\u00E9\u00A0\u2010\n\u2029"sv);
+
+    CHECK(std::ranges::equal(text.trim(), u8"\u00E9t\u00E9\u00A0\u2010"sv));
+    CHECK(std::ranges::equal(text.trim_start(), u8"\u00E9t\u00E9\u00A0\u2010\n\u2029"sv));
+    CHECK(std::ranges::equal(text.trim_end(), u8"\u3000 \t\u00E9t\u00E9\u00A0\u2010"sv));
+
+    // The views refer to the code units of the string
+    CHECK(&*text.trim().begin() == text.code_units().data() + 5);
+
+    const auto blank = upp::utf16_string::from_utf16_unchecked(u" \u0085\u3000"sv);
+
+    CHECK(blank.trim().empty());
+    CHECK(blank.trim_start().empty());
+    CHECK(blank.trim_end().empty());
+
+    const auto supplementary = upp::utf16_string::from_utf16_unchecked(u"\U0001F600\u2028"sv);
+
+    CHECK(std::ranges::equal(supplementary.trim(), u"\U0001F600"sv));
+}
+EVAL_TEST_CASE("upp::basic_ustring trim()");
+
+TEST_CASE("upp::views::trim", "[string types][ranges]")
+{
+    using namespace std::string_view_literals;
+
+    constexpr auto text = U"\t a b\u205F\r\n"sv;
+
+    CHECK(std::ranges::equal(text | upp::views::mark_as_valid_utf32 | upp::views::trim<upp::encoding::utf32>, U"a b"sv));
+    CHECK(std::ranges::equal(text | upp::views::mark_as_valid_utf32 | upp::views::trim_start<upp::encoding::utf32>, U"a b\u205F\r\n"sv));
+    CHECK(std::ranges::equal(text | upp::views::mark_as_valid_utf32 | upp::views::trim_end<upp::encoding::utf32>, U"\t a b"sv));
+
+    // The shorthands for each encoding
+    CHECK(std::ranges::equal(u8" a\u3000"sv | upp::views::mark_as_valid_utf8 | upp::views::trim_utf8, u8"a"sv));
+    CHECK(std::ranges::equal(u" a "sv | upp::views::mark_as_valid_utf16 | upp::views::trim_start_utf16, u"a "sv));
+    CHECK(std::ranges::equal(text | upp::views::mark_as_valid_utf32 | upp::views::trim_end_utf32, U"\t a b"sv));
+
+    // Ranges that are not contiguous
+    constexpr auto           chars = u8"\u00A0x\u00A0 "sv;
+    const std::list<char8_t> code_units(chars.begin(), chars.end());
+
+    CHECK(std::ranges::equal(code_units | upp::views::mark_as_valid_utf8 | upp::views::trim<upp::encoding::utf8>, u8"x"sv));
+}
+EVAL_TEST_CASE("upp::views::trim");
\ No newline at end of file
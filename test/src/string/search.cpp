@@ -0,0 +1,75 @@
+#include "../bugspray.hpp"
+
+#include <uni-cpp/string.hpp>
+#include <uni-cpp/ranges.hpp>
+
+#include <string_view>
+
+TEST_CASE("upp::basic_ustring find()", "[string types][Unicode string types]")
+{
+    using namespace std::string_view_literals;
+    using namespace upp::char_literals;
+
+    const auto text = upp::ustring::from_utf8_unchecked(u8"caf\u00E9 au lait, caf\u00E9 noir, \U0001F600"sv);
+
+    const auto cafe = upp::ustring::from_utf8_unchecked(u8"caf\u00E9"sv);
+    const auto none = upp::ustring::from_utf8_unchecked(u8"th\u00E9"sv);
+
+    CHECK(text.find(cafe) == 0);
+    CHECK(text.find(cafe, 1) == 15);
+    CHECK(text.find(cafe, 16) == upp::ustring::npos);
+    CHECK(text.find(none) == upp::ustring::npos);
+
+    CHECK(text.find(U'\u00E9'_uc) == 3);
+    CHECK(text.find(U'\u00E9'_uc, 4) == 18);
+    CHECK(text.find(U'\U0001F600'_uc) == 27);
+    CHECK(text.find(U'x'_uc) == upp::ustring::npos);
+
+    CHECK(text.rfind(cafe) == 15);
+    CHECK(text.rfind(cafe, 14) == 0);
+    CHECK(text.rfind(U'\u00E9'_uc) == 18);
+    CHECK(text.rfind(U'c'_uc, 0) == 0);
+
+    // An empty needle matches at the starting position.
+    CHECK(text.find(upp::ustring{}, 5) == 5);
+    CHECK(text.rfind(upp::ustring{}) == text.code_units().size());
+
+    // Valid code unit ranges are accepted as needles.
+    CHECK(text.find(u8"noir"sv | upp::views::mark_as_valid_encoding<upp::encoding::utf8>) == 21);
+    CHECK(text.contains(u8"au lait"sv | upp::views::mark_as_valid_encoding<upp::encoding::utf8>));
+
+    CHECK(text.contains(cafe));
+    CHECK(!text.contains(none));
+    CHECK(text.starts_with(cafe));
+    CHECK(!text.starts_with(none));
+    CHECK(text.ends_with(U'\U0001F600'_uc));
+    CHECK(!text.ends_with(cafe));
+
+    CHECK(text.count(cafe) == 2);
+    CHECK(text.count(U'\u00E9'_uc) == 2);
+    CHECK(text.count(none) == 0);
+    CHECK(text.count(upp::ustring{}) == text.code_point_count() + 1);
+}
+EVAL_TEST_CASE("upp::basic_ustring find()");
+
+TEST_CASE("upp::basic_ustring find() in UTF-16 and UTF-32", "[string types][Unicode string types]")
+{
+    using namespace std::string_view_literals;
+    using namespace upp::char_literals;
+
+    const auto utf16 = upp::utf16_string::from_utf16_unchecked(u"\U0001F600a\u00E9\U0001F600 a\u00E9"sv);
+
+    CHECK(utf16.find(U'\U0001F600'_uc) == 0);
+    CHECK(utf16.find(U'\U0001F600'_uc, 1) == 4);
+    CHECK(utf16.rfind(U'a'_uc) == 7);
+    CHECK(utf16.count(U'\u00E9'_uc) == 2);
+    CHECK(utf16.find(upp::utf16_string::from_utf16_unchecked(u" a\u00E9"sv)) == 6);
+
+    const auto utf32 = upp::utf32_string::from_utf32_unchecked(U"abc\U0001F600abc"sv);
+
+    CHECK(utf32.find(U'\U0001F600'_uc) == 3);
+    CHECK(utf32.rfind(upp::utf32_string::from_utf32_unchecked(U"abc"sv)) == 4);
+    CHECK(utf32.count(upp::utf32_string::from_utf32_unchecked(U"abc"sv)) == 2);
+    CHECK(utf32.ends_with(upp::utf32_string::from_utf32_unchecked(U"bc"sv)));
+}
+EVAL_TEST_CASE("upp::basic_ustring find() in UTF-16 and UTF-32");
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include "../bugspray.hpp"
+
+#include <uni-cpp/shared_string.hpp>
+#include <uni-cpp/string.hpp>
+
+#include <string_view>
+#include <functional>
+#include <utility>
+#include <algorithm>
+
+TEST_CASE("upp::shared_ustring", "[string types][shared string]", runtime)
+{
+    using namespace std::string_view_literals;
+
+    using shared = upp::shared_ustring<upp::encoding::utf8>;
+
+    const shared empty;
+
+    CHECK(empty.empty());
+    CHECK(empty.use_count() == 0);
+    CHECK(empty.hash() == std::hash<std::u8string_view>{}(u8""sv));
+
+    const auto text = upp::ustring::from_utf8_unchecked(u8"/api/v1/caf\u00E9"sv);
+
+    const shared route{text};
+
+    CHECK(route.size() == 13);
+    CHECK(route.use_count() == 1);
+    CHECK(route == text);
+    CHECK(route.hash() == std::hash<std::u8string_view>{}(u8"/api/v1/caf\u00E9"sv));
+
+    // Copies share the buffer
+    shared copy = route;
+
+    CHECK(route.use_count() == 2);
+    CHECK(copy.code_units().data() == route.code_units().data());
+    CHECK(copy == route);
+
+    const shared other{upp::ustring::from_utf8_unchecked(u8"/api/v2"sv)};
+
+    copy = other;
+
+    CHECK(route.use_count() == 1);
+    CHECK(other.use_count() == 2);
+    CHECK(route != other);
+    CHECK(route < other);
+
+    const shared moved = std::move(copy);
+
+    CHECK(copy.empty());
+    CHECK(other.use_count() == 2);
+
+    CHECK(std::ranges::equal(route.to_ustring().code_units(), text.code_units()));
+
+    const upp::shared_ustring<upp::encoding::utf16> utf16{upp::utf16_string::from_utf8_unchecked(u8"x\U0001F600"sv)};
+
+    CHECK(utf16.size() == 3);
+    CHECK(std::hash<upp::shared_ustring<upp::encoding::utf16>>{}(utf16) == std::hash<std::u16string_view>{}(u"x\U0001F600"sv));
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include "../bugspray.hpp"
+
+#include <uni-cpp/string.hpp>
+
+#include <string>
+#include <string_view>
+#include <algorithm>
+
+static_assert(upp::string_compatible_container<upp::small_text_buffer<char8_t>, upp::encoding::utf8>);
+static_assert(upp::string_compatible_container<upp::small_text_buffer<char16_t>, upp::encoding::utf16>);
+static_assert(upp::string_compatible_container<upp::small_text_buffer<char>, upp::encoding::ascii>);
+static_assert(upp::reservable_container<upp::small_text_buffer<char8_t>>);
+static_assert(!upp::fixed_capacity_container<upp::small_text_buffer<char8_t>>);
+
+static_assert(upp::small_text_buffer<char8_t>::inline_capacity == 31);
+static_assert(upp::small_text_buffer<char16_t>::inline_capacity == 15);
+static_assert(sizeof(void*) != 8 || sizeof(upp::small_text_buffer<char8_t>) == 32);
+static_assert(sizeof(void*) != 8 || sizeof(upp::small_text_buffer<char16_t>) == 32);
+
+TEST_CASE("upp::small_text_buffer", "[string types]")
+{
+    using buffer = upp::small_text_buffer<char8_t>;
+
+    buffer b;
+
+    CHECK(b.empty());
+    CHECK(b.is_ascii());
+    CHECK(b.code_point_count() == 0);
+
+    b.push_back(u8'a');
+    b.push_back(0xC3);
+    b.push_back(0xA9);
+
+    CHECK(b.size() == 3);
+    CHECK(!b.is_ascii());
+    CHECK(b.code_point_count() == 2);
+
+    // Erasing the only non-ASCII character
+    b.erase(b.cbegin() + 1, b.cend());
+
+    CHECK(b.is_ascii());
+    CHECK(b.code_point_count() == 1);
+
+    // Spilling out of the inline buffer
+    const std::u8string_view text = u8"\u4E16\u754C 0123456789 0123456789 0123456789";
+
+    b.insert(b.cbegin(), text.begin(), text.end());
+
+    CHECK(b.size() == text.size() + 1);
+    CHECK(b.capacity() >= b.size());
+    CHECK(!b.is_ascii());
+    CHECK(b.code_point_count() == 36);
+
+    const buffer copy = b;
+
+    CHECK(copy == b);
+    CHECK(copy.code_point_count() == 36);
+
+    b.erase(b.cbegin(), b.cbegin() + 6);
+    b.shrink_to_fit();
+
+    CHECK(b.is_ascii());
+    CHECK(b.code_point_count() == b.size());
+    CHECK(b < copy);
+
+    // Writing through non-const access discards the cached metadata
+    b.data()[0] = 0xC3;
+    b.data()[1] = 0xA9;
+
+    CHECK(!b.is_ascii());
+    CHECK(b.code_point_count() == b.size() - 1);
+
+    b.clear();
+    b.shrink_to_fit();
+
+    CHECK(b.is_ascii());
+    CHECK(b.capacity() == buffer::inline_capacity);
+}
+EVAL_TEST_CASE("upp::small_text_buffer");
+
+TEST_CASE("upp::small_ustring", "[string types][Unicode string types]")
+{
+    using namespace std::string_view_literals;
+
+    const auto short_string = upp::small_ustring::from_utf8(u8"Gr\u00FC\u00DFe"sv);
+
+    REQUIRE(short_string.has_value());
+    CHECK(std::ranges::equal(short_string->code_units(), u8"Gr\u00FC\u00DFe"sv));
+    CHECK(short_string->underlying().capacity() == upp::small_text_buffer<char8_t>::inline_capacity);
+    CHECK(short_string->code_point_count() == 5);
+    CHECK(!short_string->is_ascii());
+
+    const auto long_string = upp::small_utf16_string::from_utf8(u8"identifier_with_more_than_15_code_units"sv);
+
+    REQUIRE(long_string.has_value());
+    CHECK(long_string->code_point_count() == 39);
+    CHECK(long_string->is_ascii());
+}
+EVAL_TEST_CASE("upp::small_ustring");
+
+TEST_CASE("upp::basic_ustring code_point_count() and is_ascii()", "[string types][Unicode string types]")
+{
+    using namespace std::string_view_literals;
+
+    const auto utf8  = upp::ustring::from_utf8_unchecked(u8"caf\u00E9 \U0001F600 0123456789"sv);
+    const auto utf16 = upp::utf16_string::from_utf8_unchecked(u8"caf\u00E9 \U0001F600 0123456789"sv);
+    const auto utf32 = upp::utf32_string::from_utf8_unchecked(u8"caf\u00E9 \U0001F600 0123456789"sv);
+
+    CHECK(utf8.code_point_count() == 17);
+    CHECK(utf16.code_point_count() == 17);
+    CHECK(utf32.code_point_count() == 17);
+
+    CHECK(!utf8.is_ascii());
+    CHECK(upp::ustring::from_utf8_unchecked(u8"ascii only"sv).is_ascii());
+}
+EVAL_TEST_CASE("upp::basic_ustring code_point_count() and is_ascii()");
+
+TEST_CASE("upp::basic_ustring to_lowercase() and to_uppercase()", "[string types][Unicode string types]")
+{
+    using namespace std::string_view_literals;
+
+    const auto ascii = upp::small_ustring::from_utf8_unchecked(u8"Hello, World 123!"sv);
+
+    CHECK(std::ranges::equal(ascii.to_lowercase().code_units(), u8"hello, world 123!"sv));
+    CHECK(std::ranges::equal(ascii.to_uppercase().code_units(), u8"HELLO, WORLD 123!"sv));
+    CHECK(ascii.to_lowercase().is_ascii());
+
+    const auto mixed = upp::ustring::from_utf8_unchecked(u8"Stra\u00DFe \u0394\u03AC"sv);
+
+    CHECK(std::ranges::equal(mixed.to_lowercase().code_units(), u8"stra\u00DFe \u03B4\u03AC"sv));
+    CHECK(std::ranges::equal(mixed.to_uppercase().code_units(), u8"STRASSE \u0394\u0386"sv));
+
+    const auto utf16 = upp::small_utf16_string::from_utf8_unchecked(u8"\U00010428bc"sv);
+
+    CHECK(std::ranges::equal(utf16.to_uppercase().code_units(), u"\U00010400BC"sv));
+}
+EVAL_TEST_CASE("upp::basic_ustring to_lowercase() and to_uppercase()");
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include "../bugspray.hpp"
+
+#include <uni-cpp/string_builder.hpp>
+#include <uni-cpp/ranges.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <utility>
+
+TEST_CASE("upp::ustring_builder", "[string types][Unicode string types]")
+{
+    using namespace std::string_view_literals;
+    using namespace upp::char_literals;
+
+    upp::ustring_builder<upp::encoding::utf8> builder;
+
+    CHECK(builder.empty());
+
+    builder.append_ascii("{\"id\":"sv).append_integer(42).append_ascii(",\"name\":\""sv);
+    builder.append(upp::utf16_string::from_utf16_unchecked(u"Zo\u00EB"sv)).append(U'"'_uc);
+    builder.append_ascii(",\"min\":"sv).append_integer(std::numeric_limits<std::int64_t>::min()).append(U'}'_uc);
+    builder.append(U"\U0001F600"sv | upp::views::mark_as_valid_utf32).append(U'\u2713'_uc);
+
+    CHECK(builder.size() == builder.code_units().size());
+
+    const upp::ustring json = std::move(builder).build();
+
+    CHECK(json.underlying() == u8"{\"id\":42,\"name\":\"Zo\u00EB\",\"min\":-9223372036854775808}\U0001F600\u2713"sv);
+    CHECK(builder.empty());
+
+    upp::ustring_builder<upp::encoding::utf16> utf16_builder;
+
+    utf16_builder.append(upp::ustring::from_utf8_unchecked(u8"caf\u00E9 \U0001F600"sv)).append_integer(255, 16);
+
+    CHECK(std::move(utf16_builder).build().underlying() == u"caf\u00E9 \U0001F600ff"sv);
+}
+EVAL_TEST_CASE("upp::ustring_builder");
+
+TEST_CASE("upp::ustring_builder reset()", "[string types][Unicode string types]")
+{
+    using namespace std::string_view_literals;
+    using namespace upp::char_literals;
+
+    upp::ustring_builder<upp::encoding::utf32> builder{16};
+
+    CHECK(builder.capacity() == 16);
+
+    builder.append_ascii("first"sv);
+    builder.reset();
+
+    // The buffer is kept, so writing up to its capacity again doesn't grow it.
+    builder.append_ascii("second"sv).append(U'\U0001F600'_uc);
+
+    CHECK(builder.capacity() == 16);
+    CHECK(builder.code_units().size() == 7);
+    CHECK(std::u32string_view{builder.code_units().data(), builder.code_units().size()} == U"second\U0001F600"sv);
+}
+EVAL_TEST_CASE("upp::ustring_builder reset()");
\ No newline at end of file
@@ -0,0 +1,153 @@
+#include "../bugspray.hpp"
+
+#include <uni-cpp/string.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+using metadata_u8string  = upp::with_text_metadata<std::u8string>;
+using metadata_u16string = upp::with_text_metadata<std::u16string>;
+
+static_assert(upp::string_compatible_container<metadata_u8string, upp::encoding::utf8>);
+static_assert(upp::string_compatible_container<metadata_u16string, upp::encoding::utf16>);
+static_assert(upp::string_compatible_container<upp::with_text_metadata<std::vector<char32_t>>, upp::encoding::utf32>);
+static_assert(upp::reservable_container<metadata_u8string>);
+
+TEST_CASE("upp::with_text_metadata", "[string types]")
+{
+    using namespace std::string_view_literals;
+
+    metadata_u8string c;
+
+    CHECK(c.is_ascii());
+    CHECK(!c.has_supplementary_code_points());
+    CHECK(c.code_point_count() == 0);
+
+    c.append_range(u8"caf\u00E9"sv);
+
+    CHECK(!c.is_ascii());
+    CHECK(!c.has_supplementary_code_points());
+    CHECK(c.code_point_count() == 4);
+
+    c.insert(c.underlying().begin(), {0xF0, 0x9F, 0x98, 0x80});
+
+    CHECK(c.has_supplementary_code_points());
+    CHECK(c.code_point_count() == 5);
+
+    // Erasing the only non-ASCII characters
+    c.erase(c.underlying().begin(), c.underlying().begin() + 4);
+    c.erase(c.underlying().end() - 2, c.underlying().end());
+
+    CHECK(c.is_ascii());
+    CHECK(!c.has_supplementary_code_points());
+    CHECK(c.code_point_count() == 3);
+
+    // Writing through non-const access discards the cached metadata
+    c.data()[0] = 0xC3;
+    c.data()[1] = 0xA9;
+
+    CHECK(!c.is_ascii());
+    CHECK(c.code_point_count() == 2);
+
+    c.clear();
+
+    CHECK(c.is_ascii());
+    CHECK(c.code_point_count() == 0);
+}
+EVAL_TEST_CASE("upp::with_text_metadata");
+
+TEST_CASE("upp::basic_ustring with cached text metadata", "[string types][Unicode string types]")
+{
+    using namespace std::string_view_literals;
+
+    using string_type = upp::basic_utf8_string<metadata_u8string>;
+
+    const auto string = string_type::from_utf8(u8"Gr\u00FC\u00DFe \U0001F600"sv);
+
+    REQUIRE(string.has_value());
+    CHECK(string->code_point_count() == 7);
+    CHECK(!string->is_ascii());
+    CHECK(string->underlying().has_supplementary_code_points());
+
+    // Erasing one of several non-ASCII characters keeps the metadata of the others
+    auto container = string->underlying();
+
+    container.erase(container.underlying().end() - 4, container.underlying().end());
+
+    CHECK(!container.is_ascii());
+    CHECK(!container.has_supplementary_code_points());
+    CHECK(container.code_point_count() == 6);
+
+    const auto invalid = string_type::from_utf8("ab\xC3"sv);
+
+    REQUIRE(!invalid.has_value());
+    CHECK(invalid.error().valid_up_to == 2);
+
+    const metadata_u8string counted{std::u8string(u8"\u00E9t\u00E9"), upp::impl::text_metadata::count(u8"\u00E9t\u00E9", 5)};
+
+    CHECK(counted.code_point_count() == 3);
+    CHECK(!counted.is_ascii());
+
+    const auto utf16 = upp::utf16_string::from_utf16(u"no supplementary code points: \u4E16\u754C"sv);
+
+    REQUIRE(utf16.has_value());
+
+    const auto bmp_only = utf16->transcode<upp::encoding::utf8, metadata_u8string>();
+
+    CHECK(bmp_only.code_point_count() == 32);
+    CHECK(!bmp_only.underlying().has_supplementary_code_points());
+}
+EVAL_TEST_CASE("upp::basic_ustring with cached text metadata");
+
+TEST_CASE("upp::basic_ustring transcode()", "[string types][Unicode string types]")
+{
+    using namespace std::string_view_literals;
+
+    using string_type = upp::basic_utf8_string<metadata_u8string>;
+
+    const auto ascii = string_type::from_utf8_unchecked(u8"plain ASCII text"sv);
+
+    CHECK(std::ranges::equal(ascii.transcode<upp::encoding::utf16>().code_units(), u"plain ASCII text"sv));
+    CHECK(std::ranges::equal(ascii.transcode<upp::encoding::utf32>().code_units(), U"plain ASCII text"sv));
+
+    const auto mixed = string_type::from_utf8_unchecked(u8"caf\u00E9 \u4E16 \U0001F600"sv);
+
+    const auto utf16 = mixed.transcode<upp::encoding::utf16>();
+    const auto utf32 = mixed.transcode<upp::encoding::utf32>();
+
+    CHECK(std::ranges::equal(utf16.code_units(), u"caf\u00E9 \u4E16 \U0001F600"sv));
+    CHECK(std::ranges::equal(utf32.code_units(), U"caf\u00E9 \u4E16 \U0001F600"sv));
+    CHECK(utf32.capacity() >= utf32.code_units().size());
+
+    CHECK(std::ranges::equal(utf32.transcode<upp::encoding::utf8>().code_units(), u8"caf\u00E9 \u4E16 \U0001F600"sv));
+    CHECK(std::ranges::equal(utf16.transcode<upp::encoding::utf16, std::vector<char16_t>>().code_units(), utf16.code_units()));
+}
+EVAL_TEST_CASE("upp::basic_ustring transcode()");
+
+TEST_CASE("upp::basic_ustring case mapping of strings without letters to map", "[string types][Unicode string types]")
+{
+    using namespace std::string_view_literals;
+
+    auto symbols = upp::ustring::from_utf8_unchecked(u8"0123-4567 (89)"sv);
+
+    CHECK(std::ranges::equal(symbols.to_uppercase().code_units(), u8"0123-4567 (89)"sv));
+
+    auto lowercase = upp::ustring::from_utf8_unchecked(u8"already lowercase"sv);
+
+    const auto moved = std::move(lowercase).to_lowercase();
+
+    CHECK(std::ranges::equal(moved.code_units(), u8"already lowercase"sv));
+    CHECK(lowercase.code_units().empty());
+
+    const auto mapped = std::move(symbols).to_lowercase();
+
+    CHECK(std::ranges::equal(mapped.code_units(), u8"0123-4567 (89)"sv));
+
+    auto uppercase = upp::ustring::from_utf8_unchecked(u8"UPPERCASE"sv);
+
+    CHECK(std::ranges::equal(std::move(uppercase).to_lowercase().code_units(), u8"uppercase"sv));
+}
+EVAL_TEST_CASE("upp::basic_ustring case mapping of strings without letters to map");
\ No newline at end of file
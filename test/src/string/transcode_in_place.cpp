@@ -0,0 +1,196 @@
+#include "../bugspray.hpp"
+
+#include <uni-cpp/string.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    /// A container that keeps its elements in a `std::vector<std::byte>`, so its storage can be handed over between element types.
+    template<typename T>
+    class byte_buffer
+    {
+    public:
+        using value_type      = T;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference       = T&;
+        using const_reference = const T&;
+        using iterator        = T*;
+        using const_iterator  = const T*;
+
+        byte_buffer() = default;
+
+        byte_buffer(const std::initializer_list<T> il) { assign(il); }
+
+        template<std::input_iterator It>
+        byte_buffer(It first, It last)
+        {
+            assign(first, last);
+        }
+
+        template<typename U>
+        [[nodiscard]] static byte_buffer adopt_storage(byte_buffer<U>&& other, const size_type size)
+        {
+            byte_buffer result;
+
+            result.m_bytes = std::move(other.m_bytes);
+            result.m_bytes.resize(size * sizeof(T)); // shrinking never reallocates
+
+            return result;
+        }
+
+        [[nodiscard]] T*       data() noexcept { return reinterpret_cast<T*>(m_bytes.data()); }
+        [[nodiscard]] const T* data() const noexcept { return reinterpret_cast<const T*>(m_bytes.data()); }
+
+        [[nodiscard]] iterator       begin() noexcept { return data(); }
+        [[nodiscard]] iterator       end() noexcept { return data() + size(); }
+        [[nodiscard]] const_iterator begin() const noexcept { return data(); }
+        [[nodiscard]] const_iterator end() const noexcept { return data() + size(); }
+
+        [[nodiscard]] size_type size() const noexcept { return m_bytes.size() / sizeof(T); }
+        [[nodiscard]] bool      empty() const noexcept { return m_bytes.empty(); }
+
+        [[nodiscard]] T&       operator[](const size_type n) noexcept { return data()[n]; }
+        [[nodiscard]] const T& operator[](const size_type n) const noexcept { return data()[n]; }
+
+        template<std::input_iterator It>
+        iterator insert(const const_iterator pos, It first, It last)
+        {
+            const auto offset = static_cast<std::size_t>(pos - data()) * sizeof(T);
+
+            std::vector<std::byte> bytes;
+
+            for (; first != last; ++first)
+            {
+                const auto value = static_cast<T>(*first);
+
+                bytes.resize(bytes.size() + sizeof(T));
+                std::memcpy(bytes.data() + bytes.size() - sizeof(T), &value, sizeof(T));
+            }
+
+            m_bytes.insert(m_bytes.begin() + static_cast<std::ptrdiff_t>(offset), bytes.begin(), bytes.end());
+
+            return data() + offset / sizeof(T);
+        }
+
+        iterator insert(const const_iterator pos, const T& value) { return insert(pos, &value, &value + 1); }
+
+        iterator insert(const const_iterator pos, const size_type n, const T& value)
+        {
+            const std::vector<T> values(n, value);
+
+            return insert(pos, values.begin(), values.end());
+        }
+
+        iterator erase(const const_iterator first, const const_iterator last)
+        {
+            const auto offset = (first - data()) * static_cast<std::ptrdiff_t>(sizeof(T));
+
+            m_bytes.erase(m_bytes.begin() + offset, m_bytes.begin() + (last - data()) * static_cast<std::ptrdiff_t>(sizeof(T)));
+
+            return data() + offset / static_cast<std::ptrdiff_t>(sizeof(T));
+        }
+
+        iterator erase(const const_iterator pos) { return erase(pos, pos + 1); }
+
+        void clear() noexcept { m_bytes.clear(); }
+
+        void assign(const size_type n, const T& value)
+        {
+            clear();
+            insert(end(), n, value);
+        }
+
+        template<std::input_iterator It>
+        void assign(It first, It last)
+        {
+            clear();
+            insert(end(), first, last);
+        }
+
+        void assign(const std::initializer_list<T> il) { assign(il.begin(), il.end()); }
+
+        [[nodiscard]] friend bool operator==(const byte_buffer&, const byte_buffer&) = default;
+
+    private:
+        template<typename>
+        friend class byte_buffer;
+
+        std::vector<std::byte> m_bytes;
+    };
+} // namespace
+
+TEST_CASE("upp::basic_ustring transcode() &&", "[string types][Unicode string types]", runtime)
+{
+    using namespace std::string_view_literals;
+
+    static_assert(upp::storage_adopting_container<byte_buffer<char8_t>, byte_buffer<char32_t>>);
+    static_assert(!upp::storage_adopting_container<std::u8string, std::u32string>);
+
+    const auto utf8_text = u8"Gr\u00FC\u00DFe, \u4E16\u754C \U0001F600"sv;
+
+    // UTF-32 to UTF-8 always fits into the storage of the source.
+    {
+        auto source = upp::basic_utf32_string<byte_buffer<char32_t>>::from_utf32_unchecked(U"Gr\u00FC\u00DFe, \u4E16\u754C \U0001F600"sv);
+
+        const auto* const storage = static_cast<const void*>(source.code_units().data());
+
+        const auto utf8 = std::move(source).transcode<upp::encoding::utf8, byte_buffer<char8_t>>();
+
+        CHECK(std::ranges::equal(utf8.code_units(), utf8_text));
+        CHECK(static_cast<const void*>(utf8.code_units().data()) == storage);
+
+        auto source16 = upp::basic_utf32_string<byte_buffer<char32_t>>::from_utf32_unchecked(U"\U0001F600 \u4E16"sv);
+
+        const auto utf16 = std::move(source16).transcode<upp::encoding::utf16, byte_buffer<char16_t>>();
+
+        CHECK(std::ranges::equal(utf16.code_units(), u"\U0001F600 \u4E16"sv));
+    }
+
+    // UTF-16 to UTF-8 is done in place if no prefix of the text grows, and falls back to a new buffer otherwise.
+    {
+        auto mostly_ascii = upp::basic_utf16_string<byte_buffer<char16_t>>::from_utf16_unchecked(u"ASCII prefix, then \u4E16\u754C"sv);
+
+        const auto* const storage = static_cast<const void*>(mostly_ascii.code_units().data());
+
+        const auto in_place = std::move(mostly_ascii).transcode<upp::encoding::utf8, byte_buffer<char8_t>>();
+
+        CHECK(std::ranges::equal(in_place.code_units(), u8"ASCII prefix, then \u4E16\u754C"sv));
+        CHECK(static_cast<const void*>(in_place.code_units().data()) == storage);
+
+        auto cjk_first = upp::basic_utf16_string<byte_buffer<char16_t>>::from_utf16_unchecked(u"\u4E16\u754C"sv);
+
+        const auto copied = std::move(cjk_first).transcode<upp::encoding::utf8, byte_buffer<char8_t>>();
+
+        CHECK(std::ranges::equal(copied.code_units(), u8"\u4E16\u754C"sv));
+    }
+
+    // Without a change of the encoding or container, the string is moved.
+    {
+        auto source = upp::utf8_string::from_utf8_unchecked(u8"long enough not to be stored inline"sv);
+
+        const auto* const storage = source.code_units().data();
+
+        const auto moved = std::move(source).transcode<upp::encoding::utf8>();
+
+        CHECK(moved.code_units().data() == storage);
+    }
+
+    // Containers that can't adopt storage get a new buffer.
+    {
+        auto source = upp::utf32_string::from_utf32_unchecked(U"caf\u00E9"sv);
+
+        const auto utf8 = std::move(source).transcode<upp::encoding::utf8>();
+
+        CHECK(std::ranges::equal(utf8.code_units(), u8"caf\u00E9"sv));
+    }
+}
\ No newline at end of file
@@ -2,6 +2,9 @@
 
 #include <uni-cpp/string.hpp>
 
+#include <array>
+#include <cstddef>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 
@@ -162,4 +165,62 @@ TEST_CASE("upp::basic_ustring from_utf_unchecked()", "[UTF encoding][string type
             });
         });
 }
-EVAL_TEST_CASE("upp::basic_ustring from_utf_unchecked()");
\ No newline at end of file
+EVAL_TEST_CASE("upp::basic_ustring from_utf_unchecked()");
+
+TEST_CASE("upp::basic_ustring factories with an allocator", "[UTF encoding][string types][Unicode string types]", runtime)
+{
+    using namespace std::string_view_literals;
+
+    // Any allocation that doesn't go through the arena fails.
+    std::array<std::byte, 4096>         buffer{};
+    std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+    using utf8_type  = upp::basic_utf8_string<std::pmr::u8string>;
+    using utf16_type = upp::basic_utf16_string<std::pmr::u16string>;
+
+    const std::pmr::polymorphic_allocator<char8_t>  alloc8{&arena};
+    const std::pmr::polymorphic_allocator<char16_t> alloc16{&arena};
+
+    const auto valid = utf8_type::from_utf8(u8"Gr\u00FC\u00DFe"sv, alloc8);
+
+    REQUIRE(valid.has_value());
+    CHECK(valid->underlying() == u8"Gr\u00FC\u00DFe"sv);
+    CHECK(valid->underlying().get_allocator().resource() == &arena);
+
+    CHECK(!utf8_type::from_utf8(u8"a\xFF"sv, alloc8).has_value());
+
+    const auto lossy = utf8_type::from_utf8_lossy(u8"a\xFF"sv, alloc8);
+
+    CHECK(lossy.underlying() == u8"a\uFFFD"sv);
+    CHECK(lossy.underlying().get_allocator().resource() == &arena);
+
+    const auto from_utf16 = utf8_type::from_utf16(u"Gr\u00FC\u00DFe"sv, alloc8);
+
+    REQUIRE(from_utf16.has_value());
+    CHECK(from_utf16->underlying() == u8"Gr\u00FC\u00DFe"sv);
+    CHECK(from_utf16->underlying().get_allocator().resource() == &arena);
+
+    // A container of the same type is adopted with the allocator-extended move constructor.
+    std::pmr::u8string container{u8"Gr\u00FC\u00DFe", alloc8};
+
+    const auto adopted = utf8_type::from_utf8_unchecked(std::move(container), alloc8);
+
+    CHECK(adopted.underlying() == u8"Gr\u00FC\u00DFe"sv);
+    CHECK(adopted.underlying().get_allocator().resource() == &arena);
+
+    const auto transcoded = valid->transcode<upp::encoding::utf16, std::pmr::u16string>(alloc16);
+
+    CHECK(transcoded.underlying() == u"Gr\u00FC\u00DFe"sv);
+    CHECK(transcoded.underlying().get_allocator().resource() == &arena);
+
+    const auto utf16 = utf16_type::from_utf32_unchecked(U"Gr\u00FC\u00DFe"sv, alloc16);
+
+    CHECK(utf16.underlying() == u"Gr\u00FC\u00DFe"sv);
+    CHECK(utf16.underlying().get_allocator().resource() == &arena);
+
+    const auto ascii = upp::basic_ascii_string<std::pmr::string>::from_ascii("abc"sv, std::pmr::polymorphic_allocator<char>{&arena});
+
+    REQUIRE(ascii.has_value());
+    CHECK(ascii->underlying() == "abc"sv);
+    CHECK(ascii->underlying().get_allocator().resource() == &arena);
+}
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include <uni-cpp/uchar.hpp>
 
+#include <string>
 #include <string_view>
 #include <unordered_map>
 #include <vector>
@@ -91,6 +92,50 @@ namespace upp_test
 
         return result;
     }
+
+    /// Loads a conformance test file of the UCD (e.g. `NormalizationTest.txt`), which `dev/tools/unicode_data_generator`
+    /// copies into the test data directory as it is. Returns its lines without comments, skipping empty lines.
+    /// Returns no lines if the file doesn't exist.
+    [[nodiscard]] inline std::vector<std::string> load_ucd_test_file(const std::filesystem::path& filepath)
+    {
+        std::println("Loading UCD test file: {}", filepath.generic_string());
+
+        std::ifstream file{filepath};
+
+        std::vector<std::string> result;
+
+        std::string line;
+        while (std::getline(file, line))
+        {
+            if (const std::size_t hash_pos = line.find('#'); hash_pos != std::string::npos)
+            {
+                line = line.substr(0, hash_pos);
+            }
+
+            if (line.find_first_not_of(" \t") == std::string::npos)
+                continue;
+
+            result.push_back(std::move(line));
+        }
+
+        return result;
+    }
+
+    /// Parses a sequence of hexadecimal code points separated by spaces, like the fields of the UCD test files.
+    [[nodiscard]] inline std::u32string parse_code_points(std::string_view str)
+    {
+        std::u32string result;
+
+        for (auto code_point_chars : std::views::split(str, ' '))
+        {
+            std::string_view code_point_sv{code_point_chars};
+
+            if (!code_point_sv.empty())
+                result.push_back(static_cast<char32_t>(impl::parse_hex<std::uint32_t>(code_point_sv)));
+        }
+
+        return result;
+    }
 } // namespace upp_test
 
 #endif // TEST_TEST_DATA_HPP
\ No newline at end of file